@@ -0,0 +1,499 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  Last Changed Rev:  $Rev: 410 $
+ *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
+ *  Last Changed By:   $Author: iain $
+ */
+
+// Standard library & STL headers.
+#include <cassert>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// System headers.
+#ifndef _WIN32
+#define STEPS_BATCH_THREADS 1
+#include <pthread.h>
+#endif
+
+// STEPS headers.
+#include "../common.h"
+#include "../error.hpp"
+#include "batch.hpp"
+#include "../wmdirect/wmdirect.hpp"
+#include "../tetexact/tetexact.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+NAMESPACE_ALIAS(steps::batch, sbatch);
+NAMESPACE_ALIAS(steps::solver, ssolver);
+NAMESPACE_ALIAS(steps::rng, srng);
+
+USING(std, string);
+USING(std, vector);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Types of the initial state and observable items.
+enum
+{
+    INIT_COMP_COUNT = 0,
+    INIT_COMP_CONC,
+    INIT_COMP_CLAMPED,
+    INIT_COMP_REAC_K,
+    INIT_TET_COUNT,
+    INIT_PATCH_COUNT,
+    INIT_PATCH_CLAMPED,
+    INIT_PATCH_SREAC_K,
+    OBS_COMP_COUNT,
+    OBS_PATCH_COUNT,
+    OBS_TET_COUNT
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef STEPS_BATCH_THREADS
+
+namespace
+{
+
+/// State of one call to Batch::_run, shared between its worker threads.
+struct RunContext
+{
+    sbatch::Batch                     * batch;
+    vector<uint> const                * seeds;
+    vector<double> const              * tpnts;
+    double                            * out;
+    uint                                stride;
+    /// Index of the next realisation to be started.
+    uint                                next;
+    /// Set, with a message, by the first worker to fail.
+    bool                                failed;
+    string                              error;
+    /// Guards next, failed and error.
+    pthread_mutex_t                     lock;
+};
+
+struct WorkerArg
+{
+    RunContext                        * ctx;
+    uint                                worker;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+void runContextFail(RunContext * ctx, string const & msg)
+{
+    pthread_mutex_lock(&ctx->lock);
+    if (ctx->failed == false)
+    {
+        ctx->failed = true;
+        ctx->error = msg;
+    }
+    pthread_mutex_unlock(&ctx->lock);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Thread function: run realisations until none are left or a worker
+/// has failed. Exceptions must not leave the thread, so they are
+/// recorded in the context instead.
+void * runWorker(void * arg)
+{
+    WorkerArg * wa = static_cast<WorkerArg *>(arg);
+    RunContext * ctx = wa->ctx;
+    uint nreal = ctx->seeds->size();
+    while (true)
+    {
+        pthread_mutex_lock(&ctx->lock);
+        uint r = nreal;
+        if (ctx->failed == false && ctx->next < nreal) r = ctx->next++;
+        pthread_mutex_unlock(&ctx->lock);
+        if (r == nreal) break;
+
+        try
+        {
+            ctx->batch->_runRealisation(wa->worker, (*ctx->seeds)[r],
+                *ctx->tpnts, ctx->out + (r * ctx->stride));
+        }
+        catch (steps::Err & e)
+        {
+            runContextFail(ctx, e.getMsg());
+        }
+        catch (std::exception & e)
+        {
+            runContextFail(ctx, e.what());
+        }
+        catch (...)
+        {
+            runContextFail(ctx, "Unknown error in batch worker.");
+        }
+    }
+    return 0;
+}
+
+}
+
+#endif
+// STEPS_BATCH_THREADS
+
+////////////////////////////////////////////////////////////////////////////////
+
+sbatch::Batch::Batch(string const & solver, steps::model::Model * m,
+                     steps::wm::Geom * g, string const & rng, uint rngbufsize)
+: pSolverName(solver)
+, pModel(m)
+, pGeom(g)
+, pRNGName(rng)
+, pRNGBufSize(rngbufsize)
+, pInit()
+, pObs()
+, pSolvers()
+, pRNGs()
+{
+    if (pSolverName != "wmdirect" && pSolverName != "tetexact")
+    {
+        std::ostringstream os;
+        os << "Solver '" << pSolverName << "' cannot be used in a batch; ";
+        os << "use 'wmdirect' or 'tetexact'.";
+        throw steps::ArgErr(os.str());
+    }
+
+    // Build the first worker now, so that the model, geometry and RNG are
+    // checked by the solver here rather than at the first run.
+    _addWorkers(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+sbatch::Batch::~Batch(void)
+{
+    for (uint w = 0; w < pSolvers.size(); ++w)
+    {
+        delete pSolvers[w];
+        delete pRNGs[w];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::_addWorkers(uint nworkers)
+{
+    while (pSolvers.size() < nworkers)
+    {
+        srng::RNG * r = srng::create(pRNGName, pRNGBufSize);
+        ssolver::API * s = 0;
+        try
+        {
+            if (pSolverName == "wmdirect")
+            {
+                s = new steps::wmdirect::Wmdirect(pModel, pGeom, r);
+            }
+            else
+            {
+                s = new steps::tetexact::Tetexact(pModel, pGeom, r);
+            }
+        }
+        catch (...)
+        {
+            delete r;
+            throw;
+        }
+        pSolvers.push_back(s);
+        pRNGs.push_back(r);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setCompCount(string const & c, string const & s, double n)
+{
+    Item i = {INIT_COMP_COUNT, c, s, 0, n};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setCompConc(string const & c, string const & s, double conc)
+{
+    Item i = {INIT_COMP_CONC, c, s, 0, conc};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setCompClamped(string const & c, string const & s, bool b)
+{
+    Item i = {INIT_COMP_CLAMPED, c, s, 0, (b ? 1.0 : 0.0)};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setCompReacK(string const & c, string const & r, double kf)
+{
+    Item i = {INIT_COMP_REAC_K, c, r, 0, kf};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setTetCount(uint tidx, string const & s, double n)
+{
+    Item i = {INIT_TET_COUNT, "", s, tidx, n};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setPatchCount(string const & p, string const & s, double n)
+{
+    Item i = {INIT_PATCH_COUNT, p, s, 0, n};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setPatchClamped(string const & p, string const & s, bool b)
+{
+    Item i = {INIT_PATCH_CLAMPED, p, s, 0, (b ? 1.0 : 0.0)};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::setPatchSReacK(string const & p, string const & r, double kf)
+{
+    Item i = {INIT_PATCH_SREAC_K, p, r, 0, kf};
+    pInit.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::clearInitialState(void)
+{
+    pInit.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::addCompCount(string const & c, string const & s)
+{
+    Item i = {OBS_COMP_COUNT, c, s, 0, 0.0};
+    pObs.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::addPatchCount(string const & p, string const & s)
+{
+    Item i = {OBS_PATCH_COUNT, p, s, 0, 0.0};
+    pObs.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::addTetCount(uint tidx, string const & s)
+{
+    Item i = {OBS_TET_COUNT, "", s, tidx, 0.0};
+    pObs.push_back(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::clearObservables(void)
+{
+    pObs.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+vector<double> sbatch::Batch::run(vector<uint> const & seeds,
+                                  vector<double> const & tpnts, uint nthreads)
+{
+    vector<double> out(seeds.size() * tpnts.size() * pObs.size());
+    if (out.empty() == false) _run(seeds, tpnts, nthreads, &out[0]);
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::_run(vector<uint> const & seeds,
+                         vector<double> const & tpnts, uint nthreads,
+                         double * out)
+{
+    for (uint t = 0; t < tpnts.size(); ++t)
+    {
+        if (tpnts[t] < 0.0 || (t != 0 && tpnts[t] < tpnts[t - 1]))
+        {
+            std::ostringstream os;
+            os << "Time points must be non-negative and in non-decreasing order.";
+            throw steps::ArgErr(os.str());
+        }
+    }
+    uint nreal = seeds.size();
+    if (nreal == 0) return;
+    assert(out != 0 || tpnts.empty() || pObs.empty());
+
+    // Apply the initial state and sample every observable once on the
+    // calling thread, so that bad names or indices raise the usual errors
+    // before any thread is started.
+    vector<double> check(pObs.size());
+    _runRealisation(0, seeds[0], vector<double>(1, 0.0),
+        (check.empty() ? 0 : &check[0]));
+
+    uint stride = tpnts.size() * pObs.size();
+    if (nthreads == 0 || nthreads > nreal) nthreads = nreal;
+
+#ifdef STEPS_BATCH_THREADS
+    if (nthreads > 1)
+    {
+        _addWorkers(nthreads);
+
+        RunContext ctx;
+        ctx.batch = this;
+        ctx.seeds = &seeds;
+        ctx.tpnts = &tpnts;
+        ctx.out = out;
+        ctx.stride = stride;
+        ctx.next = 0;
+        ctx.failed = false;
+        pthread_mutex_init(&ctx.lock, 0);
+
+        // Worker 0 runs on the calling thread. If a thread cannot be
+        // created the remaining workers simply share the realisations.
+        vector<WorkerArg> args(nthreads);
+        vector<pthread_t> threads;
+        for (uint w = 0; w < nthreads; ++w)
+        {
+            args[w].ctx = &ctx;
+            args[w].worker = w;
+        }
+        for (uint w = 1; w < nthreads; ++w)
+        {
+            pthread_t th;
+            if (pthread_create(&th, 0, runWorker, &args[w]) != 0) break;
+            threads.push_back(th);
+        }
+        runWorker(&args[0]);
+        for (uint i = 0; i < threads.size(); ++i)
+        {
+            pthread_join(threads[i], 0);
+        }
+        pthread_mutex_destroy(&ctx.lock);
+
+        if (ctx.failed == true)
+        {
+            throw steps::ArgErr(ctx.error);
+        }
+        return;
+    }
+#endif
+// STEPS_BATCH_THREADS
+
+    for (uint r = 0; r < nreal; ++r)
+    {
+        _runRealisation(0, seeds[r], tpnts, out + (r * stride));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void sbatch::Batch::_runRealisation(uint w, uint seed,
+                                    vector<double> const & tpnts, double * out)
+{
+    assert(w < pSolvers.size());
+    ssolver::API * sol = pSolvers[w];
+
+    // Seed first: setting counts in a mesh distributes molecules randomly.
+    pRNGs[w]->initialize(seed);
+    sol->reset();
+
+    vector<Item>::const_iterator init_end = pInit.end();
+    for (vector<Item>::const_iterator i = pInit.begin(); i != init_end; ++i)
+    {
+        switch (i->type)
+        {
+            case INIT_COMP_COUNT:
+                sol->setCompCount(i->loc, i->name, i->val);
+                break;
+            case INIT_COMP_CONC:
+                sol->setCompConc(i->loc, i->name, i->val);
+                break;
+            case INIT_COMP_CLAMPED:
+                sol->setCompClamped(i->loc, i->name, (i->val != 0.0));
+                break;
+            case INIT_COMP_REAC_K:
+                sol->setCompReacK(i->loc, i->name, i->val);
+                break;
+            case INIT_TET_COUNT:
+                sol->setTetCount(i->idx, i->name, i->val);
+                break;
+            case INIT_PATCH_COUNT:
+                sol->setPatchCount(i->loc, i->name, i->val);
+                break;
+            case INIT_PATCH_CLAMPED:
+                sol->setPatchClamped(i->loc, i->name, (i->val != 0.0));
+                break;
+            case INIT_PATCH_SREAC_K:
+                sol->setPatchSReacK(i->loc, i->name, i->val);
+                break;
+            default:
+                assert(false);
+        }
+    }
+
+    uint nobs = pObs.size();
+    for (uint t = 0; t < tpnts.size(); ++t)
+    {
+        sol->run(tpnts[t]);
+        for (uint o = 0; o < nobs; ++o)
+        {
+            Item const & ob = pObs[o];
+            double val = 0.0;
+            switch (ob.type)
+            {
+                case OBS_COMP_COUNT:
+                    val = sol->getCompCount(ob.loc, ob.name);
+                    break;
+                case OBS_PATCH_COUNT:
+                    val = sol->getPatchCount(ob.loc, ob.name);
+                    break;
+                case OBS_TET_COUNT:
+                    val = sol->getTetCount(ob.idx, ob.name);
+                    break;
+                default:
+                    assert(false);
+            }
+            out[(t * nobs) + o] = val;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// END
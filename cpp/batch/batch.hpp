@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  Last Changed Rev:  $Rev: 410 $
+ *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
+ *  Last Changed By:   $Author: iain $
+ */
+
+#ifndef STEPS_BATCH_BATCH_HPP
+#define STEPS_BATCH_BATCH_HPP 1
+
+
+// STL headers.
+#include <string>
+#include <vector>
+
+// STEPS headers.
+#include "../common.h"
+#include "../solver/api.hpp"
+#include "../model/model.hpp"
+#include "../geom/geom.hpp"
+#include "../rng/rng.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+START_NAMESPACE(steps)
+START_NAMESPACE(batch)
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Runs independent realisations of one model and geometry in parallel.
+///
+/// Each worker thread owns a solver object and an RNG and runs its share
+/// of the realisations one after the other, resetting the solver and
+/// reseeding its RNG before each. The model and geometry are shared and
+/// only read. Solvers are created on the first run() that needs them and
+/// kept for later runs, so the cost of building the solver state is paid
+/// once per thread rather than once per realisation.
+///
+/// The initial state of every realisation is given by the set... methods,
+/// which are replayed in order after each reset. Results are recorded for
+/// the observables added with the add... methods.
+///
+/// Because a reset solver does not depend on what it ran before, the
+/// results of a realisation depend only on its seed, not on the thread
+/// that ran it or the number of threads.
+///
+class Batch
+{
+
+public:
+
+    /// Constructor.
+    ///
+    /// \param solver Name of the solver, "wmdirect" or "tetexact".
+    /// \param m Pointer to the model.
+    /// \param g Pointer to the geometry container.
+    /// \param rng Name of the random number generator.
+    /// \param rngbufsize Buffer size of each random number generator.
+    Batch(std::string const & solver, steps::model::Model * m,
+          steps::wm::Geom * g, std::string const & rng = "mt19937",
+          uint rngbufsize = 512);
+
+    /// Destructor.
+    ~Batch(void);
+
+    ////////////////////////////////////////////////////////////////////////
+    // INITIAL STATE
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Set the number of molecules of species s in compartment c.
+    void setCompCount(std::string const & c, std::string const & s, double n);
+
+    /// Set the concentration (in molar units) of species s in compartment c.
+    void setCompConc(std::string const & c, std::string const & s, double conc);
+
+    /// Clamp (or unclamp) species s in compartment c.
+    void setCompClamped(std::string const & c, std::string const & s, bool b);
+
+    /// Set the rate constant of reaction r in compartment c.
+    void setCompReacK(std::string const & c, std::string const & r, double kf);
+
+    /// Set the number of molecules of species s in tetrahedron tidx.
+    void setTetCount(uint tidx, std::string const & s, double n);
+
+    /// Set the number of molecules of species s in patch p.
+    void setPatchCount(std::string const & p, std::string const & s, double n);
+
+    /// Clamp (or unclamp) species s in patch p.
+    void setPatchClamped(std::string const & p, std::string const & s, bool b);
+
+    /// Set the rate constant of surface reaction r in patch p.
+    void setPatchSReacK(std::string const & p, std::string const & r, double kf);
+
+    /// Forget all initial state set so far.
+    void clearInitialState(void);
+
+    ////////////////////////////////////////////////////////////////////////
+    // OBSERVABLES
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Record the number of molecules of species s in compartment c.
+    void addCompCount(std::string const & c, std::string const & s);
+
+    /// Record the number of molecules of species s in patch p.
+    void addPatchCount(std::string const & p, std::string const & s);
+
+    /// Record the number of molecules of species s in tetrahedron tidx.
+    void addTetCount(uint tidx, std::string const & s);
+
+    /// Forget all observables added so far.
+    void clearObservables(void);
+
+    /// Return the number of observables.
+    inline uint countObservables(void) const
+    { return pObs.size(); }
+
+    ////////////////////////////////////////////////////////////////////////
+    // RUNNING
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Run one realisation per seed, using nthreads threads, and return
+    /// the observables sampled at each time point, as a flat list indexed
+    /// by ((realisation * tpnts.size()) + time point) * countObservables()
+    /// + observable.
+    ///
+    /// \param seeds RNG seed of each realisation.
+    /// \param tpnts Sampling times, in non-decreasing order.
+    /// \param nthreads Number of threads (0 uses one per realisation).
+    std::vector<double> run(std::vector<uint> const & seeds,
+                            std::vector<double> const & tpnts,
+                            uint nthreads);
+
+    /// As run(), but writes the results to out, which must hold
+    /// seeds.size() * tpnts.size() * countObservables() values.
+    void _run(std::vector<uint> const & seeds,
+              std::vector<double> const & tpnts, uint nthreads,
+              double * out);
+
+    ////////////////////////////////////////////////////////////////////////
+    // WORKERS (C++ INTERNAL)
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Run one realisation with the given seed on worker w and write its
+    /// samples, tpnts.size() * countObservables() values, to out.
+    /// Different workers may be used from different threads at once.
+    void _runRealisation(uint w, uint seed, std::vector<double> const & tpnts,
+                         double * out);
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Create worker solvers until there are nworkers of them.
+    void _addWorkers(uint nworkers);
+
+    ////////////////////////////////////////////////////////////////////////
+
+    /// One entry of the initial state or observable list. Which fields
+    /// are used depends on the type.
+    struct Item
+    {
+        uint                            type;
+        std::string                     loc;
+        std::string                     name;
+        uint                            idx;
+        double                          val;
+    };
+
+    std::string                         pSolverName;
+    steps::model::Model               * pModel;
+    steps::wm::Geom                   * pGeom;
+    std::string                         pRNGName;
+    uint                                pRNGBufSize;
+
+    std::vector<Item>                   pInit;
+    std::vector<Item>                   pObs;
+
+    std::vector<steps::solver::API *>   pSolvers;
+    std::vector<steps::rng::RNG *>      pRNGs;
+
+    ////////////////////////////////////////////////////////////////////////
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+END_NAMESPACE(batch)
+END_NAMESPACE(steps)
+
+#endif
+// STEPS_BATCH_BATCH_HPP
+
+// END
@@ -31,6 +31,7 @@
 
 // STL headers.
 #include <cassert>
+#include <cmath>
 #include <algorithm>
 #include <iostream>
 #include <vector>
@@ -47,6 +48,117 @@ NAMESPACE_ALIAS(steps::tetmesh, stetmesh);
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// A triangle given by its sorted vertex indices, tagged with the order in
+// which a linear search would first meet it.
+struct TriFace
+{
+    uint v[3];
+    uint key;
+};
+
+static bool trifaceLess(TriFace const & a, TriFace const & b)
+{
+    if (a.v[0] != b.v[0]) return a.v[0] < b.v[0];
+    if (a.v[1] != b.v[1]) return a.v[1] < b.v[1];
+    if (a.v[2] != b.v[2]) return a.v[2] < b.v[2];
+    return a.key < b.key;
+}
+
+static inline bool trifaceSame(TriFace const & a, TriFace const & b)
+{
+    return (a.v[0] == b.v[0] && a.v[1] == b.v[1] && a.v[2] == b.v[2]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Find the triangle index of the faces (0,1,2), (0,1,3), (0,2,3) and
+// (1,2,3) of each of the ntets tetrahedra, and store them in tet_tris
+// (4 per tetrahedron).
+//
+// On entry, tris holds ntris triangles with sorted vertex indices. A face
+// matches the first of these with the same vertices. Faces without a
+// match are appended to tris, in order of first appearance, and ntris is
+// updated. This is the numbering that a linear search over tris for each
+// face gives, but is found in O(N log N) by sorting all faces once.
+//
+static void tetmesh_find_tris(uint const * tets, uint ntets,
+                              uint * tris, uint & ntris, uint * tet_tris)
+{
+    static const uint face_verts[4][3] = {{0,1,2}, {0,1,3}, {0,2,3}, {1,2,3}};
+
+    uint ntris_in = ntris;
+    uint nfaces = ntets * 4;
+
+    std::vector<TriFace> faces(ntris_in + nfaces);
+    for (uint tri = 0; tri < ntris_in; ++tri)
+    {
+        TriFace & f = faces[tri];
+        f.v[0] = tris[tri*3];
+        f.v[1] = tris[(tri*3)+1];
+        f.v[2] = tris[(tri*3)+2];
+        f.key = tri;
+    }
+    for (uint tet = 0; tet < ntets; ++tet)
+    {
+        for (uint i = 0; i < 4; ++i)
+        {
+            TriFace & f = faces[ntris_in + (tet*4) + i];
+            f.v[0] = tets[(tet*4) + face_verts[i][0]];
+            f.v[1] = tets[(tet*4) + face_verts[i][1]];
+            f.v[2] = tets[(tet*4) + face_verts[i][2]];
+            std::sort(f.v, f.v + 3);
+            f.key = ntris_in + (tet*4) + i;
+        }
+    }
+    std::sort(faces.begin(), faces.end(), trifaceLess);
+
+    // Within a run of equal faces the smallest key comes first. If it is
+    // a supplied triangle, all faces in the run map onto it. Otherwise the
+    // run is a new triangle; remember where it starts so that new
+    // triangles can be numbered in order of first appearance.
+    std::vector<int> new_runs(nfaces, -1);
+    uint nallfaces = faces.size();
+    uint run = 0;
+    while (run < nallfaces)
+    {
+        uint run_end = run + 1;
+        while (run_end < nallfaces && trifaceSame(faces[run], faces[run_end]))
+        {
+            ++run_end;
+        }
+
+        uint first = faces[run].key;
+        if (first < ntris_in)
+        {
+            for (uint j = run; j < run_end; ++j)
+            {
+                if (faces[j].key >= ntris_in) tet_tris[faces[j].key - ntris_in] = first;
+            }
+        }
+        else
+        {
+            new_runs[first - ntris_in] = run;
+        }
+        run = run_end;
+    }
+
+    for (uint i = 0; i < nfaces; ++i)
+    {
+        if (new_runs[i] == -1) continue;
+        uint run_bgn = new_runs[i];
+        uint tri = ntris++;
+        tris[tri*3] = faces[run_bgn].v[0];
+        tris[(tri*3)+1] = faces[run_bgn].v[1];
+        tris[(tri*3)+2] = faces[run_bgn].v[2];
+        for (uint j = run_bgn; j < nallfaces && trifaceSame(faces[run_bgn], faces[j]); ++j)
+        {
+            tet_tris[faces[j].key - ntris_in] = tri;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 bool steps::tetmesh::isValidID(std::string const & id)
 {
     int idlen = id.length();
@@ -87,10 +199,13 @@ void steps::tetmesh::checkID(std::string const & id)
 stetmesh::Tetmesh::Tetmesh(uint nverts, uint ntets, uint ntris)
 : Geom()
 , pSetupDone(false)
+, pRelease(0)
+, pReleaseData(0)
 , pVertsN(nverts)
 , pVerts(0)
 , pTrisN(ntris) // initialise this member with user supplied number, but this will be modified later
 , pTris(0)
+, pTris_user(0)
 , pTri_areas(0)
 , pTri_barycs(0)
 , pTri_norms(0)
@@ -104,14 +219,13 @@ stetmesh::Tetmesh::Tetmesh(uint nverts, uint ntets, uint ntris)
 , pTet_comps(0)
 , pTet_tri_neighbours(0)
 , pTet_tet_neighbours(0)
-, pTris_user(0)
+, pDiffBoundaries()
 , pXmin(0.0)
 , pXmax(0.0)
 , pYmin(0.0)
 , pYmax(0.0)
 , pZmin(0.0)
 , pZmax(0.0)
-, pDiffBoundaries()
 
 {	/*
     assert(pVertsN > 0);
@@ -201,29 +315,31 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
 		                   std::vector<uint> const & tris)
 : Geom()
 , pSetupDone(false)
+, pRelease(0)
+, pReleaseData(0)
 , pVertsN(0)
 , pVerts(0)
 , pTrisN(0)
 , pTris(0)
+, pTris_user(0) // not used by this contructor
 , pTri_areas(0)
-, pTri_norms(0)
 , pTri_barycs(0)
+, pTri_norms(0)
 , pTri_patches(0)
 , pTri_tet_neighbours(0)
-, pTris_user(0) // not used by this contructor
 , pTetsN(0)
 , pTets(0)
 , pTet_vols(0)
 , pTet_comps(0)
 , pTet_tri_neighbours(0)
 , pTet_tet_neighbours(0)
+, pDiffBoundaries()
 , pXmin(0.0)
 , pXmax(0.0)
 , pYmin(0.0)
 , pYmax(0.0)
 , pZmin(0.0)
 , pZmax(0.0)
-, pDiffBoundaries()
 
 {
 	// check the vectors are of the expected size
@@ -286,8 +402,13 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
 		tris_added++;
 	}
 
+	// Number the triangle faces of all tetrahedra, appending the ones that
+	// were not supplied to tris_temp.
+	std::vector<uint> tet_tris(pTetsN * 4);
+	tetmesh_find_tris(pTets, pTetsN, tris_temp, tris_added, &tet_tris[0]);
+
 	uint tettetadded = 0;
-	// Loop over all tetrahedra and fill tris_temp, pTet_tri_neighbours,
+	// Loop over all tetrahedra and fill pTet_tri_neighbours,
 	// pTet_tet_neighbours, tri_tet_neighbours_temp
 	for (uint tet=0; tet < pTetsN; ++tet)
 	{
@@ -301,67 +422,12 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
 		pTet_vols[tet] = steps::math::tet_vol(vert0, vert1, vert2, vert3);
 		steps::math::tet_barycenter(vert0, vert1, vert2, vert3,pTet_barycentres + tet*3);
 
-		// create array for triangle formed by edges (0,1,2)
-		// will also sort for ease of comparison
-		uint tri_vert0[3] = {pTets[tet*4], pTets[(tet*4)+1], pTets[(tet*4)+2]};
-		std::sort(tri_vert0, tri_vert0 + 3);
-		// create array for triangle formed by edges (0,1,3)
-		uint tri_vert1[3] = {pTets[tet*4], pTets[(tet*4)+1], pTets[(tet*4)+3]};
-		std::sort(tri_vert1, tri_vert1 + 3);
-		// create array for triangle formed by edges (0,2,3)
-		uint tri_vert2[3] = {pTets[tet*4], pTets[(tet*4)+2], pTets[(tet*4)+3]};
-		std::sort(tri_vert2, tri_vert2 + 3);
-		// create array for triangle formed by edges (1,2,3)
-		uint tri_vert3[3] = {pTets[(tet*4)+1], pTets[(tet*4)+2], pTets[(tet*4)+3]};
-		std::sort(tri_vert3, tri_vert3 + 3);
-
-		int tri0idx = -1;
-		int tri1idx = -1;
-		int tri2idx = -1;
-		int tri3idx = -1;
-		uint trisfound = 0;	/// unused at the moment
-		for (uint tri = 0; tri < tris_added; ++tri)
-		{
-			uint thistri[3] = {tris_temp[tri*3], tris_temp[(tri*3)+1], tris_temp[(tri*3)+2]};
-			// should be no need to sort them now // std::sort(thistri, thistri + 3);
-			if (tri0idx == -1 && array_srt_cmp(tri_vert0, thistri, 3)) tri0idx = tri;
-			if (tri1idx == -1 && array_srt_cmp(tri_vert1, thistri, 3)) tri1idx = tri;
-			if (tri2idx == -1 && array_srt_cmp(tri_vert2, thistri, 3)) tri2idx = tri;
-			if (tri3idx == -1 && array_srt_cmp(tri_vert3, thistri, 3)) tri3idx = tri;
-		}
-		// First add the triangles that are not already included
-		if (tri0idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert0[0];
-			tris_temp[(tris_added*3)+1] = tri_vert0[1];
-			tris_temp[(tris_added*3)+2] = tri_vert0[2];
-			// label this triangle and increment triangle counter
-			tri0idx = tris_added++;
-		}
-		if (tri1idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert1[0];
-			tris_temp[(tris_added*3)+1] = tri_vert1[1];
-			tris_temp[(tris_added*3)+2] = tri_vert1[2];
-			// label this triangle and increment triangle counter
-			tri1idx = tris_added++;
-		}
-		if (tri2idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert2[0];
-			tris_temp[(tris_added*3)+1] = tri_vert2[1];
-			tris_temp[(tris_added*3)+2] = tri_vert2[2];
-			// label this triangle and increment triangle counter
-			tri2idx = tris_added++;
-		}
-		if (tri3idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert3[0];
-			tris_temp[(tris_added*3)+1] = tri_vert3[1];
-			tris_temp[(tris_added*3)+2] = tri_vert3[2];
-			// label this triangle and increment triangle counter
-			tri3idx = tris_added++;
-		}
+		// The triangles of this tetrahedron's faces (0,1,2), (0,1,3), (0,2,3)
+		// and (1,2,3) have been found by tetmesh_find_tris.
+		int tri0idx = tet_tris[tet*4];
+		int tri1idx = tet_tris[(tet*4)+1];
+		int tri2idx = tet_tris[(tet*4)+2];
+		int tri3idx = tet_tris[(tet*4)+3];
 
 		// Use this information to fill neighbours information
 		pTet_tri_neighbours[tet*4] = tri0idx;
@@ -573,6 +639,8 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
 	pZmin = zmin;
 	pZmax = zmax;
 
+	_buildTetGrid();
+
 	// Constructor has completed all necessary setting-up: Set flag.
 	pSetupDone = true;
 }
@@ -592,30 +660,32 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
    		std::vector<int> const & tet_tet_neighbs)
 : Geom()
 , pSetupDone(false)
+, pRelease(0)
+, pReleaseData(0)
 , pVertsN(0)
 , pVerts(0)
 , pTrisN(0)
 , pTris(0)
+, pTris_user(0) // not used by this contructor
 , pTri_areas(0)
-, pTri_norms(0)
 , pTri_barycs(0)
+, pTri_norms(0)
 , pTri_patches(0)
 , pTri_diffboundaries(0)
 , pTri_tet_neighbours(0)
-, pTris_user(0) // not used by this contructor
 , pTetsN(0)
 , pTets(0)
 , pTet_vols(0)
 , pTet_comps(0)
 , pTet_tri_neighbours(0)
 , pTet_tet_neighbours(0)
+, pDiffBoundaries()
 , pXmin(0.0)
 , pXmax(0.0)
 , pYmin(0.0)
 , pYmax(0.0)
 , pZmin(0.0)
 , pZmax(0.0)
-, pDiffBoundaries()
 
 {
 	// Check all vectors are of expected size
@@ -803,11 +873,100 @@ stetmesh::Tetmesh::Tetmesh(std::vector<double> const & verts,
 	pZmin = zmin;
 	pZmax = zmax;
 
+	_buildTetGrid();
+
 	// Constructor has completed all necessary setting-up: Set flag.
 	pSetupDone = true;
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+
+stetmesh::Tetmesh::Tetmesh(uint nverts, uint ntris, uint ntets,
+		double * verts, uint * tris, double * tri_areas,
+		double * tri_barycs, double * tri_norms, int * tri_tet_neighbs,
+		uint * tets, double * tet_vols, double * tet_barycs,
+		uint * tet_tri_neighbs, int * tet_tet_neighbs,
+		void (*release)(void *), void * release_data)
+: Geom()
+, pSetupDone(false)
+, pRelease(release)
+, pReleaseData(release_data)
+, pVertsN(nverts)
+, pVerts(verts)
+, pTrisN(ntris)
+, pTris(tris)
+, pTris_user(0) // not used by this contructor
+, pTri_areas(tri_areas)
+, pTri_barycs(tri_barycs)
+, pTri_norms(tri_norms)
+, pTri_patches(0)
+, pTri_diffboundaries(0)
+, pTri_tet_neighbours(tri_tet_neighbs)
+, pTetsN(ntets)
+, pTets(tets)
+, pTet_vols(tet_vols)
+, pTet_barycentres(tet_barycs)
+, pTet_comps(0)
+, pTet_tri_neighbours(tet_tri_neighbs)
+, pTet_tet_neighbours(tet_tet_neighbs)
+, pDiffBoundaries()
+, pXmin(0.0)
+, pXmax(0.0)
+, pYmin(0.0)
+, pYmax(0.0)
+, pZmin(0.0)
+, pZmax(0.0)
+{
+	assert(pRelease != 0);
+	if (pVertsN == 0 || pTrisN == 0 || pTetsN == 0)
+	{
+		// Release here, as the destructor will not run.
+		pRelease(pReleaseData);
+		std::ostringstream os;
+	    os << "Vertex, Triangle or Tet table not supplied to Tet mesh initialiser function.";
+	    throw steps::ArgErr(os.str());
+	}
+
+	// Only the comp, patch and diffusion boundary membership is mutable
+	// and so owned by the mesh.
+	pTet_comps = new stetmesh::TmComp*[pTetsN];
+	for (uint i=0; i<pTetsN; ++i) pTet_comps[i] = 0;
+	pTri_patches = new stetmesh::TmPatch*[pTrisN];
+	for (uint i=0; i<pTrisN; ++i) pTri_patches[i] = 0;
+	pTri_diffboundaries = new stetmesh::DiffBoundary*[pTrisN];
+	for (uint i=0; i<pTrisN; ++i) pTri_diffboundaries[i] = 0;
+
+	/// Find the minimal and maximal boundary values
+	double xmin = pVerts[0];
+	double xmax = pVerts[0];
+	double ymin = pVerts[1];
+	double ymax = pVerts[1];
+	double zmin = pVerts[2];
+	double zmax = pVerts[2];
+
+	for (uint i=1; i<pVertsN; ++i)
+	{
+		if (pVerts[i*3] < xmin) xmin = pVerts[i*3];
+		if (pVerts[i*3] > xmax) xmax = pVerts[i*3];
+		if (pVerts[(i*3)+1] < ymin) ymin = pVerts[(i*3)+1];
+		if (pVerts[(i*3)+1] > ymax) ymax = pVerts[(i*3)+1];
+		if (pVerts[(i*3)+2] < zmin) zmin = pVerts[(i*3)+2];
+		if (pVerts[(i*3)+2] > zmax) zmax = pVerts[(i*3)+2];
+	}
+	pXmin = xmin;
+	pXmax = xmax;
+	pYmin = ymin;
+	pYmax = ymax;
+	pZmin = zmin;
+	pZmax = zmax;
+
+	_buildTetGrid();
+
+	// Constructor has completed all necessary setting-up: Set flag.
+	pSetupDone = true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 stetmesh::Tetmesh::~Tetmesh(void)
@@ -815,16 +974,23 @@ stetmesh::Tetmesh::~Tetmesh(void)
 	// Memory created in 1st constructor must be freed if setup hasn't been called
 	if (pSetupDone == false) delete[] pTris_user;
 
+	delete[] pTri_patches;
+	delete[] pTri_diffboundaries;
+	delete[] pTet_comps;
+
+	if (pRelease != 0)
+	{
+		pRelease(pReleaseData);
+		return;
+	}
+
 	delete[] pVerts;
 	delete[] pTris;
 	delete[] pTri_areas;
 	delete[] pTri_norms;
-	delete[] pTri_patches;
-	delete[] pTri_diffboundaries;
 	delete[] pTri_tet_neighbours;
 	delete[] pTets;
 	delete[] pTet_vols;
-	delete[] pTet_comps;
 	delete[] pTet_tri_neighbours;
 	delete[] pTet_tet_neighbours;
 	delete[] pTet_barycentres;
@@ -1177,8 +1343,13 @@ void stetmesh::Tetmesh::setup(void)
 	// Now can free memory for array of user-supplied triangle information
 	delete[] pTris_user;
 
+	// Number the triangle faces of all tetrahedra, appending the ones that
+	// were not supplied to tris_temp.
+	std::vector<uint> tet_tris(pTetsN * 4);
+	tetmesh_find_tris(pTets, pTetsN, tris_temp, tris_added, &tet_tris[0]);
+
 	uint tettetadded = 0;
-	// Loop over all tetrahedra and fill tris_temp, pTet_tri_neighbours,
+	// Loop over all tetrahedra and fill pTet_tri_neighbours,
 	// pTet_tet_neighbours, tri_tet_neighbours_temp
 	for (uint tet=0; tet < pTetsN; ++tet)
 	{
@@ -1192,67 +1363,12 @@ void stetmesh::Tetmesh::setup(void)
 		pTet_vols[tet] = steps::math::tet_vol(vert0, vert1, vert2, vert3);
 		steps::math::tet_barycenter(vert0, vert1, vert2, vert3,pTet_barycentres + tet*3);
 
-		// create array for triangle formed by edges (0,1,2)
-		// will also sort for ease of comparison
-		uint tri_vert0[3] = {pTets[tet*4], pTets[(tet*4)+1], pTets[(tet*4)+2]};
-		std::sort(tri_vert0, tri_vert0 + 3);
-		// create array for triangle formed by edges (0,1,3)
-		uint tri_vert1[3] = {pTets[tet*4], pTets[(tet*4)+1], pTets[(tet*4)+3]};
-		std::sort(tri_vert1, tri_vert1 + 3);
-		// create array for triangle formed by edges (0,2,3)
-		uint tri_vert2[3] = {pTets[tet*4], pTets[(tet*4)+2], pTets[(tet*4)+3]};
-		std::sort(tri_vert2, tri_vert2 + 3);
-		// create array for triangle formed by edges (1,2,3)
-		uint tri_vert3[3] = {pTets[(tet*4)+1], pTets[(tet*4)+2], pTets[(tet*4)+3]};
-		std::sort(tri_vert3, tri_vert3 + 3);
-
-		int tri0idx = -1;
-		int tri1idx = -1;
-		int tri2idx = -1;
-		int tri3idx = -1;
-		uint trisfound = 0;	/// unused at the moment
-		for (uint tri = 0; tri < tris_added; ++tri)
-		{
-			uint thistri[3] = {tris_temp[tri*3], tris_temp[(tri*3)+1], tris_temp[(tri*3)+2]};
-			// should be no need to sort them now // std::sort(thistri, thistri + 3);
-			if (tri0idx == -1 && array_srt_cmp(tri_vert0, thistri, 3)) tri0idx = tri;
-			if (tri1idx == -1 && array_srt_cmp(tri_vert1, thistri, 3)) tri1idx = tri;
-			if (tri2idx == -1 && array_srt_cmp(tri_vert2, thistri, 3)) tri2idx = tri;
-			if (tri3idx == -1 && array_srt_cmp(tri_vert3, thistri, 3)) tri3idx = tri;
-		}
-		// First add the triangles that are not already included
-		if (tri0idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert0[0];
-			tris_temp[(tris_added*3)+1] = tri_vert0[1];
-			tris_temp[(tris_added*3)+2] = tri_vert0[2];
-			// label this triangle and increment triangle counter
-			tri0idx = tris_added++;
-		}
-		if (tri1idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert1[0];
-			tris_temp[(tris_added*3)+1] = tri_vert1[1];
-			tris_temp[(tris_added*3)+2] = tri_vert1[2];
-			// label this triangle and increment triangle counter
-			tri1idx = tris_added++;
-		}
-		if (tri2idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert2[0];
-			tris_temp[(tris_added*3)+1] = tri_vert2[1];
-			tris_temp[(tris_added*3)+2] = tri_vert2[2];
-			// label this triangle and increment triangle counter
-			tri2idx = tris_added++;
-		}
-		if (tri3idx == -1)
-		{
-			tris_temp[tris_added*3] = tri_vert3[0];
-			tris_temp[(tris_added*3)+1] = tri_vert3[1];
-			tris_temp[(tris_added*3)+2] = tri_vert3[2];
-			// label this triangle and increment triangle counter
-			tri3idx = tris_added++;
-		}
+		// The triangles of this tetrahedron's faces (0,1,2), (0,1,3), (0,2,3)
+		// and (1,2,3) have been found by tetmesh_find_tris.
+		int tri0idx = tet_tris[tet*4];
+		int tri1idx = tet_tris[(tet*4)+1];
+		int tri2idx = tet_tris[(tet*4)+2];
+		int tri3idx = tet_tris[(tet*4)+3];
 
 		// Use this information to fill neighbours information
 		pTet_tri_neighbours[tet*4] = tri0idx;
@@ -1430,6 +1546,7 @@ void stetmesh::Tetmesh::setup(void)
 	pZmin = zmin;
 	pZmax = zmax;
 
+	_buildTetGrid();
 
 	pSetupDone = true;
 }
@@ -1822,28 +1939,158 @@ std::vector<int> stetmesh::Tetmesh::getTetTetNeighb(uint tidx) const
 int stetmesh::Tetmesh::findTetByPoint(std::vector<double> p) const
 {
     assert(pSetupDone == true);
-    int tetidx = -1;
-    // initial check to see if point is outside boundary box
-    if (p[0] < pXmin || p[1] < pYmin || p[2] < pZmin
-    	|| p[0] > pXmax || p[1] > pYmax || p[2] > pZmax)
+    if (p.size() != 3)
     {
-		return tetidx;
+		std::ostringstream os;
+		os << "Point must be given by 3 coordinates.";
+		throw steps::ArgErr(os.str());
     }
     double pnt[3] = {p[0], p[1], p[2]};
-    for (uint tidx = 0; tidx < pTetsN; ++tidx)
+    return _findTetByPoint(pnt);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::vector<int> stetmesh::Tetmesh::findTetsByPoints(std::vector<double> p) const
+{
+    assert(pSetupDone == true);
+    if (p.size() % 3 != 0)
     {
+		std::ostringstream os;
+		os << "Length of point list must be a multiple of 3.";
+		throw steps::ArgErr(os.str());
+    }
+    uint npnts = p.size() / 3;
+    std::vector<int> tets(npnts);
+    for (uint i = 0; i < npnts; ++i)
+    {
+    	double pnt[3] = {p[i*3], p[(i*3)+1], p[(i*3)+2]};
+    	tets[i] = _findTetByPoint(pnt);
+    }
+    return tets;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int stetmesh::Tetmesh::_findTetByPoint(double * pnt) const
+{
+    // initial check to see if point is outside boundary box
+    if (pnt[0] < pXmin || pnt[1] < pYmin || pnt[2] < pZmin
+    	|| pnt[0] > pXmax || pnt[1] > pYmax || pnt[2] > pZmax)
+    {
+		return -1;
+    }
+
+    // Every tetrahedron containing the point is listed in the point's
+    // grid cell, in ascending order, so the first hit is the lowest
+    // index -- the same tetrahedron a linear search would return.
+    double lo[3] = {pXmin, pYmin, pZmin};
+    uint c[3];
+    for (uint d = 0; d < 3; ++d)
+    {
+    	c[d] = static_cast<uint>((pnt[d] - lo[d]) * pGridInvH[d]);
+    	if (c[d] >= pGridN[d]) c[d] = pGridN[d] - 1;
+    }
+    uint cell = c[0] + pGridN[0] * (c[1] + pGridN[1] * c[2]);
+    uint end = pGrid_offsets[cell + 1];
+    for (uint i = pGrid_offsets[cell]; i < end; ++i)
+    {
+    	uint tidx = pGrid_tets[i];
     	double * vert0 = pVerts + (3 * pTets[tidx*4]);
     	double * vert1 = pVerts + (3 * pTets[(tidx*4)+1]);
     	double * vert2 = pVerts + (3 * pTets[(tidx*4)+2]);
     	double * vert3 = pVerts + (3 * pTets[(tidx*4)+3]);
     	if (steps::math::tet_inside(vert0, vert1, vert2, vert3, pnt))
     	{
-    		tetidx = tidx;
-    		break;
+    		return tidx;
     	}
     }
+	return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stetmesh::Tetmesh::_buildTetGrid(void)
+{
+    double lo[3] = {pXmin, pYmin, pZmin};
+    double ext[3] = {pXmax - pXmin, pYmax - pYmin, pZmax - pZmin};
+    double maxext = std::max(ext[0], std::max(ext[1], ext[2]));
+
+    // Aim for roughly one grid cell per tetrahedron, with cubic cells.
+    double vol = 1.0;
+    uint ndims = 0;
+    for (uint d = 0; d < 3; ++d)
+    {
+    	if (ext[d] > 0.0) { vol *= ext[d]; ++ndims; }
+    }
+    double h = maxext;
+    if (ndims != 0 && pTetsN != 0)
+    {
+    	h = std::pow(vol / pTetsN, 1.0 / ndims);
+    }
+    for (uint d = 0; d < 3; ++d)
+    {
+    	double n = (h > 0.0) ? std::ceil(ext[d] / h) : 1.0;
+    	if (n < 1.0) n = 1.0;
+    	if (n > 1024.0) n = 1024.0;
+    	pGridN[d] = static_cast<uint>(n);
+    	pGridInvH[d] = (ext[d] > 0.0) ? (pGridN[d] / ext[d]) : 0.0;
+    }
+    uint ncells = pGridN[0] * pGridN[1] * pGridN[2];
 
-	return tetidx;
+    // Pad bounding boxes so that points accepted by tet_inside despite
+    // rounding still fall in a cell listing the tetrahedron.
+    double pad = maxext * 1.0e-9;
+
+    // Cell ranges of each tetrahedron's bounding box.
+    std::vector<uint> ranges(pTetsN * 6);
+    for (uint tidx = 0; tidx < pTetsN; ++tidx)
+    {
+    	for (uint d = 0; d < 3; ++d)
+    	{
+    		double bmin = pVerts[(3 * pTets[tidx*4]) + d];
+    		double bmax = bmin;
+    		for (uint v = 1; v < 4; ++v)
+    		{
+    			double x = pVerts[(3 * pTets[(tidx*4)+v]) + d];
+    			if (x < bmin) bmin = x;
+    			if (x > bmax) bmax = x;
+    		}
+    		double cmin = std::floor((bmin - pad - lo[d]) * pGridInvH[d]);
+    		double cmax = std::floor((bmax + pad - lo[d]) * pGridInvH[d]);
+    		if (cmin < 0.0) cmin = 0.0;
+    		if (cmax > pGridN[d] - 1.0) cmax = pGridN[d] - 1.0;
+    		ranges[(tidx*6)+(d*2)] = static_cast<uint>(cmin);
+    		ranges[(tidx*6)+(d*2)+1] = static_cast<uint>(cmax);
+    	}
+    }
+
+    // Count, then fill, in ascending tetrahedron order.
+    pGrid_offsets.assign(ncells + 1, 0);
+    for (uint pass = 0; pass < 2; ++pass)
+    {
+    	if (pass == 1)
+    	{
+    		for (uint cell = 0; cell < ncells; ++cell)
+    		{
+    			pGrid_offsets[cell + 1] += pGrid_offsets[cell];
+    		}
+    		pGrid_tets.resize(pGrid_offsets[ncells]);
+    	}
+    	std::vector<uint> fill(pGrid_offsets.begin(), pGrid_offsets.end() - 1);
+    	for (uint tidx = 0; tidx < pTetsN; ++tidx)
+    	{
+    		uint * r = &ranges[tidx*6];
+    		for (uint k = r[4]; k <= r[5]; ++k)
+    		for (uint j = r[2]; j <= r[3]; ++j)
+    		for (uint i = r[0]; i <= r[1]; ++i)
+    		{
+    			uint cell = i + pGridN[0] * (j + pGridN[1] * k);
+    			if (pass == 0) ++pGrid_offsets[cell + 1];
+    			else pGrid_tets[fill[cell]++] = tidx;
+    		}
+    	}
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +170,22 @@ public:
     		std::vector<uint> const & tet_tri_neighbs,
     		std::vector<int> const & tet_tet_neighbs);
 
+    /// Constructor for a mesh whose tables are held in external storage,
+    /// such as a memory-mapped file (see loadBinary). The tables are used
+    /// in place rather than copied. They must be writable, as patches may
+    /// reorient triangles, and remain valid until the mesh is destroyed,
+    /// when release(release_data) is called.
+    /// Table layouts are as for the previous constructor, with the
+    /// triangle barycenters (3 per triangle) supplied as well.
+    ///
+    /// Not exposed to Python.
+    Tetmesh(uint nverts, uint ntris, uint ntets,
+    		double * verts, uint * tris, double * tri_areas,
+    		double * tri_barycs, double * tri_norms, int * tri_tet_neighbs,
+    		uint * tets, double * tet_vols, double * tet_barycs,
+    		uint * tet_tri_neighbs, int * tet_tet_neighbs,
+    		void (*release)(void *), void * release_data);
+
     /// Destructor
     virtual ~Tetmesh(void);
 
@@ -392,6 +408,14 @@ public:
 
     int findTetByPoint(std::vector<double> p) const;
 
+    /// Find the tetrahedra which encompass a list of points.
+    /// Points are given as a flat list of x,y,z triplets; for each point
+    /// the result is the same as findTetByPoint.
+    /// \param p Coordinates of the points (length 3 * number of points).
+    /// \return IDs of the found tetrahedra (-1 for points outside mesh).
+
+    std::vector<int> findTetsByPoints(std::vector<double> p) const;
+
 	////////////////////////////////////////////////////////////////////////
 	// DATA ACCESS (EXPOSED TO PYTHON): MESH
 	////////////////////////////////////////////////////////////////////////
@@ -495,8 +519,24 @@ private:
 
     ////////////////////////////////////////////////////////////////////////
 
+    /// Build the uniform grid over tetrahedron bounding boxes used by
+    /// findTetByPoint. Called once vertices, tetrahedra and the mesh
+    /// bounding box are known.
+    void _buildTetGrid(void);
+
+    /// Return the index of the tetrahedron encompassing point pnt,
+    /// or -1 if there is none.
+    int _findTetByPoint(double * pnt) const;
+
+    ////////////////////////////////////////////////////////////////////////
+
     bool                                pSetupDone;
 
+    /// If not zero, the vertex, triangle and tetrahedron tables are held
+    /// in external storage and pRelease(pReleaseData) frees them
+    void                             (* pRelease)(void *);
+    void                              * pReleaseData;
+
     ///////////////////////// DATA: VERTICES ///////////////////////////////
     ///
     /// The total number of vertices in the mesh
@@ -559,6 +599,18 @@ private:
     double                      pZmin;
     double                      pZmax;
 
+    ///////////////////////// DATA: POINT LOCATION ////////////////////////
+    ///
+    /// Number of grid cells in x,y,z
+    uint                        pGridN[3];
+    /// Inverse of the grid cell size in x,y,z
+    double                      pGridInvH[3];
+    /// For each grid cell, the range into pGrid_tets of the tetrahedra
+    /// whose (padded) bounding box overlaps the cell
+    std::vector<uint>           pGrid_offsets;
+    /// Tetrahedron indices per cell, in ascending order
+    std::vector<uint>           pGrid_tets;
+
     ////////////////////////////////////////////////////////////////////////
 
 };
@@ -27,10 +27,10 @@
  *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
  *  Last Changed By:   $Author: iain $
  */
-/*
 
 // STL headers.
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -38,6 +38,17 @@
 #include <sstream>
 #include <vector>
 
+// System headers.
+#include <stdint.h>
+#ifdef _WIN32
+#define STEPS_TETMESH_RW_NO_MMAP 1
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 // STEPS headers.
 #include "../common.h"
 #include "../error.hpp"
@@ -65,14 +76,12 @@ USING(steps::wm, Patch);
 ////////////////////////////////////////////////////////////////////////////////
 
 // TODO:
-// * Change to a binary format, this will obviously be much more effective
-//   for larger meshes. Maybe use something like the NetCDF library for
-//   this. It will make loading the mesh from e.g. Matlab easier.
 // * Add a LOT more error checking and throw exceptions (while keeping in
 //   mind to clean up along the call path!! As always!!!!!!!!)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*
 Tetmesh * steps::tetmesh::loadASCII(string pathname)
 {
     typedef vector<string> strvec_t;
@@ -388,8 +397,610 @@ void steps::tetmesh::saveASCII(string pathname, Tetmesh * m)
 
     mf.close();
 }
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+// BINARY FORMAT (see tetmesh_rw.hpp for the layout)
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const char BIN_MAGIC[8] = {'S', 'T', 'E', 'P', 'S', 'M', 'S', 'H'};
+const uint32_t BIN_VERSION = 1;
+const uint32_t BIN_BYTEORDER = 0x01020304;
+
+enum
+{
+    BIN_VERTS = 0,
+    BIN_TRIS,
+    BIN_TRI_AREAS,
+    BIN_TRI_BARYCS,
+    BIN_TRI_NORMS,
+    BIN_TRI_TET_NEIGHBS,
+    BIN_TETS,
+    BIN_TET_VOLS,
+    BIN_TET_BARYCS,
+    BIN_TET_TRI_NEIGHBS,
+    BIN_TET_TET_NEIGHBS,
+    BIN_GROUPS,
+    BIN_NSECTIONS
+};
+
+struct BinHeader
+{
+    char                                magic[8];
+    uint32_t                            version;
+    uint32_t                            byteorder;
+    uint32_t                            nverts;
+    uint32_t                            ntris;
+    uint32_t                            ntets;
+    uint32_t                            unused;
+    /// Start of each section; the last entry is the file size.
+    uint64_t                            offset[BIN_NSECTIONS + 1];
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+inline uint64_t binAlign(uint64_t off)
+{
+    return (off + 7) & ~static_cast<uint64_t>(7);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Fill in the sizes in bytes of the fixed-size sections.
+void binSectionSizes(BinHeader const & head, uint64_t * sizes)
+{
+    uint64_t nverts = head.nverts;
+    uint64_t ntris = head.ntris;
+    uint64_t ntets = head.ntets;
+    sizes[BIN_VERTS] = nverts * 3 * sizeof(double);
+    sizes[BIN_TRIS] = ntris * 3 * sizeof(uint);
+    sizes[BIN_TRI_AREAS] = ntris * sizeof(double);
+    sizes[BIN_TRI_BARYCS] = ntris * 3 * sizeof(double);
+    sizes[BIN_TRI_NORMS] = ntris * 3 * sizeof(double);
+    sizes[BIN_TRI_TET_NEIGHBS] = ntris * 2 * sizeof(int);
+    sizes[BIN_TETS] = ntets * 4 * sizeof(uint);
+    sizes[BIN_TET_VOLS] = ntets * sizeof(double);
+    sizes[BIN_TET_BARYCS] = ntets * 3 * sizeof(double);
+    sizes[BIN_TET_TRI_NEIGHBS] = ntets * 4 * sizeof(uint);
+    sizes[BIN_TET_TET_NEIGHBS] = ntets * 4 * sizeof(int);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void binPutString(vector<uint32_t> & words, string const & s)
+{
+    words.push_back(s.size());
+    uint start = words.size();
+    words.resize(start + ((s.size() + 3) / 4), 0);
+    if (s.empty() == false) memcpy(&words[start], s.data(), s.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void binPutIndices(vector<uint32_t> & words, vector<uint> const & idcs)
+{
+    words.push_back(idcs.size());
+    words.insert(words.end(), idcs.begin(), idcs.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Write a section at offset off, after padding the file up to it.
+template <class T>
+void binWriteSection(ofstream & f, uint64_t & pos, uint64_t off,
+                     vector<T> const & data)
+{
+    assert(pos <= off);
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    f.write(zeros, off - pos);
+    if (data.empty() == false)
+    {
+        f.write(reinterpret_cast<char const *>(&data[0]),
+                data.size() * sizeof(T));
+    }
+    pos = off + (data.size() * sizeof(T));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Reads the compartment and patch section, checking each read against
+/// the end of the file.
+class BinGroupReader
+{
+public:
+
+    BinGroupReader(uint32_t const * begin, uint32_t const * end)
+    : pCur(begin)
+    , pEnd(end)
+    { }
+
+    uint32_t word(void)
+    {
+        _need(1);
+        return *(pCur++);
+    }
+
+    string str(void)
+    {
+        uint32_t len = word();
+        uint64_t nwords = (static_cast<uint64_t>(len) + 3) / 4;
+        _need(nwords);
+        string s(reinterpret_cast<char const *>(pCur), len);
+        pCur += nwords;
+        return s;
+    }
+
+    vector<uint> indices(void)
+    {
+        uint32_t n = word();
+        _need(n);
+        vector<uint> idcs(pCur, pCur + n);
+        pCur += n;
+        return idcs;
+    }
+
+private:
+
+    void _need(uint64_t nwords) const
+    {
+        if (static_cast<uint64_t>(pEnd - pCur) < nwords)
+        {
+            throw steps::ArgErr("Binary mesh file is truncated or corrupt.");
+        }
+    }
+
+    uint32_t const                    * pCur;
+    uint32_t const                    * pEnd;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// The memory holding a loaded file, released by the Tetmesh built on it.
+struct BinStorage
+{
+    void                              * addr;
+    uint64_t                            len;
+};
+
+void binRelease(void * data)
+{
+    BinStorage * st = static_cast<BinStorage *>(data);
+#ifdef STEPS_TETMESH_RW_NO_MMAP
+    delete[] static_cast<uint64_t *>(st->addr);
+#else
+    munmap(st->addr, st->len);
+#endif
+    delete st;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BinStorage * binMap(string const & pathname)
+{
+    BinStorage * st = new BinStorage;
+#ifdef STEPS_TETMESH_RW_NO_MMAP
+    ifstream f(pathname.c_str(), std::ios::in | std::ios::binary);
+    if (f.good()) f.seekg(0, std::ios::end);
+    if (f.good() == false)
+    {
+        delete st;
+        ostringstream os;
+        os << "Cannot open file '" << pathname << "' for reading.";
+        throw steps::IOErr(os.str());
+    }
+    st->len = f.tellg();
+    // Allocated as 64 bit words to keep the sections aligned.
+    st->addr = new uint64_t[(st->len + 7) / 8];
+    f.seekg(0, std::ios::beg);
+    f.read(static_cast<char *>(st->addr), st->len);
+    if (f.fail())
+    {
+        binRelease(st);
+        ostringstream os;
+        os << "Error reading file '" << pathname << "'.";
+        throw steps::IOErr(os.str());
+    }
+#else
+    int fd = open(pathname.c_str(), O_RDONLY);
+    struct stat sb;
+    if (fd < 0 || fstat(fd, &sb) != 0)
+    {
+        if (fd >= 0) close(fd);
+        delete st;
+        ostringstream os;
+        os << "Cannot open file '" << pathname << "' for reading.";
+        throw steps::IOErr(os.str());
+    }
+    st->len = sb.st_size;
+    st->addr = 0;
+    if (st->len != 0)
+    {
+        // Copy-on-write: pages stay shared with the page cache (and so
+        // with other processes) unless the mesh modifies them, as TmPatch
+        // does when it reorients triangles.
+        st->addr = mmap(0, st->len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (st->addr == 0 || st->addr == MAP_FAILED)
+    {
+        delete st;
+        ostringstream os;
+        os << "Cannot map file '" << pathname << "'.";
+        throw steps::IOErr(os.str());
+    }
+#endif
+    return st;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Check the header of a loaded file against the file size.
+void binCheckHeader(BinHeader const & head, uint64_t len)
+{
+    bool ok = (memcmp(head.magic, BIN_MAGIC, 8) == 0);
+    if (ok && head.byteorder != BIN_BYTEORDER)
+    {
+        throw steps::ArgErr("Binary mesh file was written with a different "
+                            "byte order.");
+    }
+    if (ok && head.version != BIN_VERSION)
+    {
+        ostringstream os;
+        os << "Unsupported binary mesh file version " << head.version << ".";
+        throw steps::ArgErr(os.str());
+    }
+    uint64_t sizes[BIN_NSECTIONS];
+    binSectionSizes(head, sizes);
+    ok = ok && (head.offset[BIN_NSECTIONS] == len) && (len % 8 == 0);
+    uint64_t end = sizeof(BinHeader);
+    for (uint s = 0; ok && s < BIN_NSECTIONS; ++s)
+    {
+        uint64_t off = head.offset[s];
+        ok = (off % 8 == 0) && (off >= end) && (off <= len);
+        end = off;
+        if (ok && s != BIN_GROUPS)
+        {
+            ok = (sizes[s] <= len - off);
+            end = off + sizes[s];
+        }
+    }
+    if (ok == false)
+    {
+        throw steps::ArgErr("File is not a valid STEPS binary mesh file.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// True if each of the n indices is below max.
+bool binIndicesBelow(uint const * idcs, uint64_t n, uint max)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        if (idcs[i] >= max) return false;
+    }
+    return true;
+}
+
+/// True if each of the n neighbours is below max or -1 (no neighbour).
+bool binNeighboursBelow(int const * nbs, uint64_t n, uint max)
+{
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        if (nbs[i] < -1 || (nbs[i] >= 0 && static_cast<uint>(nbs[i]) >= max))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Check the vertex, triangle and tetrahedron indices stored in the
+/// tables of a loaded file, whose header has been checked, so that the
+/// mesh never indexes past a table.
+void binCheckIndices(BinHeader const & head, char const * base)
+{
+    uint64_t ntris = head.ntris;
+    uint64_t ntets = head.ntets;
+    bool ok = binIndicesBelow(
+        reinterpret_cast<uint const *>(base + head.offset[BIN_TRIS]),
+        ntris * 3, head.nverts);
+    ok = ok && binIndicesBelow(
+        reinterpret_cast<uint const *>(base + head.offset[BIN_TETS]),
+        ntets * 4, head.nverts);
+    ok = ok && binIndicesBelow(
+        reinterpret_cast<uint const *>(base + head.offset[BIN_TET_TRI_NEIGHBS]),
+        ntets * 4, head.ntris);
+    ok = ok && binNeighboursBelow(
+        reinterpret_cast<int const *>(base + head.offset[BIN_TRI_TET_NEIGHBS]),
+        ntris * 2, head.ntets);
+    ok = ok && binNeighboursBelow(
+        reinterpret_cast<int const *>(base + head.offset[BIN_TET_TET_NEIGHBS]),
+        ntets * 4, head.ntets);
+    if (ok == false)
+    {
+        throw steps::ArgErr("Binary mesh file holds an index out of range.");
+    }
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void steps::tetmesh::saveBinary(string pathname, Tetmesh * m)
+{
+    assert(m != 0);
+
+    BinHeader head;
+    memset(&head, 0, sizeof(BinHeader));
+    memcpy(head.magic, BIN_MAGIC, 8);
+    head.version = BIN_VERSION;
+    head.byteorder = BIN_BYTEORDER;
+    head.nverts = m->countVertices();
+    head.ntris = m->countTris();
+    head.ntets = m->countTets();
+
+    // Compartments and patches.
+    vector<uint32_t> groups;
+    vector<Comp *> comps = m->getAllComps();
+    groups.push_back(comps.size());
+    for (vector<Comp *>::const_iterator c = comps.begin(); c != comps.end(); ++c)
+    {
+        TmComp * comp = dynamic_cast<TmComp *>(*c);
+        assert(comp != 0);
+        binPutString(groups, comp->getID());
+        set<string> volsys = comp->getVolsys();
+        groups.push_back(volsys.size());
+        for (set<string>::const_iterator v = volsys.begin(); v != volsys.end(); ++v)
+        {
+            binPutString(groups, *v);
+        }
+        binPutIndices(groups, comp->_getAllTetIndices());
+    }
+    vector<Patch *> patches = m->getAllPatches();
+    groups.push_back(patches.size());
+    for (vector<Patch *>::const_iterator p = patches.begin(); p != patches.end(); ++p)
+    {
+        TmPatch * patch = dynamic_cast<TmPatch *>(*p);
+        assert(patch != 0 && patch->getIComp() != 0);
+        binPutString(groups, patch->getID());
+        binPutString(groups, patch->getIComp()->getID());
+        if (patch->getOComp() == 0) groups.push_back(0);
+        else
+        {
+            groups.push_back(1);
+            binPutString(groups, patch->getOComp()->getID());
+        }
+        set<string> surfsys = patch->getSurfsys();
+        groups.push_back(surfsys.size());
+        for (set<string>::const_iterator s = surfsys.begin(); s != surfsys.end(); ++s)
+        {
+            binPutString(groups, *s);
+        }
+        binPutIndices(groups, patch->_getAllTriIndices());
+    }
+
+    uint64_t sizes[BIN_NSECTIONS];
+    binSectionSizes(head, sizes);
+    sizes[BIN_GROUPS] = groups.size() * sizeof(uint32_t);
+    uint64_t off = binAlign(sizeof(BinHeader));
+    for (uint s = 0; s < BIN_NSECTIONS; ++s)
+    {
+        head.offset[s] = off;
+        off = binAlign(off + sizes[s]);
+    }
+    head.offset[BIN_NSECTIONS] = off;
+
+    ofstream f(pathname.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (f.good() == false)
+    {
+        ostringstream os;
+        os << "Cannot open file '" << pathname << "' for writing.";
+        throw steps::IOErr(os.str());
+    }
+    f.write(reinterpret_cast<char const *>(&head), sizeof(BinHeader));
+    uint64_t pos = sizeof(BinHeader);
+
+    // Each section is gathered through the public accessors and written
+    // in turn, so that only one is held in memory at a time.
+    uint nverts = head.nverts;
+    uint ntris = head.ntris;
+    uint ntets = head.ntets;
+    {
+        vector<double> verts;
+        verts.reserve(nverts * 3);
+        for (uint v = 0; v < nverts; ++v)
+        {
+            vector<double> x = m->getVertex(v);
+            verts.insert(verts.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_VERTS], verts);
+    }
+    {
+        vector<uint> tris;
+        tris.reserve(ntris * 3);
+        for (uint t = 0; t < ntris; ++t)
+        {
+            vector<uint> x = m->getTri(t);
+            tris.insert(tris.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TRIS], tris);
+    }
+    {
+        vector<double> areas(ntris);
+        for (uint t = 0; t < ntris; ++t) areas[t] = m->getTriArea(t);
+        binWriteSection(f, pos, head.offset[BIN_TRI_AREAS], areas);
+    }
+    {
+        vector<double> barycs;
+        barycs.reserve(ntris * 3);
+        for (uint t = 0; t < ntris; ++t)
+        {
+            vector<double> x = m->getTriBarycenter(t);
+            barycs.insert(barycs.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TRI_BARYCS], barycs);
+    }
+    {
+        vector<double> norms;
+        norms.reserve(ntris * 3);
+        for (uint t = 0; t < ntris; ++t)
+        {
+            vector<double> x = m->getTriNorm(t);
+            norms.insert(norms.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TRI_NORMS], norms);
+    }
+    {
+        vector<int> neighbs;
+        neighbs.reserve(ntris * 2);
+        for (uint t = 0; t < ntris; ++t)
+        {
+            vector<int> x = m->getTriTetNeighb(t);
+            neighbs.insert(neighbs.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TRI_TET_NEIGHBS], neighbs);
+    }
+    {
+        vector<uint> tets;
+        tets.reserve(ntets * 4);
+        for (uint t = 0; t < ntets; ++t)
+        {
+            vector<uint> x = m->getTet(t);
+            tets.insert(tets.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TETS], tets);
+    }
+    {
+        vector<double> vols(ntets);
+        for (uint t = 0; t < ntets; ++t) vols[t] = m->getTetVol(t);
+        binWriteSection(f, pos, head.offset[BIN_TET_VOLS], vols);
+    }
+    {
+        vector<double> barycs;
+        barycs.reserve(ntets * 3);
+        for (uint t = 0; t < ntets; ++t)
+        {
+            vector<double> x = m->getTetBarycenter(t);
+            barycs.insert(barycs.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TET_BARYCS], barycs);
+    }
+    {
+        vector<uint> neighbs;
+        neighbs.reserve(ntets * 4);
+        for (uint t = 0; t < ntets; ++t)
+        {
+            vector<uint> x = m->getTetTriNeighb(t);
+            neighbs.insert(neighbs.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TET_TRI_NEIGHBS], neighbs);
+    }
+    {
+        vector<int> neighbs;
+        neighbs.reserve(ntets * 4);
+        for (uint t = 0; t < ntets; ++t)
+        {
+            vector<int> x = m->getTetTetNeighb(t);
+            neighbs.insert(neighbs.end(), x.begin(), x.end());
+        }
+        binWriteSection(f, pos, head.offset[BIN_TET_TET_NEIGHBS], neighbs);
+    }
+    binWriteSection(f, pos, head.offset[BIN_GROUPS], groups);
+    binWriteSection(f, pos, head.offset[BIN_NSECTIONS], vector<char>());
+
+    f.close();
+    if (f.fail())
+    {
+        ostringstream os;
+        os << "Error writing file '" << pathname << "'.";
+        throw steps::IOErr(os.str());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+Tetmesh * steps::tetmesh::loadBinary(string pathname)
+{
+    BinStorage * st = binMap(pathname);
+    char * base = static_cast<char *>(st->addr);
+
+    BinHeader head;
+    try
+    {
+        if (st->len < sizeof(BinHeader))
+        {
+            throw steps::ArgErr("File is not a valid STEPS binary mesh file.");
+        }
+        memcpy(&head, base, sizeof(BinHeader));
+        binCheckHeader(head, st->len);
+        binCheckIndices(head, base);
+    }
+    catch (...)
+    {
+        binRelease(st);
+        throw;
+    }
+
+    // From here on the mesh owns the storage.
+    Tetmesh * mesh = new Tetmesh(head.nverts, head.ntris, head.ntets,
+        reinterpret_cast<double *>(base + head.offset[BIN_VERTS]),
+        reinterpret_cast<uint *>(base + head.offset[BIN_TRIS]),
+        reinterpret_cast<double *>(base + head.offset[BIN_TRI_AREAS]),
+        reinterpret_cast<double *>(base + head.offset[BIN_TRI_BARYCS]),
+        reinterpret_cast<double *>(base + head.offset[BIN_TRI_NORMS]),
+        reinterpret_cast<int *>(base + head.offset[BIN_TRI_TET_NEIGHBS]),
+        reinterpret_cast<uint *>(base + head.offset[BIN_TETS]),
+        reinterpret_cast<double *>(base + head.offset[BIN_TET_VOLS]),
+        reinterpret_cast<double *>(base + head.offset[BIN_TET_BARYCS]),
+        reinterpret_cast<uint *>(base + head.offset[BIN_TET_TRI_NEIGHBS]),
+        reinterpret_cast<int *>(base + head.offset[BIN_TET_TET_NEIGHBS]),
+        binRelease, st);
+
+    try
+    {
+        BinGroupReader r(
+            reinterpret_cast<uint32_t const *>(base + head.offset[BIN_GROUPS]),
+            reinterpret_cast<uint32_t const *>(base + head.offset[BIN_NSECTIONS]));
+
+        uint ncomps = r.word();
+        for (uint c = 0; c < ncomps; ++c)
+        {
+            string id = r.str();
+            vector<string> volsys;
+            uint nvolsys = r.word();
+            for (uint v = 0; v < nvolsys; ++v) volsys.push_back(r.str());
+            TmComp * comp = new TmComp(id, mesh, r.indices());
+            for (uint v = 0; v < nvolsys; ++v) comp->addVolsys(volsys[v]);
+        }
+
+        uint npatches = r.word();
+        for (uint p = 0; p < npatches; ++p)
+        {
+            string id = r.str();
+            Comp * icomp = mesh->getComp(r.str());
+            Comp * ocomp = 0;
+            if (r.word() != 0) ocomp = mesh->getComp(r.str());
+            vector<string> surfsys;
+            uint nsurfsys = r.word();
+            for (uint s = 0; s < nsurfsys; ++s) surfsys.push_back(r.str());
+            TmPatch * patch = new TmPatch(id, mesh, r.indices(), icomp, ocomp);
+            for (uint s = 0; s < nsurfsys; ++s) patch->addSurfsys(surfsys[s]);
+        }
+    }
+    catch (...)
+    {
+        delete mesh;
+        throw;
+    }
+
+    return mesh;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 
 // END
-*/
@@ -28,7 +28,6 @@
  *  Last Changed By:   $Author: iain $
  */
 
-/*
 #ifndef STEPS_TETMESH_TETMESH_RW_HPP
 #define STEPS_TETMESH_TETMESH_RW_HPP 1
 
@@ -50,6 +49,7 @@ class Tetmesh;
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*
 //@{
 /// loadASCII() and saveASCII() are functions that read and write a
 /// tetmesh to a very simple STEPS-centered ASCII (i.e. text based)
@@ -110,6 +110,59 @@ class Tetmesh;
 Tetmesh * loadASCII(std::string pathname);
 void saveASCII(std::string pathname, Tetmesh * m);
 //@}
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+
+//@{
+/// saveBinary() and loadBinary() write and read a tetmesh in a versioned
+/// binary format which is laid out so that it can be memory-mapped and
+/// used in place: a mesh loaded this way is built without parsing or
+/// copying any per-element data, and processes loading the same file
+/// share a single page-cached copy of it (mapped copy-on-write, so
+/// pages a mesh modifies become private to it).
+///
+/// The file starts with a fixed header:
+///
+/// <OL>
+/// <LI>The 8 characters "STEPSMSH".
+/// <LI>The format version, a byte order mark (0x01020304) and the
+///     numbers of vertices, triangles and tetrahedrons, as 32 bit
+///     unsigned integers, followed by one unused 32 bit word.
+/// <LI>13 64 bit byte offsets: the start of each of the 12 sections
+///     below, and the file size.
+/// </OL>
+///
+/// The sections follow, in order, each starting on an 8 byte boundary:
+/// vertex coordinates (3 doubles per vertex); triangle vertices
+/// (3 uints); triangle areas; triangle barycenters (3 doubles);
+/// triangle normals (3 doubles); triangle tet neighbours (2 ints);
+/// tetrahedron vertices (4 uints); tetrahedron volumes; tetrahedron
+/// barycenters (3 doubles); tetrahedron triangle neighbours (4 uints);
+/// tetrahedron tet neighbours (4 ints). The last section holds the
+/// compartments and patches as 32 bit words, strings being stored as
+/// their length followed by their characters padded to a whole word:
+///
+/// <OL>
+/// <LI>The number of compartments. For each compartment: its ID, the
+///     number of volume systems and their IDs, the number of
+///     tetrahedrons and their indices.
+/// <LI>The number of patches. For each patch: its ID, the ID of its
+///     inner compartment, a flag telling whether an outer compartment
+///     follows and if so its ID, the number of surface systems and
+///     their IDs, the number of triangles and their indices.
+/// </OL>
+///
+/// Data is stored in the native byte order and loadBinary() refuses
+/// files written on a machine with a different one. Before the mesh is
+/// built, loadBinary() also checks that every vertex, triangle and
+/// tetrahedron index in the tables is in range, so a corrupt file
+/// raises steps::ArgErr. Where mmap is not available the file is read
+/// into memory in a single block instead.
+///
+void saveBinary(std::string pathname, Tetmesh * m);
+Tetmesh * loadBinary(std::string pathname);
+//@}
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -120,5 +173,4 @@ END_NAMESPACE(steps)
 // STEPS_TETMESH_TETMESH_RW_HPP
 
 // END
-*/
 
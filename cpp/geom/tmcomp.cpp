@@ -77,24 +77,14 @@ stetmesh::TmComp::TmComp(std::string const & id, Tetmesh * container,
 	for(uint i=0; i< tets.size(); ++i)
 	{
 		// perform some checks on this tet
-		bool included = false;
-		for (uint j=0; j < pTetsN; ++j)
-		{
-			// check if tet has already occurred in this list (duplicate)
-			if (tets[i] == pTet_indices[j])
-			{
-				included = true;
-				break;
-			}
-		}
-		if (included == true) continue;
-
 		if (tets[i] > maxidx)
 		{
 			std::ostringstream os;
 			os << "Invalid index supplied for tetrahedron #" << i << " in list.";
 			throw steps::ArgErr(os.str());
 		}
+		// check if tet has already occurred in this list (duplicate)
+		if (pTetmesh->getTetComp(tets[i]) == this) continue;
 		if (pTetmesh->getTetComp(tets[i]) != 0)
 		{
 			std::ostringstream os;
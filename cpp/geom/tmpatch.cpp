@@ -78,24 +78,15 @@ stetmesh::TmPatch::TmPatch(std::string const & id, Tetmesh * container,
     for (uint i=0; i <tris.size(); ++i)
     {
     	// perform some checks on this triangle
-    	bool included = false;
-    	for(uint j = 0; j <pTrisN; ++j)
-    	{
-    		// check if tri has already occured in this list (duplicate)
-    		if (tris[i] == pTri_indices[j])
-    		{
-    			included = true;
-    			break;
-    		}
-    	}
-    	if (included == true) continue;
-
     	if (tris[i] > maxidx)
     	{
     		std::ostringstream os;
     		os << "Invalid index supplied for triangle #" << i << " in list.";
     		throw steps::ArgErr(os.str());
     	}
+    	// check if tri has already occured in this list (duplicate)
+    	if (pTetmesh->getTriPatch(tris[i]) == this) continue;
+
     	if (pTetmesh->getTriPatch(tris[i]) != 0)
     	{
     		std::ostringstream os;
@@ -230,24 +221,15 @@ stetmesh::TmPatch::TmPatch(std::string const & id, Tetmesh * container,
     for (uint i=0; i <tris.size(); ++i)
     {
     	// perform some checks on this triangle
-    	bool included = false;
-    	for(uint j = 0; j <pTrisN; ++j)
-    	{
-    		// check if tri has already occured in this list (duplicate)
-    		if (tris[i] == pTri_indices[j])
-    		{
-    			included = true;
-    			break;
-    		}
-    	}
-    	if (included == true) continue;
-
     	if (tris[i] > maxidx)
     	{
     		std::ostringstream os;
     		os << "Invalid index supplied for triangle #" << i << " in list.";
     		throw steps::ArgErr(os.str());
     	}
+    	// check if tri has already occured in this list (duplicate)
+    	if (pTetmesh->getTriPatch(tris[i]) == this) continue;
+
     	if (pTetmesh->getTriPatch(tris[i]) != 0)
     	{
     		std::ostringstream os;
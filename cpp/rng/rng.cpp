@@ -56,7 +56,11 @@ RNG::RNG(uint bufsize)
 , rNext(0)
 , rEnd(0)
 , pInitialized(false)
+, pPsn()
 {
+    // JJV changed the initial values of MUPREV and MUOLD.
+    pPsn.muold = -1.0E37;
+    pPsn.muprev = -1.0E37;
     rBuffer = new uint[rSize];
     rNext = rEnd = rBuffer + rSize;
 }
@@ -76,6 +80,9 @@ void RNG::initialize(ulong const & seed)
     concreteInitialize(seed);
     pInitialized = true;
     concreteFillBuffer();
+    // Start from the same point in the stream as a new generator, so
+    // that reseeding restarts the same sequence.
+    rNext = rEnd;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -87,9 +94,9 @@ float RNG::getStdExp(void)
         0.6931472, 0.9333737, 0.9888778, 0.9984959,
         0.9998293, 0.9999833, 0.9999986, 0.9999999
     };
-    static long i;
-    static float sexpo, a, u, ustar, umin;
-    static float *q1 = q;
+    long i;
+    float sexpo, a, u, ustar, umin;
+    float *q1 = q;
     a = 0.0;
     u = getUnfEE();
     goto S30;
@@ -115,7 +122,12 @@ S70:
     ustar = getUnfEE();
     if(ustar < umin) umin = ustar;
     i += 1;
-    if(u > *(q + i - 1)) goto S70;
+    /*
+     * The table stops at 0.9999999, which in float lies below the largest
+     * u < 1.0; treat the last entry as the limit 1.0 so that the search
+     * never runs past the table.
+     */
+    if(i < 8 && u > *(q + i - 1)) goto S70;
     sexpo = a + umin * *q1;
     return sexpo;
 }
@@ -133,9 +145,6 @@ long RNG::getPsn(float lambda)
 	static float a6 = -0.1384794;
 	static float a7 = 0.125006;
 
-	// JJV changed the initial values of MUPREV and MUOLD.
-	static float muold = -1.0E37;
-	static float muprev = -1.0E37;
 	static float fact[10] =
     {
 		1.0, 1.0,
@@ -145,10 +154,21 @@ long RNG::getPsn(float lambda)
 		40320.0, 362880.0
 	};
 
+	// Values reused between calls with the same mean are kept in pPsn.
+	float & muold = pPsn.muold;
+	float & muprev = pPsn.muprev;
 	// JJV added ll to the list, for Case A.
-	static long ignpoi, j, k, kflag, l, ll, m;
-	static float b1, b2, c, c0, c1, c2, c3, d, del, difmuk, e, fk, fx, fy, g;
-	static float omega, p, p0, px, py, q, s, t, u, v, x, xx, pp[35];
+	long & l = pPsn.l;
+	long & ll = pPsn.ll;
+	long & m = pPsn.m;
+	float & b1 = pPsn.b1, & b2 = pPsn.b2, & c = pPsn.c, & c0 = pPsn.c0;
+	float & c1 = pPsn.c1, & c2 = pPsn.c2, & c3 = pPsn.c3, & d = pPsn.d;
+	float & omega = pPsn.omega, & p = pPsn.p, & p0 = pPsn.p0, & q = pPsn.q;
+	float & s = pPsn.s;
+	float * pp = pPsn.pp;
+	long ignpoi = 0, j, k, kflag;
+	float del, difmuk = 0.0, e, fk = 0.0, fx, fy, g;
+	float px, py, t, u, v, x, xx;
     float mu = 1.0 / lambda;
 
     if(mu == muprev) goto S10;
@@ -378,8 +398,8 @@ float RNG::getStdNrm(void)
     	8.781922E-2,    9.930398E-2,    0.11556,         0.1404344,
         0.1836142,      0.2790016,      0.7010474
 	};
-	static long i;
-	static float snorm, u, s, ustar, aa, w, y, tt;
+	long i;
+	float snorm, u, s, ustar, aa, w, y, tt;
     u = getUnfEE();
     s = 0.0;
     if(u > 0.5) s = 1.0;
@@ -459,6 +479,137 @@ double RNG::getExp(double lambda)
      return (1.0 / lambda) * (double)getStdExp();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+// Stirling approximation error of log(k!), used by getBinom.
+static double binom_fc(uint k)
+{
+    static const double fc[10] =
+    {
+        0.08106146679532726, 0.04134069595540929, 0.02767792568499834,
+        0.02079067210376509, 0.01664469118982119, 0.01387612882307075,
+        0.01189670994589177, 0.01041126526197209, 0.009255462182712733,
+        0.008330563433362871
+    };
+    if (k < 10) return fc[k];
+    double r = 1.0 / (k + 1.0);
+    double rr = r * r;
+    return (1.0 / 12.0 - (1.0 / 360.0 - rr / 1260.0) * rr) * r;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint RNG::getBinom(uint t, double p)
+{
+    if (t == 0 || p <= 0.0) return 0;
+    if (p >= 1.0) return t;
+    if (p > 0.5) return t - getBinom(t, 1.0 - p);
+
+    double q = 1.0 - p;
+    double n = static_cast<double>(t);
+
+    if (n * p < 10.0)
+    {
+        // Inversion by sequential search from zero. The search is
+        // restarted in the rare case that rounding runs it past t.
+        double s = p / q;
+        double a = (n + 1.0) * s;
+        double r0 = std::pow(q, n);
+        for (;;)
+        {
+            double u = getUnfIE53();
+            double r = r0;
+            uint k = 0;
+            while (u > r && k < t)
+            {
+                u -= r;
+                ++k;
+                r *= (a / k - s);
+            }
+            if (u <= r) return k;
+        }
+    }
+
+    // BTRD: transformed rejection with decomposition (W. Hoermann, "The
+    // generation of binomial random variates", J. Stat. Comput. Simul.
+    // 46, 1993).
+    double m = std::floor((n + 1.0) * p);
+    double r = p / q;
+    double nr = (n + 1.0) * r;
+    double npq = n * p * q;
+    double spq = std::sqrt(npq);
+    double b = 1.15 + 2.53 * spq;
+    double a = -0.0873 + 0.0248 * b + 0.01 * p;
+    double c = n * p + 0.5;
+    double alpha = (2.83 + 5.1 / b) * spq;
+    double vr = 0.92 - 4.2 / b;
+    double urvr = 0.86 * vr;
+
+    for (;;)
+    {
+        double u;
+        double v = getUnfEE();
+        if (v <= urvr)
+        {
+            u = v / vr - 0.43;
+            return static_cast<uint>(std::floor((2.0 * a / (0.5 - std::fabs(u)) + b) * u + c));
+        }
+        if (v >= vr)
+        {
+            u = getUnfEE() - 0.5;
+        }
+        else
+        {
+            u = v / vr - 0.93;
+            u = (u < 0.0 ? -0.5 : 0.5) - u;
+            v = getUnfEE() * vr;
+        }
+
+        double us = 0.5 - std::fabs(u);
+        double kd = std::floor((2.0 * a / us + b) * u + c);
+        if (kd < 0.0 || kd > n) continue;
+        uint k = static_cast<uint>(kd);
+        v = v * alpha / (a / (us * us) + b);
+        double km = std::fabs(kd - m);
+
+        if (km <= 15.0)
+        {
+            // Recursive evaluation of f(k)/f(m).
+            double f = 1.0;
+            if (m < kd)
+            {
+                for (double i = m + 1.0; i <= kd; i += 1.0) f *= (nr / i - r);
+            }
+            else if (m > kd)
+            {
+                for (double i = kd + 1.0; i <= m; i += 1.0) v *= (nr / i - r);
+            }
+            if (v <= f) return k;
+            continue;
+        }
+
+        // Squeeze acceptance and rejection.
+        v = std::log(v);
+        double rho = (km / npq) * (((km / 3.0 + 0.625) * km + 1.0 / 6.0) / npq + 0.5);
+        double tt = -km * km / (2.0 * npq);
+        if (v < tt - rho) return k;
+        if (v > tt + rho) continue;
+
+        // Final acceptance test.
+        uint mi = static_cast<uint>(m);
+        double nm = n - m + 1.0;
+        double h = (m + 0.5) * std::log((m + 1.0) / (r * nm))
+                 + binom_fc(mi) + binom_fc(t - mi);
+        double nk = n - kd + 1.0;
+        if (v <= h + (n + 1.0) * std::log(nm / nk)
+                   + (kd + 0.5) * std::log(nk * r / (kd + 1.0))
+                   - binom_fc(k) - binom_fc(t - k))
+        {
+            return k;
+        }
+    }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -119,6 +119,11 @@ public:
     ///
     float getStdNrm(void);
 
+    /// Get a binomially distributed number of successes in t trials
+    /// with success probability p. The sample is exact.
+    ///
+    uint getBinom(uint t, double p);
+
 protected:
 
     uint                      * rBuffer;
@@ -137,6 +142,21 @@ private:
 
     bool                        pInitialized;
 
+    /// Parameters getPsn() keeps between calls with the same mean, held
+    /// per generator so that separate generators can be used from
+    /// separate threads.
+    struct PsnState
+    {
+        float                   muold;
+        float                   muprev;
+        float                   s, d, omega;
+        float                   b1, b2, c, c0, c1, c2, c3;
+        float                   p, q, p0, pp[35];
+        long                    ll, l, m;
+    };
+
+    PsnState                    pPsn;
+
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -33,7 +33,9 @@
 
 
 // STL headers.
+#include <map>
 #include <string>
+#include <vector>
 
 // STEPS headers.
 #include "../common.h"
@@ -376,6 +378,48 @@ public:
     /// \param n Number of molecules of the species.
     void setTetCount(uint tidx, std::string const & s, double n);
 
+    /// Returns the number of molecules of species s in each of a list of
+    /// voxels.
+    ///
+    /// \param tets Indices of the tetrahedrons.
+    /// \param s Name of the species.
+    std::vector<double> getBatchTetCounts(std::vector<uint> const & tets,
+                                          std::string const & s) const;
+
+    /// Sets the number of molecules of species s in each of a list of
+    /// voxels. Nothing is changed if any index or count is invalid or if
+    /// s is undefined in one of the tetrahedrons.
+    ///
+    /// \param tets Indices of the tetrahedrons.
+    /// \param s Name of the species.
+    /// \param counts Number of molecules in each tetrahedron.
+    void setBatchTetCounts(std::vector<uint> const & tets,
+                           std::string const & s,
+                           std::vector<double> const & counts);
+
+    /// Buffer version of getBatchTetCounts: fills counts[i] with the number
+    /// of molecules of species s in tetrahedron indices[i].
+    ///
+    /// \param indices Indices of the tetrahedrons.
+    /// \param indices_size Number of indices.
+    /// \param s Name of the species.
+    /// \param counts Buffer to fill.
+    /// \param counts_size Size of the buffer; must equal indices_size.
+    void getBatchTetCountsNP(uint const * indices, uint indices_size,
+                             std::string const & s,
+                             double * counts, uint counts_size) const;
+
+    /// Buffer version of setBatchTetCounts.
+    ///
+    /// \param indices Indices of the tetrahedrons.
+    /// \param indices_size Number of indices.
+    /// \param s Name of the species.
+    /// \param counts Number of molecules in each tetrahedron.
+    /// \param counts_size Number of counts; must equal indices_size.
+    void setBatchTetCountsNP(uint const * indices, uint indices_size,
+                             std::string const & s,
+                             double const * counts, uint counts_size);
+
     /// Returns the amount (in mols) of species s in a voxel.
     ///
     /// \param tidx Index of the tetrahedron.
@@ -707,6 +751,48 @@ public:
     /// \param n Number of molecules of the species.
     void setTriCount(uint tidx, std::string const & s, double n);
 
+    /// Returns the number of molecules of species s in each of a list of
+    /// triangles.
+    ///
+    /// \param tris Indices of the triangles.
+    /// \param s Name of the species.
+    std::vector<double> getBatchTriCounts(std::vector<uint> const & tris,
+                                          std::string const & s) const;
+
+    /// Sets the number of molecules of species s in each of a list of
+    /// triangles. Nothing is changed if any index or count is invalid or
+    /// if s is undefined in one of the triangles.
+    ///
+    /// \param tris Indices of the triangles.
+    /// \param s Name of the species.
+    /// \param counts Number of molecules in each triangle.
+    void setBatchTriCounts(std::vector<uint> const & tris,
+                           std::string const & s,
+                           std::vector<double> const & counts);
+
+    /// Buffer version of getBatchTriCounts: fills counts[i] with the number
+    /// of molecules of species s in triangle indices[i].
+    ///
+    /// \param indices Indices of the triangles.
+    /// \param indices_size Number of indices.
+    /// \param s Name of the species.
+    /// \param counts Buffer to fill.
+    /// \param counts_size Size of the buffer; must equal indices_size.
+    void getBatchTriCountsNP(uint const * indices, uint indices_size,
+                             std::string const & s,
+                             double * counts, uint counts_size) const;
+
+    /// Buffer version of setBatchTriCounts.
+    ///
+    /// \param indices Indices of the triangles.
+    /// \param indices_size Number of indices.
+    /// \param s Name of the species.
+    /// \param counts Number of molecules in each triangle.
+    /// \param counts_size Number of counts; must equal indices_size.
+    void setBatchTriCountsNP(uint const * indices, uint indices_size,
+                             std::string const & s,
+                             double const * counts, uint counts_size);
+
     /// Returns the amount (in mols) of species s in a triangle.
     ///
     /// \param tidx Index of the triangle.
@@ -787,6 +873,133 @@ public:
     double getTriSReacA(uint tidx, std::string const & r) const;
 
     ////////////////////////////////////////////////////////////////////////
+    // SOLVER STATE ACCESS:
+    //      RESOLVED HANDLES
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Resolves species s in compartment c into a handle for the
+    /// handle-based accessors below. Handles stay valid for the lifetime
+    /// of the solver, including across reset() and restore(). Resolving
+    /// the same pair again returns the same handle.
+    ///
+    /// \param c Name of the compartment.
+    /// \param s Name of the species.
+    uint getCompSpecHandle(std::string const & c, std::string const & s);
+
+    /// Resolves species s in patch p into a handle.
+    ///
+    /// \param p Name of the patch.
+    /// \param s Name of the species.
+    uint getPatchSpecHandle(std::string const & p, std::string const & s);
+
+    /// Resolves species s in a tetrahedron into a handle.
+    ///
+    /// \param tidx Index of the tetrahedron.
+    /// \param s Name of the species.
+    uint getTetSpecHandle(uint tidx, std::string const & s);
+
+    /// Resolves species s in a triangle into a handle.
+    ///
+    /// \param tidx Index of the triangle.
+    /// \param s Name of the species.
+    uint getTriSpecHandle(uint tidx, std::string const & s);
+
+    /// Resolves reaction r in compartment c into a handle.
+    ///
+    /// \param c Name of the compartment.
+    /// \param r Name of the reaction.
+    uint getCompReacHandle(std::string const & c, std::string const & r);
+
+    /// Resolves surface reaction sr in patch p into a handle.
+    ///
+    /// \param p Name of the patch.
+    /// \param sr Name of the surface reaction.
+    uint getPatchSReacHandle(std::string const & p, std::string const & sr);
+
+    /// Resolves reaction r in a tetrahedron into a handle.
+    ///
+    /// \param tidx Index of the tetrahedron.
+    /// \param r Name of the reaction.
+    uint getTetReacHandle(uint tidx, std::string const & r);
+
+    /// Resolves surface reaction sr in a triangle into a handle.
+    ///
+    /// \param tidx Index of the triangle.
+    /// \param sr Name of the surface reaction.
+    uint getTriSReacHandle(uint tidx, std::string const & sr);
+
+    /// Returns the number of molecules referred to by a species handle.
+    ///
+    /// \param h Species handle.
+    double getCount(uint h) const;
+
+    /// Sets the number of molecules referred to by a species handle.
+    ///
+    /// \param h Species handle.
+    /// \param n Number of molecules.
+    void setCount(uint h, double n);
+
+    /// Returns the concentration (in molar units) referred to by a
+    /// compartment or tetrahedron species handle.
+    ///
+    /// \param h Species handle.
+    double getConc(uint h) const;
+
+    /// Sets the concentration (in molar units) referred to by a
+    /// compartment or tetrahedron species handle.
+    ///
+    /// \param h Species handle.
+    /// \param c Concentration.
+    void setConc(uint h, double c);
+
+    /// Returns whether the species referred to by a handle is clamped.
+    ///
+    /// \param h Species handle.
+    bool getClamped(uint h) const;
+
+    /// Turns clamping of the species referred to by a handle on or off.
+    ///
+    /// \param h Species handle.
+    /// \param b Flag to turn clamping on or off.
+    void setClamped(uint h, bool b);
+
+    /// Returns the macroscopic rate constant referred to by a reaction
+    /// handle.
+    ///
+    /// \param h Reaction handle.
+    double getReacK(uint h) const;
+
+    /// Sets the macroscopic rate constant referred to by a reaction
+    /// handle.
+    ///
+    /// \param h Reaction handle.
+    /// \param kf Rate constant.
+    void setReacK(uint h, double kf);
+
+    /// Returns whether the reaction referred to by a handle is active.
+    ///
+    /// \param h Reaction handle.
+    bool getReacActive(uint h) const;
+
+    /// Activates or deactivates the reaction referred to by a handle.
+    ///
+    /// \param h Reaction handle.
+    /// \param a Flag to activate or deactivate the reaction.
+    void setReacActive(uint h, bool a);
+
+    /// Returns the extent of the compartment reaction or patch surface
+    /// reaction referred to by a handle.
+    ///
+    /// \param h Reaction handle.
+    uint getReacExtent(uint h) const;
+
+    /// Resets the extent of the compartment reaction or patch surface
+    /// reaction referred to by a handle.
+    ///
+    /// \param h Reaction handle.
+    void resetReacExtent(uint h);
+
+    ////////////////////////////////////////////////////////////////////////
 
 protected:
 
@@ -844,6 +1057,16 @@ protected:
     virtual double _getTetCount(uint tidx, uint sidx) const;
     virtual void _setTetCount(uint tidx, uint sidx, double n);
 
+    // Indices and counts have been checked by the caller. The default
+    // implementations loop over _getTetCount / _setTetCount; the setter
+    // reads every entry before writing any. A solver whose _setTetCount
+    // can reject an entry that _getTetCount accepts must override
+    // _setBatchTetCounts to keep it all-or-nothing.
+    virtual void _getBatchTetCounts(uint const * indices, uint n, uint sidx,
+                                    double * counts) const;
+    virtual void _setBatchTetCounts(uint const * indices, uint n, uint sidx,
+                                    double const * counts);
+
     virtual double _getTetAmount(uint tidx, uint sidx) const;
     virtual void _setTetAmount(uint tidx, uint sidx, double m);
 
@@ -926,6 +1149,12 @@ protected:
     virtual double _getTriCount(uint tidx, uint sidx) const;
     virtual void _setTriCount(uint tidx, uint sidx, double n);
 
+    // As for the tetrahedron versions above.
+    virtual void _getBatchTriCounts(uint const * indices, uint n, uint sidx,
+                                    double * counts) const;
+    virtual void _setBatchTriCounts(uint const * indices, uint n, uint sidx,
+                                    double const * counts);
+
     virtual double _getTriAmount(uint tidx, uint sidx) const;
     virtual void _setTriAmount(uint tidx, uint sidx, double m);
 
@@ -976,6 +1205,47 @@ private:
     Statedef *                          pStatedef;						/////////
 
     ////////////////////////////////////////////////////////////////////////
+    // RESOLVED HANDLES
+    ////////////////////////////////////////////////////////////////////////
+
+    enum HandleType
+    {
+        HANDLE_COMP_SPEC,
+        HANDLE_PATCH_SPEC,
+        HANDLE_TET_SPEC,
+        HANDLE_TRI_SPEC,
+        HANDLE_COMP_REAC,
+        HANDLE_PATCH_SREAC,
+        HANDLE_TET_REAC,
+        HANDLE_TRI_SREAC
+    };
+
+    struct Handle
+    {
+        uint                            type;
+        /// Index of the compartment, patch, tetrahedron or triangle.
+        uint                            loc;
+        /// Global index of the species or reaction.
+        uint                            idx;
+
+        bool operator< (Handle const & h) const
+        {
+            if (type != h.type) return type < h.type;
+            if (loc != h.loc) return loc < h.loc;
+            return idx < h.idx;
+        }
+    };
+
+    uint _addHandle(uint type, uint loc, uint idx);
+    Handle const & _handle(uint h) const;
+
+    /// A handle is an index into this table.
+    std::vector<Handle>                 pHandles;
+    /// The handle of each entry in pHandles, so that a triple is only
+    /// added once.
+    std::map<Handle, uint>              pHandleIdcs;
+
+    ////////////////////////////////////////////////////////////////////////
 
 };
 
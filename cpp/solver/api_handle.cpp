@@ -0,0 +1,477 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  Last Changed Rev:  $Rev: 410 $
+ *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
+ *  Last Changed By:   $Author: iain $
+ */
+
+// STL headers.
+#include <map>
+#include <string>
+#include <sstream>
+#include <vector>
+
+// STEPS headers.
+#include "../common.h"
+#include "../error.hpp"
+#include "api.hpp"
+#include "statedef.hpp"
+#include "compdef.hpp"
+#include "patchdef.hpp"
+#include "types.hpp"
+#include "../geom/tetmesh.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+USING(std, string);
+USING_NAMESPACE(steps::solver);
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::_addHandle(uint type, uint loc, uint idx)
+{
+	Handle h;
+	h.type = type;
+	h.loc = loc;
+	h.idx = idx;
+	std::map<Handle, uint>::const_iterator it = pHandleIdcs.find(h);
+	if (it != pHandleIdcs.end())
+	{
+		return it->second;
+	}
+	uint hidx = pHandles.size();
+	pHandles.push_back(h);
+	pHandleIdcs[h] = hidx;
+	return hidx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+API::Handle const & API::_handle(uint h) const
+{
+	if (h >= pHandles.size())
+	{
+		std::ostringstream os;
+		os << "Unknown handle " << h << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return pHandles[h];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getCompSpecHandle(string const & c, string const & s)
+{
+	// the following may throw exceptions if strings are unknown
+	uint cidx = pStatedef->getCompIdx(c);
+	uint sidx = pStatedef->getSpecIdx(s);
+
+	if (pStatedef->compdef(cidx)->specG2L(sidx) == LIDX_UNDEFINED)
+	{
+		std::ostringstream os;
+		os << "Species " << s << " undefined in compartment " << c << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_COMP_SPEC, cidx, sidx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getPatchSpecHandle(string const & p, string const & s)
+{
+	// the following may throw exceptions if strings are unknown
+	uint pidx = pStatedef->getPatchIdx(p);
+	uint sidx = pStatedef->getSpecIdx(s);
+
+	if (pStatedef->patchdef(pidx)->specG2L(sidx) == LIDX_UNDEFINED)
+	{
+		std::ostringstream os;
+		os << "Species " << s << " undefined in patch " << p << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_PATCH_SPEC, pidx, sidx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getTetSpecHandle(uint tidx, string const & s)
+{
+	steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom());
+	if (mesh == 0)
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+	if (tidx >= mesh->countTets())
+	{
+		std::ostringstream os;
+		os << "Tetrahedron index out of range.";
+		throw steps::ArgErr(os.str());
+	}
+	// the following may throw exception if string is unknown
+	uint sidx = pStatedef->getSpecIdx(s);
+
+	if (_getTetSpecDefined(tidx, sidx) == false)
+	{
+		std::ostringstream os;
+		os << "Species " << s << " undefined in tetrahedron " << tidx << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_TET_SPEC, tidx, sidx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getTriSpecHandle(uint tidx, string const & s)
+{
+	steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom());
+	if (mesh == 0)
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+	if (tidx >= mesh->countTris())
+	{
+		std::ostringstream os;
+		os << "Triangle index out of range.";
+		throw steps::ArgErr(os.str());
+	}
+	// the following may throw exception if string is unknown
+	uint sidx = pStatedef->getSpecIdx(s);
+
+	if (_getTriSpecDefined(tidx, sidx) == false)
+	{
+		std::ostringstream os;
+		os << "Species " << s << " undefined in triangle " << tidx << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_TRI_SPEC, tidx, sidx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getCompReacHandle(string const & c, string const & r)
+{
+	// the following may throw exceptions if strings are unknown
+	uint cidx = pStatedef->getCompIdx(c);
+	uint ridx = pStatedef->getReacIdx(r);
+
+	if (pStatedef->compdef(cidx)->reacG2L(ridx) == LIDX_UNDEFINED)
+	{
+		std::ostringstream os;
+		os << "Reaction " << r << " undefined in compartment " << c << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_COMP_REAC, cidx, ridx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getPatchSReacHandle(string const & p, string const & sr)
+{
+	// the following may throw exceptions if strings are unknown
+	uint pidx = pStatedef->getPatchIdx(p);
+	uint sridx = pStatedef->getSReacIdx(sr);
+
+	if (pStatedef->patchdef(pidx)->sreacG2L(sridx) == LIDX_UNDEFINED)
+	{
+		std::ostringstream os;
+		os << "Surface reaction " << sr << " undefined in patch " << p << ".";
+		throw steps::ArgErr(os.str());
+	}
+	return _addHandle(HANDLE_PATCH_SREAC, pidx, sridx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getTetReacHandle(uint tidx, string const & r)
+{
+	steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom());
+	if (mesh == 0)
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+	if (tidx >= mesh->countTets())
+	{
+		std::ostringstream os;
+		os << "Tetrahedron index out of range.";
+		throw steps::ArgErr(os.str());
+	}
+	// the following may throw exception if string is unknown
+	uint ridx = pStatedef->getReacIdx(r);
+
+	// Let the solver check that the reaction is defined in the tetrahedron.
+	_getTetReacK(tidx, ridx);
+	return _addHandle(HANDLE_TET_REAC, tidx, ridx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getTriSReacHandle(uint tidx, string const & sr)
+{
+	steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom());
+	if (mesh == 0)
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+	if (tidx >= mesh->countTris())
+	{
+		std::ostringstream os;
+		os << "Triangle index out of range.";
+		throw steps::ArgErr(os.str());
+	}
+	// the following may throw exception if string is unknown
+	uint sridx = pStatedef->getSReacIdx(sr);
+
+	// Let the solver check that the reaction is defined in the triangle.
+	_getTriSReacK(tidx, sridx);
+	return _addHandle(HANDLE_TRI_SREAC, tidx, sridx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double API::getCount(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: return _getCompCount(hd.loc, hd.idx);
+		case HANDLE_PATCH_SPEC: return _getPatchCount(hd.loc, hd.idx);
+		case HANDLE_TET_SPEC: return _getTetCount(hd.loc, hd.idx);
+		case HANDLE_TRI_SPEC: return _getTriCount(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setCount(uint h, double n)
+{
+	if (n < 0.0)
+	{
+		std::ostringstream os;
+		os << "Number of molecules cannot be negative.";
+		throw steps::ArgErr(os.str());
+	}
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: _setCompCount(hd.loc, hd.idx, n); return;
+		case HANDLE_PATCH_SPEC: _setPatchCount(hd.loc, hd.idx, n); return;
+		case HANDLE_TET_SPEC: _setTetCount(hd.loc, hd.idx, n); return;
+		case HANDLE_TRI_SPEC: _setTriCount(hd.loc, hd.idx, n); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double API::getConc(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: return _getCompConc(hd.loc, hd.idx);
+		case HANDLE_TET_SPEC: return _getTetConc(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species in a volume.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setConc(uint h, double c)
+{
+	if (c < 0.0)
+	{
+		std::ostringstream os;
+		os << "Concentration cannot be negative.";
+		throw steps::ArgErr(os.str());
+	}
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: _setCompConc(hd.loc, hd.idx, c); return;
+		case HANDLE_TET_SPEC: _setTetConc(hd.loc, hd.idx, c); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species in a volume.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool API::getClamped(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: return _getCompClamped(hd.loc, hd.idx);
+		case HANDLE_PATCH_SPEC: return _getPatchClamped(hd.loc, hd.idx);
+		case HANDLE_TET_SPEC: return _getTetClamped(hd.loc, hd.idx);
+		case HANDLE_TRI_SPEC: return _getTriClamped(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setClamped(uint h, bool b)
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_SPEC: _setCompClamped(hd.loc, hd.idx, b); return;
+		case HANDLE_PATCH_SPEC: _setPatchClamped(hd.loc, hd.idx, b); return;
+		case HANDLE_TET_SPEC: _setTetClamped(hd.loc, hd.idx, b); return;
+		case HANDLE_TRI_SPEC: _setTriClamped(hd.loc, hd.idx, b); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a species.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double API::getReacK(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: return _getCompReacK(hd.loc, hd.idx);
+		case HANDLE_PATCH_SREAC: return _getPatchSReacK(hd.loc, hd.idx);
+		case HANDLE_TET_REAC: return _getTetReacK(hd.loc, hd.idx);
+		case HANDLE_TRI_SREAC: return _getTriSReacK(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setReacK(uint h, double kf)
+{
+	if (kf < 0.0)
+	{
+		std::ostringstream os;
+		os << "Reaction constant cannot be negative.";
+		throw steps::ArgErr(os.str());
+	}
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: _setCompReacK(hd.loc, hd.idx, kf); return;
+		case HANDLE_PATCH_SREAC: _setPatchSReacK(hd.loc, hd.idx, kf); return;
+		case HANDLE_TET_REAC: _setTetReacK(hd.loc, hd.idx, kf); return;
+		case HANDLE_TRI_SREAC: _setTriSReacK(hd.loc, hd.idx, kf); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool API::getReacActive(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: return _getCompReacActive(hd.loc, hd.idx);
+		case HANDLE_PATCH_SREAC: return _getPatchSReacActive(hd.loc, hd.idx);
+		case HANDLE_TET_REAC: return _getTetReacActive(hd.loc, hd.idx);
+		case HANDLE_TRI_SREAC: return _getTriSReacActive(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setReacActive(uint h, bool a)
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: _setCompReacActive(hd.loc, hd.idx, a); return;
+		case HANDLE_PATCH_SREAC: _setPatchSReacActive(hd.loc, hd.idx, a); return;
+		case HANDLE_TET_REAC: _setTetReacActive(hd.loc, hd.idx, a); return;
+		case HANDLE_TRI_SREAC: _setTriSReacActive(hd.loc, hd.idx, a); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint API::getReacExtent(uint h) const
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: return _getCompReacExtent(hd.loc, hd.idx);
+		case HANDLE_PATCH_SREAC: return _getPatchSReacExtent(hd.loc, hd.idx);
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a compartment or patch reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::resetReacExtent(uint h)
+{
+	Handle const & hd = _handle(h);
+	switch (hd.type)
+	{
+		case HANDLE_COMP_REAC: _resetCompReacExtent(hd.loc, hd.idx); return;
+		case HANDLE_PATCH_SREAC: _resetPatchSReacExtent(hd.loc, hd.idx); return;
+	}
+	std::ostringstream os;
+	os << "Handle " << h << " does not refer to a compartment or patch reaction.";
+	throw steps::ArgErr(os.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// END
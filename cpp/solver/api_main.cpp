@@ -53,6 +53,7 @@ API::API(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r)
 , pGeom(g)
 , pRNG(r)
 , pStatedef(0)
+, pHandles()
 {
     if (pModel == 0)
     {
@@ -31,6 +31,7 @@
 // STL headers.
 #include <string>
 #include <sstream>
+#include <vector>
 
 
 // STEPS headers.
@@ -176,6 +177,122 @@ void API::setTetCount(uint tidx, string const & s, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+std::vector<double> API::getBatchTetCounts(std::vector<uint> const & tets,
+                                          string const & s) const
+{
+	std::vector<double> counts(tets.size(), 0.0);
+	if (tets.empty())
+	{
+		getBatchTetCountsNP(0, 0, s, 0, 0);
+		return counts;
+	}
+	getBatchTetCountsNP(&tets[0], tets.size(), s, &counts[0], counts.size());
+	return counts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setBatchTetCounts(std::vector<uint> const & tets, string const & s,
+                           std::vector<double> const & counts)
+{
+	if (tets.size() != counts.size())
+	{
+		std::ostringstream os;
+		os << "Length of tetrahedron list and count list differ.";
+		throw steps::ArgErr(os.str());
+	}
+	if (tets.empty())
+	{
+		setBatchTetCountsNP(0, 0, s, 0, 0);
+		return;
+	}
+	setBatchTetCountsNP(&tets[0], tets.size(), s, &counts[0], counts.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::getBatchTetCountsNP(uint const * indices, uint indices_size,
+                             string const & s,
+                             double * counts, uint counts_size) const
+{
+	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
+	{
+		if (indices_size != counts_size)
+		{
+			std::ostringstream os;
+			os << "Length of index buffer and count buffer differ.";
+			throw steps::ArgErr(os.str());
+		}
+		uint ntets = mesh->countTets();
+		for (uint i = 0; i < indices_size; ++i)
+		{
+			if (indices[i] >= ntets)
+			{
+				std::ostringstream os;
+				os << "Tetrahedron index " << indices[i] << " out of range.";
+				throw steps::ArgErr(os.str());
+			}
+		}
+		// the following may throw exception if string is unknown
+		uint sidx = pStatedef->getSpecIdx(s);
+
+		if (indices_size != 0)
+			_getBatchTetCounts(indices, indices_size, sidx, counts);
+	}
+	else
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setBatchTetCountsNP(uint const * indices, uint indices_size,
+                             string const & s,
+                             double const * counts, uint counts_size)
+{
+	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
+	{
+		if (indices_size != counts_size)
+		{
+			std::ostringstream os;
+			os << "Length of index buffer and count buffer differ.";
+			throw steps::ArgErr(os.str());
+		}
+		uint ntets = mesh->countTets();
+		for (uint i = 0; i < indices_size; ++i)
+		{
+			if (indices[i] >= ntets)
+			{
+				std::ostringstream os;
+				os << "Tetrahedron index " << indices[i] << " out of range.";
+				throw steps::ArgErr(os.str());
+			}
+			if (counts[i] < 0.0)
+			{
+				std::ostringstream os;
+				os << "Number of molecules cannot be negative.";
+				throw steps::ArgErr(os.str());
+			}
+		}
+		// the following may throw exception if string is unknown
+		uint sidx = pStatedef->getSpecIdx(s);
+
+		if (indices_size != 0)
+			_setBatchTetCounts(indices, indices_size, sidx, counts);
+	}
+	else
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double API::getTetAmount(uint tidx, string const & s) const
 {
 	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
@@ -706,6 +823,34 @@ void API::_setTetCount(uint tidx, uint sidx, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void API::_getBatchTetCounts(uint const * indices, uint n, uint sidx,
+                            double * counts) const
+{
+	for (uint i = 0; i < n; ++i)
+	{
+		counts[i] = _getTetCount(indices[i], sidx);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::_setBatchTetCounts(uint const * indices, uint n, uint sidx,
+                            double const * counts)
+{
+	// Read every entry first, so that one the solver rejects throws
+	// before anything has been written.
+	for (uint i = 0; i < n; ++i)
+	{
+		_getTetCount(indices[i], sidx);
+	}
+	for (uint i = 0; i < n; ++i)
+	{
+		_setTetCount(indices[i], sidx, counts[i]);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double API::_getTetAmount(uint tidx, uint sidx) const
 {
     throw steps::NotImplErr();
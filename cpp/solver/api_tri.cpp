@@ -31,6 +31,7 @@
 // STL headers.
 #include <string>
 #include <sstream>
+#include <vector>
 
 
 // STEPS headers.
@@ -177,6 +178,122 @@ void API::setTriCount(uint tidx, string const & s, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+std::vector<double> API::getBatchTriCounts(std::vector<uint> const & tris,
+                                          string const & s) const
+{
+	std::vector<double> counts(tris.size(), 0.0);
+	if (tris.empty())
+	{
+		getBatchTriCountsNP(0, 0, s, 0, 0);
+		return counts;
+	}
+	getBatchTriCountsNP(&tris[0], tris.size(), s, &counts[0], counts.size());
+	return counts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setBatchTriCounts(std::vector<uint> const & tris, string const & s,
+                           std::vector<double> const & counts)
+{
+	if (tris.size() != counts.size())
+	{
+		std::ostringstream os;
+		os << "Length of triangle list and count list differ.";
+		throw steps::ArgErr(os.str());
+	}
+	if (tris.empty())
+	{
+		setBatchTriCountsNP(0, 0, s, 0, 0);
+		return;
+	}
+	setBatchTriCountsNP(&tris[0], tris.size(), s, &counts[0], counts.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::getBatchTriCountsNP(uint const * indices, uint indices_size,
+                             string const & s,
+                             double * counts, uint counts_size) const
+{
+	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
+	{
+		if (indices_size != counts_size)
+		{
+			std::ostringstream os;
+			os << "Length of index buffer and count buffer differ.";
+			throw steps::ArgErr(os.str());
+		}
+		uint ntris = mesh->countTris();
+		for (uint i = 0; i < indices_size; ++i)
+		{
+			if (indices[i] >= ntris)
+			{
+				std::ostringstream os;
+				os << "Triangle index " << indices[i] << " out of range.";
+				throw steps::ArgErr(os.str());
+			}
+		}
+		// the following may throw exception if string is unknown
+		uint sidx = pStatedef->getSpecIdx(s);
+
+		if (indices_size != 0)
+			_getBatchTriCounts(indices, indices_size, sidx, counts);
+	}
+	else
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::setBatchTriCountsNP(uint const * indices, uint indices_size,
+                             string const & s,
+                             double const * counts, uint counts_size)
+{
+	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
+	{
+		if (indices_size != counts_size)
+		{
+			std::ostringstream os;
+			os << "Length of index buffer and count buffer differ.";
+			throw steps::ArgErr(os.str());
+		}
+		uint ntris = mesh->countTris();
+		for (uint i = 0; i < indices_size; ++i)
+		{
+			if (indices[i] >= ntris)
+			{
+				std::ostringstream os;
+				os << "Triangle index " << indices[i] << " out of range.";
+				throw steps::ArgErr(os.str());
+			}
+			if (counts[i] < 0.0)
+			{
+				std::ostringstream os;
+				os << "Number of molecules cannot be negative.";
+				throw steps::ArgErr(os.str());
+			}
+		}
+		// the following may throw exception if string is unknown
+		uint sidx = pStatedef->getSpecIdx(s);
+
+		if (indices_size != 0)
+			_setBatchTriCounts(indices, indices_size, sidx, counts);
+	}
+	else
+	{
+		std::ostringstream os;
+		os << "Method not available for this solver.";
+		throw steps::NotImplErr();
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double API::getTriAmount(uint tidx, string const & s) const
 {
 	if (steps::tetmesh::Tetmesh * mesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom()))
@@ -511,6 +628,34 @@ void API::_setTriCount(uint tidx, uint sidx, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void API::_getBatchTriCounts(uint const * indices, uint n, uint sidx,
+                             double * counts) const
+{
+	for (uint i = 0; i < n; ++i)
+	{
+		counts[i] = _getTriCount(indices[i], sidx);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void API::_setBatchTriCounts(uint const * indices, uint n, uint sidx,
+                             double const * counts)
+{
+	// Read every entry first, so that one the solver rejects throws
+	// before anything has been written.
+	for (uint i = 0; i < n; ++i)
+	{
+		_getTriCount(indices[i], sidx);
+	}
+	for (uint i = 0; i < n; ++i)
+	{
+		_setTriCount(indices[i], sidx, counts[i]);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double API::_getTriAmount(uint tidx, uint sidx) const
 {
     throw steps::NotImplErr();
@@ -72,6 +72,8 @@ ssolver::Compdef::Compdef(Statedef * sd, uint idx, steps::wm::Comp * c)
 , pReac_DEP_Spec(0)
 , pReac_LHS_Spec(0)
 , pReac_UPD_Spec(0)
+, pReac_LHS_Sparse(0)
+, pReac_UPD_Sparse(0)
 , pDiffsN(0)
 , pDiff_G2L(0)
 , pDiff_L2G(0)
@@ -110,6 +112,8 @@ ssolver::Compdef::~Compdef(void)
 	delete[] pReac_DEP_Spec;
 	delete[] pReac_LHS_Spec;
 	delete[] pReac_UPD_Spec;
+	delete[] pReac_LHS_Sparse;
+	delete[] pReac_UPD_Sparse;
 	delete[] pDiff_DEP_Spec;
 	delete[] pDiff_LIG;
 	delete[] pPoolFlags;
@@ -262,6 +266,16 @@ void ssolver::Compdef::setup_indices(void)
         		pReac_UPD_Spec[aridx] = rdef->upd(si);
         	}
         }
+
+        // Compact lists of the same information, in local indices.
+        pReac_LHS_Sparse = new SpecCoeffVec[pReacsN];
+        pReac_UPD_Sparse = new SpecCoeffVec[pReacsN];
+        for (uint ri = 0; ri < pReacsN; ++ri)
+        {
+        	Reacdef * rdef = reacdef(ri);
+        	_sparseG2L(rdef->lhsSparse(), pReac_LHS_Sparse[ri]);
+        	_sparseG2L(rdef->updSparse(), pReac_UPD_Sparse[ri]);
+        }
     }
 
     if (pDiffsN != 0)
@@ -466,6 +480,22 @@ int * ssolver::Compdef::reac_upd_end(uint rlidx) const
 }
 ////////////////////////////////////////////////////////////////////////////////
 
+void ssolver::Compdef::_sparseG2L(SpecCoeffVec const & gvec,
+                                  SpecCoeffVec & lvec) const
+{
+	lvec.reserve(gvec.size());
+	SpecCoeffVecCI g_end = gvec.end();
+	for (SpecCoeffVecCI g = gvec.begin(); g != g_end; ++g)
+	{
+		SpecCoeff sc = { pSpec_G2L[g->spec], g->coeff };
+		assert(sc.spec != LIDX_UNDEFINED);
+		lvec.push_back(sc);
+	}
+	std::sort(lvec.begin(), lvec.end(), specCoeffLess);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 int ssolver::Compdef::reac_dep(uint rlidx, uint slidx) const
 {
 	return pReac_DEP_Spec[slidx + ((rlidx) * pSpecsN)];
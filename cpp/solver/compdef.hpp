@@ -41,6 +41,7 @@
 #include "statedef.hpp"
 #include "api.hpp"
 #include "../geom/comp.hpp"
+#include "types.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -224,6 +225,21 @@ public:
     /// \param rlidx Local index of the reaction.
 	int * reac_upd_end(uint rlidx) const;
 
+	/// Return the non-zero entries of the lhs array of reaction specified
+	/// by local index argument, as (local species index, order) pairs.
+    ///
+    /// \param rlidx Local index of the reaction.
+	inline SpecCoeffVec const & reac_lhs_sparse(uint rlidx) const
+	{ return pReac_LHS_Sparse[rlidx]; }
+
+	/// Return the non-zero entries of the update array of reaction
+	/// specified by local index argument, as (local species index, change)
+	/// pairs.
+    ///
+    /// \param rlidx Local index of the reaction.
+	inline SpecCoeffVec const & reac_upd_sparse(uint rlidx) const
+	{ return pReac_UPD_Sparse[rlidx]; }
+
 	/// Return the local index of species of reaction specified by
 	/// local index argument.
     ///
@@ -384,10 +400,18 @@ private:
 	inline uint _IDX_Reac_Spec(uint reac, uint spec) const
 	{ return (pSpecsN * reac) + spec; }
 
+	// Translate a list of (global species index, coefficient) pairs to
+	// local species indices, sorted by local index.
+	void _sparseG2L(SpecCoeffVec const & gvec, SpecCoeffVec & lvec) const;
+
 	int                               * pReac_DEP_Spec;
 	uint                              * pReac_LHS_Spec;
 	int                               * pReac_UPD_Spec;
 
+	// Non-zero entries of the LHS and UPD rows above, one list per reaction.
+	SpecCoeffVec                      * pReac_LHS_Sparse;
+	SpecCoeffVec                      * pReac_UPD_Sparse;
+
     ////////////////////////////////////////////////////////////////////////
     // DATA: DIFFUSION RULES
     ////////////////////////////////////////////////////////////////////////
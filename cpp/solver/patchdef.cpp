@@ -31,6 +31,7 @@
 // STL headers.
 #include <string>
 #include <cassert>
+#include <algorithm>
 
 // STEPS headers.
 #include "../common.h"
@@ -80,6 +81,12 @@ ssolver::Patchdef::Patchdef(Statedef * sd, uint idx, steps::wm::Patch * p)
 , pSReac_UPD_I_Spec(0)
 , pSReac_UPD_S_Spec(0)
 , pSReac_UPD_O_Spec(0)
+, pSReac_LHS_I_Sparse(0)
+, pSReac_LHS_S_Sparse(0)
+, pSReac_LHS_O_Sparse(0)
+, pSReac_UPD_I_Sparse(0)
+, pSReac_UPD_S_Sparse(0)
+, pSReac_UPD_O_Sparse(0)
 {
 	assert(pStatedef != 0);
 	assert(p != 0);
@@ -116,6 +123,12 @@ ssolver::Patchdef::~Patchdef(void)
 	delete[] pSReac_DEP_O_Spec;
 	delete[] pSReac_LHS_O_Spec;
 	delete[] pSReac_UPD_O_Spec;
+	delete[] pSReac_LHS_I_Sparse;
+	delete[] pSReac_LHS_S_Sparse;
+	delete[] pSReac_LHS_O_Sparse;
+	delete[] pSReac_UPD_I_Sparse;
+	delete[] pSReac_UPD_S_Sparse;
+	delete[] pSReac_UPD_O_Sparse;
 	delete[] pPoolCount;
 	delete[] pPoolFlags;
 	delete[] pSReacFlags;
@@ -363,6 +376,30 @@ void ssolver::Patchdef::setup_indices(void)
                 }
             }
         }
+
+        // Compact lists of the same information, in local indices.
+        pSReac_LHS_I_Sparse = new SpecCoeffVec[pSReacsN];
+        pSReac_LHS_S_Sparse = new SpecCoeffVec[pSReacsN];
+        pSReac_LHS_O_Sparse = new SpecCoeffVec[pSReacsN];
+        pSReac_UPD_I_Sparse = new SpecCoeffVec[pSReacsN];
+        pSReac_UPD_S_Sparse = new SpecCoeffVec[pSReacsN];
+        pSReac_UPD_O_Sparse = new SpecCoeffVec[pSReacsN];
+        for (uint ri = 0; ri < pSReacsN; ++ri)
+        {
+            SReacdef * srdef = sreacdef(ri);
+            _sparseG2L(srdef->lhsSparse_S(), 0, pSReac_LHS_S_Sparse[ri]);
+            _sparseG2L(srdef->updSparse_S(), 0, pSReac_UPD_S_Sparse[ri]);
+            if (pInner != 0)
+            {
+                _sparseG2L(srdef->lhsSparse_I(), pInner, pSReac_LHS_I_Sparse[ri]);
+                _sparseG2L(srdef->updSparse_I(), pInner, pSReac_UPD_I_Sparse[ri]);
+            }
+            if (pOuter != 0)
+            {
+                _sparseG2L(srdef->lhsSparse_O(), pOuter, pSReac_LHS_O_Sparse[ri]);
+                _sparseG2L(srdef->updSparse_O(), pOuter, pSReac_UPD_O_Sparse[ri]);
+            }
+        }
     }
 
     // Initialise the pools and flags members to zeros.
@@ -564,6 +601,23 @@ int * ssolver::Patchdef::sreac_upd_O_end(uint lidx) const
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void ssolver::Patchdef::_sparseG2L(SpecCoeffVec const & gvec, Compdef * comp,
+                                   SpecCoeffVec & lvec) const
+{
+    lvec.reserve(gvec.size());
+    SpecCoeffVecCI g_end = gvec.end();
+    for (SpecCoeffVecCI g = gvec.begin(); g != g_end; ++g)
+    {
+        uint lidx = (comp == 0 ? pSpec_G2L[g->spec] : comp->specG2L(g->spec));
+        assert(lidx != LIDX_UNDEFINED);
+        SpecCoeff sc = { lidx, g->coeff };
+        lvec.push_back(sc);
+    }
+    std::sort(lvec.begin(), lvec.end(), specCoeffLess);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void ssolver::Patchdef::setKcst(uint srlidx, double kcst)
 {
 	assert(pSetupRefsdone == true);
@@ -41,6 +41,7 @@
 #include "statedef.hpp"
 #include "api.hpp"
 #include "../geom/patch.hpp"
+#include "types.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -257,6 +258,22 @@ public:
     int * sreac_upd_O_bgn(uint lidx) const;
     int * sreac_upd_O_end(uint lidx) const;
 
+	/// Return the non-zero entries of the lhs and update arrays of surface
+	/// reaction specified by local index argument, as (local species
+	/// index, coefficient) pairs.
+    inline SpecCoeffVec const & sreac_lhs_I_sparse(uint lidx) const
+    { return pSReac_LHS_I_Sparse[lidx]; }
+    inline SpecCoeffVec const & sreac_lhs_S_sparse(uint lidx) const
+    { return pSReac_LHS_S_Sparse[lidx]; }
+    inline SpecCoeffVec const & sreac_lhs_O_sparse(uint lidx) const
+    { return pSReac_LHS_O_Sparse[lidx]; }
+    inline SpecCoeffVec const & sreac_upd_I_sparse(uint lidx) const
+    { return pSReac_UPD_I_Sparse[lidx]; }
+    inline SpecCoeffVec const & sreac_upd_S_sparse(uint lidx) const
+    { return pSReac_UPD_S_Sparse[lidx]; }
+    inline SpecCoeffVec const & sreac_upd_O_sparse(uint lidx) const
+    { return pSReac_UPD_O_Sparse[lidx]; }
+
 	/// Return pointer to flags on surface reactions for this patch.
 	inline uint * srflags(void) const
 	{ return pSReacFlags; }
@@ -392,6 +409,22 @@ private:
     int                               * pSReac_UPD_S_Spec;
     int                               * pSReac_UPD_O_Spec;
 
+    // Non-zero entries of the LHS and UPD rows above, one list per
+    // surface reaction. The inner and outer lists stay empty if the
+    // patch has no such compartment.
+    SpecCoeffVec                      * pSReac_LHS_I_Sparse;
+    SpecCoeffVec                      * pSReac_LHS_S_Sparse;
+    SpecCoeffVec                      * pSReac_LHS_O_Sparse;
+    SpecCoeffVec                      * pSReac_UPD_I_Sparse;
+    SpecCoeffVec                      * pSReac_UPD_S_Sparse;
+    SpecCoeffVec                      * pSReac_UPD_O_Sparse;
+
+    // Translate a list of (global species index, coefficient) pairs to
+    // local species indices of compartment comp, or of the patch itself
+    // if comp is 0, sorted by local index.
+    void _sparseG2L(SpecCoeffVec const & gvec, Compdef * comp,
+                    SpecCoeffVec & lvec) const;
+
     ////////////////////////////////////////////////////////////////////////
 };
 
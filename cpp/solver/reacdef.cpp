@@ -64,6 +64,8 @@ ssolver::Reacdef::Reacdef(Statedef * sd, uint idx, steps::model::Reac * r)
 , pSpec_RHS(0)
 , pSpec_UPD(0)
 , pSpec_UPD_Coll()
+, pLhs_Sparse()
+, pUpd_Sparse()
 {
     assert(pStatedef != 0);
     assert(r != 0);
@@ -140,6 +142,18 @@ void ssolver::Reacdef::setup(void)
 	    int aux = pSpec_UPD[i] = (rhs - lhs);
 	    if (lhs != 0) pSpec_DEP[i] |= DEP_STOICH;
 	    if (aux != 0) pSpec_UPD_Coll.push_back(i);
+
+	    // Compact copies for the solvers' inner loops.
+	    if (lhs != 0)
+	    {
+	        SpecCoeff sc = { i, lhs };
+	        pLhs_Sparse.push_back(sc);
+	    }
+	    if (aux != 0)
+	    {
+	        SpecCoeff sc = { i, aux };
+	        pUpd_Sparse.push_back(sc);
+	    }
 	}
 
 	pSetupdone = true;
@@ -110,6 +110,16 @@ public:
     inline steps::solver::gidxTVecCI endUpdColl(void) const
     { return pSpec_UPD_Coll.end(); }
 
+    /// Return the non-zero entries of the left hand side, as pairs of
+    /// global species index and reactant order.
+    inline steps::solver::SpecCoeffVec const & lhsSparse(void) const
+    { return pLhs_Sparse; }
+
+    /// Return the non-zero entries of the update vector, as pairs of
+    /// global species index and change in population.
+    inline steps::solver::SpecCoeffVec const & updSparse(void) const
+    { return pUpd_Sparse; }
+
     ////////////////////////////////////////////////////////////////////////
     // SOLVER METHODS: SETUP
     ////////////////////////////////////////////////////////////////////////
@@ -144,6 +154,8 @@ private:
     uint                              * pSpec_RHS;
     int                               * pSpec_UPD;
     steps::solver::gidxTVec             pSpec_UPD_Coll;
+    steps::solver::SpecCoeffVec         pLhs_Sparse;
+    steps::solver::SpecCoeffVec         pUpd_Sparse;
 
 };
 
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+/*
+ *  Last Changed Rev:  $Rev: 410 $
+ *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
+ *  Last Changed By:   $Author: iain $
+ */
+
+// STL headers.
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// STEPS headers.
+#include "../common.h"
+#include "../error.hpp"
+#include "api.hpp"
+#include "recorder.hpp"
+
+NAMESPACE_ALIAS(steps::solver, ssolver);
+
+USING(std, string);
+USING(std, vector);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// What an observable samples.
+enum
+{
+    OBS_COUNT = 0,
+    OBS_CONC,
+    OBS_EXTENT
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+ssolver::Recorder::Recorder(ssolver::API * sim)
+: pSim(sim)
+, pObs()
+, pTpnts()
+{
+    assert(pSim != 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ssolver::Recorder::~Recorder(void)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addCompCount(string const & c, string const & s)
+{
+    Obs o = {OBS_COUNT, pSim->getCompSpecHandle(c, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addCompConc(string const & c, string const & s)
+{
+    Obs o = {OBS_CONC, pSim->getCompSpecHandle(c, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addPatchCount(string const & p, string const & s)
+{
+    Obs o = {OBS_COUNT, pSim->getPatchSpecHandle(p, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addTetCount(uint tidx, string const & s)
+{
+    Obs o = {OBS_COUNT, pSim->getTetSpecHandle(tidx, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addTetConc(uint tidx, string const & s)
+{
+    Obs o = {OBS_CONC, pSim->getTetSpecHandle(tidx, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addTriCount(uint tidx, string const & s)
+{
+    Obs o = {OBS_COUNT, pSim->getTriSpecHandle(tidx, s)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addCompReacExtent(string const & c, string const & r)
+{
+    Obs o = {OBS_EXTENT, pSim->getCompReacHandle(c, r)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::addPatchSReacExtent(string const & p, string const & sr)
+{
+    Obs o = {OBS_EXTENT, pSim->getPatchSReacHandle(p, sr)};
+    pObs.push_back(o);
+    _checkLast();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::clearObservables(void)
+{
+    pObs.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::_checkLast(void)
+{
+    assert(pObs.empty() == false);
+    try
+    {
+        _value(pObs.back());
+    }
+    catch (...)
+    {
+        pObs.pop_back();
+        throw;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::setTimePoints(vector<double> const & tpnts)
+{
+    for (uint t = 0; t < tpnts.size(); ++t)
+    {
+        if (tpnts[t] < 0.0 || (t != 0 && tpnts[t] < tpnts[t - 1]))
+        {
+            std::ostringstream os;
+            os << "Time points must be non-negative and in non-decreasing order.";
+            throw steps::ArgErr(os.str());
+        }
+    }
+    pTpnts = tpnts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+vector<double> ssolver::Recorder::run(void)
+{
+    vector<double> out(pTpnts.size() * pObs.size());
+    if (out.empty() == true)
+    {
+        runNP(0, 0);
+        return out;
+    }
+    runNP(&out[0], out.size());
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::runNP(double * counts, uint counts_size)
+{
+    uint nobs = pObs.size();
+    uint ntpnts = pTpnts.size();
+    if (counts_size != ntpnts * nobs)
+    {
+        std::ostringstream os;
+        os << "Length of output buffer must be the number of time points ";
+        os << "times the number of observables (" << ntpnts * nobs << ").";
+        throw steps::ArgErr(os.str());
+    }
+    if (ntpnts != 0 && pTpnts[0] < pSim->getTime())
+    {
+        std::ostringstream os;
+        os << "Time points cannot be before the current simulation time.";
+        throw steps::ArgErr(os.str());
+    }
+
+    for (uint t = 0; t < ntpnts; ++t)
+    {
+        pSim->run(pTpnts[t]);
+        _sample(counts + (t * nobs));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ssolver::Recorder::_sample(double * out) const
+{
+    uint nobs = pObs.size();
+    for (uint o = 0; o < nobs; ++o)
+    {
+        out[o] = _value(pObs[o]);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double ssolver::Recorder::_value(Obs const & ob) const
+{
+    switch (ob.type)
+    {
+        case OBS_COUNT: return pSim->getCount(ob.handle);
+        case OBS_CONC: return pSim->getConc(ob.handle);
+        case OBS_EXTENT: return pSim->getReacExtent(ob.handle);
+    }
+    assert(false);
+    return 0.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// END
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *  Last Changed Rev:  $Rev: 410 $
+ *  Last Changed Date: $Date: 2011-04-07 16:11:28 +0900 (Thu, 07 Apr 2011) $
+ *  Last Changed By:   $Author: iain $
+ */
+
+#ifndef STEPS_SOLVER_RECORDER_HPP
+#define STEPS_SOLVER_RECORDER_HPP 1
+
+
+// STL headers.
+#include <string>
+#include <vector>
+
+// STEPS headers.
+#include "../common.h"
+#include "api.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+START_NAMESPACE(steps)
+START_NAMESPACE(solver)
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Records a time series of observables from a solver.
+///
+/// The observables are resolved into solver handles when they are added,
+/// so bad names or indices raise the usual errors at that point. run()
+/// then advances the solver through all time points and samples every
+/// observable after each, writing into one contiguous buffer without
+/// going back to the caller in between. Works with any solver that
+/// implements the underlying getters (Wmrk4, Wmdirect and Tetexact).
+///
+/// The recorder does not own the solver, which must outlive it.
+///
+class Recorder
+{
+
+public:
+
+    /// Constructor.
+    ///
+    /// \param sim Pointer to the solver to record from.
+    Recorder(API * sim);
+
+    /// Destructor.
+    ~Recorder(void);
+
+    ////////////////////////////////////////////////////////////////////////
+    // OBSERVABLES
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Record the number of molecules of species s in compartment c.
+    void addCompCount(std::string const & c, std::string const & s);
+
+    /// Record the concentration (in molar units) of species s in
+    /// compartment c.
+    void addCompConc(std::string const & c, std::string const & s);
+
+    /// Record the number of molecules of species s in patch p.
+    void addPatchCount(std::string const & p, std::string const & s);
+
+    /// Record the number of molecules of species s in tetrahedron tidx.
+    void addTetCount(uint tidx, std::string const & s);
+
+    /// Record the concentration (in molar units) of species s in
+    /// tetrahedron tidx.
+    void addTetConc(uint tidx, std::string const & s);
+
+    /// Record the number of molecules of species s in triangle tidx.
+    void addTriCount(uint tidx, std::string const & s);
+
+    /// Record the extent of reaction r in compartment c.
+    void addCompReacExtent(std::string const & c, std::string const & r);
+
+    /// Record the extent of surface reaction sr in patch p.
+    void addPatchSReacExtent(std::string const & p, std::string const & sr);
+
+    /// Forget all observables added so far.
+    void clearObservables(void);
+
+    /// Return the number of observables.
+    inline uint countObservables(void) const
+    { return pObs.size(); }
+
+    ////////////////////////////////////////////////////////////////////////
+    // TIME POINTS
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Set the sampling times, which must be non-negative and in
+    /// non-decreasing order.
+    void setTimePoints(std::vector<double> const & tpnts);
+
+    /// Return the sampling times.
+    inline std::vector<double> const & getTimePoints(void) const
+    { return pTpnts; }
+
+    /// Return the number of sampling times.
+    inline uint countTimePoints(void) const
+    { return pTpnts.size(); }
+
+    ////////////////////////////////////////////////////////////////////////
+    // RECORDING
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Run the solver to each time point in turn and return the
+    /// observables sampled there, as a flat list indexed by
+    /// (time point * countObservables()) + observable.
+    std::vector<double> run(void);
+
+    /// Buffer version of run(): writes the samples to counts, which must
+    /// hold countTimePoints() * countObservables() values.
+    ///
+    /// \param counts Output buffer.
+    /// \param counts_size Length of the output buffer.
+    void runNP(double * counts, uint counts_size);
+
+    /// Sample every observable in the current state of the solver and
+    /// write the countObservables() values to out.
+    void _sample(double * out) const;
+
+private:
+
+    ////////////////////////////////////////////////////////////////////////
+
+    /// An observable: what to sample and the solver handle to sample it
+    /// through.
+    struct Obs
+    {
+        uint                            type;
+        uint                            handle;
+    };
+
+    /// Return the current value of one observable.
+    double _value(Obs const & ob) const;
+
+    /// Check the observable just added by sampling it once, and drop it
+    /// again if the solver cannot provide it.
+    void _checkLast(void);
+
+    ////////////////////////////////////////////////////////////////////////
+
+    API                               * pSim;
+    std::vector<Obs>                    pObs;
+    std::vector<double>                 pTpnts;
+
+    ////////////////////////////////////////////////////////////////////////
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+END_NAMESPACE(solver)
+END_NAMESPACE(steps)
+
+#endif
+// STEPS_SOLVER_RECORDER_HPP
+
+// END
@@ -77,6 +77,12 @@ ssolver::SReacdef::SReacdef(Statedef * sd, uint idx, steps::model::SReac * sr)
 , pSpec_I_UPD_Coll()
 , pSpec_S_UPD_Coll()
 , pSpec_O_UPD_Coll()
+, pLhs_I_Sparse()
+, pLhs_S_Sparse()
+, pLhs_O_Sparse()
+, pUpd_I_Sparse()
+, pUpd_S_Sparse()
+, pUpd_O_Sparse()
 {
 
 	assert (pStatedef != 0);
@@ -193,6 +199,15 @@ double ssolver::SReacdef::kcst(void) const
 
 ////////////////////////////////////////////////////////////////////////////////
 
+static inline void _addSparse(ssolver::SpecCoeffVec & v, uint gidx, int coeff)
+{
+    if (coeff == 0) return;
+    ssolver::SpecCoeff sc = { gidx, coeff };
+    v.push_back(sc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void ssolver::SReacdef::setup(void)
 {
 	assert(pSetupdone == false);
@@ -259,6 +274,8 @@ void ssolver::SReacdef::setup(void)
         int aux = pSpec_S_UPD[i] = (rhs - lhs);
         if (lhs != 0) pSpec_S_DEP[i] |= DEP_STOICH;
         if (aux != 0) pSpec_S_UPD_Coll.push_back(i);
+        _addSparse(pLhs_S_Sparse, i, lhs);
+        _addSparse(pUpd_S_Sparse, i, aux);
     }
 
     // Deal with inside.
@@ -269,6 +286,8 @@ void ssolver::SReacdef::setup(void)
         int aux = pSpec_I_UPD[i] = (rhs - lhs);
         if (lhs != 0) pSpec_I_DEP[i] |= DEP_STOICH;
         if (aux != 0) pSpec_I_UPD_Coll.push_back(i);
+        _addSparse(pLhs_I_Sparse, i, lhs);
+        _addSparse(pUpd_I_Sparse, i, aux);
     }
 
     // Deal with outside.
@@ -279,6 +298,8 @@ void ssolver::SReacdef::setup(void)
         int aux = pSpec_O_UPD[i] = (rhs - lhs);
         if (lhs != 0) pSpec_O_DEP[i] |= DEP_STOICH;
         if (aux != 0) pSpec_O_UPD_Coll.push_back(i);
+        _addSparse(pLhs_O_Sparse, i, lhs);
+        _addSparse(pUpd_O_Sparse, i, aux);
     }
 
     pSetupdone = true;
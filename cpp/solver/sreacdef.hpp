@@ -225,6 +225,24 @@ public:
     inline gidxTVecCI endUpdColl_O(void) const
     { return pSpec_O_UPD_Coll.end(); }
 
+    /// Return the non-zero entries of the left hand side (as pairs of
+    /// global species index and reactant order) and of the update vector
+    /// (global species index and change in population) on the inner
+    /// volume (_I), outer volume (_O) or surface patch (_S).
+    ///
+    inline SpecCoeffVec const & lhsSparse_I(void) const
+    { return pLhs_I_Sparse; }
+    inline SpecCoeffVec const & lhsSparse_S(void) const
+    { return pLhs_S_Sparse; }
+    inline SpecCoeffVec const & lhsSparse_O(void) const
+    { return pLhs_O_Sparse; }
+    inline SpecCoeffVec const & updSparse_I(void) const
+    { return pUpd_I_Sparse; }
+    inline SpecCoeffVec const & updSparse_S(void) const
+    { return pUpd_S_Sparse; }
+    inline SpecCoeffVec const & updSparse_O(void) const
+    { return pUpd_O_Sparse; }
+
     ////////////////////////////////////////////////////////////////////////
 
 private:
@@ -308,6 +326,15 @@ private:
     gidxTVec                            pSpec_S_UPD_Coll;
     gidxTVec                            pSpec_O_UPD_Coll;
 
+    /// The non-zero entries of the LHS and update vectors above, indexed
+    /// by global species index.
+    SpecCoeffVec                        pLhs_I_Sparse;
+    SpecCoeffVec                        pLhs_S_Sparse;
+    SpecCoeffVec                        pLhs_O_Sparse;
+    SpecCoeffVec                        pUpd_I_Sparse;
+    SpecCoeffVec                        pUpd_S_Sparse;
+    SpecCoeffVec                        pUpd_O_Sparse;
+
     ////////////////////////////////////////////////////////////////////////
 };
 
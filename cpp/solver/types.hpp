@@ -79,6 +79,27 @@ static const depT DEP_RATE              = 2;
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/// A non-zero entry of a stoichiometry vector: the index of a species
+/// and its coefficient, i.e. the reactant order for a left hand side or
+/// the change in population for an update vector. Whether the index is
+/// global or local depends on the owner of the list.
+///
+struct SpecCoeff
+{
+    uint                                spec;
+    int                                 coeff;
+};
+
+typedef std::vector<SpecCoeff>          SpecCoeffVec;
+typedef SpecCoeffVec::iterator          SpecCoeffVecI;
+typedef SpecCoeffVec::const_iterator    SpecCoeffVecCI;
+
+/// Order stoichiometry entries by species index.
+inline bool specCoeffLess(SpecCoeff const & a, SpecCoeff const & b)
+{ return a.spec < b.spec; }
+
+////////////////////////////////////////////////////////////////////////////////
+
 END_NAMESPACE(solver)
 END_NAMESPACE(steps)
 
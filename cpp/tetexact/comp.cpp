@@ -30,6 +30,7 @@
 
 
 // Standard library & STL headers.
+#include <algorithm>
 #include <vector>
 
 // STEPS headers.
@@ -51,6 +52,10 @@ stex::Comp::Comp(steps::solver::Compdef * compdef)
 : pCompdef(compdef)
 , pVol(0.0)
 , pTets()
+, pCumVol()
+, pTetPools(0)
+, pTetFlags(0)
+, pTotals(0)
 {
 	assert(pCompdef != 0);
 }
@@ -59,6 +64,9 @@ stex::Comp::Comp(steps::solver::Compdef * compdef)
 
 stex::Comp::~Comp(void)
 {
+	delete[] pTetPools;
+	delete[] pTetFlags;
+	delete[] pTotals;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -80,6 +88,62 @@ void stex::Comp::addTet(stex::Tet * tet)
 	assert (tet->compdef() == def());
 	pTets.push_back(tet);
 	pVol += tet->vol();
+	pCumVol.push_back(pVol);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::setupTetPools(void)
+{
+	assert (pTetPools == 0);
+	uint nspecs = def()->countSpecs();
+	uint ntets = countTets();
+	// Never null, so that the matrix has an address even when empty.
+	pTetPools = new uint[ntets * nspecs + 1];
+	std::fill_n(pTetPools, ntets * nspecs + 1, 0);
+	pTetFlags = new uint[ntets * nspecs + 1];
+	std::fill_n(pTetFlags, ntets * nspecs + 1, 0);
+	pTotals = new double[nspecs + 1];
+	std::fill_n(pTotals, nspecs + 1, 0.0);
+	for (uint t = 0; t < ntets; ++t)
+	{
+		pTets[t]->setPoolStorage(pTetPools + t * nspecs,
+		                         pTetFlags + t * nspecs, pTotals);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::reset(void)
+{
+	def()->reset();
+	std::fill_n(pTotals, def()->countSpecs(), 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::recomputeTotals(void)
+{
+	uint nspecs = def()->countSpecs();
+	uint ntets = countTets();
+	std::fill_n(pTotals, nspecs, 0.0);
+	for (uint t = 0; t < ntets; ++t)
+	{
+		uint const * row = pTetPools + t * nspecs;
+		for (uint s = 0; s < nspecs; ++s) pTotals[s] += row[s];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::resetTotalsStorage(void)
+{
+	TetPVecCI t_end = pTets.end();
+	for (TetPVecCI t = pTets.begin(); t != t_end; ++t)
+	{
+		(*t)->setTotalsStorage(pTotals);
+	}
+	recomputeTotals();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -99,17 +163,50 @@ stex::Tet * stex::Comp::pickTetByVol(double rand01) const
 	if (countTets() == 0) return 0;
 	if (countTets() == 1) return pTets[0];
 
-	double accum = 0.0;
+	// First tet whose running volume reaches the selector.
 	double selector = rand01 * vol();
-	TetPVecCI t_end = endTet();
-	for (TetPVecCI t = bgnTet(); t != t_end; ++t)
+	std::vector<double>::const_iterator c =
+		std::lower_bound(pCumVol.begin(), pCumVol.end(), selector);
+	assert(c != pCumVol.end());
+	return pTets[c - pCumVol.begin()];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::pickTetsByVol(uint n, steps::rng::RNG * rng, uint * tidcs) const
+{
+	assert(countTets() != 0 || n == 0);
+	for (uint i = 0; i < n; ++i)
 	{
-		accum += (*t)->vol();
-		if (selector <= accum) return (*t);
+		tidcs[i] = pickTetByVol(rng->getUnfIE())->idx();
 	}
+}
 
-	assert(false);
-	return 0;
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Comp::addCountByVol(uint slidx, uint n, steps::rng::RNG * rng)
+{
+	assert(slidx < def()->countSpecs());
+	uint ntets = countTets();
+	if (ntets == 0) return;
+
+	// Each tet takes a binomial share of what the tets before it left,
+	// with probability equal to its fraction of the remaining volume.
+	double remvol = vol();
+	for (uint t = 0; t < ntets && n != 0; ++t)
+	{
+		Tet * tet = pTets[t];
+		double tvol = tet->vol();
+		uint k = n;
+		if (t + 1 < ntets && tvol < remvol)
+		{
+			k = rng->getBinom(n, tvol / remvol);
+		}
+		remvol -= tvol;
+		if (k == 0) continue;
+		tet->setCount(slidx, tet->pools()[slidx] + k);
+		n -= k;
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
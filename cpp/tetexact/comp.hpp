@@ -44,6 +44,7 @@
 #include "tet.hpp"
 #include "../solver/compdef.hpp"
 #include "../solver/types.hpp"
+#include "../rng/rng.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -94,10 +95,16 @@ public:
     ///
     void addTet(stex::Tet * tet);
 
+    /// Allocate the packed count matrix -- one row per tet, in the
+    /// order they were added, and one column per species defined in the
+    /// comp -- and point each tet's pools into it. To be called
+    /// once, after all tets have been added.
+    ///
+    void setupTetPools(void);
+
     ////////////////////////////////////////////////////////////////////////
 
-    inline void reset(void)
-    { def()->reset(); }
+    void reset(void);
 
     ////////////////////////////////////////////////////////////////////////
     // DATA ACCESS
@@ -119,11 +126,41 @@ public:
 
     stex::Tet * pickTetByVol(double rand01) const;
 
+    /// Add n molecules of species slidx, each placed in a tetrahedron
+    /// picked with probability proportional to its volume. This draws
+    /// the same multinomial distribution as n calls to pickTetByVol, as
+    /// a sequence of conditional binomials in O(ntets) time.
+    void addCountByVol(uint slidx, uint n, steps::rng::RNG * rng);
+
+    /// Pick n tetrahedrons with probability proportional to their
+    /// volume and write their global indices to tidcs.
+    void pickTetsByVol(uint n, steps::rng::RNG * rng, uint * tidcs) const;
+
     inline TetPVecCI bgnTet(void) const
     { return pTets.begin(); }
     inline TetPVecCI endTet(void) const
     { return pTets.end(); }
 
+    /// The packed count matrix of all tetrahedrons in the compartment.
+    /// Its address does not change for the lifetime of the object.
+    inline uint const * tetPools(void) const
+    { return pTetPools; }
+
+    /// Return the total number of molecules of a species over all
+    /// tets, kept up to date by Tet::setCount() and Tet::incCount().
+    ///
+    /// \param slidx Local index of the species.
+    inline double total(uint slidx) const
+    { return pTotals[slidx]; }
+
+    /// Recompute the totals from the counts, e.g. after the counts have
+    /// been restored from a checkpoint.
+    void recomputeTotals(void);
+
+    /// Point the running totals of all tets back at this object and
+    /// recompute them; see Tet::setTotalsStorage().
+    void resetTotalsStorage(void);
+
     ////////////////////////////////////////////////////////////////////////
 
 private:
@@ -134,6 +171,15 @@ private:
     double                              pVol;
 
     TetPVec                             pTets;
+    /// Running sum of the tetrahedron volumes, searched by pickTetByVol.
+    std::vector<double>                 pCumVol;
+
+    /// Packed counts of all tetrahedrons, row-major.
+    uint                              * pTetPools;
+    /// Packed pool flags, laid out like the counts.
+    uint                              * pTetFlags;
+    /// Running totals per species.
+    double                            * pTotals;
 
     ////////////////////////////////////////////////////////////////////////
 
@@ -35,20 +35,38 @@
 #include <fstream>
 #include <iostream>
 #include <cmath>
+#include <limits>
 ////////////////////////////////////////////////////////////////////////////////
 
 START_NAMESPACE(steps)
 START_NAMESPACE(tetexact)
 class KProc;
 
+// Unit roundoff used to bound the drift of the running total propensity.
+const double CR_A0_EPSILON = std::numeric_limits<double>::epsilon();
+
+// Relative error bound on the running total propensity above which it
+// is recomputed exactly from the group sums.
+const double CR_A0_RENORM_TOL = 1.0e-10;
+
+// Member of a CR group. The propensity is kept next to the KProc so
+// that rejection sampling runs over contiguous memory and only touches
+// the KProc that is finally accepted.
+struct CRGroupEntry {
+    double                                  rate;
+    KProc*                                  kproc;
+};
+
 struct CRGroup {
     CRGroup(int power, uint init_size = 1024) {
         max = pow(2, power);
         sum = 0.0;
         capacity = 1024;
         size = 0;
-        indices = (KProc**)malloc(sizeof(KProc*) * init_size);
-        if (indices == NULL) {
+        tree_pos = 0;
+        tree_dirty = false;
+        entries = (CRGroupEntry*)malloc(sizeof(CRGroupEntry) * init_size);
+        if (entries == NULL) {
             std::cerr << "DirectCR: unable to allocate memory for SSA group.\n";
             throw;
         }
@@ -65,7 +83,12 @@ struct CRGroup {
     unsigned                                size;
     double                                  max;
     double                                  sum;
-    KProc**                                 indices;
+    CRGroupEntry*                           entries;
+    
+    // leaf of this group in the group selection tree, and whether the
+    // leaf still has to be refreshed from sum
+    unsigned                                tree_pos;
+    bool                                    tree_dirty;
 };
 
 struct CRKProcData {
@@ -74,12 +97,17 @@ struct CRKProcData {
         pow = 0;
         pos = 0;
         rate = 0.0;
+        upd_gen = 0;
     }
     
     bool                                    recorded;
     int                                     pow;
     unsigned                                pos;
     double                                  rate;
+    
+    // generation of the solver's update list this kproc was last added
+    // to, so that the list never holds it twice
+    unsigned                                upd_gen;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 
 // Standard library & STL headers.
 #include <vector>
+#include <algorithm>
+#include <cmath>
 
 // STEPS headers.
 #include "../common.h"
@@ -52,14 +54,18 @@ NAMESPACE_ALIAS(steps::math, smath);
 ////////////////////////////////////////////////////////////////////////////////
 
 stex::Diff::Diff(ssolver::Diffdef * ddef, stex::Tet * tet)
-: KProc()
+: KProc(KProc::TYPE_DIFF)
 , pDiffdef(ddef)
 , pTet(tet)
-, pUpdVec()
+, pPool(0)
 , pScaledDcst(0.0)
 , pDcst(0.0)
 , pCDFSelector()
 , pNeighbCompLidx()
+, pLeaped(false)
+, pLeapOut()
+, pDomainBnd()
+, pDomainOut()
 {
 	assert(pDiffdef != 0);
 	assert(pTet != 0);
@@ -74,6 +80,7 @@ stex::Diff::Diff(ssolver::Diffdef * ddef, stex::Tet * tet)
     ligGIdx = pDiffdef->lig();
     ssolver::Compdef * cdef = pTet->compdef();
     lidxTet = cdef->specG2L(ligGIdx);
+    pPool = pTet->pools() + lidxTet;
     
     for (uint i = 0; i < 4; ++i) { pDiffBndDirection[i] = pTet->getDiffBndDirection(i);}
 
@@ -167,7 +174,7 @@ void stex::Diff::restore(std::fstream & cp_file)
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Diff::setupDeps(void)
+void stex::Diff::setupDeps(stex::Tetexact * tex)
 {
     // We will check all KProcs of the following simulation elements:
     //   * the 'source' tetrahedron
@@ -182,18 +189,20 @@ void stex::Diff::setupDeps(void)
     // Since there can be no diffusion between tetrahedrons blocked by
     // a triangle, there is no need to filter out duplicate dependent
     // kprocs.
+    //
+    // The four lists are added to the solver's dependency graph as
+    // consecutive rows, starting at pDepRow; a direction without a
+    // neighbour gets an empty row.
 
     // Search for dependencies in the 'source' tetrahedron.
-    std::set<stex::KProc*> local;
-    //std::set<stex::KProc*> local_objs;
+    std::vector<uint> local;
     
     KProcPVecCI kprocend = pTet->kprocEnd();
     for (KProcPVecCI k = pTet->kprocBegin(); k != kprocend; ++k)
     {
         // Check locally.
         if ((*k)->depSpecTet(ligGIdx, pTet) == true) {
-            //local.insert((*k)->getSSARef());
-            local.insert(*k);
+            local.push_back((*k)->schedIDX());
         }
     }
     // Check the neighbouring triangles.
@@ -205,31 +214,35 @@ void stex::Diff::setupDeps(void)
         for (KProcPVecCI k = next->kprocBegin(); k != kprocend; ++k)
         {
             if ((*k)->depSpecTet(ligGIdx, pTet) == true) {
-                //local.insert((*k)->getSSARef());
-                local.insert(*k);
+                local.push_back((*k)->schedIDX());
             }
         }
     }
 
     // Search for dependencies in neighbouring tetrahedra.
+    std::vector<uint> local2;
     for (uint i = 0; i < 4; ++i)
     {
+        local2.clear();
+
         // Fetch next tetrahedron, if it exists.
         stex::Tet * next = pTet->nextTet(i);
-        if (next == 0) continue;
-        if (pTet->nextTri(i) != 0) continue;
+        if (next == 0 || pTet->nextTri(i) != 0)
+        {
+            uint row = tex->addDepRow(local2);
+            if (i == 0) pDepRow = row;
+            continue;
+        }
 
         // Copy local dependencies.
-        std::set<stex::KProc*> local2(local.begin(), local.end());
-        //std::set<stex::KProc*> local2_objs(local_objs.begin(), local_objs.end());
+        local2.assign(local.begin(), local.end());
         
         // Find the ones 'locally' in the next tet.
         kprocend = next->kprocEnd();
         for (KProcPVecCI k = next->kprocBegin(); k != kprocend; ++k)
         {
             if ((*k)->depSpecTet(ligGIdx, next) == true) {
-                //local.insert((*k)->getSSARef());
-                local2.insert(*k);
+                local2.push_back((*k)->schedIDX());
             }
         }
 
@@ -247,16 +260,14 @@ void stex::Diff::setupDeps(void)
             for (KProcPVecCI k = next2->kprocBegin(); k != kprocend; ++k)
             {
                 if ((*k)->depSpecTet(ligGIdx, next) == true) {
-                    //local.insert((*k)->getSSARef());
-                    local2.insert(*k);
+                    local2.push_back((*k)->schedIDX());
                 }
             }
         }
 
-        // Copy the set to the update vector.
-        pUpdVec[i].assign(local2.begin(), local2.end());
-        //pUpdObjVec[i].assign(local2_objs.begin(), local2_objs.end());
-        
+        // Add the list to the dependency graph.
+        uint row = tex->addDepRow(local2);
+        if (i == 0) pDepRow = row;
     }
 }
 
@@ -392,7 +403,7 @@ double stex::Diff::rate(void) const
 
 
     // Compute the rate.
-    double rate = (pScaledDcst) * static_cast<double>(pTet->pools()[lidxTet]);
+    double rate = (pScaledDcst) * static_cast<double>(*pPool);
     assert(std::isnan(rate) == false);
     // Return.
     return rate;
@@ -400,14 +411,140 @@ double stex::Diff::rate(void) const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
+void stex::Diff::_transfer(stex::Tet * nexttet, uint dir, bool clamped)
+{
+    uint nlidx = pNeighbCompLidx[dir];
+    bool nclamped = nexttet->clamped(nlidx);
+
+    // A move within one compartment leaves its total unchanged, so the
+    // pools can be updated directly.
+    if (clamped == false && nclamped == false &&
+        nexttet->compdef() == pTet->compdef())
+    {
+        *pPool -= 1;
+        nexttet->pools()[nlidx] += 1;
+        return;
+    }
+
+    if (nclamped == false) nexttet->incCount(nlidx, 1);
+    if (clamped == false) pTet->incCount(lidxTet, -1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Diff::leapDraw(double dt, steps::rng::RNG * rng)
+{
+    std::fill_n(pLeapOut, 4, 0);
+    uint n = *pPool;
+    if (n == 0 || inactive() || pScaledDcst == 0.0) return;
+
+    uint m = rng->getBinom(n, 1.0 - std::exp(-pScaledDcst * dt));
+    if (m == 0) return;
+
+    // Direction weights from the selector. Only directions that apply()
+    // can pick take part, so rounding in the selector never sends
+    // molecules to a missing neighbour.
+    double w[4] =
+    {
+        pCDFSelector[0],
+        pCDFSelector[1] - pCDFSelector[0],
+        pCDFSelector[2] - pCDFSelector[1],
+        1.0 - pCDFSelector[2]
+    };
+    int last = -1;
+    for (uint i = 0; i < 4; ++i)
+    {
+        bool open = (pTet->nextTet(i) != 0 && pTet->dist(i) > 0.0);
+        if (pDiffBndDirection[i] == true && pDiffBndActive[i] == false) open = false;
+        if (open == false || w[i] <= 0.0) w[i] = 0.0;
+        else last = i;
+    }
+    assert(last >= 0);
+
+    // Conditional binomials give the multinomial split.
+    double wrest = w[0] + w[1] + w[2] + w[3];
+    for (int i = 0; i < last && m != 0; ++i)
+    {
+        if (w[i] == 0.0) continue;
+        uint mi = rng->getBinom(m, w[i] / wrest);
+        pLeapOut[i] = mi;
+        m -= mi;
+        wrest -= w[i];
+    }
+    pLeapOut[last] += m;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Diff::leapApply(std::vector<uint> & rows)
+{
+    uint moved = pLeapOut[0] + pLeapOut[1] + pLeapOut[2] + pLeapOut[3];
+    if (moved == 0) return;
+
+    if (pTet->clamped(lidxTet) == false)
+    {
+        pTet->incCount(lidxTet, -static_cast<int>(moved));
+    }
+    rows.push_back(pTet->specDepRow(lidxTet));
+
+    for (uint i = 0; i < 4; ++i)
+    {
+        if (pLeapOut[i] == 0) continue;
+        stex::Tet * nexttet = pTet->nextTet(i);
+        assert (nexttet != 0);
+        assert (pNeighbCompLidx[i] > -1);
+        uint nlidx = pNeighbCompLidx[i];
+        if (nexttet->clamped(nlidx) == false)
+        {
+            nexttet->incCount(nlidx, pLeapOut[i]);
+        }
+        rows.push_back(nexttet->specDepRow(nlidx));
+        pLeapOut[i] = 0;
+    }
+
+    rExtent += moved;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Diff::domainFlush(std::vector<uint> & rows)
+{
+    for (uint i = 0; i < 4; ++i)
+    {
+        if (pDomainOut[i] == 0) continue;
+        stex::Tet * nexttet = pTet->nextTet(i);
+        assert (nexttet != 0);
+        assert (pNeighbCompLidx[i] > -1);
+        uint nlidx = pNeighbCompLidx[i];
+        if (nexttet->clamped(nlidx) == false)
+        {
+            nexttet->incCount(nlidx, pDomainOut[i]);
+        }
+        rows.push_back(nexttet->specDepRow(nlidx));
+        pDomainOut[i] = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint stex::Diff::_sendAcross(uint dir, bool clamped)
+{
+    if (clamped == false) pTet->incCount(lidxTet, -1);
+    pDomainOut[dir]++;
+    rExtent++;
+    return pTet->specDepRow(lidxTet);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint stex::Diff::apply(steps::rng::RNG * rng)
 {
     //uint lidxTet = this->lidxTet;
     // Pre-fetch some general info.
 
 
     // Apply local change.
-    uint * local = pTet->pools() + lidxTet;
+    uint * local = pPool;
 	bool clamped = pTet->clamped(lidxTet);
 
     if (clamped == false)
@@ -427,16 +564,13 @@ std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
         // So we can assert that nextet 0 does indeed exist
         assert (nexttet != 0);
         assert(pNeighbCompLidx[0] > -1);
+        if (pDomainBnd[0] == true) return _sendAcross(0, clamped);
 
-        if (nexttet->clamped(pNeighbCompLidx[0]) == false)
-        {
-            nexttet->incCount(pNeighbCompLidx[0],1);
-        }
-        if (clamped == false) {pTet->incCount(lidxTet, -1); }
+        _transfer(nexttet, 0, clamped);
 
         rExtent++;
 
-        return pUpdVec[0];
+        return pDepRow + 0;
     }
     else if (sel < pCDFSelector[1])
     {
@@ -447,17 +581,13 @@ std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
         // So we can assert that nextet 1 does indeed exist
         assert (nexttet != 0);
         assert(pNeighbCompLidx[1] > -1);
+        if (pDomainBnd[1] == true) return _sendAcross(1, clamped);
       
-        if (nexttet->clamped(pNeighbCompLidx[1]) == false)
-        {
-            nexttet->incCount(pNeighbCompLidx[1],1);
-        }
-            
-        if (clamped == false) {pTet->incCount(lidxTet, -1); }
+        _transfer(nexttet, 1, clamped);
 
         rExtent++;
 
-        return pUpdVec[1];
+        return pDepRow + 1;
     }
     else if (sel < pCDFSelector[2])
     {
@@ -468,15 +598,11 @@ std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
         // So we can assert that nextet 2 does indeed exist
         assert (nexttet != 0);
         assert(pNeighbCompLidx[2] > -1);
-        if (nexttet->clamped(pNeighbCompLidx[2]) == false)
-        {
-            nexttet->incCount(pNeighbCompLidx[2],1);
-        }
-    
-        if (clamped == false) {pTet->incCount(lidxTet, -1); }
+        if (pDomainBnd[2] == true) return _sendAcross(2, clamped);
+        _transfer(nexttet, 2, clamped);
 
         rExtent++;
-        return pUpdVec[2];
+        return pDepRow + 2;
     }
     else
     {
@@ -487,16 +613,13 @@ std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
         // So we can assert that nextet 3 does indeed exist
         assert (nexttet != 0);
         assert(pNeighbCompLidx[3] > -1);
+        if (pDomainBnd[3] == true) return _sendAcross(3, clamped);
 
-        if (nexttet->clamped(pNeighbCompLidx[3]) == false)
-        {
-            nexttet->incCount(pNeighbCompLidx[3],1);
-        }
-        if (clamped == false) {pTet->incCount(lidxTet, -1); }
+        _transfer(nexttet, 3, clamped);
 
         rExtent++;
     
-        return pUpdVec[3];
+        return pDepRow + 3;
         
 
     }
@@ -505,19 +628,7 @@ std::vector<stex::KProc*> const & stex::Diff::apply(steps::rng::RNG * rng)
     assert(0);
     std::cerr << "Cannot find a suitable direction for diffusion!\n";
     throw;
-    return pUpdVec[0];
-}
-
-////////////////////////////////////////////////////////////////////////////////
-
-uint stex::Diff::updVecSize(void) const
-{
-	uint maxsize = pUpdVec[0].size();
-	for (uint i=1; i <= 3; ++i)
-	{
-		if (pUpdVec[i].size() > maxsize) maxsize = pUpdVec[i].size();
-	}
-	return maxsize;
+    return pDepRow + 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
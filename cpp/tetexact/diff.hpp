@@ -91,14 +91,12 @@ public:
     { return pDcst; }
     void setDcst(double d);
 
-    void setupDeps(void);
+    void setupDeps(steps::tetexact::Tetexact * tex);
     bool depSpecTet(uint gidx, steps::tetexact::Tet * tet);
     bool depSpecTri(uint gidx, steps::tetexact::Tri * tri);
     void reset(void);
     double rate(void) const;
-    std::vector<KProc*> const & apply(steps::rng::RNG * rng);
-
-    uint updVecSize(void) const;
+    uint apply(steps::rng::RNG * rng);
 
     ////////////////////////////////////////////////////////////////////////
 
@@ -107,16 +105,69 @@ public:
     bool getDiffBndActive(uint i) const;
 
     ////////////////////////////////////////////////////////////////////////
+    // LEAPED DIFFUSION
+    ////////////////////////////////////////////////////////////////////////
+
+    /// A leaped diffusion rule is advanced by the solver in fixed time
+    /// steps and takes no part in the SSA, which sees a zero rate.
+    inline bool leaped(void) const
+    { return pLeaped; }
+    inline void setLeaped(bool leaped)
+    { pLeaped = leaped; }
+
+    /// Molecules of the ligand in the source tetrahedron.
+    inline uint count(void) const
+    { return *pPool; }
+
+    /// Draw how many molecules leave the source tetrahedron in each
+    /// direction during dt: a binomial over all molecules, split
+    /// multinomially over the directions. Leaves all counts unchanged,
+    /// so that all rules can draw from the same state.
+    void leapDraw(double dt, steps::rng::RNG * rng);
+
+    /// Move the molecules drawn by leapDraw, and append the rows of the
+    /// solver's dependency graph for the changed pools to rows.
+    void leapApply(std::vector<uint> & rows);
+
+    ////////////////////////////////////////////////////////////////////////
+    // DOMAIN BOUNDARIES
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Mark direction i as crossing into another domain of the parallel
+    /// engine. A molecule that apply() sends across is only removed from
+    /// the source; it is held until domainFlush() delivers it.
+    inline void setDomainBnd(uint i, bool bnd)
+    { pDomainBnd[i] = bnd; }
+    inline bool domainBnd(uint i) const
+    { return pDomainBnd[i]; }
+
+    /// Deliver the molecules held at the domain boundaries, and append the
+    /// rows of the solver's dependency graph for the changed pools to rows.
+    void domainFlush(std::vector<uint> & rows);
+
+    ////////////////////////////////////////////////////////////////////////
 
 private:
 
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Move one molecule from the source tetrahedron to neighbour dir,
+    /// keeping the compartment totals up to date.
+    void _transfer(steps::tetexact::Tet * nexttet, uint dir, bool clamped);
+
+    /// Take one molecule out of the source tetrahedron and hold it for
+    /// neighbour dir in another domain. Returns the dependency row of the
+    /// source pool only, as the neighbour belongs to another domain.
+    uint _sendAcross(uint dir, bool clamped);
+
     ////////////////////////////////////////////////////////////////////////
     
     uint                                ligGIdx;
     uint                                lidxTet;
     steps::solver::Diffdef            * pDiffdef;
     steps::tetexact::Tet              * pTet;
-    std::vector<KProc*>                 pUpdVec[4];
+    // Pool count of the ligand in the source tetrahedron.
+    uint                              * pPool;
 
     // Storing the species local index for each neighbouring tet: Needed
     // because neighbours may belong to different compartments
@@ -133,6 +184,14 @@ private:
     // A flag to see if the species can move between compartments
     bool 								pDiffBndActive[4];
 
+    bool                                pLeaped;
+    // Molecules leaving in each direction, drawn by leapDraw.
+    uint                                pLeapOut[4];
+
+    // Directions into another domain, and the molecules held for them.
+    bool                                pDomainBnd[4];
+    uint                                pDomainOut[4];
+
     // Flags to store if a direction is a diffusion boundary direction
     bool 							    pDiffBndDirection[4];
 
@@ -29,7 +29,7 @@
 // STL headers.
 #include <cassert>
 #include <vector>
-#include <fstream>s
+#include <fstream>
 
 // STEPS headers.
 #include "../common.h"
@@ -109,10 +109,10 @@ public:
     void setTetDirection(uint tet, uint direction);
 
 
-    std::vector<uint> getTets(void) const
+    std::vector<uint> const & getTets(void) const
     { return pTets; }
 
-    std::vector<uint> getTetDirection(void) const
+    std::vector<uint> const & getTetDirection(void) const
     { return pTetDirection; }
 
     ////////////////////////////////////////////////////////////////////////
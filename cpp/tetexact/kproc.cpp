@@ -43,11 +43,13 @@ NAMESPACE_ALIAS(steps::tetexact, stex);
 
 ////////////////////////////////////////////////////////////////////////////////
 
-stex::KProc::KProc(void)
-: rExtent(0)
+stex::KProc::KProc(uint type)
+: crData()
+, rExtent(0)
 , pFlags(0)
 , pSchedIDX(0)
-, crData()
+, pDepRow(0)
+, pType(type)
 {
 }
 
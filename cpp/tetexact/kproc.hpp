@@ -57,6 +57,7 @@ START_NAMESPACE(tetexact)
 class Tet;
 class Tri;
 class KProc;
+class Tetexact;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -76,7 +77,7 @@ public:
     // OBJECT CONSTRUCTION & DESTRUCTION
     ////////////////////////////////////////////////////////////////////////
 
-    KProc(void);
+    KProc(uint type);
     virtual ~KProc(void);
 
     ////////////////////////////////////////////////////////////////////////
@@ -106,20 +107,39 @@ public:
 
     ////////////////////////////////////////////////////////////////////////
 
+    /// Tags for the concrete kinetic process types, allowing the solver
+    /// to dispatch rate() and apply() with a switch instead of a virtual
+    /// call on the SSA hot path.
+    static const uint TYPE_REAC = 0;
+    static const uint TYPE_DIFF = 1;
+    static const uint TYPE_SREAC = 2;
+
+    inline uint type(void) const
+    { return pType; }
+
+    ////////////////////////////////////////////////////////////////////////
+
     uint schedIDX(void) const
     { return pSchedIDX; }
 
     void setSchedIDX(uint idx)
     { pSchedIDX = idx; }
 
+    /// Return the first row of this kproc in the solver's dependency
+    /// graph. Kprocs with several possible outcomes (Diff) own one row
+    /// per outcome, stored consecutively.
+    uint depRow(void) const
+    { return pDepRow; }
+
     ////////////////////////////////////////////////////////////////////////
     // VIRTUAL INTERFACE METHODS
     ////////////////////////////////////////////////////////////////////////
 
     /// This function is called when all kproc objects have been created,
-    /// allowing the kproc to pre-compute its SchedIDXVec.
+    /// allowing the kproc to pre-compute its dependencies and add them
+    /// to the solver's dependency graph (see Tetexact::addDepRow).
     ///
-    virtual void setupDeps(void) = 0;
+    virtual void setupDeps(steps::tetexact::Tetexact * tex) = 0;
 
     virtual bool depSpecTet(uint gidx, steps::tetexact::Tet * tet) = 0;
     virtual bool depSpecTri(uint gidx, steps::tetexact::Tri * tri) = 0;
@@ -144,14 +164,12 @@ public:
     virtual double h(void) const;
 
     /// Apply a single discrete instance of the kinetic process, returning
-    /// a vector of kproc schedule indices that need to be updated as a
-    /// result.
+    /// the row of the solver's dependency graph that lists the kprocs
+    /// that need to be updated as a result.
     ///
     // NOTE: Random number generator available to this function for use
     // by Diff
-    virtual std::vector<KProc*> const & apply(steps::rng::RNG * rng) = 0;
-
-    virtual uint updVecSize(void) const = 0;
+    virtual uint apply(steps::rng::RNG * rng) = 0;
 
     ////////////////////////////////////////////////////////////////////////
 
@@ -183,6 +201,10 @@ protected:
 
     uint                                pSchedIDX;
 
+    uint                                pDepRow;
+
+    uint                                pType;
+
     ////////////////////////////////////////////////////////////////////////
 };
 
@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////////////////////////
+// STEPS - STochastic Engine for Pathway Simulation
+// Copyright (C) 2007-2011Okinawa Institute of Science and Technology, Japan.
+// Copyright (C) 2003-2006University of Antwerp, Belgium.
+//
+// See the file AUTHORS for details.
+//
+// This file is part of STEPS.
+//
+// STEPSis free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// STEPSis distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.If not, see <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ *  Last Changed Rev:  $Rev: 380 $
+ *  Last Changed Date: $Date: 2010-11-03 11:04:45 +0900 (Wed, 03 Nov 2010) $
+ *  Last Changed By:   $Author: wchen $
+ */
+
+#ifndef STEPS_TETEXACT_NSMSTRUCT_HPP
+#define STEPS_TETEXACT_NSMSTRUCT_HPP 1
+
+#include <vector>
+#include <limits>
+#include <cassert>
+
+#include "../common.h"
+#include "../rng/rng.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+START_NAMESPACE(steps)
+START_NAMESPACE(tetexact)
+
+// Forward declarations.
+class Diff;
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Indexed binary min-heap over the next event times of the subvolumes
+// of the next-subvolume method. Subvolume s sits at heap position
+// pPos[s], so that its time can be changed in O(log n). Subvolumes
+// without propensity have an infinite time and sink to the bottom.
+class NSMQueue
+{
+public:
+
+    NSMQueue(void)
+    : pTime()
+    , pHeap()
+    , pPos()
+    {
+    }
+
+    // Resize to n subvolumes, all with an infinite time.
+    inline void init(uint n)
+    {
+        pTime.assign(n, std::numeric_limits<double>::infinity());
+        pHeap.resize(n);
+        pPos.resize(n);
+        for (uint i = 0; i < n; ++i)
+        {
+            pHeap[i] = i;
+            pPos[i] = i;
+        }
+    }
+
+    // Set all times to infinity, keeping the current order.
+    inline void clear(void)
+    {
+        pTime.assign(pTime.size(), std::numeric_limits<double>::infinity());
+    }
+
+    inline uint size(void) const
+    { return pHeap.size(); }
+
+    inline double time(uint s) const
+    { return pTime[s]; }
+
+    // The subvolume with the earliest time. Only valid if size() != 0.
+    inline uint top(void) const
+    { return pHeap[0]; }
+
+    inline double topTime(void) const
+    {
+        if (pHeap.empty()) return std::numeric_limits<double>::infinity();
+        return pTime[pHeap[0]];
+    }
+
+    inline void update(uint s, double t)
+    {
+        assert(s < pTime.size());
+        double old = pTime[s];
+        pTime[s] = t;
+        if (t < old) _up(pPos[s]);
+        else if (t > old) _down(pPos[s]);
+    }
+
+private:
+
+    inline void _place(uint i, uint s)
+    {
+        pHeap[i] = s;
+        pPos[s] = i;
+    }
+
+    inline void _up(uint i)
+    {
+        uint s = pHeap[i];
+        double t = pTime[s];
+        while (i != 0)
+        {
+            uint parent = (i - 1) >> 1;
+            if (pTime[pHeap[parent]] <= t) break;
+            _place(i, pHeap[parent]);
+            i = parent;
+        }
+        _place(i, s);
+    }
+
+    inline void _down(uint i)
+    {
+        uint n = pHeap.size();
+        uint s = pHeap[i];
+        double t = pTime[s];
+        while (true)
+        {
+            uint child = (i << 1) + 1;
+            if (child >= n) break;
+            if (child + 1 < n && pTime[pHeap[child + 1]] < pTime[pHeap[child]])
+                child++;
+            if (t <= pTime[pHeap[child]]) break;
+            _place(i, pHeap[child]);
+            i = child;
+        }
+        _place(i, s);
+    }
+
+    std::vector<double>                     pTime;
+    std::vector<uint>                       pHeap;
+    std::vector<uint>                       pPos;
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// One spatial domain of the parallel engine: a set of subvolumes with
+// its own event queue and random number stream, which one thread runs
+// independently of the other domains between synchronisation points.
+struct NSMDomain
+{
+    // Subvolume subvols[i] has index i in queue.
+    std::vector<uint>                       subvols;
+    NSMQueue                                queue;
+    // Subvolumes with changed kprocs, not yet refreshed.
+    std::vector<uint>                       dirty;
+    // The subvolume being fired, or the number of subvolumes of the
+    // solver outside a step.
+    uint                                    fired;
+    // Change of the propensity sums not yet added to the solver's A0.
+    double                                  a0delta;
+    // Steps taken since the last synchronisation.
+    uint                                    nsteps;
+    steps::rng::RNG                       * rng;
+    // Diffusion rules with a direction into another domain.
+    std::vector<Diff *>                     bndDiffs;
+    // Scratch target of the running compartment and patch totals of
+    // the domain's tets and tris while the domains run concurrently.
+    std::vector<double>                     totals;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+END_NAMESPACE(tetexact)
+END_NAMESPACE(steps)
+
+#endif
+
+// STEPS_TETEXACT_NSMSTRUCT_HPP
+
+// END
@@ -30,6 +30,7 @@
  */
 
 // Standard library & STL headers.
+#include <algorithm>
 #include <vector>
 
 // STEPS headers.
@@ -49,7 +50,12 @@ NAMESPACE_ALIAS(steps::solver, ssolver);
 
 stex::Patch::Patch(ssolver::Patchdef * patchdef)
 : pPatchdef(patchdef)
+, pArea(0.0)
 , pTris()
+, pCumArea()
+, pTriPools(0)
+, pTriFlags(0)
+, pTotals(0)
 {
     assert(pPatchdef != 0);
 }
@@ -58,6 +64,9 @@ stex::Patch::Patch(ssolver::Patchdef * patchdef)
 
 stex::Patch::~Patch(void)
 {
+    delete[] pTriPools;
+    delete[] pTriFlags;
+    delete[] pTotals;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +88,62 @@ void stex::Patch::addTri(stex::Tri * tri)
     assert(tri->patchdef() == def());
     pTris.push_back(tri);
     pArea += tri->area();
+    pCumArea.push_back(pArea);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Patch::setupTriPools(void)
+{
+    assert (pTriPools == 0);
+    uint nspecs = def()->countSpecs();
+    uint ntris = countTris();
+    // Never null, so that the matrix has an address even when empty.
+    pTriPools = new uint[ntris * nspecs + 1];
+    std::fill_n(pTriPools, ntris * nspecs + 1, 0);
+    pTriFlags = new uint[ntris * nspecs + 1];
+    std::fill_n(pTriFlags, ntris * nspecs + 1, 0);
+    pTotals = new double[nspecs + 1];
+    std::fill_n(pTotals, nspecs + 1, 0.0);
+    for (uint t = 0; t < ntris; ++t)
+    {
+        pTris[t]->setPoolStorage(pTriPools + t * nspecs,
+                                 pTriFlags + t * nspecs, pTotals);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Patch::reset(void)
+{
+    def()->reset();
+    std::fill_n(pTotals, def()->countSpecs(), 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Patch::recomputeTotals(void)
+{
+    uint nspecs = def()->countSpecs();
+    uint ntris = countTris();
+    std::fill_n(pTotals, nspecs, 0.0);
+    for (uint t = 0; t < ntris; ++t)
+    {
+        uint const * row = pTriPools + t * nspecs;
+        for (uint s = 0; s < nspecs; ++s) pTotals[s] += row[s];
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Patch::resetTotalsStorage(void)
+{
+    TriPVecCI t_end = pTris.end();
+    for (TriPVecCI t = pTris.begin(); t != t_end; ++t)
+    {
+        (*t)->setTotalsStorage(pTotals);
+    }
+    recomputeTotals();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -98,16 +163,49 @@ stex::Tri * stex::Patch::pickTriByArea(double rand01) const
     if (countTris() == 0) return 0;
     if (countTris() == 1) return pTris[0];
 
-    double accum = 0.0;
+    // First triangle whose running area reaches the selector.
     double selector = rand01 * area();
-    TriPVecCI t_end = endTri();
-    for (TriPVecCI t = bgnTri(); t != t_end; ++t)
+    std::vector<double>::const_iterator c =
+        std::lower_bound(pCumArea.begin(), pCumArea.end(), selector);
+    if (c == pCumArea.end()) --c;
+    return pTris[c - pCumArea.begin()];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Patch::pickTrisByArea(uint n, steps::rng::RNG * rng, uint * tidcs) const
+{
+    assert(countTris() != 0 || n == 0);
+    for (uint i = 0; i < n; ++i)
     {
-        accum += (*t)->area();
-        if (selector <= accum) return *t;
+        tidcs[i] = pickTriByArea(rng->getUnfIE())->idx();
     }
+}
+
+////////////////////////////////////////////////////////////////////////////////
 
-    return *(t_end-1);
+void stex::Patch::addCountByArea(uint slidx, uint n, steps::rng::RNG * rng)
+{
+    assert(slidx < def()->countSpecs());
+    uint ntris = countTris();
+    if (ntris == 0) return;
+
+    // Conditional binomials over the triangles, as in Comp::addCountByVol.
+    double remarea = area();
+    for (uint t = 0; t < ntris && n != 0; ++t)
+    {
+        Tri * tri = pTris[t];
+        double tarea = tri->area();
+        uint k = n;
+        if (t + 1 < ntris && tarea < remarea)
+        {
+            k = rng->getBinom(n, tarea / remarea);
+        }
+        remarea -= tarea;
+        if (k == 0) continue;
+        tri->setCount(slidx, tri->pools()[slidx] + k);
+        n -= k;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
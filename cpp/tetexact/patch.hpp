@@ -44,6 +44,7 @@
 //#include <steps/tetexact/comp.hpp>
 #include "tri.hpp"
 #include "../solver/types.hpp"
+#include "../rng/rng.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -94,10 +95,16 @@ public:
     ///
     void addTri(stex::Tri * tri);
 
+    /// Allocate the packed count matrix -- one row per tri, in the
+    /// order they were added, and one column per species defined in the
+    /// patch -- and point each tri's pools into it. To be called
+    /// once, after all tris have been added.
+    ///
+    void setupTriPools(void);
+
     ////////////////////////////////////////////////////////////////////////
 
-    inline void reset(void)
-    { def()->reset(); }
+    void reset(void);
 
     ////////////////////////////////////////////////////////////////////////
     // DATA ACCESS
@@ -120,11 +127,40 @@ public:
 
     stex::Tri * pickTriByArea(double rand01) const;
 
+    /// Add n molecules of species slidx, each placed in a triangle
+    /// picked with probability proportional to its area; the
+    /// counterpart of Comp::addCountByVol.
+    void addCountByArea(uint slidx, uint n, steps::rng::RNG * rng);
+
+    /// Pick n triangles with probability proportional to their area and
+    /// write their global indices to tidcs.
+    void pickTrisByArea(uint n, steps::rng::RNG * rng, uint * tidcs) const;
+
     inline TriPVecCI bgnTri(void) const
     { return pTris.begin(); }
     inline TriPVecCI endTri(void) const
     { return pTris.end(); }
 
+    /// The packed count matrix of all triangles in the patch.
+    /// Its address does not change for the lifetime of the object.
+    inline uint const * triPools(void) const
+    { return pTriPools; }
+
+    /// Return the total number of molecules of a species over all
+    /// tris, kept up to date by Tri::setCount().
+    ///
+    /// \param slidx Local index of the species.
+    inline double total(uint slidx) const
+    { return pTotals[slidx]; }
+
+    /// Recompute the totals from the counts, e.g. after the counts have
+    /// been restored from a checkpoint.
+    void recomputeTotals(void);
+
+    /// Point the running totals of all tris back at this object and
+    /// recompute them; see Tri::setTotalsStorage().
+    void resetTotalsStorage(void);
+
     ////////////////////////////////////////////////////////////////////////
 
 private:
@@ -135,6 +171,15 @@ private:
     double                              pArea;
 
     TriPVec                             pTris;
+    /// Running sum of the triangle areas, searched by pickTriByArea.
+    std::vector<double>                 pCumArea;
+
+    /// Packed counts of all triangles, row-major.
+    uint                              * pTriPools;
+    /// Packed pool flags, laid out like the counts.
+    uint                              * pTriFlags;
+    /// Running totals per species.
+    double                            * pTotals;
 
 };
 
@@ -73,21 +73,28 @@ static inline double comp_ccst(double kcst, double vol, uint order, double compv
 ////////////////////////////////////////////////////////////////////////////////
 
 stex::Reac::Reac(ssolver::Reacdef * rdef, stex::Tet * tet)
-: KProc()
+: KProc(KProc::TYPE_REAC)
 , pReacdef(rdef)
 , pTet(tet)
-, pUpdVec()
+, pPools(0)
+, pLhs(0)
+, pUpd(0)
 , pCcst(0.0)
 , pKcst(0.0)
 {
 	assert (pReacdef != 0);
 	assert (pTet != 0);
 
-	uint lridx = pTet->compdef()->reacG2L(pReacdef->gidx());
-	double kcst = pTet->compdef()->kcst(lridx);
+	ssolver::Compdef * cdef = pTet->compdef();
+	uint lridx = cdef->reacG2L(pReacdef->gidx());
+	double kcst = cdef->kcst(lridx);
 	pKcst = kcst;
-	pCcst = comp_ccst(kcst, pTet->vol(), pReacdef->order(), pTet->compdef()->vol());
+	pCcst = comp_ccst(kcst, pTet->vol(), pReacdef->order(), cdef->vol());
 	assert (pCcst >= 0.0);
+
+	pPools = pTet->pools();
+	pLhs = &cdef->reac_lhs_sparse(lridx);
+	pUpd = &cdef->reac_upd_sparse(lridx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -149,9 +156,9 @@ void stex::Reac::setKcst(double k)
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Reac::setupDeps(void)
+void stex::Reac::setupDeps(stex::Tetexact * tex)
 {
-    std::set<stex::KProc*> updset;
+    std::vector<uint> updvec;
     ssolver::gidxTVecCI sbgn = pReacdef->bgnUpdColl();
     ssolver::gidxTVecCI send = pReacdef->endUpdColl();
 
@@ -162,8 +169,7 @@ void stex::Reac::setupDeps(void)
         for (ssolver::gidxTVecCI s = sbgn; s != send; ++s)
         {
             if ((*k)->depSpecTet(*s, pTet) == true) {
-                //updset.insert((*k)->getSSARef());
-                updset.insert(*k);
+                updvec.push_back((*k)->schedIDX());
             }
         }
     }
@@ -181,15 +187,13 @@ void stex::Reac::setupDeps(void)
             for (ssolver::gidxTVecCI s = sbgn; s != send; ++s)
             {
                 if ((*k)->depSpecTet(*s, pTet) == true) {
-                    //updset.insert((*k)->getSSARef());
-                    updset.insert(*k);
+                    updvec.push_back((*k)->schedIDX());
                 }
             }
         }
     }
 
-    pUpdVec.assign(updset.begin(), updset.end());
-    //pUpdObjVec.assign(updset_obj.begin(), updset_obj.end());
+    pDepRow = tex->addDepRow(updvec);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -213,19 +217,15 @@ double stex::Reac::rate(void) const
 {
     if (inactive()) return 0.0;
 
-    // Prefetch some variables.
-    ssolver::Compdef * cdef = pTet->compdef();
-    uint nspecs = cdef->countSpecs();
-    uint * lhs_vec = cdef->reac_lhs_bgn(cdef->reacG2L(pReacdef->gidx()));
-    uint * cnt_vec = pTet->pools();
+    uint * cnt_vec = pPools;
 
     // Compute combinatorial part.
     double h_mu = 1.0;
-    for (uint pool = 0; pool < nspecs; ++pool)
+    ssolver::SpecCoeffVecCI l_end = pLhs->end();
+    for (ssolver::SpecCoeffVecCI l = pLhs->begin(); l != l_end; ++l)
     {
-        uint lhs = lhs_vec[pool];
-        if (lhs == 0) continue;
-        uint cnt = cnt_vec[pool];
+        uint lhs = static_cast<uint>(l->coeff);
+        uint cnt = cnt_vec[l->spec];
         if (lhs > cnt)
         {
             h_mu = 0.0;
@@ -264,23 +264,19 @@ double stex::Reac::rate(void) const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-std::vector<stex::KProc*> const & stex::Reac::apply(steps::rng::RNG * rng)
+uint stex::Reac::apply(steps::rng::RNG * rng)
 {
-    uint * local = pTet->pools();
-    ssolver::Compdef * cdef = pTet->compdef();
-    uint l_ridx = cdef->reacG2L(pReacdef->gidx());
-    int * upd_vec = cdef->reac_upd_bgn(l_ridx);
-    uint nspecs = cdef->countSpecs();
-    for (uint i = 0; i < nspecs; ++i)
+    uint * local = pPools;
+    ssolver::SpecCoeffVecCI u_end = pUpd->end();
+    for (ssolver::SpecCoeffVecCI u = pUpd->begin(); u != u_end; ++u)
     {
+        uint i = u->spec;
         if (pTet->clamped(i) == true) continue;
-        int j = upd_vec[i];
-        if (j == 0) continue;
-        int nc = static_cast<int>(local[i]) + j;
+        int nc = static_cast<int>(local[i]) + u->coeff;
         pTet->setCount(i, static_cast<uint>(nc));
     }
     rExtent++;
-    return pUpdVec;
+    return pDepRow;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
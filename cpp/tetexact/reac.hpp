@@ -97,15 +97,12 @@ public:
     // VIRTUAL INTERFACE METHODS
     ////////////////////////////////////////////////////////////////////////
 
-    void setupDeps(void);
+    void setupDeps(steps::tetexact::Tetexact * tex);
     bool depSpecTet(uint gidx, steps::tetexact::Tet * tet);
     bool depSpecTri(uint gidx, steps::tetexact::Tri * tri);
     void reset(void);
     double rate(void) const;
-    std::vector<KProc*> const & apply(steps::rng::RNG * rng);
-
-    uint updVecSize(void) const
-    { return pUpdVec.size(); }
+    uint apply(steps::rng::RNG * rng);
 
     ////////////////////////////////////////////////////////////////////////
 
@@ -120,7 +117,11 @@ private:
 
     steps::solver::Reacdef                              * pReacdef;
     steps::tetexact::Tet                                * pTet;
-    std::vector<KProc*>                                   pUpdVec;
+    // Pool counts of the tetrahedron and the non-zero stoichiometry of
+    // this reaction in its compartment, fetched once at construction.
+    uint                                                * pPools;
+    steps::solver::SpecCoeffVec const                   * pLhs;
+    steps::solver::SpecCoeffVec const                   * pUpd;
     /// Properly scaled reaction constant.
     double                                                pCcst;
     // Also store the K constant for convenience
@@ -85,18 +85,24 @@ static inline double comp_ccst_area(double kcst, double area, uint order)
 ////////////////////////////////////////////////////////////////////////////////
 
 stex::SReac::SReac(ssolver::SReacdef * srdef, stex::Tri * tri)
-: KProc()
+: KProc(KProc::TYPE_SREAC)
 , pSReacdef(srdef)
 , pTri(tri)
-, pUpdVec()
+, pLhs_S(0)
+, pLhs_I(0)
+, pLhs_O(0)
+, pUpd_S(0)
+, pUpd_I(0)
+, pUpd_O(0)
 , pCcst(0.0)
 , pKcst(0.0)
 {
 	assert (pSReacdef != 0);
 	assert (pTri != 0);
 
-	uint lsridx = pTri->patchdef()->sreacG2L(pSReacdef->gidx());
-	double kcst = pTri->patchdef()->kcst(lsridx);
+	ssolver::Patchdef * pdef = pTri->patchdef();
+	uint lsridx = pdef->sreacG2L(pSReacdef->gidx());
+	double kcst = pdef->kcst(lsridx);
 	pKcst = kcst;
 
 	if (pSReacdef->surf_surf() == false)
@@ -123,6 +129,13 @@ stex::SReac::SReac(ssolver::SReacdef * srdef, stex::Tri * tri)
 	}
 
 	assert (pCcst >= 0);
+
+	pLhs_S = &pdef->sreac_lhs_S_sparse(lsridx);
+	pLhs_I = &pdef->sreac_lhs_I_sparse(lsridx);
+	pLhs_O = &pdef->sreac_lhs_O_sparse(lsridx);
+	pUpd_S = &pdef->sreac_upd_S_sparse(lsridx);
+	pUpd_I = &pdef->sreac_upd_I_sparse(lsridx);
+	pUpd_O = &pdef->sreac_upd_O_sparse(lsridx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -229,7 +242,7 @@ void stex::SReac::setKcst(double k)
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::SReac::setupDeps(void)
+void stex::SReac::setupDeps(stex::Tetexact * tex)
 {
     // For all non-zero entries gidx in SReacDef's UPD_S:
     //   Perform depSpecTri(gidx,tri()) for:
@@ -246,9 +259,9 @@ void stex::SReac::setupDeps(void)
     // If outer tetrahedron exists:
     //   Similar to inner tet.
     //
-    // All dependencies are first collected into a std::set, to sort them
-    // and to eliminate duplicates. At the end of the routine, they are
-    // copied into the vector that will be returned during execution.
+    // All dependencies are first collected into a vector. At the end of
+    // the routine, the solver sorts them, eliminates duplicates and
+    // stores them in its dependency graph.
 
     Tet * itet = pTri->iTet();
     Tet * otet = pTri->oTet();
@@ -260,15 +273,14 @@ void stex::SReac::setupDeps(void)
     ssolver::gidxTVecCI o_beg = pSReacdef->beginUpdColl_O();
     ssolver::gidxTVecCI o_end = pSReacdef->endUpdColl_O();
 
-    std::set<stex::KProc*> updset;
+    std::vector<uint> updvec;
     KProcPVecCI kprocend = pTri->kprocEnd();
     for (KProcPVecCI k = pTri->kprocBegin(); k != kprocend; ++k)
     {
         for (ssolver::gidxTVecCI spec = s_beg; spec != s_end; ++spec)
         {
             if ((*k)->depSpecTri(*spec, pTri) == true) {
-                //updset.insert((*k)->getSSARef());
-                updset.insert(*k);
+                updvec.push_back((*k)->schedIDX());
             }
         }
     }
@@ -281,8 +293,7 @@ void stex::SReac::setupDeps(void)
             for (ssolver::gidxTVecCI spec = i_beg; spec != i_end; ++spec)
             {
                 if ((*k)->depSpecTet(*spec, itet) == true) {
-                    //updset.insert((*k)->getSSARef());
-                    updset.insert(*k);
+                    updvec.push_back((*k)->schedIDX());
                 }
             }
         }
@@ -297,8 +308,7 @@ void stex::SReac::setupDeps(void)
                 for (ssolver::gidxTVecCI spec = i_beg; spec != i_end; ++spec)
                 {
                     if ((*k)->depSpecTet(*spec, itet) == true) {
-                        //updset.insert((*k)->getSSARef());
-                        updset.insert(*k);
+                        updvec.push_back((*k)->schedIDX());
                     }
                 }
             }
@@ -313,8 +323,7 @@ void stex::SReac::setupDeps(void)
             for (ssolver::gidxTVecCI spec = o_beg; spec != o_end; ++spec)
             {
                 if ((*k)->depSpecTet(*spec, otet) == true) {
-                    //updset.insert((*k)->getSSARef());
-                    updset.insert(*k);
+                    updvec.push_back((*k)->schedIDX());
                 }
             }
         }
@@ -329,16 +338,14 @@ void stex::SReac::setupDeps(void)
                 for (ssolver::gidxTVecCI spec = o_beg; spec != o_end; ++spec)
                 {
                     if ((*k)->depSpecTet(*spec, otet) == true) {
-                        //updset.insert((*k)->getSSARef());
-                        updset.insert(*k);
+                        updvec.push_back((*k)->schedIDX());
                     }
                 }
             }
         }
     }
 
-    pUpdVec.assign(updset.begin(), updset.end());
-    //pUpdObjVec.assign(updset_obj.begin(), updset_obj.end());
+    pDepRow = tex->addDepRow(updvec);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -383,19 +390,14 @@ double stex::SReac::rate(void) const
 	    //      depending on whether the sreac is inner() or outer()
 	    // Then we multiply with mesoscopic constant.
 
-	    ssolver::Patchdef * pdef = pTri->patchdef();
-	    uint lidx = pdef->sreacG2L(pSReacdef->gidx());
-
 	    double h_mu = 1.0;
 
-	    uint * lhs_s_vec = pdef->sreac_lhs_S_bgn(lidx);
 	    uint * cnt_s_vec = pTri->pools();
-	    uint nspecs_s = pdef->countSpecs();
-	    for (uint s = 0; s < nspecs_s; ++s)
+	    ssolver::SpecCoeffVecCI s_end = pLhs_S->end();
+	    for (ssolver::SpecCoeffVecCI s = pLhs_S->begin(); s != s_end; ++s)
 	    {
-	        uint lhs = lhs_s_vec[s];
-	        if (lhs == 0) continue;
-	        uint cnt = cnt_s_vec[s];
+	        uint lhs = static_cast<uint>(s->coeff);
+	        uint cnt = cnt_s_vec[s->spec];
 	        if (lhs > cnt)
 	        {
 	            return 0.0;
@@ -429,14 +431,12 @@ double stex::SReac::rate(void) const
 
 	    if (pSReacdef->inside())
 	    {
-	        uint * lhs_i_vec = pdef->sreac_lhs_I_bgn(lidx);
 	        uint * cnt_i_vec = pTri->iTet()->pools();
-	        uint nspecs_i = pdef->countSpecs_I();
-	        for (uint s = 0; s < nspecs_i; ++s)
+	        ssolver::SpecCoeffVecCI s_end = pLhs_I->end();
+	        for (ssolver::SpecCoeffVecCI s = pLhs_I->begin(); s != s_end; ++s)
 	        {
-	            uint lhs = lhs_i_vec[s];
-	            if (lhs == 0) continue;
-	            uint cnt = cnt_i_vec[s];
+	            uint lhs = static_cast<uint>(s->coeff);
+	            uint cnt = cnt_i_vec[s->spec];
 	            if (lhs > cnt)
 	            {
 	                return 0.0;
@@ -470,14 +470,12 @@ double stex::SReac::rate(void) const
 	    }
 	    else if (pSReacdef->outside())
 	    {
-	        uint * lhs_o_vec = pdef->sreac_lhs_O_bgn(lidx);
 	        uint * cnt_o_vec = pTri->oTet()->pools();
-	        uint nspecs_o = pdef->countSpecs_O();
-	        for (uint s = 0; s < nspecs_o; ++s)
+	        ssolver::SpecCoeffVecCI s_end = pLhs_O->end();
+	        for (ssolver::SpecCoeffVecCI s = pLhs_O->begin(); s != s_end; ++s)
 	        {
-	            uint lhs = lhs_o_vec[s];
-	            if (lhs == 0) continue;
-	            uint cnt = cnt_o_vec[s];
+	            uint lhs = static_cast<uint>(s->coeff);
+	            uint cnt = cnt_o_vec[s->spec];
 	            if (lhs > cnt)
 	            {
 	                return 0.0;
@@ -515,40 +513,33 @@ double stex::SReac::rate(void) const
 
 ////////////////////////////////////////////////////////////////////////////////
 
-std::vector<stex::KProc*> const & stex::SReac::apply(steps::rng::RNG * rng)
+uint stex::SReac::apply(steps::rng::RNG * rng)
 {
-    ssolver::Patchdef * pdef = pTri->patchdef();
-    uint lidx = pdef->sreacG2L(pSReacdef->gidx());
-
     // Update triangle pools.
-    int * upd_s_vec = pdef->sreac_upd_S_bgn(lidx);
     uint * cnt_s_vec = pTri->pools();
-    uint nspecs_s = pdef->countSpecs();
-    for (uint s = 0; s < nspecs_s; ++s)
+    ssolver::SpecCoeffVecCI s_end = pUpd_S->end();
+    for (ssolver::SpecCoeffVecCI s = pUpd_S->begin(); s != s_end; ++s)
     {
-        if (pTri->clamped(s) == true) continue;
-        int upd = upd_s_vec[s];
-        if (upd == 0) continue;
-        int nc = static_cast<int>(cnt_s_vec[s]) + upd;
+        uint sl = s->spec;
+        if (pTri->clamped(sl) == true) continue;
+        int nc = static_cast<int>(cnt_s_vec[sl]) + s->coeff;
         assert(nc >= 0);
-        pTri->setCount(s, static_cast<uint>(nc));
+        pTri->setCount(sl, static_cast<uint>(nc));
     }
 
     // Update inner tet pools.
     stex::Tet * itet = pTri->iTet();
     if (itet != 0)
     {
-        int * upd_i_vec = pdef->sreac_upd_I_bgn(lidx);
         uint * cnt_i_vec = itet->pools();
-        uint nspecs_i = pdef->countSpecs_I();
-        for (uint s = 0; s < nspecs_i; ++s)
+        ssolver::SpecCoeffVecCI s_end = pUpd_I->end();
+        for (ssolver::SpecCoeffVecCI s = pUpd_I->begin(); s != s_end; ++s)
         {
-            if (itet->clamped(s) == true) continue;
-            int upd = upd_i_vec[s];
-            if (upd == 0) continue;
-            int nc = static_cast<int>(cnt_i_vec[s]) + upd;
+            uint sl = s->spec;
+            if (itet->clamped(sl) == true) continue;
+            int nc = static_cast<int>(cnt_i_vec[sl]) + s->coeff;
             assert(nc >= 0);
-            itet->setCount(s, static_cast<uint>(nc));
+            itet->setCount(sl, static_cast<uint>(nc));
         }
     }
 
@@ -556,24 +547,21 @@ std::vector<stex::KProc*> const & stex::SReac::apply(steps::rng::RNG * rng)
     stex::Tet * otet = pTri->oTet();
     if (otet != 0)
     {
-        int * upd_o_vec = pdef->sreac_upd_O_bgn(lidx);
         uint * cnt_o_vec = otet->pools();
-        uint nspecs_o = pdef->countSpecs_O();
-        for (uint s = 0; s < nspecs_o; ++s)
+        ssolver::SpecCoeffVecCI s_end = pUpd_O->end();
+        for (ssolver::SpecCoeffVecCI s = pUpd_O->begin(); s != s_end; ++s)
         {
-            if (otet->clamped(s) == true) continue;
-            int upd = upd_o_vec[s];
-            if (upd == 0) continue;
-            int nc = static_cast<int>(cnt_o_vec[s]) + upd;
+            uint sl = s->spec;
+            if (otet->clamped(sl) == true) continue;
+            int nc = static_cast<int>(cnt_o_vec[sl]) + s->coeff;
             assert(nc >= 0);
-            otet->setCount(s, static_cast<uint>(nc));
+            otet->setCount(sl, static_cast<uint>(nc));
         }
     }
 
     rExtent++;
 
-    // Update outer tet pools.
-    return pUpdVec;
+    return pDepRow;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
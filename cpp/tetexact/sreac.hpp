@@ -99,15 +99,12 @@ public:
     // VIRTUAL INTERFACE METHODS
     ////////////////////////////////////////////////////////////////////////
 
-    void setupDeps(void);
+    void setupDeps(steps::tetexact::Tetexact * tex);
     bool depSpecTet(uint gidx, steps::tetexact::Tet * tet);
     bool depSpecTri(uint gidx, steps::tetexact::Tri * tri);
     void reset(void);
     double rate(void) const;
-    std::vector<KProc*> const & apply(steps::rng::RNG * rng);
-
-    uint updVecSize(void) const
-    { return pUpdVec.size(); }
+    uint apply(steps::rng::RNG * rng);
 
     ////////////////////////////////////////////////////////////////////////
 
@@ -122,7 +119,14 @@ private:
 
     steps::solver::SReacdef           * pSReacdef;
     steps::tetexact::Tri              * pTri;
-    std::vector<KProc*>                 pUpdVec;
+    // Non-zero stoichiometry of this surface reaction in its patch,
+    // fetched once at construction.
+    steps::solver::SpecCoeffVec const * pLhs_S;
+    steps::solver::SpecCoeffVec const * pLhs_I;
+    steps::solver::SpecCoeffVec const * pLhs_O;
+    steps::solver::SpecCoeffVec const * pUpd_S;
+    steps::solver::SpecCoeffVec const * pUpd_I;
+    steps::solver::SpecCoeffVec const * pUpd_O;
     /// Properly scaled reaction constant.
     double                              pCcst;
     // Store the kcst for convenience
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <functional>
 #include <iostream>
+#include <new>
 
 // STEPS headers.
 #include "../common.h"
@@ -73,7 +74,9 @@ stex::Tet::Tet
 , pDist()
 , pPoolCount(0)
 , pPoolFlags(0)
+, pCompTotals(0)
 , pKProcs()
+, pSpecDepRow(0)
 {
     assert(pCompdef != 0);
 	assert (pVol > 0.0);
@@ -103,11 +106,6 @@ stex::Tet::Tet
     pDist[3] = d3;
 
     // Based on compartment definition, build other structures.
-    uint nspecs = compdef()->countSpecs();
-    pPoolCount = new uint[nspecs];
-    pPoolFlags = new uint[nspecs];
-    std::fill_n(pPoolCount, nspecs, 0);
-    std::fill_n(pPoolFlags, nspecs, 0);
     std::fill_n(pDiffBndDirection, 4, false);
     pKProcs.resize(compdef()->countDiffs() + compdef()->countReacs());
 
@@ -117,13 +115,10 @@ stex::Tet::Tet
 
 stex::Tet::~Tet(void)
 {
-    // Delete species pool information.
-    delete[] pPoolCount;
-    delete[] pPoolFlags;
-
-    // Delete diffusion rules.
+    // Destroy the kinetic processes; their memory belongs to the
+    // solver's kproc arena.
     KProcPVecCI e = pKProcs.end();
-    for (KProcPVecCI i = pKProcs.begin(); i != e; ++i) delete *i;
+    for (KProcPVecCI i = pKProcs.begin(); i != e; ++i) (*i)->~KProc();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -203,7 +198,8 @@ void stex::Tet::setupKProcs(stex::Tetexact * tex)
     for (uint i = 0; i < ndiffs; ++i)
     {
         ssolver::Diffdef * ddef = compdef()->diffdef(i);
-        stex::Diff * d = new stex::Diff(ddef, this);
+        void * mem = tex->_allocKProc(sizeof(stex::Diff));
+        stex::Diff * d = new (mem) stex::Diff(ddef, this);
         pKProcs[j++] = d;
         tex->addKProc(d);
     }
@@ -213,7 +209,8 @@ void stex::Tet::setupKProcs(stex::Tetexact * tex)
     for (uint i = 0; i < nreacs; ++i)
     {
         ssolver::Reacdef * rdef = compdef()->reacdef(i);
-        stex::Reac * r = new stex::Reac(rdef, this);
+        void * mem = tex->_allocKProc(sizeof(stex::Reac));
+        stex::Reac * r = new (mem) stex::Reac(rdef, this);
         pKProcs[j++] = r;
         tex->addKProc(r);
     }
@@ -238,15 +235,8 @@ void stex::Tet::setCount(uint lidx, uint count)
 	uint oldcount = pPoolCount[lidx];
 	pPoolCount[lidx] = count;
 
-	/*
-	// 16/01/10 IH: Counts now not stored in compartment object.
-	// Now update the count in this tet's comp
-	int diff = count - oldcount;
-	double newcount = (compdef()->pools()[lidx]) + static_cast<double>(diff);
-	// Compdef method will do the checking on the double argument
-	// (should be positive or zero!)
-	compdef()->setCount(lidx, newcount);
-	*/
+	// Keep the running total of the compartment up to date.
+	pCompTotals[lidx] += static_cast<double>(count) - static_cast<double>(oldcount);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -256,11 +246,7 @@ void stex::Tet::incCount(uint lidx, int inc)
 	assert (lidx < compdef()->countSpecs());
 	pPoolCount[lidx] += inc;
 	assert(pPoolCount[lidx] >= 0);
-
-	/* 16/01/10 IH: Counts now not stored in compartment object.
-	compdef()->setCount(lidx, (compdef()->pools()[lidx] + static_cast<double>(inc)));
-	assert(compdef()->pools()[lidx] >= 0.0);
-	*/
+	pCompTotals[lidx] += inc;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +160,15 @@ public:
 
     inline uint * pools(void) const
     { return pPoolCount; }
+    /// Set the storage of the molecule counts, of the pool flags and of
+    /// the running totals of the comp, which setCount() keeps up to date.
+    /// Called once during setup by the Comp object, which owns the memory.
+    inline void setPoolStorage(uint * counts, uint * flags, double * totals)
+    { pPoolCount = counts; pPoolFlags = flags; pCompTotals = totals; }
+    /// Redirect the running totals, e.g. to a scratch array while the
+    /// parallel engine updates several tets at once.
+    inline void setTotalsStorage(double * totals)
+    { pCompTotals = totals; }
     void setCount(uint lidx, uint count);
 	void incCount(uint lidx, int inc);
 
@@ -178,6 +187,15 @@ public:
     inline uint countKProcs(void) const
     { return pKProcs.size(); }
 
+    /// Return the row of the solver's dependency graph listing the
+    /// kprocs whose rate reads species lidx of this tetrahedron.
+    inline uint specDepRow(uint lidx) const
+    { return pSpecDepRow + lidx; }
+    /// Set the first of the consecutive per-species rows; called once
+    /// by the solver during setup.
+    inline void setSpecDepRow(uint row)
+    { pSpecDepRow = row; }
+
     stex::Diff * diff(uint lidx) const;
     stex::Reac * reac(uint lidx) const;
 
@@ -221,13 +239,20 @@ private:
     double                              pAreas[4];
     double                              pDist[4];
 
-    /// Numbers of molecules -- stored as uint.
+    /// Numbers of molecules -- stored as uint. Points into the packed
+    /// count matrix of the owning Comp.
     uint                              * pPoolCount;
-    /// Flags on these pools -- stored as machine word flags.
+    /// Flags on these pools -- stored as machine word flags. Points into
+    /// the packed flag matrix of the owning Comp.
     uint                              * pPoolFlags;
+    /// Running totals of the owning Comp, indexed like pPoolCount.
+    double                            * pCompTotals;
 
-    /// The kinetic processes.
+    /// The kinetic processes. They live in the kproc arena of the
+    /// solver, which frees the memory.
     std::vector<stex::KProc *>          pKProcs;
+    /// First row of the per-species dependency rows.
+    uint                                pSpecDepRow;
 
     /// Flag if a direction is a diffusion boundary direction
     bool  								pDiffBndDirection[4];
@@ -40,6 +40,13 @@
 #include <queue>
 #include <fstream>
 #include <iomanip>
+#include <new>
+
+// System headers.
+#ifndef _WIN32
+#define STEPS_TETEXACT_THREADS 1
+#include <pthread.h>
+#endif
 
 // STEPS headers.
 #include "../common.h"
@@ -61,6 +68,7 @@
 #include "../solver/reacdef.hpp"
 #include "../solver/sreacdef.hpp"
 #include "../solver/diffdef.hpp"
+#include "../solver/specdef.hpp"
 #include "../solver/types.hpp"
 #include "../geom/tetmesh.hpp"
 #include "../geom/tet.hpp"
@@ -90,6 +98,248 @@ struct DeleteArray
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/// Orders tets by one coordinate of their barycenter.
+///
+struct BarycLess
+{
+    std::vector<double> const & baryc;
+    uint axis;
+
+    BarycLess(std::vector<double> const & b, uint a)
+    : baryc(b)
+    , axis(a)
+    {
+    }
+
+    bool operator() (uint t1, uint t2) const
+    { return baryc[t1 * 3 + axis] < baryc[t2 * 3 + axis]; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Orders tets (or triangles) by a precomputed key.
+///
+struct KeyLess
+{
+    std::vector<uint> const & key;
+
+    KeyLess(std::vector<uint> const & k)
+    : key(k)
+    {
+    }
+
+    bool operator() (uint t1, uint t2) const
+    { return key[t1] < key[t2]; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Distance along a Hilbert curve through a 1024^3 grid of the point with
+/// grid coordinates x (each below 1024). Uses Skilling's algorithm
+/// (AIP Conf. Proc. 707, 2004): the coordinates are turned into the
+/// transposed Hilbert index in place and its bits are then interleaved.
+///
+static uint hilbert_key(uint x[3])
+{
+    const uint bits = 10;
+    const uint m = 1u << (bits - 1);
+
+    // Inverse undo.
+    for (uint q = m; q > 1; q >>= 1)
+    {
+        uint p = q - 1;
+        for (uint i = 0; i < 3; ++i)
+        {
+            if (x[i] & q) x[0] ^= p;
+            else
+            {
+                uint t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode.
+    for (uint i = 1; i < 3; ++i) x[i] ^= x[i - 1];
+    uint t = 0;
+    for (uint q = m; q > 1; q >>= 1)
+    {
+        if (x[2] & q) t ^= q - 1;
+    }
+    for (uint i = 0; i < 3; ++i) x[i] ^= t;
+
+    uint key = 0;
+    for (int b = bits - 1; b >= 0; --b)
+    {
+        for (uint i = 0; i < 3; ++i)
+        {
+            key = (key << 1) | ((x[i] >> b) & 1u);
+        }
+    }
+    return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Split the groups of tets in [bgn, end), each named by one of its tets,
+/// into n domains, starting at domain first, by recursive coordinate
+/// bisection on their centroids: each cut is made across the longest side
+/// of the bounding box, so that the number of tets on either side is in
+/// proportion to the number of domains there.
+///
+static void par_bisect(std::vector<uint>::iterator bgn,
+                       std::vector<uint>::iterator end,
+                       uint first, uint n,
+                       std::vector<double> const & baryc,
+                       std::vector<uint> const & weight,
+                       std::vector<uint> & tetdomain)
+{
+    if (n == 1 || end - bgn < 2)
+    {
+        for (std::vector<uint>::iterator t = bgn; t != end; ++t)
+        {
+            tetdomain[*t] = first;
+        }
+        return;
+    }
+
+    double lo[3], hi[3];
+    for (uint a = 0; a < 3; ++a)
+    {
+        lo[a] = std::numeric_limits<double>::infinity();
+        hi[a] = -std::numeric_limits<double>::infinity();
+    }
+    for (std::vector<uint>::iterator t = bgn; t != end; ++t)
+    {
+        for (uint a = 0; a < 3; ++a)
+        {
+            lo[a] = std::min(lo[a], baryc[*t * 3 + a]);
+            hi[a] = std::max(hi[a], baryc[*t * 3 + a]);
+        }
+    }
+    uint axis = 0;
+    for (uint a = 1; a < 3; ++a)
+    {
+        if (hi[a] - lo[a] > hi[axis] - lo[axis]) axis = a;
+    }
+
+    std::sort(bgn, end, BarycLess(baryc, axis));
+    double total = 0.0;
+    for (std::vector<uint>::iterator t = bgn; t != end; ++t)
+    {
+        total += weight[*t];
+    }
+
+    // Cut where the running weight reaches the share of the lower half,
+    // leaving at least one group on either side.
+    uint nlo = n / 2;
+    double target = (total * nlo) / n;
+    double sum = weight[*bgn];
+    std::vector<uint>::iterator mid = bgn + 1;
+    while (mid != end - 1 && sum + weight[*mid] <= target)
+    {
+        sum += weight[*mid];
+        ++mid;
+    }
+    par_bisect(bgn, mid, first, nlo, baryc, weight, tetdomain);
+    par_bisect(mid, end, first + nlo, n - nlo, baryc, weight, tetdomain);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Root of t in a union-find forest, halving the path on the way.
+///
+static uint par_find(std::vector<uint> & parent, uint t)
+{
+    while (parent[t] != t)
+    {
+        parent[t] = parent[parent[t]];
+        t = parent[t];
+    }
+    return t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef STEPS_TETEXACT_THREADS
+
+struct ParWorkerArg
+{
+    stex::Tetexact                    * solver;
+    uint                                worker;
+};
+
+/// Worker threads of the parallel engine. Each round the calling thread
+/// sets endtime, bumps generation and waits until pending drops to zero.
+///
+struct stex::ParPool
+{
+    pthread_mutex_t                     lock;
+    pthread_cond_t                      start;
+    pthread_cond_t                      done;
+    /// All below are guarded by lock.
+    uint                                generation;
+    uint                                pending;
+    bool                                quit;
+    double                              endtime;
+
+    std::vector<pthread_t>              threads;
+    std::vector<ParWorkerArg>           args;
+};
+
+static void * par_worker(void * arg)
+{
+    ParWorkerArg * wa = static_cast<ParWorkerArg *>(arg);
+    wa->solver->_parWork(wa->worker);
+    return 0;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Propensity and application of a kinetic process, dispatched on its type
+/// tag. The qualified calls bypass the vtable on the SSA hot path.
+///
+static inline double kproc_rate(stex::KProc * kp)
+{
+    switch (kp->type())
+    {
+        case stex::KProc::TYPE_REAC:
+            return static_cast<stex::Reac*>(kp)->stex::Reac::rate();
+        case stex::KProc::TYPE_DIFF:
+        {
+            stex::Diff * diff = static_cast<stex::Diff*>(kp);
+            // Leaped diffusion is advanced outside the SSA.
+            if (diff->leaped()) return 0.0;
+            return diff->stex::Diff::rate();
+        }
+        case stex::KProc::TYPE_SREAC:
+            return static_cast<stex::SReac*>(kp)->stex::SReac::rate();
+    }
+    return kp->rate();
+}
+
+static inline uint kproc_apply
+(
+    stex::KProc * kp, steps::rng::RNG * rng
+)
+{
+    switch (kp->type())
+    {
+        case stex::KProc::TYPE_REAC:
+            return static_cast<stex::Reac*>(kp)->stex::Reac::apply(rng);
+        case stex::KProc::TYPE_DIFF:
+            return static_cast<stex::Diff*>(kp)->stex::Diff::apply(rng);
+        case stex::KProc::TYPE_SREAC:
+            return static_cast<stex::SReac*>(kp)->stex::SReac::apply(rng);
+    }
+    return kp->apply(rng);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void stex::schedIDXSet_To_Vec(stex::SchedIDXSet const & s, stex::SchedIDXVec & v)
 {
     v.resize(s.size());
@@ -98,17 +348,59 @@ void stex::schedIDXSet_To_Vec(stex::SchedIDXSet const & s, stex::SchedIDXVec & v
 
 ////////////////////////////////////////////////////////////////////////////////
 
-stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r)
+stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r,
+                         bool reorder)
 : API(m, g, r)
 , pMesh(0)
-, pKProcs()
 , pComps()
 , pCompMap()
 , pPatches()
 , pDiffBoundaries()
 , pTets()
 , pTris()
+, pTetOrder()
+, pTriOrder()
+, pTetArena(0)
+, pTetArenaUsed(0)
+, pTriArena(0)
+, pTriArenaUsed(0)
 , pA0(0.0)
+, pA0Err(0.0)
+, pA0Renorms(0)
+, pKProcs()
+, pKProcArena(0)
+, pKProcArenaSize(0)
+, pKProcArenaUsed(0)
+, pDepOffsets()
+, pDepIdx()
+, pTreeLeaves(0)
+, pGroupTree()
+, pTreeGroups()
+, pDirtyGroups()
+, pLeapDT(0.0)
+, pLeapNext(0.0)
+, pLeapThreshold(0)
+, pLeapSpec()
+, pLeapDiffs()
+, pLeapRows()
+, pUpdList()
+, pUpdGen(0)
+, pUpdAllocs(0)
+, pEngine(ENGINE_CR)
+, pNSMOffsets()
+, pNSMSubvol()
+, pNSMSum()
+, pNSMQueue()
+, pNSMDirty()
+, pNSMIsDirty()
+, pNSMFired(0)
+, pParDomains()
+, pParDomainOf()
+, pParLocal()
+, pParTetDomain()
+, pParDT(0.0)
+, pParRows()
+, pParPool(0)
 {
 	// Perform upcast.
 	pMesh = dynamic_cast<steps::tetmesh::Tetmesh*>(geom());
@@ -169,6 +461,49 @@ stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rn
     }
     uint ncomps = pComps.size();
     assert (mesh()->_countComps() == ncomps);
+    uint npatches = pPatches.size();
+    assert (mesh()->_countPatches() == npatches);
+
+    // Count the tets and tris that belong to a comp or patch, so that
+    // each kind can be laid out in a single arena.
+    uint ncomptets = 0;
+    for (uint c = 0; c < ncomps; ++c)
+    {
+        steps::tetmesh::TmComp * tmcomp =
+            dynamic_cast<steps::tetmesh::TmComp*>(mesh()->_getComp(c));
+        ncomptets += tmcomp->countTets();
+    }
+    uint npatchtris = 0;
+    for (uint p = 0; p < npatches; ++p)
+    {
+        steps::tetmesh::TmPatch * tmpatch =
+            dynamic_cast<steps::tetmesh::TmPatch*>(mesh()->_getPatch(p));
+        npatchtris += tmpatch->_getAllTriIndices().size();
+    }
+    pTetArena = static_cast<char*>(::operator new(ncomptets * sizeof(stex::Tet)));
+    pTriArena = static_cast<char*>(::operator new(npatchtris * sizeof(stex::Tri)));
+
+    // Position of every tet on a Hilbert curve through the bounding box.
+    std::vector<uint> tetkey;
+    if (reorder == true)
+    {
+        tetkey.resize(ntets);
+        std::vector<double> bmin = mesh()->getBoundMin();
+        std::vector<double> bmax = mesh()->getBoundMax();
+        for (uint t = 0; t < ntets; ++t)
+        {
+            std::vector<double> b = mesh()->getTetBarycenter(t);
+            uint x[3];
+            for (uint a = 0; a < 3; ++a)
+            {
+                double ext = bmax[a] - bmin[a];
+                double u = (ext > 0.0) ? (b[a] - bmin[a]) / ext : 0.0;
+                x[a] = static_cast<uint>(std::min(std::max(u, 0.0), 1.0) * 1023.0);
+            }
+            tetkey[t] = hilbert_key(x);
+        }
+    }
+
     for (uint c = 0; c < ncomps; ++c)
     {
         // Now add the tets for this comp
@@ -177,35 +512,38 @@ stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rn
         // Perform upcast
         steps::tetmesh::TmComp * tmcomp = dynamic_cast<steps::tetmesh::TmComp*>(wmcomp);
         steps::tetexact::Comp * localcomp = pComps[c];
-        std::vector<uint> const & tetindcs = tmcomp->_getAllTetIndices();
+        std::vector<uint> tetindcs = tmcomp->_getAllTetIndices();
+        if (reorder == true)
+        {
+            std::stable_sort(tetindcs.begin(), tetindcs.end(), KeyLess(tetkey));
+        }
         std::vector<uint>::const_iterator t_end = tetindcs.end();
         for (std::vector<uint>::const_iterator t = tetindcs.begin();
              t != t_end; ++t)
         {
-        	steps::tetmesh::Tet * tet = new steps::tetmesh::Tet(mesh(), (*t));
-        	assert (tet->getComp() == tmcomp);
-        	double vol = tet->getVol();
-        	double a0 = tet->getTri0Area();
-        	double a1 = tet->getTri1Area();
-        	double a2 = tet->getTri2Area();
-        	double a3 = tet->getTri3Area();
-        	double d0 = tet->getTet0Dist();
-        	double d1 = tet->getTet1Dist();
-        	double d2 = tet->getTet2Dist();
-        	double d3 = tet->getTet3Dist();
+        	steps::tetmesh::Tet tet(mesh(), (*t));
+        	assert (tet.getComp() == tmcomp);
+        	double vol = tet.getVol();
+        	double a0 = tet.getTri0Area();
+        	double a1 = tet.getTri1Area();
+        	double a2 = tet.getTri2Area();
+        	double a3 = tet.getTri3Area();
+        	double d0 = tet.getTet0Dist();
+        	double d1 = tet.getTet1Dist();
+        	double d2 = tet.getTet2Dist();
+        	double d3 = tet.getTet3Dist();
         	// At this point fetch the indices of neighbouring tets too
-        	int tet0 = tet->getTet0Idx();
-        	int tet1 = tet->getTet1Idx();
-        	int tet2 = tet->getTet2Idx();
-        	int tet3 = tet->getTet3Idx();
+        	int tet0 = tet.getTet0Idx();
+        	int tet1 = tet.getTet1Idx();
+        	int tet2 = tet.getTet2Idx();
+        	int tet3 = tet.getTet3Idx();
 
         	_addTet((*t), localcomp, vol, a0, a1, a2, a3, d0, d1, d2, d3,
         			tet0, tet1, tet2, tet3);
-        	delete tet;
+        	if (reorder == true) pTetOrder.push_back(pTets[*t]);
         }
+        localcomp->setupTetPools();
     }
-    uint npatches = pPatches.size();
-    assert (mesh()->_countPatches() == npatches);
     for (uint p = 0; p < npatches; ++p)
     {
     	// Now add the tris for this patch
@@ -214,25 +552,51 @@ stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rn
         // Perform upcast
         steps::tetmesh::TmPatch * tmpatch = dynamic_cast<steps::tetmesh::TmPatch*>(wmpatch);
     	steps::tetexact::Patch * localpatch = pPatches[p];
-    	std::vector<uint> const & triindcs = tmpatch->_getAllTriIndices();
+    	std::vector<uint> triindcs = tmpatch->_getAllTriIndices();
+    	if (reorder == true)
+    	{
+    		// A triangle goes with its inner tet.
+    		std::vector<uint> trikey(ntris, 0);
+    		std::vector<uint>::const_iterator t_end = triindcs.end();
+    		for (std::vector<uint>::const_iterator t = triindcs.begin();
+    			 t != t_end; ++t)
+    		{
+    			int tetinner = mesh()->_getTriTetNeighb(*t)[0];
+    			if (tetinner >= 0) trikey[*t] = tetkey[tetinner];
+    		}
+    		std::stable_sort(triindcs.begin(), triindcs.end(), KeyLess(trikey));
+    	}
     	std::vector<uint>::const_iterator t_end = triindcs.end();
     	for (std::vector<uint>::const_iterator t = triindcs.begin();
 			 t != t_end; ++t)
     	{
-    		steps::tetmesh::Tri * tri = new steps::tetmesh::Tri(mesh(), (*t));
-    		assert (tri->getPatch() == tmpatch);
-    		double area = tri->getArea();
+    		steps::tetmesh::Tri tri(mesh(), (*t));
+    		assert (tri.getPatch() == tmpatch);
+    		double area = tri.getArea();
     		//// TO DO: For 2D diffusion find length and distance information here
     		// e.g.
     		// double l0 = tri->getBar0Length();
     		// ..
     		// double d2 = tri->getTri2Dist();
-    		int tetinner = tri->getTet0Idx();
-    		int tetouter = tri->getTet1Idx();
+    		int tetinner = tri.getTet0Idx();
+    		int tetouter = tri.getTet1Idx();
 
     		_addTri((*t), localpatch, area, tetinner, tetouter);
-    		delete tri;
+    		if (reorder == true) pTriOrder.push_back(pTris[*t]);
     	}
+    	localpatch->setupTriPools();
+    }
+
+    if (reorder == false)
+    {
+        for (uint t = 0; t < ntets; ++t)
+        {
+            if (pTets[t] != 0) pTetOrder.push_back(pTets[t]);
+        }
+        for (uint t = 0; t < ntris; ++t)
+        {
+            if (pTris[t] != 0) pTriOrder.push_back(pTris[t]);
+        }
     }
 
     // All tets and tris that belong to some comp or patch have been created
@@ -461,6 +825,8 @@ stex::Tetexact::Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rn
 
 stex::Tetexact::~Tetexact(void)
 {
+    _parClear();
+
     CompPVecCI comp_e = pComps.end();
     for (CompPVecCI c = pComps.begin(); c != comp_e; ++c) delete *c;
     PatchPVecCI patch_e = pPatches.end();
@@ -471,24 +837,29 @@ stex::Tetexact::~Tetexact(void)
     TetPVecCI tet_e = pTets.end();
     for (TetPVecCI t = pTets.begin(); t != tet_e; ++t)
     {
-        if ((*t) != 0) delete (*t);
+        if ((*t) != 0) (*t)->~Tet();
     }
 
     TriPVecCI tri_e = pTris.end();
-    for (TriPVecCI t = pTris.end(); t != tri_e; ++t)
+    for (TriPVecCI t = pTris.begin(); t != tri_e; ++t)
     {
-        if ((*t) != 0) delete (*t);
+        if ((*t) != 0) (*t)->~Tri();
     }
+
+    // The kprocs have been destroyed by their tets and tris.
+    ::operator delete(pKProcArena);
+    ::operator delete(pTriArena);
+    ::operator delete(pTetArena);
         
     uint ngroups = nGroups.size();
     for (uint i = 0; i < ngroups; i++) {
-        free(nGroups[i]->indices);
+        free(nGroups[i]->entries);
         delete nGroups[i];
     }
         
     ngroups = pGroups.size();
     for (uint i = 0; i < ngroups; i++) {
-        free(pGroups[i]->indices);
+        free(pGroups[i]->entries);
         delete pGroups[i];
     }
     
@@ -518,7 +889,7 @@ void stex::Tetexact::checkpoint(std::string const & file_name)
     }
 
     TriPVecCI tri_e = pTris.end();
-    for (TriPVecCI t = pTris.end(); t != tri_e; ++t)
+    for (TriPVecCI t = pTris.begin(); t != tri_e; ++t)
     {
         if ((*t) != 0) {
             (*t)->checkpoint(cp_file);
@@ -554,17 +925,24 @@ void stex::Tetexact::restore(std::string const & file_name)
         }
     }
     TriPVecCI tri_e = pTris.end();
-    for (TriPVecCI t = pTris.end(); t != tri_e; ++t)
+    for (TriPVecCI t = pTris.begin(); t != tri_e; ++t)
     {
         if ((*t) != 0) {
             (*t)->restore(cp_file);
         }
     }
 
+    // The counts were read in directly; bring the totals up to date.
+    for (CompPVecCI c = pComps.begin(); c != comp_e; ++c) (*c)->recomputeTotals();
+    for (PatchPVecCI p = pPatches.begin(); p != patch_e; ++p) (*p)->recomputeTotals();
+
 	statedef()->restore(cp_file);
 
     cp_file.close();
 
+    pLeapNext = statedef()->time() + pLeapDT;
+    _beginUpdList();
+    _classifyLeapDiffs();
     _reset();
 }
 
@@ -602,8 +980,38 @@ std::string stex::Tetexact::getSolverEmail(void) const
 
 void stex::Tetexact::_setup(void)
 {   
-	TetPVecCI tet_end = pTets.end();
-	for (TetPVecCI t = pTets.begin(); t != tet_end; ++t)
+	// Size the kproc arena and the schedule before the tets and tris
+	// create their kprocs, so that neither is reallocated.
+	TetPVecCI tet_end = pTetOrder.end();
+	TriPVecCI tri_end = pTriOrder.end();
+	std::size_t arenasize = 0;
+	uint nkprocs = 0;
+	uint ndiffkprocs = 0;
+	for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
+	{
+		if ((*t) == 0) continue;
+		uint ndiffs = (*t)->compdef()->countDiffs();
+		uint nreacs = (*t)->compdef()->countReacs();
+		arenasize += ndiffs * _kprocSlot(sizeof(stex::Diff));
+		arenasize += nreacs * _kprocSlot(sizeof(stex::Reac));
+		nkprocs += ndiffs + nreacs;
+		ndiffkprocs += ndiffs;
+	}
+	for (TriPVecCI t = pTriOrder.begin(); t != tri_end; ++t)
+	{
+		if ((*t) == 0) continue;
+		uint nsreacs = (*t)->patchdef()->countSReacs();
+		arenasize += nsreacs * _kprocSlot(sizeof(stex::SReac));
+		nkprocs += nsreacs;
+	}
+	assert (pKProcArena == 0);
+	pKProcArena = static_cast<char*>(::operator new(arenasize));
+	pKProcArenaSize = arenasize;
+	pKProcArenaUsed = 0;
+	pKProcs.reserve(nkprocs);
+	pLeapDiffs.reserve(ndiffkprocs);
+
+	for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
 	{
 		// DEBUG: vector holds all possible tetrahedrons,
 		// but they have not necessarily been added to a compartment.
@@ -612,8 +1020,7 @@ void stex::Tetexact::_setup(void)
 		(*t)->setupKProcs(this);
 	}
 
-	TriPVecCI tri_end = pTris.end();
-	for (TriPVecCI t = pTris.begin(); t != tri_end; ++t)
+	for (TriPVecCI t = pTriOrder.begin(); t != tri_end; ++t)
 	{
 		// DEBUG: vector holds all possible triangles, but
 		// only patch triangles are filled
@@ -621,8 +1028,54 @@ void stex::Tetexact::_setup(void)
 
 		(*t)->setupKProcs(this);
 	}
-    
-	for (TetPVecCI t = pTets.begin(); t != tet_end; ++t)
+	assert (pKProcArenaUsed == pKProcArenaSize);
+
+	// The kprocs of a tet or tri have consecutive schedule indices, which
+	// makes each of them a subvolume for the next-subvolume method.
+	pNSMOffsets.clear();
+	pNSMOffsets.push_back(0);
+	pNSMSubvol.resize(pKProcs.size());
+	for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
+	{
+		if ((*t) == 0 || (*t)->countKProcs() == 0) continue;
+		uint s = pNSMOffsets.size() - 1;
+		KProcPVecCI kprocend = (*t)->kprocEnd();
+		for (KProcPVecCI k = (*t)->kprocBegin(); k != kprocend; ++k)
+		{
+			assert ((*k)->schedIDX() == pNSMOffsets.back() + (k - (*t)->kprocBegin()));
+			pNSMSubvol[(*k)->schedIDX()] = s;
+		}
+		pNSMOffsets.push_back(pNSMOffsets.back() + (*t)->countKProcs());
+	}
+	for (TriPVecCI t = pTriOrder.begin(); t != tri_end; ++t)
+	{
+		if ((*t) == 0 || (*t)->countKProcs() == 0) continue;
+		uint s = pNSMOffsets.size() - 1;
+		KProcPVecCI kprocend = (*t)->kprocEnd();
+		for (KProcPVecCI k = (*t)->kprocBegin(); k != kprocend; ++k)
+		{
+			assert ((*k)->schedIDX() == pNSMOffsets.back() + (k - (*t)->kprocBegin()));
+			pNSMSubvol[(*k)->schedIDX()] = s;
+		}
+		pNSMOffsets.push_back(pNSMOffsets.back() + (*t)->countKProcs());
+	}
+	assert (pNSMOffsets.back() == pKProcs.size());
+	uint nsubvols = pNSMOffsets.size() - 1;
+	pNSMSum.assign(nsubvols, 0.0);
+	pNSMQueue.init(nsubvols);
+	pNSMDirty.reserve(nsubvols);
+	pNSMIsDirty.assign(nsubvols, false);
+	pNSMFired = nsubvols;
+
+	pLeapSpec.assign(statedef()->countSpecs(), false);
+
+	// Every kproc adds at least one row to the dependency graph.
+	pDepOffsets.clear();
+	pDepOffsets.reserve(pKProcs.size() + 1);
+	pDepOffsets.push_back(0);
+	pDepIdx.clear();
+
+	for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
 	{
 		// DEBUG: vector holds all possible tetrahedrons,
 		// but they have not necessarily been added to a compartment.
@@ -631,12 +1084,12 @@ void stex::Tetexact::_setup(void)
 		KProcPVecCI kprocend = (*t)->kprocEnd();
 		for (KProcPVecCI k = (*t)->kprocBegin(); k != kprocend; ++k)
 		{
-		    (*k)->setupDeps();
+		    (*k)->setupDeps(this);
 		}
 	}
     
     
-	for (TriPVecCI t = pTris.begin(); t != tri_end; ++t)
+	for (TriPVecCI t = pTriOrder.begin(); t != tri_end; ++t)
 	{
 		// DEBUG: vector holds all possible triangles, but
 		// only patch triangles are filled
@@ -645,11 +1098,88 @@ void stex::Tetexact::_setup(void)
 	    KProcPVecCI kprocend = (*t)->kprocEnd();
 	    for (KProcPVecCI k = (*t)->kprocBegin(); k != kprocend; ++k)
 	    {
-	        (*k)->setupDeps();
+	        (*k)->setupDeps(this);
 	    }
 	}
 
+	// One more row per species of each tet and triangle, listing the
+	// kprocs whose rate reads it. These are used by _updateSpec.
+	std::vector<uint> deps;
+	uint nspecs = statedef()->countSpecs();
+	for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
+	{
+		if ((*t) == 0) continue;
+
+		Tet * tet = *t;
+		ssolver::Compdef * cdef = tet->compdef();
+		std::vector<uint> l2g(cdef->countSpecs());
+		for (uint s = 0; s < nspecs; ++s)
+		{
+			uint lidx = cdef->specG2L(s);
+			if (lidx != ssolver::LIDX_UNDEFINED) l2g[lidx] = s;
+		}
+
+		tet->setSpecDepRow(pDepOffsets.size() - 1);
+		uint nlspecs = l2g.size();
+		for (uint l = 0; l < nlspecs; ++l)
+		{
+			deps.clear();
+			KProcPVecCI kprocend = tet->kprocEnd();
+			for (KProcPVecCI k = tet->kprocBegin(); k != kprocend; ++k)
+			{
+				if ((*k)->depSpecTet(l2g[l], tet) == true)
+					deps.push_back((*k)->schedIDX());
+			}
+			for (uint i = 0; i < 4; ++i)
+			{
+				Tri * tri = tet->nextTri(i);
+				if (tri == 0) continue;
+				kprocend = tri->kprocEnd();
+				for (KProcPVecCI k = tri->kprocBegin(); k != kprocend; ++k)
+				{
+					if ((*k)->depSpecTet(l2g[l], tet) == true)
+						deps.push_back((*k)->schedIDX());
+				}
+			}
+			uint row = addDepRow(deps);
+			assert(row == tet->specDepRow(l));
+		}
+	}
+
+	for (TriPVecCI t = pTriOrder.begin(); t != tri_end; ++t)
+	{
+		if ((*t) == 0) continue;
+
+		Tri * tri = *t;
+		ssolver::Patchdef * pdef = tri->patchdef();
+		std::vector<uint> l2g(pdef->countSpecs());
+		for (uint s = 0; s < nspecs; ++s)
+		{
+			uint lidx = pdef->specG2L(s);
+			if (lidx != ssolver::LIDX_UNDEFINED) l2g[lidx] = s;
+		}
+
+		tri->setSpecDepRow(pDepOffsets.size() - 1);
+		uint nlspecs = l2g.size();
+		for (uint l = 0; l < nlspecs; ++l)
+		{
+			deps.clear();
+			KProcPVecCI kprocend = tri->kprocEnd();
+			for (KProcPVecCI k = tri->kprocBegin(); k != kprocend; ++k)
+			{
+				if ((*k)->depSpecTri(l2g[l], tri) == true)
+					deps.push_back((*k)->schedIDX());
+			}
+			uint row = addDepRow(deps);
+			assert(row == tri->specDepRow(l));
+		}
+	}
+
+	// Release the spare capacity of the edge array.
+	std::vector<uint>(pDepIdx).swap(pDepIdx);
+
 	nEntries = pKProcs.size();
+	pUpdList.reserve(nEntries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -700,8 +1230,9 @@ void stex::Tetexact::_addTet(uint tetidx,
 							 int tet0, int tet1, int tet2, int tet3)
 {
 	steps::solver::Compdef * compdef  = comp->def();
-    stex::Tet * localtet = new stex::Tet(tetidx, compdef, vol, a1, a2, a3, a4, d1, d2, d3, d4,
-									     tet0, tet1, tet2, tet3);
+    void * mem = pTetArena + pTetArenaUsed++ * sizeof(stex::Tet);
+    stex::Tet * localtet = new (mem) stex::Tet(tetidx, compdef, vol, a1, a2, a3, a4, d1, d2, d3, d4,
+									           tet0, tet1, tet2, tet3);
     assert(localtet != 0);
     assert(tetidx < pTets.size());
     assert(pTets[tetidx] == 0);
@@ -715,7 +1246,8 @@ void stex::Tetexact::_addTri(uint triidx, steps::tetexact::Patch * patch, double
 							 int tinner, int touter)
 {
     steps::solver::Patchdef * patchdef = patch->def();
-    stex::Tri * tri = new stex::Tri(triidx, patchdef, area, tinner, touter);
+    void * mem = pTriArena + pTriArenaUsed++ * sizeof(stex::Tri);
+    stex::Tri * tri = new (mem) stex::Tri(triidx, patchdef, area, tinner, touter);
     assert(tri != 0);
     assert (triidx < pTris.size());
     assert (pTris[triidx] == 0);
@@ -746,23 +1278,27 @@ void stex::Tetexact::reset(void)
 		(*t)->reset();
 	}
 
-    uint ngroups = nGroups.size();
-    for (uint i = 0; i < ngroups; i++) {
-        free(nGroups[i]->indices);
-        delete nGroups[i];
-    }
-    nGroups.clear();
+    _freeGroups();
     
-    ngroups = pGroups.size();
-    for (uint i = 0; i < ngroups; i++) {
-        free(pGroups[i]->indices);
-        delete pGroups[i];
+    std::fill(pNSMSum.begin(), pNSMSum.end(), 0.0);
+    pNSMQueue.clear();
+    // Reseed the domain streams, so that a reseeded solver repeats itself.
+    uint ndomains = pParDomains.size();
+    for (uint i = 0; i < ndomains; i++) {
+        pParDomains[i]->queue.clear();
+        pParDomains[i]->rng->initialize(rng()->get());
     }
-    pGroups.clear();
+    
+    // The counts are zero, so only selected species stay leaped.
+    _beginUpdList();
+    _classifyLeapDiffs();
+    pLeapNext = pLeapDT;
     
     pSum = 0.0;
     nSum = 0.0;
     pA0 = 0.0;
+    pA0Err = 0.0;
+    pA0Renorms = 0;
     
 	statedef()->resetTime();
 	statedef()->resetNSteps();
@@ -778,6 +1314,33 @@ void stex::Tetexact::run(double endtime)
 		os << "Endtime is before current simulation time";
 	    throw steps::ArgErr(os.str());
 	}
+	while (pLeapDT > 0.0 && pLeapNext <= endtime)
+	{
+		_runSSA(pLeapNext);
+		_leapDiffusion();
+		pLeapNext += pLeapDT;
+	}
+	_runSSA(endtime);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_runSSA(double endtime)
+{
+	if (pEngine == ENGINE_PAR)
+	{
+		_runParallel(endtime);
+		return;
+	}
+	if (pEngine == ENGINE_NSM)
+	{
+		while (pNSMQueue.topTime() <= endtime)
+		{
+			_executeNSMStep(pNSMQueue.top(), pNSMQueue.topTime());
+		}
+		statedef()->setTime(endtime);
+		return;
+	}
 	while (statedef()->time() < endtime)
 	{
         //std::cout << "pass1\n";
@@ -814,11 +1377,45 @@ void stex::Tetexact::advance(double adv)
 void stex::Tetexact::advanceSteps(uint nsteps)
 {
 	while (nsteps != 0) {
+        if (pEngine == ENGINE_PAR) {
+            // Fire the earliest event of all domains and deliver at once
+            // whatever it sends across, which is exact.
+            stex::NSMDomain * d = 0;
+            double t = std::numeric_limits<double>::infinity();
+            uint ndomains = pParDomains.size();
+            for (uint i = 0; i < ndomains; i++) {
+                if (pParDomains[i]->queue.topTime() < t) {
+                    d = pParDomains[i];
+                    t = d->queue.topTime();
+                }
+            }
+            if (d == 0) return;
+            if (_leapBefore(t)) continue;
+            stex::KProc * kp = _parExecute(*d, d->queue.top(), t);
+            statedef()->setTime(t);
+            statedef()->incNSteps();
+            _updateA0(d->a0delta);
+            d->a0delta = 0.0;
+            if (kp->type() == stex::KProc::TYPE_DIFF) {
+                _parFlush(static_cast<stex::Diff*>(kp));
+            }
+            nsteps--;
+            continue;
+        }
+        if (pEngine == ENGINE_NSM) {
+            double t = pNSMQueue.topTime();
+            if (t == std::numeric_limits<double>::infinity()) return;
+            if (_leapBefore(t)) continue;
+            _executeNSMStep(pNSMQueue.top(), t);
+            nsteps--;
+            continue;
+        }
         stex::KProc * kp = _getNext();
         if (kp == 0) return;
         double a0 = getA0();
         if (a0 == 0.0) return;
         double dt = rng()->getExp(a0);
+        if (_leapBefore(statedef()->time() + dt)) continue;
         _executeStep(kp, dt);
         nsteps--;
     }
@@ -828,38 +1425,339 @@ void stex::Tetexact::advanceSteps(uint nsteps)
 
 void stex::Tetexact::step(void)
 {
-	stex::KProc * kp = _getNext();
-	if (kp == 0) return;
-	double a0 = getA0();
-	if (a0 == 0.0) return;
-	double dt = rng()->getExp(a0);
-	_executeStep(kp, dt);
+	advanceSteps(1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-double stex::Tetexact::getTime(void) const
+void stex::Tetexact::setEngine(std::string const & engine)
 {
-	return statedef()->time();
+	uint e;
+	if (engine == "cr") e = ENGINE_CR;
+	else if (engine == "nsm") e = ENGINE_NSM;
+	else
+	{
+		std::ostringstream os;
+		os << "Unknown engine '" << engine << "'; use 'cr' or 'nsm'";
+		throw steps::ArgErr(os.str());
+	}
+	if (e == pEngine) return;
+
+	if (pEngine == ENGINE_PAR) _parClear();
+	_switchEngine(e);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::setTime(double time)
+void stex::Tetexact::_switchEngine(uint e)
 {
-	statedef()->setTime(time);
+	// Forget the propensities held by any engine, then let the new
+	// engine record them all again.
+	_freeGroups();
+	for (uint i = 0; i < nEntries; i++)
+	{
+		CRKProcData & data = pKProcs[i]->crData;
+		data.recorded = false;
+		data.pow = 0;
+		data.pos = 0;
+		data.rate = 0.0;
+	}
+	std::fill(pNSMSum.begin(), pNSMSum.end(), 0.0);
+	pNSMQueue.clear();
+	pA0 = 0.0;
+	pA0Err = 0.0;
+
+	pEngine = e;
+	_update();
 }
 
-////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
 
-uint stex::Tetexact::getNSteps(void) const
+void stex::Tetexact::setParallel(uint nthreads, double dt)
 {
-    return statedef()->nsteps();
+	if (nthreads == 0)
+	{
+		std::ostringstream os;
+		os << "Parallel engine needs at least one thread";
+		throw steps::ArgErr(os.str());
+	}
+	if (dt <= 0.0)
+	{
+		std::ostringstream os;
+		os << "Synchronisation time step must be positive";
+		throw steps::ArgErr(os.str());
+	}
+
+	if (pEngine == ENGINE_PAR) _parClear();
+	pParDT = dt;
+	_parPartition(nthreads);
+	_parStartPool();
+	_switchEngine(ENGINE_PAR);
 }
 
-////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::setNSteps(uint nsteps)
+uint stex::Tetexact::getParallelThreads(void) const
+{
+	if (pEngine != ENGINE_PAR) return 0;
+	return pParDomains.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double stex::Tetexact::getParallelSyncDT(void) const
+{
+	return pParDT;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string stex::Tetexact::getEngine(void) const
+{
+	if (pEngine == ENGINE_NSM) return "nsm";
+	if (pEngine == ENGINE_PAR) return "parallel";
+	return "cr";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::setDiffLeapDT(double dt)
+{
+	if (dt < 0.0)
+	{
+		std::ostringstream os;
+		os << "Diffusion leap time step cannot be negative";
+		throw steps::ArgErr(os.str());
+	}
+	pLeapDT = dt;
+	pLeapNext = statedef()->time() + dt;
+	// A leap touches at most five dependency rows per rule.
+	pLeapRows.reserve(5 * pLeapDiffs.capacity());
+
+	_beginUpdList();
+	_classifyLeapDiffs();
+	_update(pUpdList);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double stex::Tetexact::getDiffLeapDT(void) const
+{
+	return pLeapDT;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::setSpecDiffLeap(std::string const & s, bool leap)
+{
+	// the following may throw exception if string is unknown
+	uint sidx = statedef()->getSpecIdx(s);
+	assert(sidx < pLeapSpec.size());
+	pLeapSpec[sidx] = leap;
+
+	_beginUpdList();
+	_classifyLeapDiffs();
+	_update(pUpdList);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool stex::Tetexact::getSpecDiffLeap(std::string const & s) const
+{
+	// the following may throw exception if string is unknown
+	uint sidx = statedef()->getSpecIdx(s);
+	assert(sidx < pLeapSpec.size());
+	return pLeapSpec[sidx];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::setDiffLeapThreshold(uint n)
+{
+	pLeapThreshold = n;
+
+	_beginUpdList();
+	_classifyLeapDiffs();
+	_update(pUpdList);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint stex::Tetexact::getDiffLeapThreshold(void) const
+{
+	return pLeapThreshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+double stex::Tetexact::getTime(void) const
+{
+	return statedef()->time();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::setTime(double time)
+{
+	statedef()->setTime(time);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+uint stex::Tetexact::getNSteps(void) const
+{
+    return statedef()->nsteps();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<uint> stex::Tetexact::getCompTetCountsTets(std::string const & c) const
+{
+	// the following may throw exception if string is unknown
+	uint cidx = statedef()->getCompIdx(c);
+	assert (cidx < pComps.size());
+	stex::Comp * comp = pComps[cidx];
+
+	std::vector<uint> tets;
+	tets.reserve(comp->countTets());
+	TetPVecCI t_end = comp->endTet();
+	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
+	{
+		tets.push_back((*t)->idx());
+	}
+	return tets;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<std::string> stex::Tetexact::getCompTetCountsSpecs(std::string const & c) const
+{
+	// the following may throw exception if string is unknown
+	uint cidx = statedef()->getCompIdx(c);
+	ssolver::Compdef * cdef = statedef()->compdef(cidx);
+
+	std::vector<std::string> specs(cdef->countSpecs());
+	uint nspecs = statedef()->countSpecs();
+	for (uint s = 0; s < nspecs; ++s)
+	{
+		uint lsidx = cdef->specG2L(s);
+		if (lsidx == ssolver::LIDX_UNDEFINED) continue;
+		specs[lsidx] = statedef()->specdef(s)->name();
+	}
+	return specs;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<uint> stex::Tetexact::getPatchTriCountsTris(std::string const & p) const
+{
+	// the following may throw exception if string is unknown
+	uint pidx = statedef()->getPatchIdx(p);
+	assert (pidx < pPatches.size());
+	stex::Patch * patch = pPatches[pidx];
+
+	std::vector<uint> tris;
+	tris.reserve(patch->countTris());
+	TriPVecCI t_end = patch->endTri();
+	for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
+	{
+		tris.push_back((*t)->idx());
+	}
+	return tris;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<std::string> stex::Tetexact::getPatchTriCountsSpecs(std::string const & p) const
+{
+	// the following may throw exception if string is unknown
+	uint pidx = statedef()->getPatchIdx(p);
+	ssolver::Patchdef * pdef = statedef()->patchdef(pidx);
+
+	std::vector<std::string> specs(pdef->countSpecs());
+	uint nspecs = statedef()->countSpecs();
+	for (uint s = 0; s < nspecs; ++s)
+	{
+		uint lsidx = pdef->specG2L(s);
+		if (lsidx == ssolver::LIDX_UNDEFINED) continue;
+		specs[lsidx] = statedef()->specdef(s)->name();
+	}
+	return specs;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+uint const * stex::Tetexact::_getCompTetCounts(std::string const & c,
+                                               uint & ntets, uint & nspecs) const
+{
+	// the following may throw exception if string is unknown
+	uint cidx = statedef()->getCompIdx(c);
+	assert (cidx < pComps.size());
+	stex::Comp * comp = pComps[cidx];
+
+	ntets = comp->countTets();
+	nspecs = comp->def()->countSpecs();
+	return comp->tetPools();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+uint const * stex::Tetexact::_getPatchTriCounts(std::string const & p,
+                                                uint & ntris, uint & nspecs) const
+{
+	// the following may throw exception if string is unknown
+	uint pidx = statedef()->getPatchIdx(p);
+	assert (pidx < pPatches.size());
+	stex::Patch * patch = pPatches[pidx];
+
+	ntris = patch->countTris();
+	nspecs = patch->def()->countSpecs();
+	return patch->triPools();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<uint> stex::Tetexact::pickCompTets(std::string const & c, uint n)
+{
+	// the following may throw exception if string is unknown
+	uint cidx = statedef()->getCompIdx(c);
+	assert (cidx < pComps.size());
+	stex::Comp * comp = pComps[cidx];
+	if (n != 0 && comp->countTets() == 0)
+	{
+		std::ostringstream os;
+		os << "Compartment '" << c << "' contains no tetrahedrons.\n";
+		throw steps::ArgErr(os.str());
+	}
+
+	std::vector<uint> tets(n);
+	if (n != 0) comp->pickTetsByVol(n, rng(), &tets[0]);
+	return tets;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+std::vector<uint> stex::Tetexact::pickPatchTris(std::string const & p, uint n)
+{
+	// the following may throw exception if string is unknown
+	uint pidx = statedef()->getPatchIdx(p);
+	assert (pidx < pPatches.size());
+	stex::Patch * patch = pPatches[pidx];
+	if (n != 0 && patch->countTris() == 0)
+	{
+		std::ostringstream os;
+		os << "Patch '" << p << "' contains no triangles.\n";
+		throw steps::ArgErr(os.str());
+	}
+
+	std::vector<uint> tris(n);
+	if (n != 0) patch->pickTrisByArea(n, rng(), &tris[0]);
+	return tris;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::setNSteps(uint nsteps)
 {
     statedef()->setNSteps(nsteps);
 }
@@ -892,14 +1790,7 @@ double stex::Tetexact::_getCompCount(uint cidx, uint sidx) const
 		throw steps::ArgErr(os.str());
 	}
 
-	uint count = 0;
-	TetPVecCI t_end = comp->endTet();
-	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
-	{
-		count += (*t)->pools()[slidx];
-	}
-
-	return count;
+	return comp->total(slidx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -980,21 +1871,11 @@ void stex::Tetexact::_setCompCount(uint cidx, uint sidx, double n)
 	assert(nremoved <= c);
 	c -= nremoved;
 
-	while (c != 0)
-	{
-		Tet * tet = comp->pickTetByVol(rng()->getUnfIE());
-        assert (tet != 0);
-        tet->setCount(slidx, (tet->pools()[slidx] + 1.0));
-        c--;
-	}
-
-	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
-	{
-		_updateSpec(*t, slidx);
-	}
+	// Place the remainder by volume in a single pass.
+	comp->addCountByVol(slidx, c, rng());
 
-	// Rates have changed
-	_reset();
+	// Only the kprocs that depend on this species have changed.
+	_updateCompSpec(comp, slidx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1137,14 +2018,16 @@ void stex::Tetexact::_setCompReacK(uint cidx, uint ridx, double kf)
 	comp->def()->setKcst(lridx, kf);
 
 	// Now update all tetrahedra in this comp
+	_beginUpdList();
 	TetPVecCI t_end = comp->endTet();
 	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
 	{
 		(*t)->reac(lridx)->setKcst(kf);
+		_addToUpdList((*t)->reac(lridx));
 	}
 
-	// Rates have changed
-	_reset();
+	// Only the rates of this reaction have changed
+	_update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1193,13 +2076,14 @@ void stex::Tetexact::_setCompReacActive(uint cidx, uint ridx, bool a)
 	// necessary
 	comp->def()->setActive(lridx, a);
 
+	_beginUpdList();
 	TetPVecCI t_end = comp->endTet();
 	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
 	{
 		(*t)->reac(lridx)->setActive(a);
+		_addToUpdList((*t)->reac(lridx));
 	}
-    // It's cheaper to just recompute everything.
-    _reset();
+	_update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1247,14 +2131,16 @@ void stex::Tetexact::_setCompDiffD(uint cidx, uint didx, double dk)
 	comp->def()->setDcst(ldidx, dk);
 
 	// Now update all tets in this comp
+	_beginUpdList();
 	TetPVecCI t_end = comp->endTet();
 	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
 	{
 		(*t)->diff(ldidx)->setDcst(dk);
+		_addToUpdList((*t)->diff(ldidx));
 	}
 
-	// Rates have changed
-	_reset();
+	// Only the rates of this diffusion rule have changed
+	_update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1299,13 +2185,14 @@ void stex::Tetexact::_setCompDiffActive(uint cidx, uint didx, bool act)
 		throw steps::ArgErr(os.str());
 	}
 
+	_beginUpdList();
 	TetPVecCI t_end = comp->endTet();
 	for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
 	{
 		(*t)->diff(ldidx)->setActive(act);
+		_addToUpdList((*t)->diff(ldidx));
 	}
-    // It's cheaper to just recompute everything.
-    _reset();
+	_update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1336,14 +2223,7 @@ double stex::Tetexact::_getPatchCount(uint pidx, uint sidx) const
 		throw steps::ArgErr(os.str());
 	}
 
-	uint count = 0;
-	TriPVecCI t_end = patch->endTri();
-	for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
-	{
-		count += (*t)->pools()[slidx];
-	}
-
-	return count;
+	return patch->total(slidx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1426,21 +2306,11 @@ void stex::Tetexact::_setPatchCount(uint pidx, uint sidx, double n)
 	assert(nremoved <= c);
 	c -= nremoved;
 
-	while(c != 0)
-	{
-		Tri * tri = patch->pickTriByArea(rng()->getUnfIE());
-		assert (tri != 0);
-		tri->setCount(slidx, (tri->pools()[slidx] + 1.0));
-		c--;
-	}
+	// Place the remainder by area in a single pass.
+	patch->addCountByArea(slidx, c, rng());
 
-	for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
-	{
-		_updateSpec(*t, slidx);
-	}
-
-	// Rates have changed
-	_reset();
+	// Only the kprocs that depend on this species have changed.
+	_updatePatchSpec(patch, slidx);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1561,14 +2431,16 @@ void stex::Tetexact::_setPatchSReacK(uint pidx, uint ridx, double kf)
     patch->def()->setKcst(lsridx, kf);
 
     // Now update all triangles in this patch
+    _beginUpdList();
     TriPVecCI t_end = patch->endTri();
     for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
     {
         (*t)->sreac(lsridx)->setKcst(kf);
+        _addToUpdList((*t)->sreac(lsridx));
     }
 
-	// Rates have changed
-	_reset();
+	// Only the rates of this surface reaction have changed
+	_update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1617,13 +2489,14 @@ void stex::Tetexact::_setPatchSReacActive(uint pidx, uint ridx, bool a)
     // not entirely necessary for this solver
     patch->def()->setActive(lsridx, a);
 
+    _beginUpdList();
     TriPVecCI t_end = patch->endTri();
     for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
     {
         (*t)->sreac(lsridx)->setActive(a);
+        _addToUpdList((*t)->sreac(lsridx));
     }
-    // It's cheaper to just recompute everything.
-    _reset();
+    _update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1652,6 +2525,61 @@ void stex::Tetexact::_setDiffBoundaryDiffusionActive(uint dbidx, uint sidx, bool
 	uint lsidxB = compB->def()->specG2L(sidx);
 
 
+	if (lsidxA == ssolver::LIDX_UNDEFINED or lsidxB == ssolver::LIDX_UNDEFINED)
+	{
+		std::ostringstream os;
+		os << "Species undefined in compartments connected by diffusion boundary.\n";
+		throw steps::ArgErr(os.str());
+	}
+
+	std::vector<uint> const & bdtets = diffb->getTets();
+	std::vector<uint> const & bdtetsdir = diffb->getTetDirection();
+
+	// Have to use indices rather than iterator because need access to the
+	// tet direction
+	uint ntets = bdtets.size();
+	_beginUpdList();
+
+	for (uint bdt = 0; bdt != ntets; ++bdt)
+	{
+		stex::Tet * tet = _tet(bdtets[bdt]);
+		uint direction = bdtetsdir[bdt];
+		assert(direction >= 0 and direction < 4);
+
+		// Each diff kproc then has access to the species through it's defined parent
+		uint ndiffs = tet->compdef()->countDiffs();
+		for (uint d = 0; d != ndiffs; ++d)
+		{
+			stex::Diff * diff = tet->diff(d);
+			// sidx is the global species index; so is the lig() return from diffdef
+			uint specgidx = diff->def()->lig();
+			if (specgidx == sidx)
+			{
+				diff->setDiffBndActive(direction, act);
+				_addToUpdList(diff);
+			}
+		}
+	}
+
+	// The scaled diffusion constants of these kprocs have changed. A tet
+	// can border the boundary on several faces; the list skips repeats.
+	_update(pUpdList);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool stex::Tetexact::_getDiffBoundaryDiffusionActive(uint dbidx, uint sidx) const
+{
+	assert (dbidx < statedef()->countDiffBoundaries());
+	assert (sidx < statedef()->countSpecs());
+
+	stex::DiffBoundary * diffb = _diffboundary(dbidx);
+	stex::Comp * compA = diffb->compA();
+	stex::Comp * compB = diffb->compB();
+
+	uint lsidxA = compA->def()->specG2L(sidx);
+	uint lsidxB = compB->def()->specG2L(sidx);
+
 	if (lsidxA == ssolver::LIDX_UNDEFINED or lsidxB == ssolver::LIDX_UNDEFINED)
 	{
 		std::ostringstream os;
@@ -1664,6 +2592,7 @@ void stex::Tetexact::_setDiffBoundaryDiffusionActive(uint dbidx, uint sidx, bool
 
 	// Have to use indices rather than iterator because need access to the
 	// tet direction
+
 	uint ntets = bdtets.size();
 
 	for (uint bdt = 0; bdt != ntets; ++bdt)
@@ -1681,286 +2610,851 @@ void stex::Tetexact::_setDiffBoundaryDiffusionActive(uint dbidx, uint sidx, bool
 			uint specgidx = diff->def()->lig();
 			if (specgidx == sidx)
 			{
-				diff->setDiffBndActive(direction, act);
+				// Just need to check the first one
+				if (diff->getDiffBndActive(direction)) return true;
+				else return false;
 			}
 		}
 	}
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::addKProc(steps::tetexact::KProc * kp)
+{
+	assert (kp != 0);
+
+	SchedIDX nidx = pKProcs.size();
+	pKProcs.push_back(kp);
+	kp->setSchedIDX(nidx);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void * stex::Tetexact::_allocKProc(std::size_t size)
+{
+	std::size_t slot = _kprocSlot(size);
+	assert (pKProcArenaUsed + slot <= pKProcArenaSize);
+	void * mem = pKProcArena + pKProcArenaUsed;
+	pKProcArenaUsed += slot;
+	return mem;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+uint stex::Tetexact::addDepRow(std::vector<uint> & deps)
+{
+	std::sort(deps.begin(), deps.end());
+	deps.erase(std::unique(deps.begin(), deps.end()), deps.end());
+
+	pDepIdx.insert(pDepIdx.end(), deps.begin(), deps.end());
+	pDepOffsets.push_back(pDepIdx.size());
+	return pDepOffsets.size() - 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_build(void)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_rebuildTree(void)
+{
+    uint ngroups = pTreeGroups.size();
+    uint nleaves = (pTreeLeaves == 0 ? 1 : pTreeLeaves);
+    while (nleaves < ngroups) nleaves <<= 1;
+    
+    #ifdef SSA_DEBUG
+    std::cout << "SSA: rebuild group tree with " << nleaves << " leaves\n";
+    #endif
+    
+    pTreeLeaves = nleaves;
+    if (pGroupTree.capacity() < 2 * nleaves) pUpdAllocs++;
+    pGroupTree.assign(2 * nleaves, 0.0);
+    for (uint i = 0; i < ngroups; i++) {
+        pTreeGroups[i]->tree_dirty = false;
+        pGroupTree[nleaves + i] = pTreeGroups[i]->sum;
+    }
+    for (uint node = nleaves - 1; node != 0; node--) {
+        pGroupTree[node] = pGroupTree[node << 1] + pGroupTree[(node << 1) + 1];
+    }
+    pDirtyGroups.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+steps::tetexact::KProc * stex::Tetexact::_getNext(void) const
+{
+    #ifdef SSA_DEBUG
+    std::cout << "SSA: Search for next event\n";
+    #endif
+    assert(pA0 >= 0.0);
+    // Quick check to see whether nothing is there.
+    if (pA0 == 0.0) return NULL;
+    
+    // The group is selected on the tree root rather than on pA0, so that
+    // the selector is always consistent with the sums in the tree.
+    assert(pDirtyGroups.empty());
+    double tree_sum = pGroupTree[1];
+    double selector = tree_sum * rng()->getUnfII();
+    
+    #ifdef SSA_DEBUG
+    std::cout << "selector: " << selector << " in total " << tree_sum << "\n";
+    #endif
+    
+    // Descend the tree, never entering a subtree without propensity.
+    uint node = 1;
+    while (node < pTreeLeaves) {
+        uint left = node << 1;
+        double left_sum = pGroupTree[left];
+        if (selector < left_sum || pGroupTree[left + 1] <= 0.0) {
+            node = left;
+        }
+        else {
+            selector -= left_sum;
+            node = left + 1;
+        }
+    }
+    
+    CRGroup* group = NULL;
+    if (node - pTreeLeaves < pTreeGroups.size()) {
+        group = pTreeGroups[node - pTreeLeaves];
+    }
+    
+    if (group == NULL || group->size == 0) {
+        std::cerr << "Cannot find any suitable entry.\n";
+        std::cerr << "A0: " << std::setprecision (15) << pA0 << "\n";
+        std::cerr << "Tree sum: " << std::setprecision (15) << tree_sum << "\n";
+        std::cerr << "Selector: " << std::setprecision (15) << selector << "\n";
+        
+        std::cerr << "Distribution of group sums\n";
+        std::cerr << "Negative groups\n";
+        
+        uint n_neg_groups = nGroups.size();
+        uint n_pos_groups = pGroups.size();
+        for (uint i = 0; i < n_neg_groups; i++) {
+            std::cerr << i << ": " << std::setprecision (15) << nGroups[i]->sum << "\n"; 
+        }
+        std::cerr << "Positive groups\n";
+        for (uint i = 0; i < n_pos_groups; i++) {
+            std::cerr << i << ": " << std::setprecision (15) << pGroups[i]->sum << "\n"; 
+        }
+        
+        throw;
+    }
+    
+    double g_max = group->max;
+    double random_rate = g_max * rng()->getUnfII();
+    uint group_size = group->size;
+    uint random_pos = rng()->get() % group_size;
+    CRGroupEntry* entries = group->entries;
+    
+    #ifdef SSA_DEBUG
+    std::cout << "search for event\n";
+    std::cout << "group max: " << g_max << "\n";
+    std::cout << "random rate: " << random_rate << "\n";
+    std::cout << "random pos " << random_pos << "\n";
+    std::cout << "random kp rate " << entries[random_pos].rate << "\n";
+    #endif
+    
+    while (entries[random_pos].rate <= random_rate) {
+        random_rate = g_max * rng()->getUnfII();
+        random_pos = rng()->get() % group_size;
+        #ifdef SSA_DEBUG
+        std::cout << "renew search\n";
+        std::cout << "random rate: " << random_rate << "\n";
+        std::cout << "random pos " << random_pos << "\n";
+        std::cout << "random kp rate " << entries[random_pos].rate << "\n";
+        #endif
+    }
+    
+    KProc* random_kp = entries[random_pos].kproc;
+    
+    #ifdef SSA_DEBUG
+    std::cout << "selected kp index: " << random_kp->schedIDX() << "\n";
+    std::cout << "--------------------------------------------------------\n";
+    #endif
+    return random_kp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_reset(void)
+{
+    _update();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_executeStep(steps::tetexact::KProc * kp, double dt)
+{
+    //std::cout << "passe1\n";
+    uint upd = kproc_apply(kp, rng());
+	//std::cout << "passe2\n";
+    _update(upd);
+    //std::cout << "passe3\n";
+    statedef()->incTime(dt);
+    statedef()->incNSteps();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_executeNSMStep(uint s, double t)
+{
+    assert(pNSMSum[s] > 0.0);
+
+    // Select a kproc of the subvolume in proportion to its propensity.
+    uint k = pNSMOffsets[s];
+    uint last = pNSMOffsets[s + 1] - 1;
+    double selector = pNSMSum[s] * rng()->getUnfIE();
+    for (; k < last; ++k)
+    {
+        double rate = pKProcs[k]->crData.rate;
+        if (selector < rate) break;
+        selector -= rate;
+    }
+    // Rounding may carry the selector past the last kproc with propensity.
+    while (pKProcs[k]->crData.rate <= 0.0) --k;
+
+    uint upd = kproc_apply(pKProcs[k], rng());
+    statedef()->setTime(t);
+    // The subvolume has fired, so it needs a new event time even if its
+    // propensity is unchanged.
+    _nsmMark(s);
+    pNSMFired = s;
+    _update(upd);
+    pNSMFired = pNSMSum.size();
+    statedef()->incNSteps();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_nsmRefresh(void)
+{
+    double now = statedef()->time();
+    uint n_dirty = pNSMDirty.size();
+    for (uint i = 0; i < n_dirty; i++) {
+        uint s = pNSMDirty[i];
+        pNSMIsDirty[s] = false;
+        
+        double sum = 0.0;
+        uint end = pNSMOffsets[s + 1];
+        for (uint k = pNSMOffsets[s]; k < end; k++) {
+            sum += pKProcs[k]->crData.rate;
+        }
+        double old_sum = pNSMSum[s];
+        if (sum != old_sum) _updateA0(sum - old_sum);
+        pNSMSum[s] = sum;
+        
+        // The subvolume that fired needs a new draw. Any other one still
+        // has an exponential waiting time, which only has to be rescaled
+        // to the new propensity (Gibson and Bruck).
+        double t = std::numeric_limits<double>::infinity();
+        if (sum > 0.0) {
+            if (s == pNSMFired || old_sum <= 0.0) {
+                t = now + rng()->getExp(sum);
+            }
+            else {
+                t = now + (pNSMQueue.time(s) - now) * (old_sum / sum);
+            }
+        }
+        pNSMQueue.update(s, t);
+    }
+    pNSMDirty.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parPartition(uint n)
+{
+    assert(pParDomains.empty());
+    uint ntets = pTets.size();
+
+    // Tets that share a patch triangle must stay together, since a
+    // surface reaction changes both; join them in a union-find forest.
+    std::vector<uint> parent(ntets);
+    for (uint t = 0; t < ntets; ++t) parent[t] = t;
+    TriPVecCI tri_end = pTris.end();
+    for (TriPVecCI t = pTris.begin(); t != tri_end; ++t)
+    {
+        if ((*t) == 0 || (*t)->iTet() == 0 || (*t)->oTet() == 0) continue;
+        uint r1 = par_find(parent, (*t)->iTet()->idx());
+        uint r2 = par_find(parent, (*t)->oTet()->idx());
+        if (r1 != r2) parent[r2] = r1;
+    }
+
+    // Bisect over the groups, each placed at the centroid of its tets and
+    // weighted by their number, then give every tet its group's domain.
+    std::vector<uint> tets;
+    std::vector<uint> roots;
+    std::vector<double> baryc(ntets * 3, 0.0);
+    std::vector<uint> weight(ntets, 0);
+    for (uint t = 0; t < ntets; ++t)
+    {
+        if (pTets[t] == 0) continue;
+        tets.push_back(t);
+        uint r = par_find(parent, t);
+        if (weight[r] == 0) roots.push_back(r);
+        weight[r] += 1;
+        std::vector<double> b = mesh()->getTetBarycenter(t);
+        for (uint a = 0; a < 3; ++a) baryc[r * 3 + a] += b[a];
+    }
+    uint nroots = roots.size();
+    for (uint i = 0; i < nroots; ++i)
+    {
+        uint r = roots[i];
+        for (uint a = 0; a < 3; ++a) baryc[r * 3 + a] /= weight[r];
+    }
+    pParTetDomain.assign(ntets, 0);
+    par_bisect(roots.begin(), roots.end(), 0, n, baryc, weight, pParTetDomain);
+    uint ncomptets = tets.size();
+    for (uint i = 0; i < ncomptets; ++i)
+    {
+        uint t = tets[i];
+        pParTetDomain[t] = pParTetDomain[par_find(parent, t)];
+    }
+
+    uint maxspecs = 0;
+    CompPVecCI comp_e = pComps.end();
+    for (CompPVecCI c = pComps.begin(); c != comp_e; ++c)
+    {
+        maxspecs = std::max(maxspecs, (*c)->def()->countSpecs());
+    }
+    PatchPVecCI patch_e = pPatches.end();
+    for (PatchPVecCI p = pPatches.begin(); p != patch_e; ++p)
+    {
+        maxspecs = std::max(maxspecs, (*p)->def()->countSpecs());
+    }
+
+    uint nsubvols = pNSMSum.size();
+    for (uint i = 0; i < n; ++i)
+    {
+        stex::NSMDomain * d = new stex::NSMDomain();
+        d->fired = nsubvols;
+        d->a0delta = 0.0;
+        d->nsteps = 0;
+        d->rng = steps::rng::create_mt19937(512);
+        d->rng->initialize(rng()->get());
+        d->totals.assign(std::max(maxspecs, 1u), 0.0);
+        pParDomains.push_back(d);
+    }
+
+    // Subvolumes are numbered as in _setup: tets, then triangles, which
+    // go with their inner tet.
+    pParDomainOf.assign(nsubvols, 0);
+    pParLocal.assign(nsubvols, 0);
+    uint s = 0;
+    TetPVecCI tet_end = pTetOrder.end();
+    for (TetPVecCI t = pTetOrder.begin(); t != tet_end; ++t)
+    {
+        if ((*t) == 0 || (*t)->countKProcs() == 0) continue;
+        stex::NSMDomain * d = pParDomains[pParTetDomain[(*t)->idx()]];
+        pParDomainOf[s] = pParTetDomain[(*t)->idx()];
+        pParLocal[s] = d->subvols.size();
+        d->subvols.push_back(s++);
+
+        // Mark the diffusion rules that leave the domain.
+        KProcPVecCI kprocend = (*t)->kprocEnd();
+        for (KProcPVecCI k = (*t)->kprocBegin(); k != kprocend; ++k)
+        {
+            if ((*k)->type() != KProc::TYPE_DIFF) continue;
+            stex::Diff * diff = static_cast<stex::Diff*>(*k);
+            bool bnd = false;
+            for (uint i = 0; i < 4; ++i)
+            {
+                stex::Tet * next = (*t)->nextTet(i);
+                if (next == 0) continue;
+                if (pParTetDomain[next->idx()] == pParDomainOf[s - 1]) continue;
+                diff->setDomainBnd(i, true);
+                bnd = true;
+            }
+            if (bnd) d->bndDiffs.push_back(diff);
+        }
+    }
+    TriPVecCI tri_e = pTriOrder.end();
+    for (TriPVecCI t = pTriOrder.begin(); t != tri_e; ++t)
+    {
+        if ((*t) == 0 || (*t)->countKProcs() == 0) continue;
+        assert ((*t)->iTet() != 0);
+        stex::NSMDomain * d = pParDomains[pParTetDomain[(*t)->iTet()->idx()]];
+        pParDomainOf[s] = pParTetDomain[(*t)->iTet()->idx()];
+        pParLocal[s] = d->subvols.size();
+        d->subvols.push_back(s++);
+    }
+    assert (s == nsubvols);
+
+    uint nbnd = 0;
+    for (uint i = 0; i < n; ++i)
+    {
+        stex::NSMDomain * d = pParDomains[i];
+        d->queue.init(d->subvols.size());
+        d->dirty.reserve(d->subvols.size());
+        nbnd += d->bndDiffs.size();
+    }
+    // A delivery touches at most four rows per rule.
+    pParRows.reserve(4 * nbnd);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parClear(void)
+{
+    _parStopPool();
+    uint ndomains = pParDomains.size();
+    for (uint i = 0; i < ndomains; i++)
+    {
+        stex::NSMDomain * d = pParDomains[i];
+        uint nbnd = d->bndDiffs.size();
+        for (uint b = 0; b < nbnd; b++)
+        {
+            for (uint dir = 0; dir < 4; ++dir)
+            {
+                d->bndDiffs[b]->setDomainBnd(dir, false);
+            }
+        }
+        delete d->rng;
+        delete d;
+    }
+    pParDomains.clear();
+    pParDomainOf.clear();
+    pParLocal.clear();
+    pParTetDomain.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parStartPool(void)
+{
+#ifdef STEPS_TETEXACT_THREADS
+    uint nworkers = pParDomains.size();
+    if (nworkers < 2) return;
+
+    stex::ParPool * pool = new stex::ParPool();
+    pthread_mutex_init(&pool->lock, 0);
+    pthread_cond_init(&pool->start, 0);
+    pthread_cond_init(&pool->done, 0);
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->quit = false;
+    pool->endtime = 0.0;
+    pool->args.resize(nworkers);
+    pParPool = pool;
+
+    // Worker 0 is the calling thread. If a thread cannot be created, the
+    // domains run on the calling thread instead, with the same result.
+    for (uint w = 1; w < nworkers; ++w)
+    {
+        pool->args[w].solver = this;
+        pool->args[w].worker = w;
+        pthread_t th;
+        if (pthread_create(&th, 0, par_worker, &pool->args[w]) != 0)
+        {
+            _parStopPool();
+            return;
+        }
+        pool->threads.push_back(th);
+    }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parStopPool(void)
+{
+#ifdef STEPS_TETEXACT_THREADS
+    stex::ParPool * pool = pParPool;
+    if (pool == 0) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    uint nthreads = pool->threads.size();
+    for (uint i = 0; i < nthreads; ++i)
+    {
+        pthread_join(pool->threads[i], 0);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    delete pool;
+    pParPool = 0;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parWork(uint w)
+{
+#ifdef STEPS_TETEXACT_THREADS
+    stex::ParPool * pool = pParPool;
+    uint seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    while (true)
+    {
+        while (pool->generation == seen && pool->quit == false)
+        {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->quit == true) break;
+        seen = pool->generation;
+        double endtime = pool->endtime;
+        pthread_mutex_unlock(&pool->lock);
+
+        _parRun(*pParDomains[w], endtime);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_runParallel(double endtime)
+{
+    // The domains update the running totals concurrently, so point them
+    // at per-domain scratch space and recompute the totals afterwards.
+    TetPVecCI tet_end = pTets.end();
+    for (TetPVecCI t = pTets.begin(); t != tet_end; ++t)
+    {
+        if ((*t) == 0) continue;
+        (*t)->setTotalsStorage(&pParDomains[pParTetDomain[(*t)->idx()]]->totals[0]);
+    }
+    TriPVecCI tri_end = pTris.end();
+    for (TriPVecCI t = pTris.begin(); t != tri_end; ++t)
+    {
+        if ((*t) == 0) continue;
+        (*t)->setTotalsStorage(&pParDomains[pParTetDomain[(*t)->iTet()->idx()]]->totals[0]);
+    }
+
+    uint ndomains = pParDomains.size();
+    while (statedef()->time() < endtime)
+    {
+        double synct = std::min(statedef()->time() + pParDT, endtime);
+        _parRunAll(synct);
+
+        statedef()->setTime(synct);
+        for (uint i = 0; i < ndomains; i++)
+        {
+            stex::NSMDomain * d = pParDomains[i];
+            if (d->nsteps != 0) statedef()->incNSteps(d->nsteps);
+            d->nsteps = 0;
+            _updateA0(d->a0delta);
+            d->a0delta = 0.0;
+        }
+        _parFlush();
+    }
+
+    CompPVecCI comp_e = pComps.end();
+    for (CompPVecCI c = pComps.begin(); c != comp_e; ++c) (*c)->resetTotalsStorage();
+    PatchPVecCI patch_e = pPatches.end();
+    for (PatchPVecCI p = pPatches.begin(); p != patch_e; ++p) (*p)->resetTotalsStorage();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_parRunAll(double endtime)
+{
+#ifdef STEPS_TETEXACT_THREADS
+    stex::ParPool * pool = pParPool;
+    if (pool != 0)
+    {
+        pthread_mutex_lock(&pool->lock);
+        pool->endtime = endtime;
+        pool->pending = pool->threads.size();
+        pool->generation++;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+
+        _parRun(*pParDomains[0], endtime);
+
+        pthread_mutex_lock(&pool->lock);
+        while (pool->pending != 0)
+        {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+#endif
+    uint ndomains = pParDomains.size();
+    for (uint i = 0; i < ndomains; i++)
+    {
+        _parRun(*pParDomains[i], endtime);
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-bool stex::Tetexact::_getDiffBoundaryDiffusionActive(uint dbidx, uint sidx) const
+void stex::Tetexact::_parRun(stex::NSMDomain & d, double endtime)
 {
-	assert (dbidx < statedef()->countDiffBoundaries());
-	assert (sidx < statedef()->countSpecs());
-
-	stex::DiffBoundary * diffb = _diffboundary(dbidx);
-	stex::Comp * compA = diffb->compA();
-	stex::Comp * compB = diffb->compB();
+    while (d.queue.topTime() <= endtime)
+    {
+        _parExecute(d, d.queue.top(), d.queue.topTime());
+        d.nsteps++;
+    }
+}
 
-	uint lsidxA = compA->def()->specG2L(sidx);
-	uint lsidxB = compB->def()->specG2L(sidx);
+////////////////////////////////////////////////////////////////////////////////
 
-	if (lsidxA == ssolver::LIDX_UNDEFINED or lsidxB == ssolver::LIDX_UNDEFINED)
-	{
-		std::ostringstream os;
-		os << "Species undefined in compartments connected by diffusion boundary.\n";
-		throw steps::ArgErr(os.str());
-	}
+stex::KProc * stex::Tetexact::_parExecute(stex::NSMDomain & d, uint l, double t)
+{
+    uint s = d.subvols[l];
+    assert(pNSMSum[s] > 0.0);
+
+    // As in _executeNSMStep, but with the stream of the domain and
+    // without touching the state of other domains.
+    uint k = pNSMOffsets[s];
+    uint last = pNSMOffsets[s + 1] - 1;
+    double selector = pNSMSum[s] * d.rng->getUnfIE();
+    for (; k < last; ++k)
+    {
+        double rate = pKProcs[k]->crData.rate;
+        if (selector < rate) break;
+        selector -= rate;
+    }
+    while (pKProcs[k]->crData.rate <= 0.0) --k;
 
-	std::vector<uint> bdtets = diffb->getTets();
-	std::vector<uint> bdtetsdir = diffb->getTetDirection();
+    uint upd = kproc_apply(pKProcs[k], d.rng);
+    _nsmMark(s);
+    d.fired = s;
+    uint end = pDepOffsets[upd + 1];
+    for (uint i = pDepOffsets[upd]; i < end; i++)
+    {
+        _updateElement(pKProcs[pDepIdx[i]]);
+    }
+    _parRefresh(d, t);
+    d.fired = pNSMSum.size();
+    return pKProcs[k];
+}
 
-	// Have to use indices rather than iterator because need access to the
-	// tet direction
+////////////////////////////////////////////////////////////////////////////////
 
-	uint ntets = bdtets.size();
+void stex::Tetexact::_parRefresh(stex::NSMDomain & d, double now)
+{
+    uint n_dirty = d.dirty.size();
+    for (uint i = 0; i < n_dirty; i++)
+    {
+        uint s = d.dirty[i];
+        pNSMIsDirty[s] = false;
 
-	for (uint bdt = 0; bdt != ntets; ++bdt)
-	{
-		stex::Tet * tet = _tet(bdtets[bdt]);
-		uint direction = bdtetsdir[bdt];
-		assert(direction >= 0 and direction < 4);
+        double sum = 0.0;
+        uint end = pNSMOffsets[s + 1];
+        for (uint k = pNSMOffsets[s]; k < end; k++)
+        {
+            sum += pKProcs[k]->crData.rate;
+        }
+        double old_sum = pNSMSum[s];
+        d.a0delta += sum - old_sum;
+        pNSMSum[s] = sum;
 
-		// Each diff kproc then has access to the species through it's defined parent
-		uint ndiffs = tet->compdef()->countDiffs();
-		for (uint d = 0; d != ndiffs; ++d)
-		{
-			stex::Diff * diff = tet->diff(d);
-			// sidx is the global species index; so is the lig() return from diffdef
-			uint specgidx = diff->def()->lig();
-			if (specgidx == sidx)
-			{
-				// Just need to check the first one
-				if (diff->getDiffBndActive(direction)) return true;
-				else return false;
-			}
-		}
-	}
-	return false;
+        uint l = pParLocal[s];
+        double t = std::numeric_limits<double>::infinity();
+        if (sum > 0.0)
+        {
+            if (s == d.fired || old_sum <= 0.0)
+            {
+                t = now + d.rng->getExp(sum);
+            }
+            else
+            {
+                t = now + (d.queue.time(l) - now) * (old_sum / sum);
+            }
+        }
+        d.queue.update(l, t);
+    }
+    d.dirty.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::addKProc(steps::tetexact::KProc * kp)
+void stex::Tetexact::_parRefreshAll(void)
 {
-	assert (kp != 0);
-
-	SchedIDX nidx = pKProcs.size();
-	pKProcs.push_back(kp);
-	kp->setSchedIDX(nidx);
+    double now = statedef()->time();
+    uint ndomains = pParDomains.size();
+    for (uint i = 0; i < ndomains; i++)
+    {
+        stex::NSMDomain * d = pParDomains[i];
+        _parRefresh(*d, now);
+        _updateA0(d->a0delta);
+        d->a0delta = 0.0;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::_build(void)
+void stex::Tetexact::_parFlush(stex::Diff * diff)
 {
+    pParRows.clear();
+    if (diff != 0) diff->domainFlush(pParRows);
+    uint ndomains = (diff != 0) ? 0 : pParDomains.size();
+    for (uint i = 0; i < ndomains; i++)
+    {
+        stex::NSMDomain * d = pParDomains[i];
+        uint nbnd = d->bndDiffs.size();
+        for (uint b = 0; b < nbnd; b++)
+        {
+            d->bndDiffs[b]->domainFlush(pParRows);
+        }
+    }
+
+    _beginUpdList();
+    uint nrows = pParRows.size();
+    for (uint r = 0; r < nrows; r++)
+    {
+        uint row = pParRows[r];
+        uint end = pDepOffsets[row + 1];
+        for (uint i = pDepOffsets[row]; i < end; i++)
+        {
+            _addToUpdList(pKProcs[pDepIdx[i]]);
+        }
+    }
+    _update(pUpdList);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-steps::tetexact::KProc * stex::Tetexact::_getNext(void) const
+void stex::Tetexact::_freeGroups(void)
 {
-    #ifdef SSA_DEBUG
-    std::cout << "SSA: Search for next event\n";
-    #endif
-    assert(pA0 >= 0.0);
-    // Quick check to see whether nothing is there.
-    if (pA0 == 0.0) return NULL;
-    
-    double selector = pA0 * rng()->getUnfII();
-    
-    #ifdef SSA_DEBUG
-    std::cout << "selector: " << selector << " in total " << pA0 << "\n";
-    #endif
+    uint ngroups = nGroups.size();
+    for (uint i = 0; i < ngroups; i++) {
+        free(nGroups[i]->entries);
+        delete nGroups[i];
+    }
+    nGroups.clear();
     
-    double partial_sum = 0.0;
+    ngroups = pGroups.size();
+    for (uint i = 0; i < ngroups; i++) {
+        free(pGroups[i]->entries);
+        delete pGroups[i];
+    }
+    pGroups.clear();
     
-    uint n_neg_groups = nGroups.size();
-    uint n_pos_groups = pGroups.size();
+    pTreeLeaves = 0;
+    pGroupTree.clear();
+    pTreeGroups.clear();
+    pDirtyGroups.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool stex::Tetexact::_leapBefore(double t)
+{
+    if (pLeapDT <= 0.0 || t <= pLeapNext) return false;
+    statedef()->setTime(pLeapNext);
+    _leapDiffusion();
+    pLeapNext += pLeapDT;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_leapDiffusion(void)
+{
+    // All draws are made on the pools at the start of the step, so the
+    // result does not depend on the order of the rules.
+    uint nleaps = pLeapDiffs.size();
+    for (uint i = 0; i < nleaps; i++) {
+        pLeapDiffs[i]->leapDraw(pLeapDT, rng());
+    }
+    pLeapRows.clear();
+    for (uint i = 0; i < nleaps; i++) {
+        pLeapDiffs[i]->leapApply(pLeapRows);
+    }
     
-    for (uint i = 0; i < n_neg_groups; i++) {
-        CRGroup* group = nGroups[i];
-        if (group->size == 0) continue;
-
-        if (selector > partial_sum + group->sum) {
-            partial_sum += group->sum;
-            #ifdef SSA_DEBUG
-            std::cout << "increase partial sum to " << partial_sum;
-            std::cout << " by neg group " << i << "\n";
-            #endif            
-            continue;
-        }
-        
-        double g_max = group->max;
-        double random_rate = g_max * rng()->getUnfII();;
-        uint group_size = group->size;
-        uint random_pos = rng()->get() % group_size;
-        KProc* random_kp = group->indices[random_pos];
-        
-        #ifdef SSA_DEBUG
-        std::cout << "search for event\n";
-        std::cout << "group max: " << g_max << "\n";
-        std::cout << "random rate: " << random_rate << "\n";
-        std::cout << "random pos " << random_pos << "\n";
-        std::cout << "random kp rate " << random_kp->crData.rate << "\n";
-        #endif
-        
-        while (random_kp->crData.rate <= random_rate) {
-            random_rate = g_max * rng()->getUnfII();
-            random_pos = rng()->get() % group_size;
-            random_kp = group->indices[random_pos];
-            #ifdef SSA_DEBUG
-            std::cout << "renew search\n";
-            std::cout << "random rate: " << random_rate << "\n";
-            std::cout << "random pos " << random_pos << "\n";
-            std::cout << "random kp rate " << random_kp->crData.rate << "\n";
-            #endif
+    _beginUpdList();
+    uint nrows = pLeapRows.size();
+    for (uint r = 0; r < nrows; r++) {
+        uint row = pLeapRows[r];
+        uint end = pDepOffsets[row + 1];
+        for (uint i = pDepOffsets[row]; i < end; i++) {
+            _addToUpdList(pKProcs[pDepIdx[i]]);
         }
-        
-        #ifdef SSA_DEBUG
-        std::cout << "selected kp index: " << random_kp->schedIDX() << "\n";
-        std::cout << "--------------------------------------------------------\n";
-        #endif
-        return random_kp;        
     }
-    
-    for (uint i = 0; i < n_pos_groups; i++) {
-        CRGroup* group = pGroups[i];
-        if (group->size == 0) continue;
+    // Counts have moved, so rules may cross the threshold either way.
+    _classifyLeapDiffs();
+    _update(pUpdList);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_classifyLeapDiffs(void)
+{
+    pLeapDiffs.clear();
+    uint nkprocs = pKProcs.size();
+    for (uint k = 0; k < nkprocs; k++) {
+        KProc * kp = pKProcs[k];
+        if (kp->type() != KProc::TYPE_DIFF) continue;
+        stex::Diff * diff = static_cast<stex::Diff*>(kp);
         
-        if (selector > partial_sum + group->sum) {
-            partial_sum += group->sum;
-            #ifdef SSA_DEBUG
-            std::cout << "increase partial sum to " << partial_sum;
-            std::cout << " by neg group " << i << "\n";
-            #endif            
-            continue;
+        bool leap = false;
+        if (pLeapDT > 0.0) {
+            leap = pLeapSpec[diff->def()->lig()]
+                || (pLeapThreshold != 0 && diff->count() >= pLeapThreshold);
         }
-        
-        double g_max = group->max;
-        double random_rate = g_max * rng()->getUnfII();;
-        uint group_size = group->size;
-        uint random_pos = rng()->get() % group_size;
-        KProc* random_kp = group->indices[random_pos];
-        
-        #ifdef SSA_DEBUG
-        std::cout << "search for event\n";
-        std::cout << "group max: " << g_max << "\n";
-        std::cout << "random rate: " << random_rate << "\n";
-        std::cout << "random pos " << random_pos << "\n";
-        std::cout << "random kp rate " << random_kp->crData.rate << "\n";
-        #endif
-        
-        while (random_kp->crData.rate <= random_rate) {
-            random_rate = g_max * rng()->getUnfII();
-            random_pos = rng()->get() % group_size;
-            random_kp = group->indices[random_pos];
-            #ifdef SSA_DEBUG
-            std::cout << "renew search\n";
-            std::cout << "random rate: " << random_rate << "\n";
-            std::cout << "random pos " << random_pos << "\n";
-            std::cout << "random kp rate " << random_kp->crData.rate << "\n";
-            #endif
+        if (leap != diff->leaped()) {
+            diff->setLeaped(leap);
+            _addToUpdList(diff);
         }
-        
-        #ifdef SSA_DEBUG
-        std::cout << "selected kp index: " << random_kp->schedIDX() << "\n";
-        std::cout << "--------------------------------------------------------\n";
-        #endif
-        return random_kp;        
-    }    
-    
-        
-    std::cerr << "Cannot find any suitable entry.\n";
-    std::cerr << "A0: " << std::setprecision (15) << pA0 << "\n";
-    std::cerr << "Selector: " << std::setprecision (15) << selector << "\n";
-    std::cerr << "Current Partial Sum: " << std::setprecision (15) << partial_sum << "\n";
-    
-    std::cerr << "Distribution of group sums\n";
-    std::cerr << "Negative groups\n";
-    
-    for (uint i = 0; i < n_neg_groups; i++) {
-        std::cerr << i << ": " << std::setprecision (15) << nGroups[i]->sum << "\n"; 
-    }
-    std::cerr << "Positive groups\n";
-    for (uint i = 0; i < n_pos_groups; i++) {
-        std::cerr << i << ": " << std::setprecision (15) << pGroups[i]->sum << "\n"; 
+        if (leap) pLeapDiffs.push_back(diff);
     }
-    
-    throw;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::_reset(void)
+void stex::Tetexact::_updateSpec(steps::tetexact::Tet * tet, uint spec_lidx)
 {
-    _update();
+    _update(tet->specDepRow(spec_lidx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::_executeStep(steps::tetexact::KProc * kp, double dt)
+void stex::Tetexact::_updateSpec(steps::tetexact::Tri * tri, uint spec_lidx)
 {
-    //std::cout << "passe1\n";
-    std::vector<KProc*> const & upd = kp->apply(rng());
-	//std::cout << "passe2\n";
-    _update(upd);
-    //std::cout << "passe3\n";
-    statedef()->incTime(dt);
-    statedef()->incNSteps();
+    _update(tri->specDepRow(spec_lidx));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::_updateSpec(steps::tetexact::Tet * tet, uint spec_lidx)
+void stex::Tetexact::_updateCompSpec(steps::tetexact::Comp * comp, uint spec_lidx)
 {
-    std::set<stex::KProc*> updset;
-
-    // Loop over tet.
-    KProcPVecCI kproc_end = tet->kprocEnd();
-    for (KProcPVecCI k = tet->kprocBegin(); k != kproc_end; ++k)
-    {
-        updset.insert(*k);
-    }
-
-    // Loop over neighbouring triangles.
-    for (uint i = 0; i < 4; ++i)
+    // The rows of a tet also hold the surface reactions of its triangles
+    // that read the species. A triangle only sees one tet per compartment,
+    // so no kproc is visited twice.
+    TetPVecCI t_end = comp->endTet();
+    for (TetPVecCI t = comp->bgnTet(); t != t_end; ++t)
     {
-        Tri * tri = tet->nextTri(i);
-        if (tri == 0) continue;
-        kproc_end = tri->kprocEnd();
-        for (KProcPVecCI k = tri->kprocBegin(); k != kproc_end; ++k)
+        uint row = (*t)->specDepRow(spec_lidx);
+        uint end = pDepOffsets[row + 1];
+        for (uint i = pDepOffsets[row]; i < end; i++)
         {
-            updset.insert(*k);
+            _updateElement(pKProcs[pDepIdx[i]]);
         }
     }
-
-    // Send the list of kprocs that need to be updated to the schedule.
-    if (updset.empty()) return;
-    std::vector<KProc*> updvec(updset.begin(), updset.end());
-
-    _update(updvec);
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void stex::Tetexact::_updateSpec(steps::tetexact::Tri * tri, uint spec_lidx)
+void stex::Tetexact::_updatePatchSpec(steps::tetexact::Patch * patch, uint spec_lidx)
 {
-    std::set<stex::KProc*> updset;
-
-    KProcPVecCI kproc_end = tri->kprocEnd();
-    for (KProcPVecCI k = tri->kprocBegin(); k != kproc_end; ++k)
+    TriPVecCI t_end = patch->endTri();
+    for (TriPVecCI t = patch->bgnTri(); t != t_end; ++t)
     {
-        updset.insert(*k);
+        uint row = (*t)->specDepRow(spec_lidx);
+        uint end = pDepOffsets[row + 1];
+        for (uint i = pDepOffsets[row]; i < end; i++)
+        {
+            _updateElement(pKProcs[pDepIdx[i]]);
+        }
     }
-
-    // Send the list of kprocs that need to be updated to the schedule.
-    if (updset.empty()) return;
-    
-    std::vector<stex::KProc*> updvec(updset.begin(), updset.end());
-
-    _update(updvec);
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2405,6 +3899,87 @@ void stex::Tetexact::_setTetCount(uint tidx, uint sidx, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void stex::Tetexact::_getBatchTetCounts(uint const * indices, uint n,
+                                       uint sidx, double * counts) const
+{
+	assert (sidx < statedef()->countSpecs());
+
+	for (uint i = 0; i < n; ++i)
+	{
+		assert (indices[i] < pTets.size());
+		stex::Tet * tet = pTets[indices[i]];
+		if (tet == 0)
+		{
+			std::ostringstream os;
+			os << "Tetrahedron " << indices[i] << " has not been assigned to a compartment.";
+			throw steps::ArgErr(os.str());
+		}
+		uint lsidx = tet->compdef()->specG2L(sidx);
+		if (lsidx == ssolver::LIDX_UNDEFINED)
+		{
+			std::ostringstream os;
+			os << "Species undefined in tetrahedron " << indices[i] << ".\n";
+			throw steps::ArgErr(os.str());
+		}
+		counts[i] = tet->pools()[lsidx];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_setBatchTetCounts(uint const * indices, uint n,
+                                       uint sidx, double const * counts)
+{
+	assert (sidx < statedef()->countSpecs());
+
+	// Check everything first, so that a bad entry leaves the state alone.
+	for (uint i = 0; i < n; ++i)
+	{
+		assert (indices[i] < pTets.size());
+		assert (counts[i] >= 0.0);
+		stex::Tet * tet = pTets[indices[i]];
+		if (tet == 0)
+		{
+			std::ostringstream os;
+			os << "Tetrahedron " << indices[i] << " has not been assigned to a compartment.";
+			throw steps::ArgErr(os.str());
+		}
+		if (tet->compdef()->specG2L(sidx) == ssolver::LIDX_UNDEFINED)
+		{
+			std::ostringstream os;
+			os << "Species undefined in tetrahedron " << indices[i] << ".\n";
+			throw steps::ArgErr(os.str());
+		}
+		if (counts[i] > std::numeric_limits<unsigned int>::max( ))
+		{
+			std::ostringstream os;
+			os << "Can't set count greater than maximum unsigned integer (";
+			os << std::numeric_limits<unsigned int>::max( ) << ").\n";
+			throw steps::ArgErr(os.str());
+		}
+	}
+
+	for (uint i = 0; i < n; ++i)
+	{
+		stex::Tet * tet = pTets[indices[i]];
+		uint lsidx = tet->compdef()->specG2L(sidx);
+
+		double n_int = std::floor(counts[i]);
+		double n_frc = counts[i] - n_int;
+		uint c = static_cast<uint>(n_int);
+		if (n_frc > 0.0)
+		{
+			double rand01 = rng()->getUnfIE();
+			if (rand01 < n_frc) c++;
+		}
+
+		tet->setCount(lsidx, c);
+		_updateSpec(tet, lsidx);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double stex::Tetexact::_getTetAmount(uint tidx, uint sidx) const
 {
 	// following method does all necessary argument checking
@@ -2562,7 +4137,7 @@ void stex::Tetexact::_setTetReacK(uint tidx, uint ridx, double kf)
 	tet->reac(lridx)->setKcst(kf);
 
 	_updateElement(tet->reac(lridx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2620,7 +4195,7 @@ void stex::Tetexact::_setTetReacActive(uint tidx, uint ridx, bool act)
 	tet->reac(lridx)->setActive(act);
 
 	_updateElement(tet->reac(lridx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2678,7 +4253,7 @@ void stex::Tetexact::_setTetDiffD(uint tidx, uint didx, double dk)
 	tet->diff(ldidx)->setDcst(dk);
 
 	_updateElement(tet->diff(ldidx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2736,7 +4311,7 @@ void stex::Tetexact::_setTetDiffActive(uint tidx, uint didx, bool act)
 	tet->diff(ldidx)->setActive(act);
 
 	_updateElement(tet->diff(ldidx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2958,6 +4533,87 @@ void stex::Tetexact::_setTriCount(uint tidx, uint sidx, double n)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+void stex::Tetexact::_getBatchTriCounts(uint const * indices, uint n,
+                                       uint sidx, double * counts) const
+{
+	assert (sidx < statedef()->countSpecs());
+
+	for (uint i = 0; i < n; ++i)
+	{
+		assert (indices[i] < pTris.size());
+		stex::Tri * tri = pTris[indices[i]];
+		if (tri == 0)
+		{
+			std::ostringstream os;
+			os << "Triangle " << indices[i] << " has not been assigned to a patch.";
+			throw steps::ArgErr(os.str());
+		}
+		uint lsidx = tri->patchdef()->specG2L(sidx);
+		if (lsidx == ssolver::LIDX_UNDEFINED)
+		{
+			std::ostringstream os;
+			os << "Species undefined in triangle " << indices[i] << ".\n";
+			throw steps::ArgErr(os.str());
+		}
+		counts[i] = tri->pools()[lsidx];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void stex::Tetexact::_setBatchTriCounts(uint const * indices, uint n,
+                                       uint sidx, double const * counts)
+{
+	assert (sidx < statedef()->countSpecs());
+
+	// Check everything first, so that a bad entry leaves the state alone.
+	for (uint i = 0; i < n; ++i)
+	{
+		assert (indices[i] < pTris.size());
+		assert (counts[i] >= 0.0);
+		stex::Tri * tri = pTris[indices[i]];
+		if (tri == 0)
+		{
+			std::ostringstream os;
+			os << "Triangle " << indices[i] << " has not been assigned to a patch.";
+			throw steps::ArgErr(os.str());
+		}
+		if (tri->patchdef()->specG2L(sidx) == ssolver::LIDX_UNDEFINED)
+		{
+			std::ostringstream os;
+			os << "Species undefined in triangle " << indices[i] << ".\n";
+			throw steps::ArgErr(os.str());
+		}
+		if (counts[i] > std::numeric_limits<unsigned int>::max( ))
+		{
+			std::ostringstream os;
+			os << "Can't set count greater than maximum unsigned integer (";
+			os << std::numeric_limits<unsigned int>::max( ) << ").\n";
+			throw steps::ArgErr(os.str());
+		}
+	}
+
+	for (uint i = 0; i < n; ++i)
+	{
+		stex::Tri * tri = pTris[indices[i]];
+		uint lsidx = tri->patchdef()->specG2L(sidx);
+
+		double n_int = std::floor(counts[i]);
+		double n_frc = counts[i] - n_int;
+		uint c = static_cast<uint>(n_int);
+		if (n_frc > 0.0)
+		{
+			double rand01 = rng()->getUnfIE();
+			if (rand01 < n_frc) c++;
+		}
+
+		tri->setCount(lsidx, c);
+		_updateSpec(tri, lsidx);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 double stex::Tetexact::_getTriAmount(uint tidx, uint sidx) const
 {
 	// following method does all necessary argument checking
@@ -3084,7 +4740,7 @@ void stex::Tetexact::_setTriSReacK(uint tidx, uint ridx, double kf)
 	tri->sreac(lsridx)->setKcst(kf);
 
 	_updateElement(tri->sreac(lsridx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3142,7 +4798,7 @@ void stex::Tetexact::_setTriSReacActive(uint tidx, uint ridx, bool act)
 	tri->sreac(lsridx)->setActive(act);
 
 	_updateElement(tri->sreac(lsridx));
-    _updateSum();
+    _updateDone();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3234,14 +4890,24 @@ void stex::Tetexact::_updateElement(KProc* kp)
     std::cout << "SSA: Update KProc element " << kp->schedIDX() << "\n";
 #endif
     
-    double new_rate = kp->rate();
+    double new_rate = kproc_rate(kp);
     
 #ifdef SSA_DEBUG
     std::cout << "new rate: " << new_rate << "\n";
 #endif
     
+    if (pEngine != ENGINE_CR) {
+        // The subvolume sum is recomputed in _nsmRefresh or _parRefresh.
+        if (new_rate != kp->crData.rate) {
+            kp->crData.rate = new_rate;
+            _nsmMark(pNSMSubvol[kp->schedIDX()]);
+        }
+        return;
+    }
+    
     CRKProcData & data = kp->crData;
     double old_rate = data.rate;
+    bool old_recorded = data.recorded;
     
     data.rate = new_rate;
     
@@ -3280,6 +4946,8 @@ void stex::Tetexact::_updateElement(KProc* kp)
 #endif
             
             old_group->sum += (new_rate - old_rate);
+            old_group->entries[data.pos].rate = new_rate;
+            _markGroup(old_group);
             
 #ifdef SSA_DEBUG
             std::cout << "new group sum: " << old_group->sum << " new pSum " << pSum << "\n";
@@ -3303,10 +4971,11 @@ void stex::Tetexact::_updateElement(KProc* kp)
                 else {
                     old_group->sum -= old_rate;
                     
-                    KProc* last = old_group->indices[old_group->size];
-                    old_group->indices[data.pos] = last;
-                    last->crData.pos = data.pos;
+                    CRGroupEntry & last = old_group->entries[old_group->size];
+                    old_group->entries[data.pos] = last;
+                    last.kproc->crData.pos = data.pos;
                 }
+                _markGroup(old_group);
             }
             
             // add new
@@ -3320,9 +4989,11 @@ void stex::Tetexact::_updateElement(KProc* kp)
             assert(new_group != NULL);
             if (new_group->size == new_group->capacity) _extendGroup(new_group);
             uint pos = new_group->size;
-            new_group->indices[pos] = kp;
+            new_group->entries[pos].rate = new_rate;
+            new_group->entries[pos].kproc = kp;
             new_group->size++;
             new_group->sum += new_rate;
+            _markGroup(new_group);
             data.pos = pos;
             
         }
@@ -3348,6 +5019,8 @@ void stex::Tetexact::_updateElement(KProc* kp)
 #endif
             
             old_group->sum += (new_rate - old_rate);
+            old_group->entries[data.pos].rate = new_rate;
+            _markGroup(old_group);
             
 #ifdef SSA_DEBUG
             std::cout << "new group sum: " << old_group->sum << " new nSum " << nSum << "\n";
@@ -3369,10 +5042,11 @@ void stex::Tetexact::_updateElement(KProc* kp)
                 else {
                     old_group->sum -= old_rate;
                     
-                    KProc* last = old_group->indices[old_group->size];
-                    old_group->indices[data.pos] = last;
-                    last->crData.pos = data.pos;
+                    CRGroupEntry & last = old_group->entries[old_group->size];
+                    old_group->entries[data.pos] = last;
+                    last.kproc->crData.pos = data.pos;
                 }
+                _markGroup(old_group);
             }
             
             // add new
@@ -3386,9 +5060,11 @@ void stex::Tetexact::_updateElement(KProc* kp)
             
             if (new_group->size == new_group->capacity) _extendGroup(new_group);
             uint pos = new_group->size;
-            new_group->indices[pos] = kp;
+            new_group->entries[pos].rate = new_rate;
+            new_group->entries[pos].kproc = kp;
             new_group->size++;
             new_group->sum += new_rate;
+            _markGroup(new_group);
             data.pos = pos;
             
         }
@@ -3410,14 +5086,21 @@ void stex::Tetexact::_updateElement(KProc* kp)
             else {
                 old_group->sum -= old_rate;
                 
-                KProc* last = old_group->indices[old_group->size];
-                old_group->indices[data.pos] = last;
-                last->crData.pos = data.pos;
+                CRGroupEntry & last = old_group->entries[old_group->size];
+                old_group->entries[data.pos] = last;
+                last.kproc->crData.pos = data.pos;
             }
+            _markGroup(old_group);
         }
         data.recorded = false;
     }
     
+    // Only recorded entries contribute to the group sums, so the running
+    // total moves by the change in recorded propensity.
+    double old_contrib = (old_recorded ? old_rate : 0.0);
+    double new_contrib = (data.recorded ? new_rate : 0.0);
+    if (new_contrib != old_contrib) _updateA0(new_contrib - old_contrib);
+    
 #ifdef SSA_DEBUG
     std::cout << "--------------------------------------------------------\n";
 #endif
@@ -51,6 +51,7 @@
 #include "patch.hpp"
 #include "diffboundary.hpp"
 #include "crstruct.hpp"
+#include "nsmstruct.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +61,7 @@ START_NAMESPACE(tetexact)
 ////////////////////////////////////////////////////////////////////////////////
 
 // Forward declarations.
+struct ParPool;
 
 // Auxiliary declarations.
 typedef uint                            SchedIDX;
@@ -84,7 +86,15 @@ class Tetexact: public steps::solver::API
 
 public:
 
-    Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
+    /// With reorder set, the tets of each compartment and the triangles
+    /// of each patch are laid out along a Hilbert curve through their
+    /// barycenters, triangles following their inner tet, instead of in
+    /// mesh order. Neighbours then lie close together in memory, which
+    /// helps meshes from generators that number them far apart. The tet
+    /// and triangle indices seen by the user do not change.
+    ///
+    Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r,
+             bool reorder = false);
     ~Tetexact(void);
 
     steps::tetmesh::Tetmesh * mesh(void) const
@@ -110,6 +120,43 @@ public:
     void advanceSteps(uint nsteps);
     void step(void);
 
+    /// Select the simulation engine: "cr" (the default) samples the next
+    /// event from all kprocs with composition-rejection, "nsm" uses the
+    /// next-subvolume method with a queue of per tet / tri event times.
+    /// Both are exact; the state of the simulation carries over.
+    /// getEngine() returns "parallel" after setParallel().
+    ///
+    void setEngine(std::string const & engine);
+    std::string getEngine(void) const;
+
+    /// Select the parallel engine. The tets are split by recursive
+    /// coordinate bisection into nthreads spatially contiguous domains,
+    /// each with its own next-subvolume queue, random number stream and
+    /// thread. Tets coupled by a patch triangle stay in one domain.
+    /// Diffusion across a domain boundary is held back and delivered
+    /// every dt, so dt should be small compared with the time a molecule
+    /// stays in a tetrahedron. The result depends on the seed, nthreads
+    /// and dt, but not on the scheduling of the threads.
+    ///
+    void setParallel(uint nthreads, double dt);
+    uint getParallelThreads(void) const;
+    double getParallelSyncDT(void) const;
+
+    /// Operator-split diffusion: with a step dt > 0, the diffusion of the
+    /// selected species is advanced every dt by binomial draws instead of
+    /// one molecule at a time, while reactions and all other diffusion
+    /// stay exact. A species is leaped in a tetrahedron if it has been
+    /// selected with setSpecDiffLeap, or if the threshold is non-zero and
+    /// its count there has reached it. dt = 0 (the default) switches
+    /// leaping off.
+    ///
+    void setDiffLeapDT(double dt);
+    double getDiffLeapDT(void) const;
+    void setSpecDiffLeap(std::string const & s, bool leap);
+    bool getSpecDiffLeap(std::string const & s) const;
+    void setDiffLeapThreshold(uint n);
+    uint getDiffLeapThreshold(void) const;
+
     void checkpoint(std::string const & file_name);
     void restore(std::string const & file_name);
 
@@ -123,8 +170,66 @@ public:
     inline double getA0(void) const
     { return pA0;}
 
+    /// Return the number of times the running total propensity has been
+    /// recomputed exactly from the group sums to remove rounding drift.
+    ///
+    inline uint getA0Renorms(void) const
+    { return pA0Renorms; }
+
+    /// Return the number of times the update path has allocated memory,
+    /// i.e. grown the SSA group storage or the scratch update list. Once
+    /// the groups have settled, setters and steps leave it unchanged.
+    ///
+    inline uint getUpdAllocs(void) const
+    { return pUpdAllocs; }
+
     uint getNSteps(void) const;
 
+    ////////////////////////////////////////////////////////////////////////
+    // SOLVER STATE ACCESS:
+    //      PACKED COUNT MATRICES
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Return the indices of the tetrahedrons in compartment c, in the row
+    /// order of the compartment's packed count matrix.
+    std::vector<uint> getCompTetCountsTets(std::string const & c) const;
+
+    /// Return the names of the species in compartment c, in the column
+    /// order of the compartment's packed count matrix.
+    std::vector<std::string> getCompTetCountsSpecs(std::string const & c) const;
+
+    /// Return the indices of the triangles in patch p, in the row order
+    /// of the patch's packed count matrix.
+    std::vector<uint> getPatchTriCountsTris(std::string const & p) const;
+
+    /// Return the names of the species in patch p, in the column order of
+    /// the patch's packed count matrix.
+    std::vector<std::string> getPatchTriCountsSpecs(std::string const & p) const;
+
+    /// Return the packed count matrix of compartment c and its shape.
+    /// The matrix is owned by the solver and stays at the same address
+    /// for its lifetime; reset() and restore() overwrite it in place.
+    uint const * _getCompTetCounts(std::string const & c,
+                                   uint & ntets, uint & nspecs) const;
+
+    /// Return the packed count matrix of patch p and its shape.
+    uint const * _getPatchTriCounts(std::string const & p,
+                                    uint & ntris, uint & nspecs) const;
+
+    ////////////////////////////////////////////////////////////////////////
+    // SOLVER STATE ACCESS:
+    //      RANDOM PLACEMENT
+    ////////////////////////////////////////////////////////////////////////
+
+    /// Return the indices of n tetrahedrons of compartment c, each picked
+    /// independently with probability proportional to its volume, using
+    /// the solver's random number generator.
+    std::vector<uint> pickCompTets(std::string const & c, uint n);
+
+    /// Return the indices of n triangles of patch p, each picked
+    /// independently with probability proportional to its area.
+    std::vector<uint> pickPatchTris(std::string const & p, uint n);
+
     ////////////////////////////////////////////////////////////////////////
     // SOLVER STATE ACCESS:
     //      ADVANCE
@@ -220,6 +325,11 @@ public:
     double _getTetCount(uint tidx, uint sidx) const;
     void _setTetCount(uint tidx, uint sidx, double n);
 
+    void _getBatchTetCounts(uint const * indices, uint n, uint sidx,
+                            double * counts) const;
+    void _setBatchTetCounts(uint const * indices, uint n, uint sidx,
+                            double const * counts);
+
     bool _getTetSpecDefined(uint tidx, uint sidx) const;
 
     double _getTetAmount(uint tidx, uint sidx) const;
@@ -264,6 +374,11 @@ public:
     double _getTriCount(uint tidx, uint sidx) const;
     void _setTriCount(uint tidx, uint sidx, double n);
 
+    void _getBatchTriCounts(uint const * indices, uint n, uint sidx,
+                            double * counts) const;
+    void _setBatchTriCounts(uint const * indices, uint n, uint sidx,
+                            double const * counts);
+
     double _getTriAmount(uint tidx, uint sidx) const;
     void _setTriAmount(uint tidx, uint sidx, double m);
 
@@ -287,9 +402,23 @@ public:
 	// Called from local Comp or Patch objects. Ass KProc to this object
 	void addKProc(steps::tetexact::KProc * kp);
 
+	// Called from Tet and Tri::setupKProcs. Returns memory for a kproc of
+	// the given size from the kproc arena, which _setup sizes exactly.
+	void * _allocKProc(std::size_t size);
+
+	// Thread function of worker w > 0 of the parallel engine: run the
+	// domain of the worker to each synchronisation point until the
+	// pool is stopped.
+	void _parWork(uint w);
+
 	inline uint countKProcs(void) const
 	{ return pKProcs.size(); }
 
+	// Called from KProc::setupDeps. Sorts the schedule indices in deps,
+	// removes duplicates and appends them as a new row to the dependency
+	// graph. Returns the index of the row.
+	uint addDepRow(std::vector<uint> & deps);
+
 private:
 
 	////////////////////////////////////////////////////////////////////////
@@ -325,21 +454,88 @@ private:
 
 	void _executeStep(steps::tetexact::KProc * kp, double dt);
 
-    /// Update the kproc's of a tet, after a species has been changed.
-    /// This also updates kproc's in surrounding triangles.
-    ///
-    /// Currently doesn't care about the species.
+	// Fire a kproc of subvolume s, whose next event is at time t.
+	void _executeNSMStep(uint s, double t);
+
+	// Run the SSA of the selected engine until endtime, without leaps.
+	void _runSSA(double endtime);
+
+	// If the next SSA event, at time t, lies past the next leap, advance
+	// to the leap and perform it instead. The event is dropped, which is
+	// exact by memorylessness.
+	bool _leapBefore(double t);
+
+	// Advance all leaped diffusion rules by pLeapDT.
+	void _leapDiffusion(void);
+
+	// Decide which diffusion rules are leaped and rebuild pLeapDiffs.
+	// Rules that change mode are added to the update list.
+	void _classifyLeapDiffs(void);
+
+	// Free the CR groups and the group tree.
+	void _freeGroups(void);
+
+	// Drop all propensities and let engine e record them again.
+	void _switchEngine(uint e);
+
+	// Split the subvolumes into n domains and mark the diffusion rules
+	// that cross between them.
+	void _parPartition(uint n);
+
+	// Stop the threads, clear the boundary marks and free the domains.
+	void _parClear(void);
+
+	void _parStartPool(void);
+	void _parStopPool(void);
+
+	// Run the domains concurrently from the current time to endtime,
+	// delivering the diffusion across domains every pParDT.
+	void _runParallel(double endtime);
+
+	// Run every domain to endtime, on the worker threads if there are.
+	void _parRunAll(double endtime);
+
+	// Run one domain to endtime. Touches only the state of its own
+	// subvolumes, so domains can run concurrently.
+	void _parRun(NSMDomain & d, double endtime);
+
+	// Fire a kproc of the subvolume with index l in domain d, whose next
+	// event is at time t, and return it.
+	KProc * _parExecute(NSMDomain & d, uint l, double t);
+
+	// Refresh the marked subvolumes of domain d at time now.
+	void _parRefresh(NSMDomain & d, double now);
+
+	// Refresh the marked subvolumes of all domains at the current time
+	// and add their propensity changes to A0.
+	void _parRefreshAll(void);
+
+	// Deliver the diffusion held at the domain boundaries, or only that
+	// held by diff if given, and update the kprocs that depend on it.
+	void _parFlush(Diff * diff = 0);
+
+    /// Update the kproc's whose rate reads species spec_lidx of a tet,
+    /// after its count has been changed. This includes kproc's in the
+    /// surrounding triangles.
     ///
     void _updateSpec(steps::tetexact::Tet * tet, uint spec_lidx);
 
-    /// Update the kproc's of a triangle, after a species has been changed.
-    /// This does not need to update the kproc's of any neighbouring
-    /// tetrahedrons.
-    ///
-    /// Currently doesn't care about the species.
+    /// Update the kproc's whose rate reads species spec_lidx of a
+    /// triangle. No kproc's of neighbouring tetrahedrons read it.
     ///
     void _updateSpec(steps::tetexact::Tri * tri, uint spec_lidx);
 
+    /// Update the kproc's that read species spec_lidx in any tetrahedron
+    /// of a compartment, including the surface reactions of the patches
+    /// bordering it. Used by the compartment-wide setters.
+    ///
+    void _updateCompSpec(steps::tetexact::Comp * comp, uint spec_lidx);
+
+    /// Update the kproc's that read species spec_lidx in any triangle of
+    /// a patch.
+    ///
+    void _updatePatchSpec(steps::tetexact::Patch * patch, uint spec_lidx);
+
     ////////////////////////////////////////////////////////////////////////
     // LIST OF TETEXACT SOLVER OBJECTS
     ////////////////////////////////////////////////////////////////////////
@@ -362,6 +558,19 @@ private:
     { return pTets[tidx]; }
 
     std::vector<steps::tetexact::Tri *>        pTris;
+
+    // The tets and tris in the order in which their kprocs are laid out:
+    // mesh order, or arena order if the solver reorders.
+    std::vector<steps::tetexact::Tet *>        pTetOrder;
+    std::vector<steps::tetexact::Tri *>        pTriOrder;
+
+    // Contiguous storage for the Tet and Tri objects, which are created
+    // by placement new in compartment (patch) order and destroyed
+    // explicitly in the destructor.
+    char                                      * pTetArena;
+    uint                                        pTetArenaUsed;
+    char                                      * pTriArena;
+    uint                                        pTriArenaUsed;
     
 
     ////////////////////////////////////////////////////////////////////////
@@ -371,12 +580,110 @@ private:
     double                                      pSum;
     double                                      nSum;
     double                                      pA0;
+
+    // Running bound on the rounding error accumulated in pA0 since it
+    // was last recomputed from the group sums.
+    double                                      pA0Err;
+    uint                                        pA0Renorms;
     
     std::vector<KProc*>                         pKProcs;
+
+    // Arena holding the Diff, Reac and SReac objects in schedule order.
+    // Every object takes a slot rounded up to the alignment that
+    // operator new guarantees.
+    static inline std::size_t _kprocSlot(std::size_t size)
+    { return (size + 15) & ~std::size_t(15); }
+    char                                      * pKProcArena;
+    std::size_t                                 pKProcArenaSize;
+    std::size_t                                 pKProcArenaUsed;
+    
+    // Dependency graph in compressed sparse row form: the schedule
+    // indices of the kprocs to update after row r has been applied are
+    // pDepIdx[pDepOffsets[r]] to pDepIdx[pDepOffsets[r+1]-1].
+    std::vector<uint>                           pDepOffsets;
+    std::vector<uint>                           pDepIdx;
     
     std::vector<CRGroup*>                       nGroups;
     std::vector<CRGroup*>                       pGroups;
     
+    // Binary sum tree over the group sums, used to select a group in
+    // O(log G). Node 1 is the root, leaves start at pTreeLeaves. The
+    // CRGroup sums remain the reference; the tree only mirrors them.
+    uint                                        pTreeLeaves;
+    std::vector<double>                         pGroupTree;
+    std::vector<CRGroup*>                       pTreeGroups;
+    std::vector<CRGroup*>                       pDirtyGroups;
+    
+    // Leaped diffusion; see setDiffLeapDT. pLeapSpec is indexed by global
+    // species index, pLeapNext is the time of the next leap and pLeapRows
+    // collects the dependency rows touched by a leap.
+    double                                      pLeapDT;
+    double                                      pLeapNext;
+    uint                                        pLeapThreshold;
+    std::vector<bool>                           pLeapSpec;
+    std::vector<Diff*>                          pLeapDiffs;
+    std::vector<uint>                           pLeapRows;
+    
+    // Scratch list of kprocs to update, reused by the setters. A kproc is
+    // in the list when its crData.upd_gen equals pUpdGen. Reserved for
+    // all kprocs in _setup, so it never grows.
+    std::vector<KProc*>                         pUpdList;
+    unsigned                                    pUpdGen;
+    uint                                        pUpdAllocs;
+
+    static const uint                           ENGINE_CR = 0;
+    static const uint                           ENGINE_NSM = 1;
+    static const uint                           ENGINE_PAR = 2;
+    uint                                        pEngine;
+
+    ////////////////////////////////////////////////////////////////////////
+    // NSM Kernel Data and Methods
+    ////////////////////////////////////////////////////////////////////////
+
+    // Every tet and tri with kprocs is a subvolume. The kprocs of
+    // subvolume s have the schedule indices pNSMOffsets[s] to
+    // pNSMOffsets[s+1]-1, and pNSMSubvol maps a schedule index back to s.
+    std::vector<uint>                           pNSMOffsets;
+    std::vector<uint>                           pNSMSubvol;
+    // Propensity sum of each subvolume, recomputed from crData.rate
+    // whenever one of its kprocs has changed.
+    std::vector<double>                         pNSMSum;
+    NSMQueue                                    pNSMQueue;
+    // Subvolumes with changed kprocs, refreshed by _updateDone.
+    std::vector<uint>                           pNSMDirty;
+    // Bytes rather than bits, so that domains can mark concurrently.
+    std::vector<unsigned char>                  pNSMIsDirty;
+    // The subvolume being fired by _executeNSMStep, or the number of
+    // subvolumes outside a step.
+    uint                                        pNSMFired;
+
+    inline void _nsmMark(uint s) {
+        if (pNSMIsDirty[s]) return;
+        pNSMIsDirty[s] = true;
+        if (pEngine == ENGINE_PAR) pParDomains[pParDomainOf[s]]->dirty.push_back(s);
+        else pNSMDirty.push_back(s);
+    }
+
+    // Recompute the sums of the marked subvolumes and draw their next
+    // event times from the current time.
+    void _nsmRefresh(void);
+
+    ////////////////////////////////////////////////////////////////////////
+    // Parallel Kernel Data
+    ////////////////////////////////////////////////////////////////////////
+
+    // The domains, the domain of each subvolume and its index within the
+    // domain, and the domain of each tet by global index.
+    std::vector<NSMDomain*>                     pParDomains;
+    std::vector<uint>                           pParDomainOf;
+    std::vector<uint>                           pParLocal;
+    std::vector<uint>                           pParTetDomain;
+    double                                      pParDT;
+    // Dependency rows touched by a delivery, see _parFlush.
+    std::vector<uint>                           pParRows;
+    // Worker threads, or 0 if the domains run on the calling thread.
+    ParPool                                   * pParPool;
+    
     ////////////////////////////////////////////////////////////////////////////////
     
     inline void _update(std::vector<KProc*> const & upd_entries) {
@@ -389,7 +696,54 @@ private:
             _updateElement(upd_entries[i]);
         }
         
-        _updateSum();
+        _updateDone();
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    inline void _beginUpdList(void) {
+        pUpdList.clear();
+        if (++pUpdGen == 0) {
+            // The stamps have wrapped around; clear them all.
+            for (uint i = 0; i < nEntries; i++) pKProcs[i]->crData.upd_gen = 0;
+            pUpdGen = 1;
+        }
+    }
+    
+    inline void _addToUpdList(KProc* kp) {
+        if (kp->crData.upd_gen == pUpdGen) return;
+        kp->crData.upd_gen = pUpdGen;
+        if (pUpdList.size() == pUpdList.capacity()) pUpdAllocs++;
+        pUpdList.push_back(kp);
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    inline void _update(uint dep_row) {
+        #ifdef SSA_DEBUG
+        std::cout << "SSA: update dependency row " << dep_row << "\n";
+        #endif
+        uint end = pDepOffsets[dep_row + 1];
+        for (uint i = pDepOffsets[dep_row]; i < end; i++) {
+            _updateElement(pKProcs[pDepIdx[i]]);
+        }
+        
+        _updateDone();
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    inline void _updateDone(void) {
+        if (pEngine == ENGINE_NSM) _nsmRefresh();
+        else if (pEngine == ENGINE_PAR) _parRefreshAll();
+        else _refreshTree();
+        
+        // pA0 is kept as a running total by _updateElement; only go back
+        // to the group sums once the drift may have become significant.
+        if (pA0Err > CR_A0_RENORM_TOL * pA0) {
+            _updateSum();
+            pA0Renorms++;
+        }
         #ifdef SSA_DEBUG
         std::cout << "--------------------------------------------------------\n";
         #endif
@@ -405,6 +759,19 @@ private:
             _updateElement(pKProcs[i]);
         }
         
+        if (pEngine != ENGINE_CR) {
+            // Redraw every event time, which may predate the current time;
+            // with the sums cleared none of them is rescaled. pA0 is
+            // recomputed below.
+            uint nsubvols = pNSMSum.size();
+            for (uint s = 0; s < nsubvols; s++) {
+                pNSMSum[s] = 0.0;
+                _nsmMark(s);
+            }
+            if (pEngine == ENGINE_NSM) _nsmRefresh();
+            else _parRefreshAll();
+        }
+        else _refreshTree();
         _updateSum();
         #ifdef SSA_DEBUG
         std::cout << "--------------------------------------------------------\n";
@@ -447,7 +814,9 @@ private:
         #endif
         
         while (curr_size < new_size) {
+            pUpdAllocs++;
             pGroups.push_back(new CRGroup(curr_size));
+            _addTreeGroup(pGroups.back());
             curr_size ++;
         }
     }
@@ -466,7 +835,9 @@ private:
         
         while (curr_size < new_size) {
             
+            pUpdAllocs++;
             nGroups.push_back(new CRGroup(-curr_size));
+            _addTreeGroup(nGroups.back());
             curr_size ++;
         }
     }
@@ -479,10 +850,11 @@ private:
         std::cout << "current capacity: " << group->capacity << "\n";
         #endif
         
+        pUpdAllocs++;
         group->capacity += size;
-        group->indices = (KProc**)realloc(group->indices,
-                                          sizeof(KProc*) * group->capacity);
-        if (group->indices == NULL) {
+        group->entries = (CRGroupEntry*)realloc(group->entries,
+                                                sizeof(CRGroupEntry) * group->capacity);
+        if (group->entries == NULL) {
             std::cerr << "DirectCR: unable to allocate memory for SSA group.\n";
             throw;
         }
@@ -494,8 +866,58 @@ private:
     
     ////////////////////////////////////////////////////////////////////////////////
     
+    inline void _addTreeGroup(CRGroup* group) {
+        group->tree_pos = pTreeGroups.size();
+        pTreeGroups.push_back(group);
+        
+        if (pTreeGroups.size() > pTreeLeaves) {
+            _rebuildTree();
+        }
+        else {
+            _markGroup(group);
+        }
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    inline void _markGroup(CRGroup* group) {
+        if (group->tree_dirty) return;
+        group->tree_dirty = true;
+        pDirtyGroups.push_back(group);
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    inline void _refreshTree(void) {
+        uint n_dirty = pDirtyGroups.size();
+        for (uint i = 0; i < n_dirty; i++) {
+            CRGroup* group = pDirtyGroups[i];
+            group->tree_dirty = false;
+            
+            uint node = pTreeLeaves + group->tree_pos;
+            pGroupTree[node] = group->sum;
+            node >>= 1;
+            while (node != 0) {
+                pGroupTree[node] = pGroupTree[node << 1] + pGroupTree[(node << 1) + 1];
+                node >>= 1;
+            }
+        }
+        pDirtyGroups.clear();
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
+    void _rebuildTree(void);
+    
     void _updateElement(KProc* kp);
     
+    inline void _updateA0(double delta) {
+        pA0 += delta;
+        pA0Err += CR_A0_EPSILON * (std::fabs(pA0) + std::fabs(delta));
+    }
+    
+    ////////////////////////////////////////////////////////////////////////////////
+    
     inline void _updateSum(void) {
         #ifdef SSA_DEBUG
         std::cout << "update A0 from " << pA0 << " to ";
@@ -503,17 +925,27 @@ private:
         
         pA0 = 0.0;
         
-        uint n_neg_groups = nGroups.size();
-        uint n_pos_groups = pGroups.size();
-        
-        for (uint i = 0; i < n_neg_groups; i++) {
-            pA0 += nGroups[i]->sum;
+        if (pEngine != ENGINE_CR) {
+            uint nsubvols = pNSMSum.size();
+            for (uint s = 0; s < nsubvols; s++) {
+                pA0 += pNSMSum[s];
+            }
         }
-        
-        for (uint i = 0; i < n_pos_groups; i++) {
-            pA0 += pGroups[i]->sum;
+        else {
+            uint n_neg_groups = nGroups.size();
+            uint n_pos_groups = pGroups.size();
+            
+            for (uint i = 0; i < n_neg_groups; i++) {
+                pA0 += nGroups[i]->sum;
+            }
+            
+            for (uint i = 0; i < n_pos_groups; i++) {
+                pA0 += pGroups[i]->sum;
+            }
         }
         
+        pA0Err = 0.0;
+        
         #ifdef SSA_DEBUG
         std::cout << pA0 << "\n";
         #endif
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <functional>
 #include <iostream>
+#include <new>
 
 // STEPS headers.
 #include "../common.h"
@@ -62,7 +63,9 @@ stex::Tri::Tri(uint idx, steps::solver::Patchdef * patchdef, double area,
 , pTets()
 , pPoolCount(0)
 , pPoolFlags(0)
+, pPatchTotals(0)
 , pKProcs()
+, pSpecDepRow(0)
 {
 	assert(pPatchdef != 0);
 	assert (pArea > 0.0);
@@ -70,11 +73,6 @@ stex::Tri::Tri(uint idx, steps::solver::Patchdef * patchdef, double area,
 	pTets[0] = tetinner;
 	pTets[1] = tetouter;
 
-	uint nspecs = pPatchdef->countSpecs();
-    pPoolCount = new uint[nspecs];
-    pPoolFlags = new uint[nspecs];
-    std::fill_n(pPoolCount, nspecs, 0);
-    std::fill_n(pPoolFlags, nspecs, 0);
     pKProcs.resize(pPatchdef->countSReacs());
 }
 
@@ -82,11 +80,10 @@ stex::Tri::Tri(uint idx, steps::solver::Patchdef * patchdef, double area,
 
 stex::Tri::~Tri(void)
 {
-    delete[] pPoolCount;
-    delete[] pPoolFlags;
+    // The kprocs live in the solver's kproc arena; only destroy them.
     KProcPVecCI e = pKProcs.end();
     for (std::vector<stex::KProc *>::const_iterator i = pKProcs.begin();
-         i != e; ++i) delete *i;
+         i != e; ++i) (*i)->~KProc();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -137,7 +134,8 @@ void stex::Tri::setupKProcs(stex::Tetexact * tex)
 	for (uint i=0; i < nsreacs; ++i)
 	{
 		ssolver::SReacdef * srdef = patchdef()->sreacdef(i);
-		stex::SReac * sr = new SReac(srdef, this);
+		void * mem = tex->_allocKProc(sizeof(stex::SReac));
+		stex::SReac * sr = new (mem) SReac(srdef, this);
 		assert(sr != 0);
 		pKProcs[j++] = sr;
 		tex->addKProc(sr);
@@ -164,13 +162,8 @@ void stex::Tri::setCount(uint lidx, uint count)
 	double c = static_cast<double>(count);
 	pPoolCount[lidx] = c;
 
-	/* 16/01/10 IH: Counts no longer stored in patch object.
-	// Now update the count in this tri's patch
-	double diff = c - oldcount;
-	double newcount = (patchdef()->pools()[lidx]) + diff;
-	// Patchdef method will do the checking on the double argument (should be positive!)
-	patchdef()->setCount(lidx, newcount);
-	*/
+	// Keep the running total of the patch up to date.
+	pPatchTotals[lidx] += c - oldcount;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
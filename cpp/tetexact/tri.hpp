@@ -139,6 +139,15 @@ public:
 
     inline uint * pools(void) const
     { return pPoolCount; }
+    /// Set the storage of the molecule counts, of the pool flags and of
+    /// the running totals of the patch, which setCount() keeps up to date.
+    /// Called once during setup by the Patch object, which owns the memory.
+    inline void setPoolStorage(uint * counts, uint * flags, double * totals)
+    { pPoolCount = counts; pPoolFlags = flags; pPatchTotals = totals; }
+    /// Redirect the running totals, e.g. to a scratch array while the
+    /// parallel engine updates several tris at once.
+    inline void setTotalsStorage(double * totals)
+    { pPatchTotals = totals; }
     void setCount(uint lidx, uint count);
 
     static const uint CLAMPED = 1;
@@ -156,6 +165,15 @@ public:
     inline uint countKProcs(void) const
     { return pKProcs.size(); }
 
+    /// Return the row of the solver's dependency graph listing the
+    /// kprocs whose rate reads species lidx of this triangle.
+    inline uint specDepRow(uint lidx) const
+    { return pSpecDepRow + lidx; }
+    /// Set the first of the consecutive per-species rows; called once
+    /// by the solver during setup.
+    inline void setSpecDepRow(uint row)
+    { pSpecDepRow = row; }
+
     stex::SReac * sreac(uint lidx) const;
 
     inline int tet(uint t) const
@@ -179,13 +197,18 @@ private:
 
     double                              pArea;
 
-    /// Numbers of molecules -- stored as machine word integers.
+    /// Numbers of molecules -- stored as machine word integers. Points
+    /// into the packed count matrix of the owning Patch.
     uint                              * pPoolCount;
     /// Flags on these pools -- stored as machine word flags.
     uint                              * pPoolFlags;
+    /// Running totals of the owning Patch, indexed like pPoolCount.
+    double                            * pPatchTotals;
 
     /// The kinetic processes.
     std::vector<stex::KProc *>          pKProcs;
+    /// First row of the per-species dependency rows.
+    uint                                pSpecDepRow;
 
     ////////////////////////////////////////////////////////////////////////
 
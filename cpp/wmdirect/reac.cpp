@@ -196,17 +196,17 @@ double swmd::Reac::rate(void) const
 
     // Prefetch some variables.
     ssolver::Compdef * cdef = pComp->def();
-    uint nspecs = cdef->countSpecs();
-    uint * lhs_vec = cdef->reac_lhs_bgn(cdef->reacG2L(defr()->gidx()));
+    ssolver::SpecCoeffVec const & lhs_vec =
+        cdef->reac_lhs_sparse(cdef->reacG2L(defr()->gidx()));
     double * cnt_vec = cdef->pools();
 
     // Compute combinatorial part.
         double h_mu = 1.0;
-        for (uint pool = 0; pool < nspecs; ++pool)
+        ssolver::SpecCoeffVecCI l_end = lhs_vec.end();
+        for (ssolver::SpecCoeffVecCI l = lhs_vec.begin(); l != l_end; ++l)
         {
-            uint lhs = lhs_vec[pool];
-            if (lhs == 0) continue;
-            uint cnt = static_cast<uint>(cnt_vec[pool]);
+            uint lhs = static_cast<uint>(l->coeff);
+            uint cnt = static_cast<uint>(cnt_vec[l->spec]);
             if (lhs > cnt)
             {
                 h_mu = 0.0;
@@ -251,14 +251,13 @@ std::vector<uint> const & swmd::Reac::apply(void)
     ssolver::Compdef * cdef = pComp->def();
     double * local = cdef->pools();
     uint l_ridx = cdef->reacG2L(defr()->gidx());
-    int * upd_vec = cdef->reac_upd_bgn(l_ridx);
-    uint nspecs = cdef->countSpecs();
-    for (uint i=0; i < nspecs; ++i)
+    ssolver::SpecCoeffVec const & upd_vec = cdef->reac_upd_sparse(l_ridx);
+    ssolver::SpecCoeffVecCI u_end = upd_vec.end();
+    for (ssolver::SpecCoeffVecCI u = upd_vec.begin(); u != u_end; ++u)
     {
+    	uint i = u->spec;
     	if (cdef->clamped(i) == true) continue;
-    	int j = upd_vec[i];
-    	if (j == 0) continue;
-    	int nc = static_cast<int>(local[i]) + j;
+    	int nc = static_cast<int>(local[i]) + u->coeff;
     	cdef->setCount(i, static_cast<double>(nc));
     }
     rExtent++;
@@ -334,14 +334,13 @@ double swmd::SReac::rate(void) const
 
     double h_mu = 1.0;
 
-    uint * lhs_s_vec = pdef->sreac_lhs_S_bgn(lidx);
+    ssolver::SpecCoeffVec const & lhs_s_vec = pdef->sreac_lhs_S_sparse(lidx);
     double * cnt_s_vec = pdef->pools();
-    uint nspecs_s = pdef->countSpecs();
-    for (uint s = 0; s < nspecs_s; ++s)
+    ssolver::SpecCoeffVecCI s_end = lhs_s_vec.end();
+    for (ssolver::SpecCoeffVecCI s = lhs_s_vec.begin(); s != s_end; ++s)
     {
-        uint lhs = lhs_s_vec[s];
-        if (lhs == 0) continue;
-        uint cnt = static_cast<uint>(cnt_s_vec[s]);
+        uint lhs = static_cast<uint>(s->coeff);
+        uint cnt = static_cast<uint>(cnt_s_vec[s->spec]);
         if (lhs > cnt)
         {
             return 0.0;
@@ -375,14 +374,13 @@ double swmd::SReac::rate(void) const
 
     if (defsr()->inside())
     {
-        uint * lhs_i_vec = pdef->sreac_lhs_I_bgn(lidx);
+        ssolver::SpecCoeffVec const & lhs_i_vec = pdef->sreac_lhs_I_sparse(lidx);
         double * cnt_i_vec = pPatch->iComp()->def()->pools();
-        uint nspecs_i = pdef->countSpecs_I();
-        for (uint s = 0; s < nspecs_i; ++s)
+        ssolver::SpecCoeffVecCI s_end = lhs_i_vec.end();
+        for (ssolver::SpecCoeffVecCI s = lhs_i_vec.begin(); s != s_end; ++s)
         {
-            uint lhs = lhs_i_vec[s];
-            if (lhs == 0) continue;
-            uint cnt = static_cast<double>(cnt_i_vec[s]);
+            uint lhs = static_cast<uint>(s->coeff);
+            uint cnt = static_cast<uint>(cnt_i_vec[s->spec]);
             if (lhs > cnt)
             {
                 return 0.0;
@@ -416,14 +414,13 @@ double swmd::SReac::rate(void) const
     }
     else if (defsr()->outside())
     {
-        uint * lhs_o_vec = pdef->sreac_lhs_O_bgn(lidx);
+        ssolver::SpecCoeffVec const & lhs_o_vec = pdef->sreac_lhs_O_sparse(lidx);
         double * cnt_o_vec = pPatch->oComp()->def()->pools();
-        uint nspecs_o = pdef->countSpecs_O();
-        for (uint s = 0; s < nspecs_o; ++s)
+        ssolver::SpecCoeffVecCI s_end = lhs_o_vec.end();
+        for (ssolver::SpecCoeffVecCI s = lhs_o_vec.begin(); s != s_end; ++s)
         {
-            uint lhs = lhs_o_vec[s];
-            if (lhs == 0) continue;
-            uint cnt = static_cast<double>(cnt_o_vec[s]);
+            uint lhs = static_cast<uint>(s->coeff);
+            uint cnt = static_cast<uint>(cnt_o_vec[s->spec]);
             if (lhs > cnt)
             {
                 return 0.0;
@@ -467,35 +464,32 @@ std::vector<uint> const & swmd::SReac::apply(void)
     uint lidx = pdef->sreacG2L(defsr()->gidx());
 
     // Update patch pools.
-    int * upd_s_vec = pdef->sreac_upd_S_bgn(lidx);
+    ssolver::SpecCoeffVec const & upd_s_vec = pdef->sreac_upd_S_sparse(lidx);
     double * cnt_s_vec = pdef->pools();
-    uint nspecs_s = pdef->countSpecs();
-
-    for (uint s = 0; s < nspecs_s; ++s)
+    ssolver::SpecCoeffVecCI s_end = upd_s_vec.end();
+    for (ssolver::SpecCoeffVecCI s = upd_s_vec.begin(); s != s_end; ++s)
     {
-        if (pdef->clamped(s) == true) continue;
-        int upd = upd_s_vec[s];
-        if (upd == 0) continue;
-        int nc = static_cast<int>(cnt_s_vec[s]) + upd;
+        uint sl = s->spec;
+        if (pdef->clamped(sl) == true) continue;
+        int nc = static_cast<int>(cnt_s_vec[sl]) + s->coeff;
         assert(nc >= 0);
-        pdef->setCount(s, static_cast<double>(nc));
+        pdef->setCount(sl, static_cast<double>(nc));
     }
 
     // Update inner comp pools.
     Comp * icomp = pPatch->iComp();
     if (icomp != 0)
     {
-        int * upd_i_vec = pdef->sreac_upd_I_bgn(lidx);
+        ssolver::SpecCoeffVec const & upd_i_vec = pdef->sreac_upd_I_sparse(lidx);
         double * cnt_i_vec = icomp->def()->pools();
-        uint nspecs_i = pdef->countSpecs_I();
-        for (uint s = 0; s < nspecs_i; ++s)
+        ssolver::SpecCoeffVecCI s_end = upd_i_vec.end();
+        for (ssolver::SpecCoeffVecCI s = upd_i_vec.begin(); s != s_end; ++s)
         {
-            if (icomp->def()->clamped(s) == true) continue;
-            int upd = upd_i_vec[s];
-            if (upd == 0) continue;
-            int nc = static_cast<int>(cnt_i_vec[s]) + upd;
+            uint sl = s->spec;
+            if (icomp->def()->clamped(sl) == true) continue;
+            int nc = static_cast<int>(cnt_i_vec[sl]) + s->coeff;
             assert(nc >= 0);
-            icomp->def()->setCount(s, static_cast<double>(nc));
+            icomp->def()->setCount(sl, static_cast<double>(nc));
         }
     }
 
@@ -503,17 +497,16 @@ std::vector<uint> const & swmd::SReac::apply(void)
     Comp * ocomp = pPatch->oComp();
     if (ocomp != 0)
     {
-        int * upd_o_vec = pdef->sreac_upd_O_bgn(lidx);
+        ssolver::SpecCoeffVec const & upd_o_vec = pdef->sreac_upd_O_sparse(lidx);
         double * cnt_o_vec = ocomp->def()->pools();
-        uint nspecs_o = pdef->countSpecs_O();
-        for (uint s = 0; s < nspecs_o; ++s)
+        ssolver::SpecCoeffVecCI s_end = upd_o_vec.end();
+        for (ssolver::SpecCoeffVecCI s = upd_o_vec.begin(); s != s_end; ++s)
         {
-            if (ocomp->def()->clamped(s) == true) continue;
-            int upd = upd_o_vec[s];
-            if (upd == 0) continue;
-            int nc = static_cast<int>(cnt_o_vec[s]) + upd;
+            uint sl = s->spec;
+            if (ocomp->def()->clamped(sl) == true) continue;
+            int nc = static_cast<int>(cnt_o_vec[sl]) + s->coeff;
             assert(nc >= 0);
-            ocomp->def()->setCount(s, static_cast<double>(nc));
+            ocomp->def()->setCount(sl, static_cast<double>(nc));
         }
     }
 
@@ -0,0 +1,146 @@
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# STEPS - STochastic Engine for Pathway Simulation
+# Copyright (C) 2007-2011 Okinawa Institute of Science and Technology, Japan.
+# Copyright (C) 2003-2006 University of Antwerp, Belgium.
+#
+# See the file AUTHORS for details.
+#
+# This file is part of STEPS.
+#
+# STEPS is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# STEPS is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+# Example: Recording time series with steps.solver.Recorder
+# Records the same observables at the same time points from a Wmdirect
+# and a Tetexact solver, once with the usual Python loop of run() and
+# getter calls and once with a Recorder, which does the whole loop in C++
+# and writes into one preallocated NumPy array. Prints the wall time of
+# both; the recorded values are identical, since both start from the
+# same seed.
+# Run from the examples/benchmark directory.
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+import time
+
+import numpy
+
+import steps.model as smodel
+import steps.geom as stetmesh
+import steps.rng as srng
+import steps.solver as ssolver
+
+import steps.utilities.meshio as smeshio
+
+########################################################################
+
+# Sampling times (s)
+TPNTS = numpy.arange(0.0, 0.1, 1.0e-5)
+# Tetrahedrons to record counts from
+TETS = range(0, 1000, 10)
+
+########################################################################
+
+def gen_model():
+    mdl = smodel.Model()
+    A = smodel.Spec('A', mdl)
+    B = smodel.Spec('B', mdl)
+    C = smodel.Spec('C', mdl)
+    vsys = smodel.Volsys('vsys', mdl)
+    smodel.Reac('fwd', vsys, lhs = [A, B], rhs = [C], kcst = 1.0e8)
+    smodel.Reac('bwd', vsys, lhs = [C], rhs = [A, B], kcst = 10.0)
+    smodel.Diff('diff_A', vsys, A, dcst = 1.0e-11)
+    smodel.Diff('diff_B', vsys, B, dcst = 2.0e-11)
+    smodel.Diff('diff_C', vsys, C, dcst = 0.5e-11)
+    return mdl
+
+########################################################################
+
+def gen_geom():
+    mesh = smeshio.loadMesh('../tutorial/meshes/sphere_rad10_11Ktets')[0]
+    comp = stetmesh.TmComp('cyto', mesh, range(mesh.countTets()))
+    comp.addVolsys('vsys')
+    return mesh
+
+########################################################################
+
+def init(sim):
+    sim.reset()
+    sim.setCompCount('cyto', 'A', 2000)
+    sim.setCompCount('cyto', 'B', 1200)
+    sim.setCompCount('cyto', 'C', 240)
+
+########################################################################
+
+def record_loop(sim, tets):
+    res = numpy.zeros((len(TPNTS), 4 + len(tets)))
+    for t, tpnt in enumerate(TPNTS):
+        sim.run(tpnt)
+        res[t, 0] = sim.getCompCount('cyto', 'A')
+        res[t, 1] = sim.getCompCount('cyto', 'B')
+        res[t, 2] = sim.getCompConc('cyto', 'C')
+        res[t, 3] = sim.getCompReacExtent('cyto', 'fwd')
+        for i, tet in enumerate(tets):
+            res[t, 4 + i] = sim.getTetCount(tet, 'C')
+    return res
+
+########################################################################
+
+def record_recorder(sim, tets):
+    rec = ssolver.Recorder(sim)
+    rec.addCompCount('cyto', 'A')
+    rec.addCompCount('cyto', 'B')
+    rec.addCompConc('cyto', 'C')
+    rec.addCompReacExtent('cyto', 'fwd')
+    for tet in tets:
+        rec.addTetCount(tet, 'C')
+    rec.setTimePoints(TPNTS)
+    res = numpy.zeros((rec.countTimePoints(), rec.countObservables()))
+    rec.runNP(res)
+    return res
+
+########################################################################
+
+mdl = gen_model()
+mesh = gen_geom()
+rng = srng.create('mt19937', 512)
+
+print '%10s %12s %12s %8s %10s' % \
+    ('solver', 'loop (s)', 'recorder (s)', 'ratio', 'identical')
+for name in ['wmdirect', 'tetexact']:
+    if name == 'wmdirect':
+        sim = ssolver.Wmdirect(mdl, mesh, rng)
+        tets = []
+    else:
+        sim = ssolver.Tetexact(mdl, mesh, rng)
+        tets = TETS
+
+    rng.initialize(2903)
+    init(sim)
+    beg_time = time.time()
+    res_loop = record_loop(sim, tets)
+    t_loop = time.time() - beg_time
+
+    rng.initialize(2903)
+    init(sim)
+    beg_time = time.time()
+    res_rec = record_recorder(sim, tets)
+    t_rec = time.time() - beg_time
+
+    print '%10s %12.3f %12.3f %8.2f %10s' % \
+        (name, t_loop, t_rec, t_loop / t_rec, 
+         (res_loop == res_rec).all())
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
@@ -0,0 +1,122 @@
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# STEPS - STochastic Engine for Pathway Simulation
+# Copyright (C) 2007-2011 Okinawa Institute of Science and Technology, Japan.
+# Copyright (C) 2003-2006 University of Antwerp, Belgium.
+#
+# See the file AUTHORS for details.
+#
+# This file is part of STEPS.
+#
+# STEPS is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# STEPS is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+# Example: Compare the two Tetexact engines
+# Runs the same reaction-diffusion model with the composition-rejection
+# ('cr') and the next-subvolume ('nsm') engine on cube meshes of growing
+# size, and prints the throughput of each engine together with the mean
+# final counts, which should agree within sampling error.
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+import time
+
+import steps.model as smodel
+import steps.geom as stetmesh
+import steps.rng as srng
+import steps.solver as ssolver
+
+########################################################################
+
+# Numbers of cubes along each edge of the mesh; each cube is split into 
+# six tetrahedrons.
+SIZES = [4, 8, 16, 24]
+# Edge of a cube (m)
+H = 0.1e-6
+# Simulated time per run (s)
+ENDT = 0.005
+# Runs per engine and mesh size
+NITER = 3
+
+########################################################################
+
+def gen_model():
+    mdl = smodel.Model()
+    A = smodel.Spec('A', mdl)
+    B = smodel.Spec('B', mdl)
+    C = smodel.Spec('C', mdl)
+    vsys = smodel.Volsys('vsys', mdl)
+    smodel.Reac('fwd', vsys, lhs = [A, B], rhs = [C], kcst = 1.0e8)
+    smodel.Reac('bwd', vsys, lhs = [C], rhs = [A, B], kcst = 10.0)
+    smodel.Diff('diff_A', vsys, A, dcst = 1.0e-11)
+    smodel.Diff('diff_B', vsys, B, dcst = 2.0e-11)
+    smodel.Diff('diff_C', vsys, C, dcst = 0.5e-11)
+    return mdl
+
+########################################################################
+
+def gen_geom(n):
+    m = n + 1
+    verts = []
+    for k in range(m):
+        for j in range(m):
+            for i in range(m):
+                verts += [i * H, j * H, k * H]
+    perms = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [1, 2, 0], [2, 0, 1], [2, 1, 0]]
+    tets = []
+    for k in range(n):
+        for j in range(n):
+            for i in range(n):
+                for p in perms:
+                    c = [i, j, k]
+                    tets.append(c[0] + m * (c[1] + m * c[2]))
+                    for q in p:
+                        c[q] += 1
+                        tets.append(c[0] + m * (c[1] + m * c[2]))
+    mesh = stetmesh.Tetmesh(verts, tets)
+    comp = stetmesh.TmComp('cyto', mesh, range(mesh.countTets()))
+    comp.addVolsys('vsys')
+    return mesh
+
+########################################################################
+
+mdl = gen_model()
+
+print '%8s %6s %12s %10s %10s %10s' % ('ntets', 'engine', 'steps/s', 'A', 'B', 'C')
+for n in SIZES:
+    mesh = gen_geom(n)
+    for engine in ['cr', 'nsm']:
+        rng = srng.create('mt19937', 512)
+        rng.initialize(2903)
+        sim = ssolver.Tetexact(mdl, mesh, rng)
+        sim.setEngine(engine)
+        nsteps = 0
+        walltime = 0.0
+        counts = [0.0, 0.0, 0.0]
+        for i in range(NITER):
+            sim.reset()
+            sim.setCompCount('cyto', 'A', 2500)
+            sim.setCompCount('cyto', 'B', 1500)
+            sim.setCompCount('cyto', 'C', 300)
+            beg_time = time.time()
+            sim.run(ENDT)
+            walltime += time.time() - beg_time
+            nsteps += sim.getNSteps()
+            for s, spec in enumerate(['A', 'B', 'C']):
+                counts[s] += sim.getCompCount('cyto', spec) / NITER
+        print '%8d %6s %12.3g %10.1f %10.1f %10.1f' % \
+            (mesh.countTets(), engine, nsteps / walltime, 
+             counts[0], counts[1], counts[2])
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
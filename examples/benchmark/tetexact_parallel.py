@@ -0,0 +1,156 @@
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# STEPS - STochastic Engine for Pathway Simulation
+# Copyright (C) 2007-2011 Okinawa Institute of Science and Technology, Japan.
+# Copyright (C) 2003-2006 University of Antwerp, Belgium.
+#
+# See the file AUTHORS for details.
+#
+# This file is part of STEPS.
+#
+# STEPS is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# STEPS is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+# Example: Strong scaling of the parallel Tetexact engine
+# Runs one reaction-diffusion model on the sphere_rad10_11Ktets mesh and
+# on a larger synthetic cube mesh, first with the serial 'cr' engine and
+# then with the parallel engine on a growing number of threads. Prints
+# the throughput, the speedup over one thread and the mean final counts,
+# which should agree with the serial engine within sampling error as long
+# as the synchronisation step is small compared with the time a molecule
+# stays in a tetrahedron.
+# Run from the examples/benchmark directory.
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+import time
+
+import steps.model as smodel
+import steps.geom as stetmesh
+import steps.rng as srng
+import steps.solver as ssolver
+
+import steps.utilities.meshio as smeshio
+
+########################################################################
+
+# Thread counts to run the parallel engine with
+THREADS = [1, 2, 4, 8, 16, 32, 64]
+# Runs per configuration
+NITER = 3
+# Molecules of A, B and C at the start of a run
+COUNTS = [20000, 12000, 2400]
+
+# Each entry: name, mesh generator, simulated time per run (s) and 
+# synchronisation step of the parallel engine (s).
+MESHES = [
+    ('sphere_rad10_11Ktets', lambda: gen_sphere(), 0.1, 1.0e-4),
+    ('cube_32', lambda: gen_cube(32, 0.2e-6), 0.02, 1.0e-5),
+]
+
+########################################################################
+
+def gen_model():
+    mdl = smodel.Model()
+    A = smodel.Spec('A', mdl)
+    B = smodel.Spec('B', mdl)
+    C = smodel.Spec('C', mdl)
+    vsys = smodel.Volsys('vsys', mdl)
+    smodel.Reac('fwd', vsys, lhs = [A, B], rhs = [C], kcst = 1.0e8)
+    smodel.Reac('bwd', vsys, lhs = [C], rhs = [A, B], kcst = 10.0)
+    smodel.Diff('diff_A', vsys, A, dcst = 1.0e-11)
+    smodel.Diff('diff_B', vsys, B, dcst = 2.0e-11)
+    smodel.Diff('diff_C', vsys, C, dcst = 0.5e-11)
+    return mdl
+
+########################################################################
+
+def gen_sphere():
+    mesh = smeshio.loadMesh('../tutorial/meshes/sphere_rad10_11Ktets')[0]
+    comp = stetmesh.TmComp('cyto', mesh, range(mesh.countTets()))
+    comp.addVolsys('vsys')
+    return mesh
+
+########################################################################
+
+# A cube of n x n x n cubes with edge h, each split into six 
+# tetrahedrons.
+def gen_cube(n, h):
+    m = n + 1
+    verts = []
+    for k in range(m):
+        for j in range(m):
+            for i in range(m):
+                verts += [i * h, j * h, k * h]
+    perms = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [1, 2, 0], [2, 0, 1], [2, 1, 0]]
+    tets = []
+    for k in range(n):
+        for j in range(n):
+            for i in range(n):
+                for p in perms:
+                    c = [i, j, k]
+                    tets.append(c[0] + m * (c[1] + m * c[2]))
+                    for q in p:
+                        c[q] += 1
+                        tets.append(c[0] + m * (c[1] + m * c[2]))
+    mesh = stetmesh.Tetmesh(verts, tets)
+    comp = stetmesh.TmComp('cyto', mesh, range(mesh.countTets()))
+    comp.addVolsys('vsys')
+    return mesh
+
+########################################################################
+
+def bench(sim, endt):
+    nsteps = 0
+    walltime = 0.0
+    counts = [0.0, 0.0, 0.0]
+    for i in range(NITER):
+        sim.reset()
+        for s, spec in enumerate(['A', 'B', 'C']):
+            sim.setCompCount('cyto', spec, COUNTS[s])
+        beg_time = time.time()
+        sim.run(endt)
+        walltime += time.time() - beg_time
+        nsteps += sim.getNSteps()
+        for s, spec in enumerate(['A', 'B', 'C']):
+            counts[s] += sim.getCompCount('cyto', spec) / NITER
+    return nsteps / walltime, counts
+
+########################################################################
+
+mdl = gen_model()
+
+print '%22s %8s %8s %12s %8s %10s %10s %10s' % \
+    ('mesh', 'ntets', 'threads', 'steps/s', 'speedup', 'A', 'B', 'C')
+for name, gen_geom, endt, syncdt in MESHES:
+    mesh = gen_geom()
+    rng = srng.create('mt19937', 512)
+    rng.initialize(2903)
+    sim = ssolver.Tetexact(mdl, mesh, rng)
+
+    rate, counts = bench(sim, endt)
+    print '%22s %8d %8s %12.3g %8s %10.1f %10.1f %10.1f' % \
+        (name, mesh.countTets(), 'cr', rate, '', 
+         counts[0], counts[1], counts[2])
+
+    rate1 = None
+    for nthreads in THREADS:
+        sim.setParallel(nthreads, syncdt)
+        rate, counts = bench(sim, endt)
+        if rate1 == None: rate1 = rate
+        print '%22s %8d %8d %12.3g %8.2f %10.1f %10.1f %10.1f' % \
+            (name, mesh.countTets(), nthreads, rate, rate / rate1,
+             counts[0], counts[1], counts[2])
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
@@ -0,0 +1,176 @@
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# STEPS - STochastic Engine for Pathway Simulation
+# Copyright (C) 2007-2011 Okinawa Institute of Science and Technology, Japan.
+# Copyright (C) 2003-2006 University of Antwerp, Belgium.
+#
+# See the file AUTHORS for details.
+#
+# This file is part of STEPS.
+#
+# STEPS is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# STEPS is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+#
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+# Example: Effect of the Tetexact element reordering on memory locality
+# Runs one reaction-diffusion model on the sphere_rad10_11Ktets mesh and on
+# a synthetic cube mesh, each once in its own tetrahedron numbering and once
+# with the numbering randomly shuffled (as with the output of some mesh
+# generators), and with the solver's reordering off and on. Prints the
+# throughput; the final counts only show that the runs are alike.
+# The reordering should bring a shuffled mesh back to about the speed of a
+# well-numbered one. To compare cache misses directly, run a single
+# configuration under perf, e.g.
+#
+#   perf stat -e cache-references,cache-misses \
+#       python tetexact_reorder.py cube_48 shuffled 0
+#   perf stat -e cache-references,cache-misses \
+#       python tetexact_reorder.py cube_48 shuffled 1
+#
+# Run from the examples/benchmark directory.
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+
+import random
+import sys
+import time
+
+import steps.model as smodel
+import steps.geom as stetmesh
+import steps.rng as srng
+import steps.solver as ssolver
+
+import steps.utilities.meshio as smeshio
+
+########################################################################
+
+# Runs per configuration
+NITER = 3
+# Molecules of A, B and C at the start of a run
+COUNTS = [20000, 12000, 2400]
+
+# Each entry: name, (vertices, tetrahedrons) generator and simulated time
+# per run (s).
+MESHES = [
+    ('sphere_rad10_11Ktets', lambda: load_sphere(), 0.1),
+    ('cube_48', lambda: gen_cube(48, 0.2e-6), 0.005),
+]
+
+########################################################################
+
+def gen_model():
+    mdl = smodel.Model()
+    A = smodel.Spec('A', mdl)
+    B = smodel.Spec('B', mdl)
+    C = smodel.Spec('C', mdl)
+    vsys = smodel.Volsys('vsys', mdl)
+    smodel.Reac('fwd', vsys, lhs = [A, B], rhs = [C], kcst = 1.0e8)
+    smodel.Reac('bwd', vsys, lhs = [C], rhs = [A, B], kcst = 10.0)
+    smodel.Diff('diff_A', vsys, A, dcst = 1.0e-11)
+    smodel.Diff('diff_B', vsys, B, dcst = 2.0e-11)
+    smodel.Diff('diff_C', vsys, C, dcst = 0.5e-11)
+    return mdl
+
+########################################################################
+
+def load_sphere():
+    mesh = smeshio.loadMesh('../tutorial/meshes/sphere_rad10_11Ktets')[0]
+    verts = []
+    for v in range(mesh.countVertices()):
+        verts += mesh.getVertex(v)
+    tets = []
+    for t in range(mesh.countTets()):
+        tets += mesh.getTet(t)
+    return verts, tets
+
+########################################################################
+
+# A cube of n x n x n cubes with edge h, each split into six 
+# tetrahedrons.
+def gen_cube(n, h):
+    m = n + 1
+    verts = []
+    for k in range(m):
+        for j in range(m):
+            for i in range(m):
+                verts += [i * h, j * h, k * h]
+    perms = [[0, 1, 2], [0, 2, 1], [1, 0, 2], [1, 2, 0], [2, 0, 1], [2, 1, 0]]
+    tets = []
+    for k in range(n):
+        for j in range(n):
+            for i in range(n):
+                for p in perms:
+                    c = [i, j, k]
+                    tets.append(c[0] + m * (c[1] + m * c[2]))
+                    for q in p:
+                        c[q] += 1
+                        tets.append(c[0] + m * (c[1] + m * c[2]))
+    return verts, tets
+
+########################################################################
+
+def gen_geom(verts, tets, shuffle):
+    if shuffle:
+        quads = [tets[i:i + 4] for i in range(0, len(tets), 4)]
+        random.Random(13).shuffle(quads)
+        tets = [v for q in quads for v in q]
+    mesh = stetmesh.Tetmesh(verts, tets)
+    comp = stetmesh.TmComp('cyto', mesh, range(mesh.countTets()))
+    comp.addVolsys('vsys')
+    return mesh
+
+########################################################################
+
+def bench(sim, endt):
+    nsteps = 0
+    walltime = 0.0
+    counts = [0.0, 0.0, 0.0]
+    for i in range(NITER):
+        sim.reset()
+        for s, spec in enumerate(['A', 'B', 'C']):
+            sim.setCompCount('cyto', spec, COUNTS[s])
+        beg_time = time.time()
+        sim.run(endt)
+        walltime += time.time() - beg_time
+        nsteps += sim.getNSteps()
+        for s, spec in enumerate(['A', 'B', 'C']):
+            counts[s] += sim.getCompCount('cyto', spec) / NITER
+    return nsteps / walltime, counts
+
+########################################################################
+
+# Optional arguments: mesh name, 'original' or 'shuffled', and 0 or 1 for
+# the reordering, to run a single configuration.
+only = sys.argv[1:4]
+
+mdl = gen_model()
+
+print '%22s %8s %10s %8s %12s %10s %10s %10s' % \
+    ('mesh', 'ntets', 'numbering', 'reorder', 'steps/s', 'A', 'B', 'C')
+for name, gen_elems, endt in MESHES:
+    if only and only[0] != name: continue
+    verts, tets = gen_elems()
+    for numbering in ['original', 'shuffled']:
+        if len(only) > 1 and only[1] != numbering: continue
+        mesh = gen_geom(verts, tets, numbering == 'shuffled')
+        for reorder in [False, True]:
+            if len(only) > 2 and int(only[2]) != int(reorder): continue
+            rng = srng.create('mt19937', 512)
+            rng.initialize(2903)
+            sim = ssolver.Tetexact(mdl, mesh, rng, reorder)
+            rate, counts = bench(sim, endt)
+            print '%22s %8d %10s %8s %12.3g %10.1f %10.1f %10.1f' % \
+                (name, mesh.countTets(), numbering, reorder, rate,
+                 counts[0], counts[1], counts[2])
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
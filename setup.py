@@ -85,13 +85,14 @@ def steps_ext():
         'cpp/rng/rng.cpp', 'cpp/rng/mt19937.cpp',
 
         'cpp/solver/api_comp.cpp','cpp/solver/api_main.cpp',
+        'cpp/solver/api_handle.cpp',
         'cpp/solver/api_patch.cpp','cpp/solver/api_tet.cpp',
         'cpp/solver/api_tri.cpp', 'cpp/solver/api_diffboundary.cpp',
         'cpp/solver/compdef.cpp',
         'cpp/solver/diffdef.cpp','cpp/solver/patchdef.cpp',
         'cpp/solver/reacdef.cpp','cpp/solver/specdef.cpp',
         'cpp/solver/sreacdef.cpp', 'cpp/solver/diffboundarydef.cpp',
-        'cpp/solver/statedef.cpp',
+        'cpp/solver/statedef.cpp', 'cpp/solver/recorder.cpp',
         
         'cpp/tetexact/comp.cpp','cpp/tetexact/diff.cpp',
         'cpp/tetexact/kproc.cpp','cpp/tetexact/patch.cpp',
@@ -104,6 +105,8 @@ def steps_ext():
         'cpp/wmdirect/sreac.cpp','cpp/wmdirect/wmdirect.cpp',
         
         'cpp/wmrk4/wmrk4.cpp',
+
+        'cpp/batch/batch.cpp',
         
         'swig/steps_wrap.cpp'],
         
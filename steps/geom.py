@@ -44,6 +44,9 @@ import _steps_swig
 ### Now defunct mesh saving/loading tool ###
 # from steps_swig import loadASCII, saveASCII
 
+### Binary mesh saving/loading, see cpp/geom/tetmesh_rw.hpp ###
+from steps_swig import saveBinary, loadBinary
+
 
 # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # 
 
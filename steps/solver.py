@@ -192,26 +192,72 @@ class Wmdirect(steps_swig.Wmdirect) :
 # Tetrahedral Direct SSA
 # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #        
 class Tetexact(steps_swig.Tetexact) :  
-    def __init__(self, model, geom, rng): 
+    def __init__(self, model, geom, rng, reorder = False): 
         """
         Construction::
         
-            sim = steps.solver.Tetexact(model, geom, rng)
+            sim = steps.solver.Tetexact(model, geom, rng, reorder = False)
             
-        Create a Tetexact SSA simulation solver.
+        Create a Tetexact SSA simulation solver. If reorder is True, the 
+        tetrahedrons and triangles are laid out in memory along a 
+        space-filling curve; their indices are not affected.
             
         Arguments: 
             * steps.model.Model model
             * steps.geom.Geom geom
             * steps.rng.RNG rng
+            * bool reorder
         """
-        this = _steps_swig.new_Tetexact(model, geom, rng)
+        this = _steps_swig.new_Tetexact(model, geom, rng, reorder)
         try: self.this.append(this)
         except: self.this = this
         self.thisown = True
         self.model = model
         self.geom = geom
 
+    def getCompTetCountsView(self, comp):
+        """
+        Returns a read-only view of the molecule counts of all tetrahedrons 
+        in compartment comp, as a matrix with one row per tetrahedron 
+        (see getCompTetCountsTets) and one column per species (see 
+        getCompTetCountsSpecs). numpy.asarray() turns the view into an 
+        array without copying.
+        
+        The view reads the solver's memory directly, so it always shows the 
+        current state, including after reset() and restore(). It keeps 
+        the solver alive.
+        
+        Syntax::
+        
+            getCompTetCountsView(comp)
+        
+        Arguments:
+            * string comp
+        
+        Return:
+            buffer<uint>
+        """
+        return _steps_swig.Tetexact__getCompTetCountsView(self, self, comp)
+
+    def getPatchTriCountsView(self, patch):
+        """
+        Returns a read-only view of the molecule counts of all triangles 
+        in patch patch, as a matrix with one row per triangle (see 
+        getPatchTriCountsTris) and one column per species (see 
+        getPatchTriCountsSpecs). See getCompTetCountsView.
+        
+        Syntax::
+        
+            getPatchTriCountsView(patch)
+        
+        Arguments:
+            * string patch
+        
+        Return:
+            buffer<uint>
+        """
+        return _steps_swig.Tetexact__getPatchTriCountsView(self, self, patch)
+
         
     def run(self, end_time, cp_interval = 0.0, prefix = ""):
         """
@@ -253,3 +299,57 @@ class Tetexact(steps_swig.Tetexact) :
             _steps_swig.API_checkpoint(self, filename)
         else:
             _steps_swig.API_run(self, end_time)
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# Batch runner
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+class Batch(steps_swig.Batch) :
+    def __init__(self, solver, model, geom, rng = 'mt19937', rngbufsize = 512): 
+        """
+        Construction::
+        
+            b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)
+            
+        Create a runner for independent realisations of one model and 
+        geometry, run in parallel. Each worker thread owns a solver object 
+        of the given kind ('wmdirect' or 'tetexact') and a random number 
+        generator of the given kind; the model and geometry are shared.
+            
+        Arguments: 
+            * string solver
+            * steps.model.Model model
+            * steps.geom.Geom geom
+            * string rng
+            * uint rngbufsize
+        """
+        this = _steps_swig.new_Batch(solver, model, geom, rng, rngbufsize)
+        try: self.this.append(this)
+        except: self.this = this
+        self.thisown = True
+        self.model = model
+        self.geom = geom
+
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+# Time-series recorder
+# # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # # #
+class Recorder(steps_swig.Recorder) :
+    def __init__(self, sim): 
+        """
+        Construction::
+        
+            rec = steps.solver.Recorder(sim)
+            
+        Create a recorder of time series from solver sim. Observables are 
+        added with the add... methods and sampling times with 
+        setTimePoints(); run() then advances the solver through all the 
+        time points and samples every observable after each, without 
+        returning to Python in between.
+            
+        Arguments: 
+            * steps.solver.API sim
+        """
+        this = _steps_swig.new_Recorder(sim)
+        try: self.this.append(this)
+        except: self.this = this
+        self.thisown = True
+        self.sim = sim
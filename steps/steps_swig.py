@@ -4961,6 +4961,26 @@ class Tetmesh(Geom):
         """
         return _steps_swig.Tetmesh_findTetByPoint(self, *args)
 
+    def findTetsByPoints(self, *args):
+        """
+        Returns the indices of the tetrahedra which encompass a list of points 
+        p, given as a flat list of Cartesian coordinates x0,y0,z0,x1,y1,z1,... 
+        For each point the result is the same as findTetByPoint; -1 is returned 
+        for points outside the mesh.
+
+        Syntax::
+
+            findTetsByPoints(p)
+
+        Arguments:
+            list<float, length = 3 * n> p
+                     
+        Return:
+            list<int, length = n>
+
+        """
+        return _steps_swig.Tetmesh_findTetsByPoints(self, *args)
+
     def getBoundMin(self):
         """
         Returns the minimal Cartesian coordinate of the rectangular bounding box of the mesh. 
@@ -5015,6 +5035,48 @@ class Tetmesh(Geom):
 Tetmesh_swigregister = _steps_swig.Tetmesh_swigregister
 Tetmesh_swigregister(Tetmesh)
 
+
+def saveBinary(*args):
+  """
+    Saves a Tetmesh, with its compartments and patches, to a binary file 
+    which can be loaded by loadBinary. The file holds all the data the 
+    Tetmesh constructor would otherwise compute, in a layout that can be 
+    memory-mapped.
+
+    Syntax::
+
+        saveBinary(pathname, mesh)
+
+    Arguments:
+        * string pathname
+        * steps.geom.Tetmesh mesh
+                 
+    Return:
+        None
+
+    """
+  return _steps_swig.saveBinary(*args)
+
+def loadBinary(*args):
+  """
+    Loads a Tetmesh, with its compartments and patches, from a binary file 
+    written by saveBinary. The file is memory-mapped and the mesh uses the 
+    mapped data in place, so loading does not depend on the number of 
+    elements and processes loading the same file share one copy of it.
+    Compartments and patches can be retrieved with getComp and getPatch.
+
+    Syntax::
+
+        loadBinary(pathname)
+
+    Arguments:
+        string pathname
+                 
+    Return:
+        steps.geom.Tetmesh
+
+    """
+  return _steps_swig.loadBinary(*args)
 class TmComp(Comp):
     """Proxy of C++ steps::tetmesh::TmComp class"""
     __swig_setmethods__ = {}
@@ -6534,6 +6596,90 @@ class API(_object):
         """
         return _steps_swig.API_setTetCount(self, *args)
 
+    def getBatchTetCounts(self, *args):
+        """
+        Returns the numbers of molecules of species with identifier string spec 
+        in the tetrahedral elements with indices in list idxs.
+
+        Syntax::
+            
+            getBatchTetCounts(idxs, spec)
+            
+        Arguments:
+            * list<uint> idxs
+            * string spec
+
+        Return:
+            list<float>
+
+        """
+        return _steps_swig.API_getBatchTetCounts(self, *args)
+
+    def setBatchTetCounts(self, *args):
+        """
+        Sets the number of molecules of species with identifier string spec in 
+        each tetrahedral element with index idxs[i] to counts[i]. Nothing is changed if any 
+        index or count is invalid.
+
+        Syntax::
+            
+            setBatchTetCounts(idxs, spec, counts)
+            
+        Arguments:
+            * list<uint> idxs
+            * string spec
+            * list<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setBatchTetCounts(self, *args)
+
+    def getBatchTetCountsNP(self, *args):
+        """
+        Fills counts[i] with the number of molecules of species with identifier 
+        string spec in the tetrahedral element with index idxs[i]. idxs and counts are 
+        contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+        and float64; no copies are made.
+
+        Syntax::
+            
+            getBatchTetCountsNP(idxs, spec, counts)
+            
+        Arguments:
+            * buffer<uint> idxs
+            * string spec
+            * buffer<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_getBatchTetCountsNP(self, *args)
+
+    def setBatchTetCountsNP(self, *args):
+        """
+        Sets the number of molecules of species with identifier string spec in 
+        the tetrahedral element with index idxs[i] to counts[i]. idxs and counts are 
+        contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+        and float64; no copies are made.
+
+        Syntax::
+            
+            setBatchTetCountsNP(idxs, spec, counts)
+            
+        Arguments:
+            * buffer<uint> idxs
+            * string spec
+            * buffer<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setBatchTetCountsNP(self, *args)
+
     def getTetAmount(self, *args):
         """
         Returns the amount (in mols) of species with identifier string spec in 
@@ -7406,6 +7552,90 @@ class API(_object):
         """
         return _steps_swig.API_setTriCount(self, *args)
 
+    def getBatchTriCounts(self, *args):
+        """
+        Returns the numbers of molecules of species with identifier string spec 
+        in the triangular elements with indices in list idxs.
+
+        Syntax::
+            
+            getBatchTriCounts(idxs, spec)
+            
+        Arguments:
+            * list<uint> idxs
+            * string spec
+
+        Return:
+            list<float>
+
+        """
+        return _steps_swig.API_getBatchTriCounts(self, *args)
+
+    def setBatchTriCounts(self, *args):
+        """
+        Sets the number of molecules of species with identifier string spec in 
+        each triangular element with index idxs[i] to counts[i]. Nothing is changed if any 
+        index or count is invalid.
+
+        Syntax::
+            
+            setBatchTriCounts(idxs, spec, counts)
+            
+        Arguments:
+            * list<uint> idxs
+            * string spec
+            * list<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setBatchTriCounts(self, *args)
+
+    def getBatchTriCountsNP(self, *args):
+        """
+        Fills counts[i] with the number of molecules of species with identifier 
+        string spec in the triangular element with index idxs[i]. idxs and counts are 
+        contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+        and float64; no copies are made.
+
+        Syntax::
+            
+            getBatchTriCountsNP(idxs, spec, counts)
+            
+        Arguments:
+            * buffer<uint> idxs
+            * string spec
+            * buffer<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_getBatchTriCountsNP(self, *args)
+
+    def setBatchTriCountsNP(self, *args):
+        """
+        Sets the number of molecules of species with identifier string spec in 
+        the triangular element with index idxs[i] to counts[i]. idxs and counts are 
+        contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+        and float64; no copies are made.
+
+        Syntax::
+            
+            setBatchTriCountsNP(idxs, spec, counts)
+            
+        Arguments:
+            * buffer<uint> idxs
+            * string spec
+            * buffer<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setBatchTriCountsNP(self, *args)
+
     def getTriAmount(self, *args):
         """
         Returns the amount (in mols) of species with identifier string spec in triangular 
@@ -7631,189 +7861,423 @@ class API(_object):
         """
         return _steps_swig.API_getTriSReacA(self, *args)
 
-API_swigregister = _steps_swig.API_swigregister
-API_swigregister(API)
-
-class Wmrk4(API):
-    """Proxy of C++ steps::wmrk4::Wmrk4 class"""
-    __swig_setmethods__ = {}
-    for _s in [API]: __swig_setmethods__.update(getattr(_s,'__swig_setmethods__',{}))
-    __setattr__ = lambda self, name, value: _swig_setattr(self, Wmrk4, name, value)
-    __swig_getmethods__ = {}
-    for _s in [API]: __swig_getmethods__.update(getattr(_s,'__swig_getmethods__',{}))
-    __getattr__ = lambda self, name: _swig_getattr(self, Wmrk4, name)
-    __repr__ = _swig_repr
-    def __init__(self, *args): 
-        """__init__(self, Model m, Geom g, RNG r) -> Wmrk4"""
-        this = _steps_swig.new_Wmrk4(*args)
-        try: self.this.append(this)
-        except: self.this = this
-    __swig_destroy__ = _steps_swig.delete_Wmrk4
-    __del__ = lambda self : None;
-    def getSolverName(self):
+    def getCompSpecHandle(self, *args):
         """
-        Returns a string of the solver's name.
+        Resolves the species with identifier string spec in compartment with 
+        identifier string comp into a handle for getCount, setReacK and the 
+        other handle-based methods, which skip the name lookups. Handles stay 
+        valid for the lifetime of the solver.
 
         Syntax::
             
-            getSolverName()
+            getCompSpecHandle(comp, spec)
             
         Arguments:
-            None
+            * string comp
+            * string spec
 
         Return:
-            string
+            uint
 
         """
-        return _steps_swig.Wmrk4_getSolverName(self)
+        return _steps_swig.API_getCompSpecHandle(self, *args)
 
-    def getSolverDesc(self):
+    def getPatchSpecHandle(self, *args):
         """
-        Returns a string giving a short description of the solver.
+        Resolves the species with identifier string spec in patch with 
+        identifier string patch into a handle for getCount, setReacK and the 
+        other handle-based methods, which skip the name lookups. Handles stay 
+        valid for the lifetime of the solver.
 
         Syntax::
             
-            getSolverDesc()
+            getPatchSpecHandle(patch, spec)
             
         Arguments:
-            None
+            * string patch
+            * string spec
 
         Return:
-            string
+            uint
 
         """
-        return _steps_swig.Wmrk4_getSolverDesc(self)
+        return _steps_swig.API_getPatchSpecHandle(self, *args)
 
-    def getSolverAuthors(self):
+    def getTetSpecHandle(self, *args):
         """
-        Returns a string of the solver authors names.
+        Resolves the species with identifier string spec in tetrahedral element 
+        with index idx into a handle for getCount, setReacK and the other 
+        handle-based methods, which skip the name lookups. Handles stay valid 
+        for the lifetime of the solver.
 
         Syntax::
             
-            getSolverAuthors()
+            getTetSpecHandle(idx, spec)
             
         Arguments:
-            None
+            * uint idx
+            * string spec
 
         Return:
-            string
+            uint
 
         """
-        return _steps_swig.Wmrk4_getSolverAuthors(self)
+        return _steps_swig.API_getTetSpecHandle(self, *args)
 
-    def getSolverEmail(self):
+    def getTriSpecHandle(self, *args):
         """
-        Returns a string giving the author's email address.
+        Resolves the species with identifier string spec in triangular element 
+        with index idx into a handle for getCount, setReacK and the other 
+        handle-based methods, which skip the name lookups. Handles stay valid 
+        for the lifetime of the solver.
 
         Syntax::
             
-            getSolverEmail()
+            getTriSpecHandle(idx, spec)
             
         Arguments:
-            None
+            * uint idx
+            * string spec
 
         Return:
-            string
+            uint
 
         """
-        return _steps_swig.Wmrk4_getSolverEmail(self)
+        return _steps_swig.API_getTriSpecHandle(self, *args)
 
-    def reset(self):
+    def getCompReacHandle(self, *args):
         """
-        Reset the simulation to the state the solver was initialised to. 
-        Typically, this resets all concentrations of all chemical species in 
-        all elements (whether compartments and patches in a well-mixed solver 
-        or tetrahedrons and triangles in a mesh-based solver) to zero, 
-        resets the simulation time to zero and resets reaction (and diffusion) 
-        rates to the default values described in the steps.model objects. 
-        All reaction (and diffusion) rules are reset to active and all 
-        compartment volumes and patch areas are reset to default values 
-        described in steps.geom objects (for well-mixed solvers). 
-        Usually, this method should be called before starting each simulation iteration.
+        Resolves the reaction with identifier string reac in compartment with 
+        identifier string comp into a handle for getCount, setReacK and the 
+        other handle-based methods, which skip the name lookups. Handles stay 
+        valid for the lifetime of the solver.
 
         Syntax::
             
-            reset()
+            getCompReacHandle(comp, reac)
             
         Arguments:
-            None
+            * string comp
+            * string reac
 
         Return:
-            None
+            uint
 
         """
-        return _steps_swig.Wmrk4_reset(self)
+        return _steps_swig.API_getCompReacHandle(self, *args)
 
-    def run(self, *args):
+    def getPatchSReacHandle(self, *args):
         """
-        Advance the simulation until endtime (given in seconds) is reached. 
-        The endtime must be larger or equal to the current simulation time.
+        Resolves the surface reaction with identifier string sreac in patch with 
+        identifier string patch into a handle for getCount, setReacK and the 
+        other handle-based methods, which skip the name lookups. Handles stay 
+        valid for the lifetime of the solver.
 
         Syntax::
             
-            run(endtime)
+            getPatchSReacHandle(patch, sreac)
             
         Arguments:
-            float endtime
+            * string patch
+            * string sreac
 
         Return:
-            None
+            uint
 
         """
-        return _steps_swig.Wmrk4_run(self, *args)
+        return _steps_swig.API_getPatchSReacHandle(self, *args)
 
-    def getTime(self):
+    def getTetReacHandle(self, *args):
         """
-        Returns the current simulation time in seconds.
+        Resolves the reaction with identifier string reac in tetrahedral element 
+        with index idx into a handle for getCount, setReacK and the other 
+        handle-based methods, which skip the name lookups. Handles stay valid 
+        for the lifetime of the solver.
 
         Syntax::
             
-            getTime()
+            getTetReacHandle(idx, reac)
             
         Arguments:
-            None
+            * uint idx
+            * string reac
 
         Return:
-            float
+            uint
 
         """
-        return _steps_swig.Wmrk4_getTime(self)
-
-Wmrk4_swigregister = _steps_swig.Wmrk4_swigregister
-Wmrk4_swigregister(Wmrk4)
+        return _steps_swig.API_getTetReacHandle(self, *args)
 
-class Wmdirect(API):
-    """Proxy of C++ steps::wmdirect::Wmdirect class"""
-    __swig_setmethods__ = {}
-    for _s in [API]: __swig_setmethods__.update(getattr(_s,'__swig_setmethods__',{}))
-    __setattr__ = lambda self, name, value: _swig_setattr(self, Wmdirect, name, value)
-    __swig_getmethods__ = {}
-    for _s in [API]: __swig_getmethods__.update(getattr(_s,'__swig_getmethods__',{}))
-    __getattr__ = lambda self, name: _swig_getattr(self, Wmdirect, name)
-    __repr__ = _swig_repr
-    def __init__(self, *args): 
-        """__init__(self, Model m, Geom g, RNG r) -> Wmdirect"""
-        this = _steps_swig.new_Wmdirect(*args)
-        try: self.this.append(this)
-        except: self.this = this
-    __swig_destroy__ = _steps_swig.delete_Wmdirect
-    __del__ = lambda self : None;
-    def getSolverName(self):
+    def getTriSReacHandle(self, *args):
         """
-        Returns a string of the solver's name.
+        Resolves the surface reaction with identifier string sreac in triangular 
+        element with index idx into a handle for getCount, setReacK and the 
+        other handle-based methods, which skip the name lookups. Handles stay 
+        valid for the lifetime of the solver.
 
         Syntax::
             
-            getSolverName()
+            getTriSReacHandle(idx, sreac)
             
         Arguments:
-            None
+            * uint idx
+            * string sreac
 
         Return:
-            string
+            uint
 
         """
-        return _steps_swig.Wmdirect_getSolverName(self)
+        return _steps_swig.API_getTriSReacHandle(self, *args)
+
+    def getCount(self, *args):
+        """
+        Returns the number of molecules referred to by species handle h.
+
+        Syntax::
+            
+            getCount(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            float
+
+        """
+        return _steps_swig.API_getCount(self, *args)
+
+    def setCount(self, *args):
+        """
+        Sets the number of molecules referred to by species handle h to n.
+
+        Syntax::
+            
+            setCount(h, n)
+            
+        Arguments:
+            * uint h
+            * float n
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setCount(self, *args)
+
+    def getConc(self, *args):
+        """
+        Returns the concentration (in molar units) referred to by species 
+        handle h of a compartment or tetrahedral element.
+
+        Syntax::
+            
+            getConc(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            float
+
+        """
+        return _steps_swig.API_getConc(self, *args)
+
+    def setConc(self, *args):
+        """
+        Sets the concentration (in molar units) referred to by species handle 
+        h of a compartment or tetrahedral element to c.
+
+        Syntax::
+            
+            setConc(h, c)
+            
+        Arguments:
+            * uint h
+            * float c
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setConc(self, *args)
+
+    def getClamped(self, *args):
+        """
+        Returns whether the species referred to by handle h is clamped.
+
+        Syntax::
+            
+            getClamped(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            bool
+
+        """
+        return _steps_swig.API_getClamped(self, *args)
+
+    def setClamped(self, *args):
+        """
+        Turns clamping of the species referred to by handle h on or off.
+
+        Syntax::
+            
+            setClamped(h, b)
+            
+        Arguments:
+            * uint h
+            * bool b
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setClamped(self, *args)
+
+    def getReacK(self, *args):
+        """
+        Returns the macroscopic rate constant referred to by reaction handle h.
+
+        Syntax::
+            
+            getReacK(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            float
+
+        """
+        return _steps_swig.API_getReacK(self, *args)
+
+    def setReacK(self, *args):
+        """
+        Sets the macroscopic rate constant referred to by reaction handle h to 
+        kf.
+
+        Syntax::
+            
+            setReacK(h, kf)
+            
+        Arguments:
+            * uint h
+            * float kf
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setReacK(self, *args)
+
+    def getReacActive(self, *args):
+        """
+        Returns whether the reaction referred to by handle h is active.
+
+        Syntax::
+            
+            getReacActive(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            bool
+
+        """
+        return _steps_swig.API_getReacActive(self, *args)
+
+    def setReacActive(self, *args):
+        """
+        Activates or deactivates the reaction referred to by handle h.
+
+        Syntax::
+            
+            setReacActive(h, a)
+            
+        Arguments:
+            * uint h
+            * bool a
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_setReacActive(self, *args)
+
+    def getReacExtent(self, *args):
+        """
+        Returns the extent of the compartment reaction or patch surface 
+        reaction referred to by handle h.
+
+        Syntax::
+            
+            getReacExtent(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.API_getReacExtent(self, *args)
+
+    def resetReacExtent(self, *args):
+        """
+        Resets the extent of the compartment reaction or patch surface reaction 
+        referred to by handle h.
+
+        Syntax::
+            
+            resetReacExtent(h)
+            
+        Arguments:
+            * uint h
+
+        Return:
+            None
+
+        """
+        return _steps_swig.API_resetReacExtent(self, *args)
+
+API_swigregister = _steps_swig.API_swigregister
+API_swigregister(API)
+
+class Wmrk4(API):
+    """Proxy of C++ steps::wmrk4::Wmrk4 class"""
+    __swig_setmethods__ = {}
+    for _s in [API]: __swig_setmethods__.update(getattr(_s,'__swig_setmethods__',{}))
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Wmrk4, name, value)
+    __swig_getmethods__ = {}
+    for _s in [API]: __swig_getmethods__.update(getattr(_s,'__swig_getmethods__',{}))
+    __getattr__ = lambda self, name: _swig_getattr(self, Wmrk4, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        """__init__(self, Model m, Geom g, RNG r) -> Wmrk4"""
+        this = _steps_swig.new_Wmrk4(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _steps_swig.delete_Wmrk4
+    __del__ = lambda self : None;
+    def getSolverName(self):
+        """
+        Returns a string of the solver's name.
+
+        Syntax::
+            
+            getSolverName()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Wmrk4_getSolverName(self)
 
     def getSolverDesc(self):
         """
@@ -7830,7 +8294,7 @@ class Wmdirect(API):
             string
 
         """
-        return _steps_swig.Wmdirect_getSolverDesc(self)
+        return _steps_swig.Wmrk4_getSolverDesc(self)
 
     def getSolverAuthors(self):
         """
@@ -7847,7 +8311,7 @@ class Wmdirect(API):
             string
 
         """
-        return _steps_swig.Wmdirect_getSolverAuthors(self)
+        return _steps_swig.Wmrk4_getSolverAuthors(self)
 
     def getSolverEmail(self):
         """
@@ -7864,7 +8328,7 @@ class Wmdirect(API):
             string
 
         """
-        return _steps_swig.Wmdirect_getSolverEmail(self)
+        return _steps_swig.Wmrk4_getSolverEmail(self)
 
     def reset(self):
         """
@@ -7890,7 +8354,7 @@ class Wmdirect(API):
             None
 
         """
-        return _steps_swig.Wmdirect_reset(self)
+        return _steps_swig.Wmrk4_reset(self)
 
     def run(self, *args):
         """
@@ -7908,7 +8372,7 @@ class Wmdirect(API):
             None
 
         """
-        return _steps_swig.Wmdirect_run(self, *args)
+        return _steps_swig.Wmrk4_run(self, *args)
 
     def getTime(self):
         """
@@ -7925,26 +8389,26 @@ class Wmdirect(API):
             float
 
         """
-        return _steps_swig.Wmdirect_getTime(self)
+        return _steps_swig.Wmrk4_getTime(self)
 
-Wmdirect_swigregister = _steps_swig.Wmdirect_swigregister
-Wmdirect_swigregister(Wmdirect)
+Wmrk4_swigregister = _steps_swig.Wmrk4_swigregister
+Wmrk4_swigregister(Wmrk4)
 
-class Tetexact(API):
-    """Proxy of C++ steps::tetexact::Tetexact class"""
+class Wmdirect(API):
+    """Proxy of C++ steps::wmdirect::Wmdirect class"""
     __swig_setmethods__ = {}
     for _s in [API]: __swig_setmethods__.update(getattr(_s,'__swig_setmethods__',{}))
-    __setattr__ = lambda self, name, value: _swig_setattr(self, Tetexact, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Wmdirect, name, value)
     __swig_getmethods__ = {}
     for _s in [API]: __swig_getmethods__.update(getattr(_s,'__swig_getmethods__',{}))
-    __getattr__ = lambda self, name: _swig_getattr(self, Tetexact, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, Wmdirect, name)
     __repr__ = _swig_repr
     def __init__(self, *args): 
-        """__init__(self, Model m, Geom g, RNG r) -> Tetexact"""
-        this = _steps_swig.new_Tetexact(*args)
+        """__init__(self, Model m, Geom g, RNG r) -> Wmdirect"""
+        this = _steps_swig.new_Wmdirect(*args)
         try: self.this.append(this)
         except: self.this = this
-    __swig_destroy__ = _steps_swig.delete_Tetexact
+    __swig_destroy__ = _steps_swig.delete_Wmdirect
     __del__ = lambda self : None;
     def getSolverName(self):
         """
@@ -7961,7 +8425,7 @@ class Tetexact(API):
             string
 
         """
-        return _steps_swig.Tetexact_getSolverName(self)
+        return _steps_swig.Wmdirect_getSolverName(self)
 
     def getSolverDesc(self):
         """
@@ -7978,7 +8442,7 @@ class Tetexact(API):
             string
 
         """
-        return _steps_swig.Tetexact_getSolverDesc(self)
+        return _steps_swig.Wmdirect_getSolverDesc(self)
 
     def getSolverAuthors(self):
         """
@@ -7995,7 +8459,7 @@ class Tetexact(API):
             string
 
         """
-        return _steps_swig.Tetexact_getSolverAuthors(self)
+        return _steps_swig.Wmdirect_getSolverAuthors(self)
 
     def getSolverEmail(self):
         """
@@ -8012,7 +8476,7 @@ class Tetexact(API):
             string
 
         """
-        return _steps_swig.Tetexact_getSolverEmail(self)
+        return _steps_swig.Wmdirect_getSolverEmail(self)
 
     def reset(self):
         """
@@ -8038,7 +8502,7 @@ class Tetexact(API):
             None
 
         """
-        return _steps_swig.Tetexact_reset(self)
+        return _steps_swig.Wmdirect_reset(self)
 
     def run(self, *args):
         """
@@ -8056,7 +8520,7 @@ class Tetexact(API):
             None
 
         """
-        return _steps_swig.Tetexact_run(self, *args)
+        return _steps_swig.Wmdirect_run(self, *args)
 
     def getTime(self):
         """
@@ -8073,27 +8537,1253 @@ class Tetexact(API):
             float
 
         """
-        return _steps_swig.Tetexact_getTime(self)
+        return _steps_swig.Wmdirect_getTime(self)
 
-    def advanceSteps(self, *args):
+Wmdirect_swigregister = _steps_swig.Wmdirect_swigregister
+Wmdirect_swigregister(Wmdirect)
+
+class Tetexact(API):
+    """Proxy of C++ steps::tetexact::Tetexact class"""
+    __swig_setmethods__ = {}
+    for _s in [API]: __swig_setmethods__.update(getattr(_s,'__swig_setmethods__',{}))
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Tetexact, name, value)
+    __swig_getmethods__ = {}
+    for _s in [API]: __swig_getmethods__.update(getattr(_s,'__swig_getmethods__',{}))
+    __getattr__ = lambda self, name: _swig_getattr(self, Tetexact, name)
+    __repr__ = _swig_repr
+    def __init__(self, m, g, r, reorder = False): 
         """
-        Returns the current simulation time in seconds.
+        Construct a Tetexact solver. If reorder is True, the tetrahedrons and
+        triangles are laid out in memory along a space-filling curve through
+        their barycenters, which can speed up meshes whose element numbering
+        has poor locality. Tetrahedron and triangle indices are not affected.
 
         Syntax::
             
-            getTime()
+            Tetexact(model, geom, rng, reorder = False)
             
         Arguments:
+            * steps.model.Model model
+            * steps.geom.Tetmesh geom
+            * steps.rng.RNG rng
+            * bool reorder
+
+        Return:
             None
 
+
+        Construct a Tetexact solver. If reorder is True, the tetrahedrons and
+        triangles are laid out in memory along a space-filling curve through
+        their barycenters, which can speed up meshes whose element numbering
+        has poor locality. Tetrahedron and triangle indices are not affected.
+
+        Syntax::
+            
+            Tetexact(model, geom, rng, reorder = False)
+            
+        Arguments:
+            * steps.model.Model model
+            * steps.geom.Tetmesh geom
+            * steps.rng.RNG rng
+            * bool reorder
+
         Return:
-            float
+            None
 
         """
-        return _steps_swig.Tetexact_advanceSteps(self, *args)
-
-Tetexact_swigregister = _steps_swig.Tetexact_swigregister
-Tetexact_swigregister(Tetexact)
+        this = _steps_swig.new_Tetexact(m, g, r, reorder)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _steps_swig.delete_Tetexact
+    __del__ = lambda self : None;
+    def getSolverName(self):
+        """
+        Returns a string of the solver's name.
+
+        Syntax::
+            
+            getSolverName()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Tetexact_getSolverName(self)
+
+    def getSolverDesc(self):
+        """
+        Returns a string giving a short description of the solver.
+
+        Syntax::
+            
+            getSolverDesc()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Tetexact_getSolverDesc(self)
+
+    def getSolverAuthors(self):
+        """
+        Returns a string of the solver authors names.
+
+        Syntax::
+            
+            getSolverAuthors()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Tetexact_getSolverAuthors(self)
+
+    def getSolverEmail(self):
+        """
+        Returns a string giving the author's email address.
+
+        Syntax::
+            
+            getSolverEmail()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Tetexact_getSolverEmail(self)
+
+    def reset(self):
+        """
+        Reset the simulation to the state the solver was initialised to. 
+        Typically, this resets all concentrations of all chemical species in 
+        all elements (whether compartments and patches in a well-mixed solver 
+        or tetrahedrons and triangles in a mesh-based solver) to zero, 
+        resets the simulation time to zero and resets reaction (and diffusion) 
+        rates to the default values described in the steps.model objects. 
+        All reaction (and diffusion) rules are reset to active and all 
+        compartment volumes and patch areas are reset to default values 
+        described in steps.geom objects (for well-mixed solvers). 
+        Usually, this method should be called before starting each simulation iteration.
+
+        Syntax::
+            
+            reset()
+            
+        Arguments:
+            None
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_reset(self)
+
+    def run(self, *args):
+        """
+        Advance the simulation until endtime (given in seconds) is reached. 
+        The endtime must be larger or equal to the current simulation time.
+
+        Syntax::
+            
+            run(endtime)
+            
+        Arguments:
+            float endtime
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_run(self, *args)
+
+    def getTime(self):
+        """
+        Returns the current simulation time in seconds.
+
+        Syntax::
+            
+            getTime()
+            
+        Arguments:
+            None
+
+        Return:
+            float
+
+        """
+        return _steps_swig.Tetexact_getTime(self)
+
+    def advanceSteps(self, *args):
+        """
+        Returns the current simulation time in seconds.
+
+        Syntax::
+            
+            getTime()
+            
+        Arguments:
+            None
+
+        Return:
+            float
+
+        """
+        return _steps_swig.Tetexact_advanceSteps(self, *args)
+
+    def getA0Renorms(self):
+        """
+        Returns the number of times the running total propensity (A0) of the 
+        solver has been recomputed exactly to remove accumulated rounding error.
+        The counter is set to zero by reset().
+
+        Syntax::
+            
+            getA0Renorms()
+            
+        Arguments:
+            None
+
+        Return:
+            int
+
+        """
+        return _steps_swig.Tetexact_getA0Renorms(self)
+
+    def getUpdAllocs(self):
+        """
+        Returns the number of times the solver's update path has allocated 
+        memory, by growing its event group storage or its scratch update list.
+        Once the event groups have settled, setters and steps leave the counter 
+        unchanged, so it can be used to check that a protocol runs without 
+        allocation.
+
+        Syntax::
+            
+            getUpdAllocs()
+            
+        Arguments:
+            None
+
+        Return:
+            int
+
+        """
+        return _steps_swig.Tetexact_getUpdAllocs(self)
+
+    def setEngine(self, *args):
+        """
+        Selects the simulation engine. 'cr' (the default) samples each event 
+        from all reaction and diffusion events in the mesh with the 
+        composition-rejection method. 'nsm' uses the next-subvolume method: 
+        every tetrahedron and triangle keeps the sum of its own propensities 
+        and a queue orders them by the time of their next event. Both engines 
+        are exact and the simulation state carries over when switching; which 
+        one is faster depends on the model and the mesh.
+
+        Syntax::
+            
+            setEngine(engine)
+            
+        Arguments:
+            string engine
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_setEngine(self, *args)
+
+    def getEngine(self):
+        """
+        Returns the simulation engine selected with setEngine, 'cr' or 'nsm', 
+        or 'parallel' after setParallel.
+
+        Syntax::
+            
+            getEngine()
+            
+        Arguments:
+            None
+
+        Return:
+            string
+
+        """
+        return _steps_swig.Tetexact_getEngine(self)
+
+    def setParallel(self, *args):
+        """
+        Selects the parallel engine. The tetrahedrons are split into nthreads 
+        spatially contiguous domains, each with its own next-subvolume event 
+        queue, random number stream and thread. Tetrahedrons coupled by a patch 
+        triangle stay in one domain. Diffusion across a domain boundary is held 
+        back and delivered every dt, so dt should be small compared with the 
+        mean time a molecule stays in a tetrahedron. The result depends on the 
+        seed, nthreads and dt, but not on the scheduling of the threads. 
+        setEngine switches back to a serial engine.
+
+        Syntax::
+            
+            setParallel(nthreads, dt)
+            
+        Arguments:
+            uint nthreads
+            float dt
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_setParallel(self, *args)
+
+    def getParallelThreads(self):
+        """
+        Returns the number of threads of the parallel engine, or 0 if it is not 
+        selected.
+
+        Syntax::
+            
+            getParallelThreads()
+            
+        Arguments:
+            None
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.Tetexact_getParallelThreads(self)
+
+    def getParallelSyncDT(self):
+        """
+        Returns the synchronisation time step of the parallel engine.
+
+        Syntax::
+            
+            getParallelSyncDT()
+            
+        Arguments:
+            None
+
+        Return:
+            float
+
+        """
+        return _steps_swig.Tetexact_getParallelSyncDT(self)
+
+    def setDiffLeapDT(self, *args):
+        """
+        Sets the time step of leaped diffusion. Every dt the diffusion of the 
+        selected species is advanced by binomial draws over the four faces of 
+        each tetrahedron, instead of one molecule at a time; reactions and all 
+        other diffusion stay exact. Species are selected with setSpecDiffLeap 
+        or setDiffLeapThreshold. dt should be small compared with the mean 
+        time a molecule stays in a tetrahedron. dt = 0 (the default) switches 
+        leaping off.
+
+        Syntax::
+            
+            setDiffLeapDT(dt)
+            
+        Arguments:
+            float dt
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_setDiffLeapDT(self, *args)
+
+    def getDiffLeapDT(self):
+        """
+        Returns the time step of leaped diffusion, 0 if it is off.
+
+        Syntax::
+            
+            getDiffLeapDT()
+            
+        Arguments:
+            None
+
+        Return:
+            float
+
+        """
+        return _steps_swig.Tetexact_getDiffLeapDT(self)
+
+    def setSpecDiffLeap(self, *args):
+        """
+        Selects whether the diffusion of species spec is always leaped, see 
+        setDiffLeapDT.
+
+        Syntax::
+            
+            setSpecDiffLeap(spec, leap)
+            
+        Arguments:
+            string spec
+            bool leap
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_setSpecDiffLeap(self, *args)
+
+    def getSpecDiffLeap(self, *args):
+        """
+        Returns whether the diffusion of species spec is always leaped.
+
+        Syntax::
+            
+            getSpecDiffLeap(spec)
+            
+        Arguments:
+            string spec
+
+        Return:
+            bool
+
+        """
+        return _steps_swig.Tetexact_getSpecDiffLeap(self, *args)
+
+    def setDiffLeapThreshold(self, *args):
+        """
+        Sets the count from which the diffusion of any species in a 
+        tetrahedron is leaped, see setDiffLeapDT. 0 (the default) disables 
+        the threshold.
+
+        Syntax::
+            
+            setDiffLeapThreshold(n)
+            
+        Arguments:
+            uint n
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Tetexact_setDiffLeapThreshold(self, *args)
+
+    def getDiffLeapThreshold(self):
+        """
+        Returns the count threshold of leaped diffusion, 0 if it is disabled.
+
+        Syntax::
+            
+            getDiffLeapThreshold()
+            
+        Arguments:
+            None
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.Tetexact_getDiffLeapThreshold(self)
+
+    def getCompTetCountsTets(self, *args):
+        """
+        Returns the indices of the tetrahedrons in compartment comp, in the 
+        row order of getCompTetCountsView(comp).
+
+        Syntax::
+            
+            getCompTetCountsTets(comp)
+            
+        Arguments:
+            string comp
+
+        Return:
+            list<uint>
+
+        """
+        return _steps_swig.Tetexact_getCompTetCountsTets(self, *args)
+
+    def getCompTetCountsSpecs(self, *args):
+        """
+        Returns the names of the species in compartment comp, in the column 
+        order of getCompTetCountsView(comp).
+
+        Syntax::
+            
+            getCompTetCountsSpecs(comp)
+            
+        Arguments:
+            string comp
+
+        Return:
+            list<string>
+
+        """
+        return _steps_swig.Tetexact_getCompTetCountsSpecs(self, *args)
+
+    def getPatchTriCountsTris(self, *args):
+        """
+        Returns the indices of the triangles in patch patch, in the row order 
+        of getPatchTriCountsView(patch).
+
+        Syntax::
+            
+            getPatchTriCountsTris(patch)
+            
+        Arguments:
+            string patch
+
+        Return:
+            list<uint>
+
+        """
+        return _steps_swig.Tetexact_getPatchTriCountsTris(self, *args)
+
+    def getPatchTriCountsSpecs(self, *args):
+        """
+        Returns the names of the species in patch patch, in the column order 
+        of getPatchTriCountsView(patch).
+
+        Syntax::
+            
+            getPatchTriCountsSpecs(patch)
+            
+        Arguments:
+            string patch
+
+        Return:
+            list<string>
+
+        """
+        return _steps_swig.Tetexact_getPatchTriCountsSpecs(self, *args)
+
+    def pickCompTets(self, *args):
+        """
+        Returns the indices of n tetrahedrons of compartment comp, each picked 
+        independently with probability proportional to its volume.
+
+        Syntax::
+            
+            pickCompTets(comp, n)
+            
+        Arguments:
+            * string comp
+            * uint n
+
+        Return:
+            list<uint>
+
+        """
+        return _steps_swig.Tetexact_pickCompTets(self, *args)
+
+    def pickPatchTris(self, *args):
+        """
+        Returns the indices of n triangles of patch patch, each picked 
+        independently with probability proportional to its area.
+
+        Syntax::
+            
+            pickPatchTris(patch, n)
+            
+        Arguments:
+            * string patch
+            * uint n
+
+        Return:
+            list<uint>
+
+        """
+        return _steps_swig.Tetexact_pickPatchTris(self, *args)
+
+    def _getCompTetCountsView(self, *args):
+        """_getCompTetCountsView(self, PyObject owner, string c) -> PyObject"""
+        return _steps_swig.Tetexact__getCompTetCountsView(self, *args)
+
+    def _getPatchTriCountsView(self, *args):
+        """_getPatchTriCountsView(self, PyObject owner, string p) -> PyObject"""
+        return _steps_swig.Tetexact__getPatchTriCountsView(self, *args)
+
+Tetexact_swigregister = _steps_swig.Tetexact_swigregister
+Tetexact_swigregister(Tetexact)
+
+class Batch(_object):
+    """Proxy of C++ steps::batch::Batch class"""
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Batch, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, Batch, name)
+    __repr__ = _swig_repr
+    def __init__(self, solver, m, g, rng = "mt19937", rngbufsize = 512): 
+        """
+        Construction::
+
+            b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)
+
+        Create a runner for independent realisations of one model and 
+        geometry, run in parallel. Each worker thread owns a solver object of 
+        the given kind ('wmdirect' or 'tetexact') and a random number generator 
+        of the given kind; the model and geometry are shared. Before each 
+        realisation the worker's solver is reset, its generator reseeded and 
+        the initial state replayed, so the results of a realisation depend only 
+        on its seed.
+
+        Arguments:
+            * string solver
+            * steps.model.Model model
+            * steps.geom.Geom geom
+            * string rng
+            * uint rngbufsize
+
+
+        Construction::
+
+            b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)
+
+        Create a runner for independent realisations of one model and 
+        geometry, run in parallel. Each worker thread owns a solver object of 
+        the given kind ('wmdirect' or 'tetexact') and a random number generator 
+        of the given kind; the model and geometry are shared. Before each 
+        realisation the worker's solver is reset, its generator reseeded and 
+        the initial state replayed, so the results of a realisation depend only 
+        on its seed.
+
+        Arguments:
+            * string solver
+            * steps.model.Model model
+            * steps.geom.Geom geom
+            * string rng
+            * uint rngbufsize
+
+
+        Construction::
+
+            b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)
+
+        Create a runner for independent realisations of one model and 
+        geometry, run in parallel. Each worker thread owns a solver object of 
+        the given kind ('wmdirect' or 'tetexact') and a random number generator 
+        of the given kind; the model and geometry are shared. Before each 
+        realisation the worker's solver is reset, its generator reseeded and 
+        the initial state replayed, so the results of a realisation depend only 
+        on its seed.
+
+        Arguments:
+            * string solver
+            * steps.model.Model model
+            * steps.geom.Geom geom
+            * string rng
+            * uint rngbufsize
+
+        """
+        this = _steps_swig.new_Batch(solver, m, g, rng, rngbufsize)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _steps_swig.delete_Batch
+    __del__ = lambda self : None;
+    def setCompCount(self, *args):
+        """
+        Adds to the initial state of every realisation: the number of molecules 
+        of species s in compartment c.
+
+        Syntax::
+
+            setCompCount(c, s, n)
+
+        Arguments:
+            * string c
+            * string s
+            * float n
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setCompCount(self, *args)
+
+    def setCompConc(self, *args):
+        """
+        Adds to the initial state of every realisation: the concentration (in 
+        molar units) of species s in compartment c.
+
+        Syntax::
+
+            setCompConc(c, s, conc)
+
+        Arguments:
+            * string c
+            * string s
+            * float conc
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setCompConc(self, *args)
+
+    def setCompClamped(self, *args):
+        """
+        Adds to the initial state of every realisation: whether species s is 
+        clamped in compartment c.
+
+        Syntax::
+
+            setCompClamped(c, s, b)
+
+        Arguments:
+            * string c
+            * string s
+            * bool b
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setCompClamped(self, *args)
+
+    def setCompReacK(self, *args):
+        """
+        Adds to the initial state of every realisation: the rate constant of 
+        reaction r in compartment c.
+
+        Syntax::
+
+            setCompReacK(c, r, kf)
+
+        Arguments:
+            * string c
+            * string r
+            * float kf
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setCompReacK(self, *args)
+
+    def setTetCount(self, *args):
+        """
+        Adds to the initial state of every realisation: the number of molecules 
+        of species s in tetrahedron tidx (mesh-based solvers only).
+
+        Syntax::
+
+            setTetCount(tidx, s, n)
+
+        Arguments:
+            * uint tidx
+            * string s
+            * float n
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setTetCount(self, *args)
+
+    def setPatchCount(self, *args):
+        """
+        Adds to the initial state of every realisation: the number of molecules 
+        of species s in patch p.
+
+        Syntax::
+
+            setPatchCount(p, s, n)
+
+        Arguments:
+            * string p
+            * string s
+            * float n
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setPatchCount(self, *args)
+
+    def setPatchClamped(self, *args):
+        """
+        Adds to the initial state of every realisation: whether species s is 
+        clamped in patch p.
+
+        Syntax::
+
+            setPatchClamped(p, s, b)
+
+        Arguments:
+            * string p
+            * string s
+            * bool b
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setPatchClamped(self, *args)
+
+    def setPatchSReacK(self, *args):
+        """
+        Adds to the initial state of every realisation: the rate constant of 
+        surface reaction r in patch p.
+
+        Syntax::
+
+            setPatchSReacK(p, r, kf)
+
+        Arguments:
+            * string p
+            * string r
+            * float kf
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_setPatchSReacK(self, *args)
+
+    def clearInitialState(self):
+        """
+        Removes everything added to the initial state.
+
+        Syntax::
+
+            clearInitialState()
+
+        Arguments:
+            None
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_clearInitialState(self)
+
+    def addCompCount(self, *args):
+        """
+        Adds an observable: the number of molecules of species s in 
+        compartment c.
+
+        Syntax::
+
+            addCompCount(c, s)
+
+        Arguments:
+            * string c
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_addCompCount(self, *args)
+
+    def addPatchCount(self, *args):
+        """
+        Adds an observable: the number of molecules of species s in patch p.
+
+        Syntax::
+
+            addPatchCount(p, s)
+
+        Arguments:
+            * string p
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_addPatchCount(self, *args)
+
+    def addTetCount(self, *args):
+        """
+        Adds an observable: the number of molecules of species s in 
+        tetrahedron tidx (mesh-based solvers only).
+
+        Syntax::
+
+            addTetCount(tidx, s)
+
+        Arguments:
+            * uint tidx
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_addTetCount(self, *args)
+
+    def clearObservables(self):
+        """
+        Removes all observables.
+
+        Syntax::
+
+            clearObservables()
+
+        Arguments:
+            None
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Batch_clearObservables(self)
+
+    def countObservables(self):
+        """
+        Returns the number of observables.
+
+        Syntax::
+
+            countObservables()
+
+        Arguments:
+            None
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.Batch_countObservables(self)
+
+    def run(self, *args):
+        """
+        Runs one realisation per seed on nthreads threads (0 for one thread per 
+        realisation) and returns the observables sampled at each time point, 
+        as a flat list which can be reshaped to 
+        (len(seeds), len(tpnts), countObservables()).
+
+        Syntax::
+
+            run(seeds, tpnts, nthreads)
+
+        Arguments:
+            * list<uint> seeds
+            * list<float> tpnts
+            * uint nthreads
+
+        Return:
+            list<float>
+
+        """
+        return _steps_swig.Batch_run(self, *args)
+
+Batch_swigregister = _steps_swig.Batch_swigregister
+Batch_swigregister(Batch)
+
+class Recorder(_object):
+    """Proxy of C++ steps::solver::Recorder class"""
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Recorder, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, Recorder, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        """
+        Construction::
+
+            rec = steps.solver.Recorder(sim)
+
+        Create a recorder of time series from solver sim (a Wmrk4, Wmdirect or 
+        Tetexact object). Observables are added with the add... methods and 
+        sampling times with setTimePoints(); run() then advances the solver 
+        through all the time points and samples every observable after each, 
+        without returning to Python in between. The solver must be kept alive 
+        for as long as the recorder is used.
+
+        Arguments:
+            * steps.solver.API sim
+
+        """
+        this = _steps_swig.new_Recorder(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _steps_swig.delete_Recorder
+    __del__ = lambda self : None;
+    def addCompCount(self, *args):
+        """
+        Records the number of molecules of species s in compartment c.
+
+        Syntax::
+
+            addCompCount(c, s)
+
+        Arguments:
+            * string c
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addCompCount(self, *args)
+
+    def addCompConc(self, *args):
+        """
+        Records the concentration (in molar units) of species s in 
+        compartment c.
+
+        Syntax::
+
+            addCompConc(c, s)
+
+        Arguments:
+            * string c
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addCompConc(self, *args)
+
+    def addPatchCount(self, *args):
+        """
+        Records the number of molecules of species s in patch p.
+
+        Syntax::
+
+            addPatchCount(p, s)
+
+        Arguments:
+            * string p
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addPatchCount(self, *args)
+
+    def addTetCount(self, *args):
+        """
+        Records the number of molecules of species s in tetrahedron 
+        tidx.
+
+        Syntax::
+
+            addTetCount(tidx, s)
+
+        Arguments:
+            * uint tidx
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addTetCount(self, *args)
+
+    def addTetConc(self, *args):
+        """
+        Records the concentration (in molar units) of species s in 
+        tetrahedron tidx.
+
+        Syntax::
+
+            addTetConc(tidx, s)
+
+        Arguments:
+            * uint tidx
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addTetConc(self, *args)
+
+    def addTriCount(self, *args):
+        """
+        Records the number of molecules of species s in triangle tidx.
+
+        Syntax::
+
+            addTriCount(tidx, s)
+
+        Arguments:
+            * uint tidx
+            * string s
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addTriCount(self, *args)
+
+    def addCompReacExtent(self, *args):
+        """
+        Records the extent of reaction r in compartment c.
+
+        Syntax::
+
+            addCompReacExtent(c, r)
+
+        Arguments:
+            * string c
+            * string r
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addCompReacExtent(self, *args)
+
+    def addPatchSReacExtent(self, *args):
+        """
+        Records the extent of surface reaction sr in patch p.
+
+        Syntax::
+
+            addPatchSReacExtent(p, sr)
+
+        Arguments:
+            * string p
+            * string sr
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_addPatchSReacExtent(self, *args)
+
+    def clearObservables(self):
+        """
+        Forgets all observables added so far.
+
+        Syntax::
+
+            clearObservables()
+
+        Arguments:
+            None
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_clearObservables(self)
+
+    def countObservables(self):
+        """
+        Returns the number of observables.
+
+        Syntax::
+
+            countObservables()
+
+        Arguments:
+            None
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.Recorder_countObservables(self)
+
+    def setTimePoints(self, *args):
+        """
+        Sets the sampling times, which must be non-negative and in 
+        non-decreasing order.
+
+        Syntax::
+
+            setTimePoints(tpnts)
+
+        Arguments:
+            * list<float> tpnts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_setTimePoints(self, *args)
+
+    def getTimePoints(self):
+        """
+        Returns the sampling times.
+
+        Syntax::
+
+            getTimePoints()
+
+        Arguments:
+            None
+
+        Return:
+            list<float>
+
+        """
+        return _steps_swig.Recorder_getTimePoints(self)
+
+    def countTimePoints(self):
+        """
+        Returns the number of sampling times.
+
+        Syntax::
+
+            countTimePoints()
+
+        Arguments:
+            None
+
+        Return:
+            uint
+
+        """
+        return _steps_swig.Recorder_countTimePoints(self)
+
+    def run(self):
+        """
+        Runs the solver to each time point in turn and returns the observables 
+        sampled there, as a flat list which can be reshaped to 
+        (countTimePoints(), countObservables()).
+
+        Syntax::
+
+            run()
+
+        Arguments:
+            None
+
+        Return:
+            list<float>
+
+        """
+        return _steps_swig.Recorder_run(self)
+
+    def runNP(self, *args):
+        """
+        As run(), but writes the samples to counts, a contiguous buffer of 
+        countTimePoints() * countObservables() values, e.g. a NumPy array of 
+        dtype float64; no copies are made.
+
+        Syntax::
+
+            runNP(counts)
+
+        Arguments:
+            * buffer<float> counts
+
+        Return:
+            None
+
+        """
+        return _steps_swig.Recorder_runNP(self, *args)
+
+Recorder_swigregister = _steps_swig.Recorder_swigregister
+Recorder_swigregister(Recorder)
 
 
 
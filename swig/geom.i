@@ -120,6 +120,9 @@ namespace std
 	} catch (steps::NotImplErr & nie) {
 		PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
 		return NULL;
+	} catch (steps::IOErr & ioe) {
+		PyErr_SetString(PyExc_IOError, ioe.getMsg());
+		return NULL;
 	}
 }
 
@@ -1101,6 +1104,25 @@ Return:
     int
 ");
 	int findTetByPoint(std::vector<double> p) const;
+
+    %feature("autodoc", 
+"
+Returns the indices of the tetrahedra which encompass a list of points 
+p, given as a flat list of Cartesian coordinates x0,y0,z0,x1,y1,z1,... 
+For each point the result is the same as findTetByPoint; -1 is returned 
+for points outside the mesh.
+
+Syntax::
+
+    findTetsByPoints(p)
+
+Arguments:
+    list<float, length = 3 * n> p
+             
+Return:
+    list<int, length = n>
+");
+	std::vector<int> findTetsByPoints(std::vector<double> p) const;
 	
     %feature("autodoc", 
 "
@@ -1158,6 +1180,47 @@ Tetmesh * loadASCII(std::string pathname);
 
 void saveASCII(std::string pathname, Tetmesh * m);
 */
+
+%feature("autodoc", 
+"
+Saves a Tetmesh, with its compartments and patches, to a binary file 
+which can be loaded by loadBinary. The file holds all the data the 
+Tetmesh constructor would otherwise compute, in a layout that can be 
+memory-mapped.
+
+Syntax::
+
+    saveBinary(pathname, mesh)
+
+Arguments:
+    * string pathname
+    * steps.geom.Tetmesh mesh
+             
+Return:
+    None
+");
+void saveBinary(std::string pathname, Tetmesh * m);
+
+%feature("autodoc", 
+"
+Loads a Tetmesh, with its compartments and patches, from a binary file 
+written by saveBinary. The file is memory-mapped and the mesh uses the 
+mapped data in place, so loading does not depend on the number of 
+elements and processes loading the same file share one copy of it.
+Compartments and patches can be retrieved with getComp and getPatch.
+
+Syntax::
+
+    loadBinary(pathname)
+
+Arguments:
+    string pathname
+             
+Return:
+    steps.geom.Tetmesh
+");
+%newobject loadBinary;
+Tetmesh * loadBinary(std::string pathname);
 ////////////////////////////////////////////////////////////////////////////////
 
 /* /////////////////////////////////////////////////////////////////////////////
@@ -38,9 +38,11 @@
 %{
 #include "../cpp//solver/api.hpp"
 #include "../cpp/solver/statedef.hpp"
+#include "../cpp/solver/recorder.hpp"
 #include "../cpp/wmrk4/wmrk4.hpp"
 #include "../cpp/wmdirect/wmdirect.hpp"
 #include "../cpp/tetexact/tetexact.hpp"
+#include "../cpp/batch/batch.hpp"
 #include "../cpp/error.hpp"
 %}
 
@@ -74,13 +76,185 @@ namespace std
 		$action
 	} catch (steps::ArgErr & ae) {
 		PyErr_SetString(PyExc_NameError, ae.getMsg());
-		return NULL;
+		SWIG_fail;
 	} catch (steps::NotImplErr & nie) {
 		PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-		return NULL;
+		SWIG_fail;
 	}
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Buffer arguments for the batch state access methods. Any C-contiguous
+// object supporting the buffer protocol (e.g. a NumPy array of dtype
+// uint32 or float64) is passed to C++ without copying and without
+// creating a Python object per element.
+
+%{
+static int steps_getbuffer(PyObject * obj, Py_buffer * view,
+                           char const * codes, Py_ssize_t itemsize,
+                           bool writable)
+{
+	int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+	if (writable) flags |= PyBUF_WRITABLE;
+	if (PyObject_GetBuffer(obj, view, flags) != 0) return -1;
+
+	// Skip a byte order prefix if it matches the native one: '<' or '>'
+	// is what ctypes arrays report.
+	unsigned int one = 1;
+	char native = (*reinterpret_cast<char *>(&one) == 1) ? '<' : '>';
+	char const * fmt = view->format;
+	if (fmt != 0 && (fmt[0] == '@' || fmt[0] == '=' || fmt[0] == native)) ++fmt;
+	if (view->itemsize != itemsize || fmt == 0 || fmt[0] == '\0' ||
+	    fmt[1] != '\0' || strchr(codes, fmt[0]) == 0)
+	{
+		PyBuffer_Release(view);
+		PyErr_Format(PyExc_TypeError,
+		             "Expected a contiguous buffer of type '%c'.", codes[0]);
+		return -1;
+	}
+	return 0;
+}
+%}
+
+////////////////////////////////////////////////////////////////////////////////
+// Read-only 2D views of the packed count matrices of Tetexact. A view
+// holds a reference to the solver object that owns the matrix, so the
+// memory stays valid for as long as the view (or any NumPy array created
+// from it) is alive.
+
+%{
+typedef struct
+{
+	PyObject_HEAD
+	PyObject          * owner;
+	unsigned int const* data;
+	Py_ssize_t          shape[2];
+	Py_ssize_t          strides[2];
+} steps_PoolView;
+
+static void steps_poolview_dealloc(steps_PoolView * self)
+{
+	Py_XDECREF(self->owner);
+	PyObject_Del(self);
+}
+
+static int steps_poolview_getbuffer(steps_PoolView * self, Py_buffer * view,
+                                    int flags)
+{
+	if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE)
+	{
+		view->obj = 0;
+		PyErr_SetString(PyExc_BufferError, "Count views are read-only.");
+		return -1;
+	}
+	view->buf = const_cast<unsigned int *>(self->data);
+	view->obj = reinterpret_cast<PyObject *>(self);
+	Py_INCREF(self);
+	view->len = self->shape[0] * self->shape[1] * sizeof(unsigned int);
+	view->readonly = 1;
+	view->itemsize = sizeof(unsigned int);
+	view->format = 0;
+	if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+		view->format = const_cast<char *>("I");
+	view->ndim = 1;
+	view->shape = 0;
+	view->strides = 0;
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->ndim = 2;
+		view->shape = self->shape;
+		if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+			view->strides = self->strides;
+	}
+	view->suboffsets = 0;
+	view->internal = 0;
+	return 0;
+}
+
+static PyBufferProcs steps_poolview_as_buffer;
+
+#ifndef Py_TPFLAGS_HAVE_NEWBUFFER
+#define Py_TPFLAGS_HAVE_NEWBUFFER 0
+#endif
+
+static PyTypeObject steps_PoolViewType =
+{
+	PyVarObject_HEAD_INIT(0, 0)
+	"steps_swig.PoolView",                          // tp_name
+	sizeof(steps_PoolView),                         // tp_basicsize
+	0,                                              // tp_itemsize
+	reinterpret_cast<destructor>(steps_poolview_dealloc),
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	&steps_poolview_as_buffer,                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, // tp_flags
+	"Read-only view of a packed count matrix (tets x species)."
+};
+
+static PyObject * steps_poolview_new(PyObject * owner,
+                                     unsigned int const * data,
+                                     unsigned int nrows, unsigned int ncols)
+{
+	if (steps_poolview_as_buffer.bf_getbuffer == 0)
+	{
+		steps_poolview_as_buffer.bf_getbuffer =
+			reinterpret_cast<getbufferproc>(steps_poolview_getbuffer);
+		if (PyType_Ready(&steps_PoolViewType) < 0) return 0;
+	}
+	steps_PoolView * self = PyObject_New(steps_PoolView, &steps_PoolViewType);
+	if (self == 0) return 0;
+	Py_XINCREF(owner);
+	self->owner = owner;
+	self->data = data;
+	self->shape[0] = nrows;
+	self->shape[1] = ncols;
+	self->strides[0] = ncols * sizeof(unsigned int);
+	self->strides[1] = sizeof(unsigned int);
+	return reinterpret_cast<PyObject *>(self);
+}
+%}
+
+%typemap(in) (unsigned int const * indices, unsigned int indices_size)
+             (Py_buffer view, Py_buffer * pview = 0)
+{
+	if (steps_getbuffer($input, &view, "IL", sizeof(unsigned int), false) != 0)
+		SWIG_fail;
+	pview = &view;
+	$1 = static_cast<$1_ltype>(view.buf);
+	$2 = static_cast<$2_ltype>(view.len / view.itemsize);
+}
+%typemap(freearg) (unsigned int const * indices, unsigned int indices_size)
+{
+	if (pview$argnum) PyBuffer_Release(pview$argnum);
+}
+
+%typemap(in) (double * counts, unsigned int counts_size)
+             (Py_buffer view, Py_buffer * pview = 0)
+{
+	if (steps_getbuffer($input, &view, "d", sizeof(double), true) != 0)
+		SWIG_fail;
+	pview = &view;
+	$1 = static_cast<$1_ltype>(view.buf);
+	$2 = static_cast<$2_ltype>(view.len / view.itemsize);
+}
+%typemap(freearg) (double * counts, unsigned int counts_size)
+{
+	if (pview$argnum) PyBuffer_Release(pview$argnum);
+}
+
+%typemap(in) (double const * counts, unsigned int counts_size)
+             (Py_buffer view, Py_buffer * pview = 0)
+{
+	if (steps_getbuffer($input, &view, "d", sizeof(double), false) != 0)
+		SWIG_fail;
+	pview = &view;
+	$1 = static_cast<$1_ltype>(view.buf);
+	$2 = static_cast<$2_ltype>(view.len / view.itemsize);
+}
+%typemap(freearg) (double const * counts, unsigned int counts_size)
+{
+	if (pview$argnum) PyBuffer_Release(pview$argnum);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace steps
@@ -1020,6 +1194,93 @@ Return:
     None
 ");
     void setTetCount(unsigned int tidx, std::string const & s, double n);
+
+    %feature("autodoc", 
+"
+Returns the numbers of molecules of species with identifier string spec 
+in the tetrahedral elements with indices in list idxs.
+
+Syntax::
+    
+    getBatchTetCounts(idxs, spec)
+    
+Arguments:
+    * list<uint> idxs
+    * string spec
+
+Return:
+    list<float>
+");
+    std::vector<double> getBatchTetCounts(std::vector<unsigned int> const & tets,
+                                          std::string const & s) const;
+
+    %feature("autodoc", 
+"
+Sets the number of molecules of species with identifier string spec in 
+each tetrahedral element with index idxs[i] to counts[i]. Nothing is changed if any 
+index or count is invalid.
+
+Syntax::
+    
+    setBatchTetCounts(idxs, spec, counts)
+    
+Arguments:
+    * list<uint> idxs
+    * string spec
+    * list<float> counts
+
+Return:
+    None
+");
+    void setBatchTetCounts(std::vector<unsigned int> const & tets,
+                           std::string const & s,
+                           std::vector<double> const & counts);
+
+    %feature("autodoc", 
+"
+Fills counts[i] with the number of molecules of species with identifier 
+string spec in the tetrahedral element with index idxs[i]. idxs and counts are 
+contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+and float64; no copies are made.
+
+Syntax::
+    
+    getBatchTetCountsNP(idxs, spec, counts)
+    
+Arguments:
+    * buffer<uint> idxs
+    * string spec
+    * buffer<float> counts
+
+Return:
+    None
+");
+    void getBatchTetCountsNP(unsigned int const * indices, unsigned int indices_size,
+                            std::string const & s,
+                            double * counts, unsigned int counts_size) const;
+
+    %feature("autodoc", 
+"
+Sets the number of molecules of species with identifier string spec in 
+the tetrahedral element with index idxs[i] to counts[i]. idxs and counts are 
+contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+and float64; no copies are made.
+
+Syntax::
+    
+    setBatchTetCountsNP(idxs, spec, counts)
+    
+Arguments:
+    * buffer<uint> idxs
+    * string spec
+    * buffer<float> counts
+
+Return:
+    None
+");
+    void setBatchTetCountsNP(unsigned int const * indices, unsigned int indices_size,
+                            std::string const & s,
+                            double const * counts, unsigned int counts_size);
 	
     %feature("autodoc", 
 "
@@ -1856,6 +2117,93 @@ Return:
 
     %feature("autodoc", 
 "
+Returns the numbers of molecules of species with identifier string spec 
+in the triangular elements with indices in list idxs.
+
+Syntax::
+    
+    getBatchTriCounts(idxs, spec)
+    
+Arguments:
+    * list<uint> idxs
+    * string spec
+
+Return:
+    list<float>
+");
+    std::vector<double> getBatchTriCounts(std::vector<unsigned int> const & tris,
+                                          std::string const & s) const;
+
+    %feature("autodoc", 
+"
+Sets the number of molecules of species with identifier string spec in 
+each triangular element with index idxs[i] to counts[i]. Nothing is changed if any 
+index or count is invalid.
+
+Syntax::
+    
+    setBatchTriCounts(idxs, spec, counts)
+    
+Arguments:
+    * list<uint> idxs
+    * string spec
+    * list<float> counts
+
+Return:
+    None
+");
+    void setBatchTriCounts(std::vector<unsigned int> const & tris,
+                           std::string const & s,
+                           std::vector<double> const & counts);
+
+    %feature("autodoc", 
+"
+Fills counts[i] with the number of molecules of species with identifier 
+string spec in the triangular element with index idxs[i]. idxs and counts are 
+contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+and float64; no copies are made.
+
+Syntax::
+    
+    getBatchTriCountsNP(idxs, spec, counts)
+    
+Arguments:
+    * buffer<uint> idxs
+    * string spec
+    * buffer<float> counts
+
+Return:
+    None
+");
+    void getBatchTriCountsNP(unsigned int const * indices, unsigned int indices_size,
+                            std::string const & s,
+                            double * counts, unsigned int counts_size) const;
+
+    %feature("autodoc", 
+"
+Sets the number of molecules of species with identifier string spec in 
+the triangular element with index idxs[i] to counts[i]. idxs and counts are 
+contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 
+and float64; no copies are made.
+
+Syntax::
+    
+    setBatchTriCountsNP(idxs, spec, counts)
+    
+Arguments:
+    * buffer<uint> idxs
+    * string spec
+    * buffer<float> counts
+
+Return:
+    None
+");
+    void setBatchTriCountsNP(unsigned int const * indices, unsigned int indices_size,
+                            std::string const & s,
+                            double const * counts, unsigned int counts_size);
+
+    %feature("autodoc", 
+"
 Returns the amount (in mols) of species with identifier string spec in triangular 
 element with index idx.  
 
@@ -2068,179 +2416,394 @@ Return:
 ");
     double getTriSReacA(unsigned int tidx, std::string const & r) const;
 
-};  
-
-////////////////////////////////////////////////////////////////////////////////
-	
-} // end namespace solver
-} // end namespace steps
+    %feature("autodoc", 
+"
+Resolves the species with identifier string spec in compartment with 
+identifier string comp into a handle for getCount, setReacK and the 
+other handle-based methods, which skip the name lookups. Handles stay 
+valid for the lifetime of the solver.
 
-////////////////////////////////////////////////////////////////////////////////
+Syntax::
+    
+    getCompSpecHandle(comp, spec)
+    
+Arguments:
+    * string comp
+    * string spec
 
-%feature("autodoc", "1");
+Return:
+    uint
+");
+    uint getCompSpecHandle(std::string const & c, std::string const & s);
 
-namespace steps
-{
-namespace wmrk4
-{
-	
-class Wmrk4 : public steps::solver::API
-{
-	
-public:
-	%feature("autodoc", "1");
-	Wmrk4(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
-    %feature("autodoc", "1");
-	~Wmrk4(void);
-    
     %feature("autodoc", 
 "
-Returns a string of the solver's name.
+Resolves the species with identifier string spec in patch with 
+identifier string patch into a handle for getCount, setReacK and the 
+other handle-based methods, which skip the name lookups. Handles stay 
+valid for the lifetime of the solver.
 
 Syntax::
     
-    getSolverName()
+    getPatchSpecHandle(patch, spec)
     
 Arguments:
-    None
+    * string patch
+    * string spec
 
 Return:
-    string
+    uint
 ");
-    virtual std::string getSolverName(void) const;
-    
+    uint getPatchSpecHandle(std::string const & p, std::string const & s);
+
     %feature("autodoc", 
 "
-Returns a string giving a short description of the solver.
+Resolves the species with identifier string spec in tetrahedral element 
+with index idx into a handle for getCount, setReacK and the other 
+handle-based methods, which skip the name lookups. Handles stay valid 
+for the lifetime of the solver.
 
 Syntax::
     
-    getSolverDesc()
+    getTetSpecHandle(idx, spec)
     
 Arguments:
-    None
+    * uint idx
+    * string spec
 
 Return:
-    string
+    uint
 ");
-    virtual std::string getSolverDesc(void) const;
-    
+    uint getTetSpecHandle(unsigned int tidx, std::string const & s);
+
     %feature("autodoc", 
 "
-Returns a string of the solver authors names.
+Resolves the species with identifier string spec in triangular element 
+with index idx into a handle for getCount, setReacK and the other 
+handle-based methods, which skip the name lookups. Handles stay valid 
+for the lifetime of the solver.
 
 Syntax::
     
-    getSolverAuthors()
+    getTriSpecHandle(idx, spec)
     
 Arguments:
-    None
+    * uint idx
+    * string spec
 
 Return:
-    string
+    uint
 ");
-    virtual std::string getSolverAuthors(void) const;
-    
+    uint getTriSpecHandle(unsigned int tidx, std::string const & s);
+
     %feature("autodoc", 
 "
-Returns a string giving the author's email address.
+Resolves the reaction with identifier string reac in compartment with 
+identifier string comp into a handle for getCount, setReacK and the 
+other handle-based methods, which skip the name lookups. Handles stay 
+valid for the lifetime of the solver.
 
 Syntax::
     
-    getSolverEmail()
+    getCompReacHandle(comp, reac)
     
 Arguments:
-    None
+    * string comp
+    * string reac
 
 Return:
-    string
+    uint
 ");
-    virtual std::string getSolverEmail(void) const;
+    uint getCompReacHandle(std::string const & c, std::string const & r);
 
     %feature("autodoc", 
 "
-Reset the simulation to the state the solver was initialised to. 
-Typically, this resets all concentrations of all chemical species in 
-all elements (whether compartments and patches in a well-mixed solver 
-or tetrahedrons and triangles in a mesh-based solver) to zero, 
-resets the simulation time to zero and resets reaction (and diffusion) 
-rates to the default values described in the steps.model objects. 
-All reaction (and diffusion) rules are reset to active and all 
-compartment volumes and patch areas are reset to default values 
-described in steps.geom objects (for well-mixed solvers). 
-Usually, this method should be called before starting each simulation iteration.
+Resolves the surface reaction with identifier string sreac in patch with 
+identifier string patch into a handle for getCount, setReacK and the 
+other handle-based methods, which skip the name lookups. Handles stay 
+valid for the lifetime of the solver.
 
 Syntax::
     
-    reset()
+    getPatchSReacHandle(patch, sreac)
     
 Arguments:
-    None
+    * string patch
+    * string sreac
 
 Return:
-    None
+    uint
 ");
-    virtual void reset(void);
-    
+    uint getPatchSReacHandle(std::string const & p, std::string const & sr);
+
     %feature("autodoc", 
 "
-Advance the simulation until endtime (given in seconds) is reached. 
-The endtime must be larger or equal to the current simulation time.
+Resolves the reaction with identifier string reac in tetrahedral element 
+with index idx into a handle for getCount, setReacK and the other 
+handle-based methods, which skip the name lookups. Handles stay valid 
+for the lifetime of the solver.
 
 Syntax::
     
-    run(endtime)
+    getTetReacHandle(idx, reac)
     
 Arguments:
-    float endtime
+    * uint idx
+    * string reac
 
 Return:
-    None
+    uint
 ");
-    virtual void run(double endtime);
-    
+    uint getTetReacHandle(unsigned int tidx, std::string const & r);
+
     %feature("autodoc", 
 "
-Returns the current simulation time in seconds.
+Resolves the surface reaction with identifier string sreac in triangular 
+element with index idx into a handle for getCount, setReacK and the 
+other handle-based methods, which skip the name lookups. Handles stay 
+valid for the lifetime of the solver.
 
 Syntax::
     
-    getTime()
+    getTriSReacHandle(idx, sreac)
     
 Arguments:
-    None
+    * uint idx
+    * string sreac
 
 Return:
-    float
+    uint
 ");
-    virtual double getTime(void) const;
+    uint getTriSReacHandle(unsigned int tidx, std::string const & sr);
 
+    %feature("autodoc", 
+"
+Returns the number of molecules referred to by species handle h.
 
-	////////////////////////////////////////////////////////////////////////			
-		
-};
+Syntax::
+    
+    getCount(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    float
+");
+    double getCount(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Sets the number of molecules referred to by species handle h to n.
+
+Syntax::
+    
+    setCount(h, n)
+    
+Arguments:
+    * uint h
+    * float n
+
+Return:
+    None
+");
+    void setCount(unsigned int h, double n);
+
+    %feature("autodoc", 
+"
+Returns the concentration (in molar units) referred to by species 
+handle h of a compartment or tetrahedral element.
+
+Syntax::
+    
+    getConc(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    float
+");
+    double getConc(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Sets the concentration (in molar units) referred to by species handle 
+h of a compartment or tetrahedral element to c.
+
+Syntax::
+    
+    setConc(h, c)
+    
+Arguments:
+    * uint h
+    * float c
+
+Return:
+    None
+");
+    void setConc(unsigned int h, double c);
+
+    %feature("autodoc", 
+"
+Returns whether the species referred to by handle h is clamped.
+
+Syntax::
+    
+    getClamped(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    bool
+");
+    bool getClamped(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Turns clamping of the species referred to by handle h on or off.
+
+Syntax::
+    
+    setClamped(h, b)
+    
+Arguments:
+    * uint h
+    * bool b
+
+Return:
+    None
+");
+    void setClamped(unsigned int h, bool b);
+
+    %feature("autodoc", 
+"
+Returns the macroscopic rate constant referred to by reaction handle h.
+
+Syntax::
+    
+    getReacK(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    float
+");
+    double getReacK(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Sets the macroscopic rate constant referred to by reaction handle h to 
+kf.
+
+Syntax::
+    
+    setReacK(h, kf)
+    
+Arguments:
+    * uint h
+    * float kf
+
+Return:
+    None
+");
+    void setReacK(unsigned int h, double kf);
+
+    %feature("autodoc", 
+"
+Returns whether the reaction referred to by handle h is active.
+
+Syntax::
+    
+    getReacActive(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    bool
+");
+    bool getReacActive(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Activates or deactivates the reaction referred to by handle h.
+
+Syntax::
+    
+    setReacActive(h, a)
+    
+Arguments:
+    * uint h
+    * bool a
+
+Return:
+    None
+");
+    void setReacActive(unsigned int h, bool a);
+
+    %feature("autodoc", 
+"
+Returns the extent of the compartment reaction or patch surface 
+reaction referred to by handle h.
+
+Syntax::
+    
+    getReacExtent(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    uint
+");
+    unsigned int getReacExtent(unsigned int h) const;
+
+    %feature("autodoc", 
+"
+Resets the extent of the compartment reaction or patch surface reaction 
+referred to by handle h.
+
+Syntax::
+    
+    resetReacExtent(h)
+    
+Arguments:
+    * uint h
+
+Return:
+    None
+");
+    void resetReacExtent(unsigned int h);
+
+};  
 
 ////////////////////////////////////////////////////////////////////////////////
 	
-} // end namespace wmrk4
+} // end namespace solver
 } // end namespace steps
 
 ////////////////////////////////////////////////////////////////////////////////
 
+%feature("autodoc", "1");
+
 namespace steps
 {
-namespace wmdirect
+namespace wmrk4
 {
-
-class Wmdirect : public steps::solver::API
+	
+class Wmrk4 : public steps::solver::API
 {
-
+	
 public:
-    %feature("autodoc", "1");
-	Wmdirect(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
 	%feature("autodoc", "1");
-    ~Wmdirect(void);
-     %feature("autodoc", 
+	Wmrk4(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
+    %feature("autodoc", "1");
+	~Wmrk4(void);
+    
+    %feature("autodoc", 
 "
 Returns a string of the solver's name.
 
@@ -2363,32 +2926,31 @@ Return:
     virtual double getTime(void) const;
 
 
-	
 	////////////////////////////////////////////////////////////////////////			
-	
-};
 		
-////////////////////////////////////////////////////////////////////////////////
+};
 
-} // end namespace wmdirect
+////////////////////////////////////////////////////////////////////////////////
+	
+} // end namespace wmrk4
 } // end namespace steps
 
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace steps
 {
-namespace tetexact
+namespace wmdirect
 {
 
-class Tetexact : public steps::solver::API
-{	
+class Wmdirect : public steps::solver::API
+{
 
 public:
     %feature("autodoc", "1");
-    Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
-    %feature("autodoc", "1");
-    ~Tetexact(void);
-    %feature("autodoc", 
+	Wmdirect(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r);
+	%feature("autodoc", "1");
+    ~Wmdirect(void);
+     %feature("autodoc", 
 "
 Returns a string of the solver's name.
 
@@ -2510,14 +3072,1161 @@ Return:
 ");
     virtual double getTime(void) const;
 
-    void advanceSteps(uint nsteps);
+
 	
 	////////////////////////////////////////////////////////////////////////			
 	
 };
-	
+		
 ////////////////////////////////////////////////////////////////////////////////
-	
-} // end namespace tetexact
+
+} // end namespace wmdirect
+} // end namespace steps
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace steps
+{
+namespace tetexact
+{
+
+class Tetexact : public steps::solver::API
+{	
+
+public:
+    %feature("autodoc", 
+"
+Construct a Tetexact solver. If reorder is True, the tetrahedrons and
+triangles are laid out in memory along a space-filling curve through
+their barycenters, which can speed up meshes whose element numbering
+has poor locality. Tetrahedron and triangle indices are not affected.
+
+Syntax::
+    
+    Tetexact(model, geom, rng, reorder = False)
+    
+Arguments:
+    * steps.model.Model model
+    * steps.geom.Tetmesh geom
+    * steps.rng.RNG rng
+    * bool reorder
+
+Return:
+    None
+");
+    Tetexact(steps::model::Model * m, steps::wm::Geom * g, steps::rng::RNG * r,
+             bool reorder = false);
+    %feature("autodoc", "1");
+    ~Tetexact(void);
+    %feature("autodoc", 
+"
+Returns a string of the solver's name.
+
+Syntax::
+    
+    getSolverName()
+    
+Arguments:
+    None
+
+Return:
+    string
+");
+    virtual std::string getSolverName(void) const;
+    
+    %feature("autodoc", 
+"
+Returns a string giving a short description of the solver.
+
+Syntax::
+    
+    getSolverDesc()
+    
+Arguments:
+    None
+
+Return:
+    string
+");
+    virtual std::string getSolverDesc(void) const;
+    
+    %feature("autodoc", 
+"
+Returns a string of the solver authors names.
+
+Syntax::
+    
+    getSolverAuthors()
+    
+Arguments:
+    None
+
+Return:
+    string
+");
+    virtual std::string getSolverAuthors(void) const;
+    
+    %feature("autodoc", 
+"
+Returns a string giving the author's email address.
+
+Syntax::
+    
+    getSolverEmail()
+    
+Arguments:
+    None
+
+Return:
+    string
+");
+    virtual std::string getSolverEmail(void) const;
+
+    %feature("autodoc", 
+"
+Reset the simulation to the state the solver was initialised to. 
+Typically, this resets all concentrations of all chemical species in 
+all elements (whether compartments and patches in a well-mixed solver 
+or tetrahedrons and triangles in a mesh-based solver) to zero, 
+resets the simulation time to zero and resets reaction (and diffusion) 
+rates to the default values described in the steps.model objects. 
+All reaction (and diffusion) rules are reset to active and all 
+compartment volumes and patch areas are reset to default values 
+described in steps.geom objects (for well-mixed solvers). 
+Usually, this method should be called before starting each simulation iteration.
+
+Syntax::
+    
+    reset()
+    
+Arguments:
+    None
+
+Return:
+    None
+");
+    virtual void reset(void);
+    
+    %feature("autodoc", 
+"
+Advance the simulation until endtime (given in seconds) is reached. 
+The endtime must be larger or equal to the current simulation time.
+
+Syntax::
+    
+    run(endtime)
+    
+Arguments:
+    float endtime
+
+Return:
+    None
+");
+    virtual void run(double endtime);
+    
+    %feature("autodoc", 
+"
+Returns the current simulation time in seconds.
+
+Syntax::
+    
+    getTime()
+    
+Arguments:
+    None
+
+Return:
+    float
+");
+    virtual double getTime(void) const;
+
+    void advanceSteps(uint nsteps);
+
+    %feature("autodoc", 
+"
+Returns the number of times the running total propensity (A0) of the 
+solver has been recomputed exactly to remove accumulated rounding error.
+The counter is set to zero by reset().
+
+Syntax::
+    
+    getA0Renorms()
+    
+Arguments:
+    None
+
+Return:
+    int
+");
+    uint getA0Renorms(void) const;
+
+    %feature("autodoc", 
+"
+Returns the number of times the solver's update path has allocated 
+memory, by growing its event group storage or its scratch update list.
+Once the event groups have settled, setters and steps leave the counter 
+unchanged, so it can be used to check that a protocol runs without 
+allocation.
+
+Syntax::
+    
+    getUpdAllocs()
+    
+Arguments:
+    None
+
+Return:
+    int
+");
+    uint getUpdAllocs(void) const;
+
+    %feature("autodoc", 
+"
+Selects the simulation engine. 'cr' (the default) samples each event 
+from all reaction and diffusion events in the mesh with the 
+composition-rejection method. 'nsm' uses the next-subvolume method: 
+every tetrahedron and triangle keeps the sum of its own propensities 
+and a queue orders them by the time of their next event. Both engines 
+are exact and the simulation state carries over when switching; which 
+one is faster depends on the model and the mesh.
+
+Syntax::
+    
+    setEngine(engine)
+    
+Arguments:
+    string engine
+
+Return:
+    None
+");
+    void setEngine(std::string const & engine);
+
+    %feature("autodoc", 
+"
+Returns the simulation engine selected with setEngine, 'cr' or 'nsm', 
+or 'parallel' after setParallel.
+
+Syntax::
+    
+    getEngine()
+    
+Arguments:
+    None
+
+Return:
+    string
+");
+    std::string getEngine(void) const;
+
+    %feature("autodoc", 
+"
+Selects the parallel engine. The tetrahedrons are split into nthreads 
+spatially contiguous domains, each with its own next-subvolume event 
+queue, random number stream and thread. Tetrahedrons coupled by a patch 
+triangle stay in one domain. Diffusion across a domain boundary is held 
+back and delivered every dt, so dt should be small compared with the 
+mean time a molecule stays in a tetrahedron. The result depends on the 
+seed, nthreads and dt, but not on the scheduling of the threads. 
+setEngine switches back to a serial engine.
+
+Syntax::
+    
+    setParallel(nthreads, dt)
+    
+Arguments:
+    uint nthreads
+    float dt
+
+Return:
+    None
+");
+    void setParallel(uint nthreads, double dt);
+
+    %feature("autodoc", 
+"
+Returns the number of threads of the parallel engine, or 0 if it is not 
+selected.
+
+Syntax::
+    
+    getParallelThreads()
+    
+Arguments:
+    None
+
+Return:
+    uint
+");
+    uint getParallelThreads(void) const;
+
+    %feature("autodoc", 
+"
+Returns the synchronisation time step of the parallel engine.
+
+Syntax::
+    
+    getParallelSyncDT()
+    
+Arguments:
+    None
+
+Return:
+    float
+");
+    double getParallelSyncDT(void) const;
+
+    %feature("autodoc", 
+"
+Sets the time step of leaped diffusion. Every dt the diffusion of the 
+selected species is advanced by binomial draws over the four faces of 
+each tetrahedron, instead of one molecule at a time; reactions and all 
+other diffusion stay exact. Species are selected with setSpecDiffLeap 
+or setDiffLeapThreshold. dt should be small compared with the mean 
+time a molecule stays in a tetrahedron. dt = 0 (the default) switches 
+leaping off.
+
+Syntax::
+    
+    setDiffLeapDT(dt)
+    
+Arguments:
+    float dt
+
+Return:
+    None
+");
+    void setDiffLeapDT(double dt);
+
+    %feature("autodoc", 
+"
+Returns the time step of leaped diffusion, 0 if it is off.
+
+Syntax::
+    
+    getDiffLeapDT()
+    
+Arguments:
+    None
+
+Return:
+    float
+");
+    double getDiffLeapDT(void) const;
+
+    %feature("autodoc", 
+"
+Selects whether the diffusion of species spec is always leaped, see 
+setDiffLeapDT.
+
+Syntax::
+    
+    setSpecDiffLeap(spec, leap)
+    
+Arguments:
+    string spec
+    bool leap
+
+Return:
+    None
+");
+    void setSpecDiffLeap(std::string const & s, bool leap);
+
+    %feature("autodoc", 
+"
+Returns whether the diffusion of species spec is always leaped.
+
+Syntax::
+    
+    getSpecDiffLeap(spec)
+    
+Arguments:
+    string spec
+
+Return:
+    bool
+");
+    bool getSpecDiffLeap(std::string const & s) const;
+
+    %feature("autodoc", 
+"
+Sets the count from which the diffusion of any species in a 
+tetrahedron is leaped, see setDiffLeapDT. 0 (the default) disables 
+the threshold.
+
+Syntax::
+    
+    setDiffLeapThreshold(n)
+    
+Arguments:
+    uint n
+
+Return:
+    None
+");
+    void setDiffLeapThreshold(uint n);
+
+    %feature("autodoc", 
+"
+Returns the count threshold of leaped diffusion, 0 if it is disabled.
+
+Syntax::
+    
+    getDiffLeapThreshold()
+    
+Arguments:
+    None
+
+Return:
+    uint
+");
+    uint getDiffLeapThreshold(void) const;
+
+    %feature("autodoc", 
+"
+Returns the indices of the tetrahedrons in compartment comp, in the 
+row order of getCompTetCountsView(comp).
+
+Syntax::
+    
+    getCompTetCountsTets(comp)
+    
+Arguments:
+    string comp
+
+Return:
+    list<uint>
+");
+    std::vector<unsigned int> getCompTetCountsTets(std::string const & c) const;
+
+    %feature("autodoc", 
+"
+Returns the names of the species in compartment comp, in the column 
+order of getCompTetCountsView(comp).
+
+Syntax::
+    
+    getCompTetCountsSpecs(comp)
+    
+Arguments:
+    string comp
+
+Return:
+    list<string>
+");
+    std::vector<std::string> getCompTetCountsSpecs(std::string const & c) const;
+
+    %feature("autodoc", 
+"
+Returns the indices of the triangles in patch patch, in the row order 
+of getPatchTriCountsView(patch).
+
+Syntax::
+    
+    getPatchTriCountsTris(patch)
+    
+Arguments:
+    string patch
+
+Return:
+    list<uint>
+");
+    std::vector<unsigned int> getPatchTriCountsTris(std::string const & p) const;
+
+    %feature("autodoc", 
+"
+Returns the names of the species in patch patch, in the column order 
+of getPatchTriCountsView(patch).
+
+Syntax::
+    
+    getPatchTriCountsSpecs(patch)
+    
+Arguments:
+    string patch
+
+Return:
+    list<string>
+");
+    std::vector<std::string> getPatchTriCountsSpecs(std::string const & p) const;
+
+    %feature("autodoc", 
+"
+Returns the indices of n tetrahedrons of compartment comp, each picked 
+independently with probability proportional to its volume.
+
+Syntax::
+    
+    pickCompTets(comp, n)
+    
+Arguments:
+    * string comp
+    * uint n
+
+Return:
+    list<uint>
+");
+    std::vector<unsigned int> pickCompTets(std::string const & c, unsigned int n);
+
+    %feature("autodoc", 
+"
+Returns the indices of n triangles of patch patch, each picked 
+independently with probability proportional to its area.
+
+Syntax::
+    
+    pickPatchTris(patch, n)
+    
+Arguments:
+    * string patch
+    * uint n
+
+Return:
+    list<uint>
+");
+    std::vector<unsigned int> pickPatchTris(std::string const & p, unsigned int n);
+
+    %feature("autodoc", "1");
+    %extend
+    {
+        PyObject * _getCompTetCountsView(PyObject * owner, std::string const & c)
+        {
+            unsigned int ntets = 0, nspecs = 0;
+            unsigned int const * data = $self->_getCompTetCounts(c, ntets, nspecs);
+            return steps_poolview_new(owner, data, ntets, nspecs);
+        }
+
+        PyObject * _getPatchTriCountsView(PyObject * owner, std::string const & p)
+        {
+            unsigned int ntris = 0, nspecs = 0;
+            unsigned int const * data = $self->_getPatchTriCounts(p, ntris, nspecs);
+            return steps_poolview_new(owner, data, ntris, nspecs);
+        }
+    }
+	
+	////////////////////////////////////////////////////////////////////////			
+	
+};
+	
+////////////////////////////////////////////////////////////////////////////////
+	
+} // end namespace tetexact
+} // end namespace steps
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace steps
+{
+namespace batch
+{
+
+class Batch
+{
+
+public:
+
+    %feature("autodoc", 
+"
+Construction::
+
+    b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)
+
+Create a runner for independent realisations of one model and 
+geometry, run in parallel. Each worker thread owns a solver object of 
+the given kind ('wmdirect' or 'tetexact') and a random number generator 
+of the given kind; the model and geometry are shared. Before each 
+realisation the worker's solver is reset, its generator reseeded and 
+the initial state replayed, so the results of a realisation depend only 
+on its seed.
+
+Arguments:
+    * string solver
+    * steps.model.Model model
+    * steps.geom.Geom geom
+    * string rng
+    * uint rngbufsize
+");
+    Batch(std::string const & solver, steps::model::Model * m,
+          steps::wm::Geom * g, std::string const & rng = "mt19937",
+          uint rngbufsize = 512);
+    %feature("autodoc", "1");
+    ~Batch(void);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the number of molecules 
+of species s in compartment c.
+
+Syntax::
+
+    setCompCount(c, s, n)
+
+Arguments:
+    * string c
+    * string s
+    * float n
+
+Return:
+    None
+");
+    void setCompCount(std::string const & c, std::string const & s, double n);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the concentration (in 
+molar units) of species s in compartment c.
+
+Syntax::
+
+    setCompConc(c, s, conc)
+
+Arguments:
+    * string c
+    * string s
+    * float conc
+
+Return:
+    None
+");
+    void setCompConc(std::string const & c, std::string const & s, double conc);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: whether species s is 
+clamped in compartment c.
+
+Syntax::
+
+    setCompClamped(c, s, b)
+
+Arguments:
+    * string c
+    * string s
+    * bool b
+
+Return:
+    None
+");
+    void setCompClamped(std::string const & c, std::string const & s, bool b);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the rate constant of 
+reaction r in compartment c.
+
+Syntax::
+
+    setCompReacK(c, r, kf)
+
+Arguments:
+    * string c
+    * string r
+    * float kf
+
+Return:
+    None
+");
+    void setCompReacK(std::string const & c, std::string const & r, double kf);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the number of molecules 
+of species s in tetrahedron tidx (mesh-based solvers only).
+
+Syntax::
+
+    setTetCount(tidx, s, n)
+
+Arguments:
+    * uint tidx
+    * string s
+    * float n
+
+Return:
+    None
+");
+    void setTetCount(uint tidx, std::string const & s, double n);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the number of molecules 
+of species s in patch p.
+
+Syntax::
+
+    setPatchCount(p, s, n)
+
+Arguments:
+    * string p
+    * string s
+    * float n
+
+Return:
+    None
+");
+    void setPatchCount(std::string const & p, std::string const & s, double n);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: whether species s is 
+clamped in patch p.
+
+Syntax::
+
+    setPatchClamped(p, s, b)
+
+Arguments:
+    * string p
+    * string s
+    * bool b
+
+Return:
+    None
+");
+    void setPatchClamped(std::string const & p, std::string const & s, bool b);
+
+    %feature("autodoc", 
+"
+Adds to the initial state of every realisation: the rate constant of 
+surface reaction r in patch p.
+
+Syntax::
+
+    setPatchSReacK(p, r, kf)
+
+Arguments:
+    * string p
+    * string r
+    * float kf
+
+Return:
+    None
+");
+    void setPatchSReacK(std::string const & p, std::string const & r, double kf);
+
+    %feature("autodoc", 
+"
+Removes everything added to the initial state.
+
+Syntax::
+
+    clearInitialState()
+
+Arguments:
+    None
+
+Return:
+    None
+");
+    void clearInitialState(void);
+
+    %feature("autodoc", 
+"
+Adds an observable: the number of molecules of species s in 
+compartment c.
+
+Syntax::
+
+    addCompCount(c, s)
+
+Arguments:
+    * string c
+    * string s
+
+Return:
+    None
+");
+    void addCompCount(std::string const & c, std::string const & s);
+
+    %feature("autodoc", 
+"
+Adds an observable: the number of molecules of species s in patch p.
+
+Syntax::
+
+    addPatchCount(p, s)
+
+Arguments:
+    * string p
+    * string s
+
+Return:
+    None
+");
+    void addPatchCount(std::string const & p, std::string const & s);
+
+    %feature("autodoc", 
+"
+Adds an observable: the number of molecules of species s in 
+tetrahedron tidx (mesh-based solvers only).
+
+Syntax::
+
+    addTetCount(tidx, s)
+
+Arguments:
+    * uint tidx
+    * string s
+
+Return:
+    None
+");
+    void addTetCount(uint tidx, std::string const & s);
+
+    %feature("autodoc", 
+"
+Removes all observables.
+
+Syntax::
+
+    clearObservables()
+
+Arguments:
+    None
+
+Return:
+    None
+");
+    void clearObservables(void);
+
+    %feature("autodoc", 
+"
+Returns the number of observables.
+
+Syntax::
+
+    countObservables()
+
+Arguments:
+    None
+
+Return:
+    uint
+");
+    uint countObservables(void) const;
+
+    %feature("autodoc", 
+"
+Runs one realisation per seed on nthreads threads (0 for one thread per 
+realisation) and returns the observables sampled at each time point, 
+as a flat list which can be reshaped to 
+(len(seeds), len(tpnts), countObservables()).
+
+Syntax::
+
+    run(seeds, tpnts, nthreads)
+
+Arguments:
+    * list<uint> seeds
+    * list<float> tpnts
+    * uint nthreads
+
+Return:
+    list<float>
+");
+    std::vector<double> run(std::vector<uint> const & seeds,
+                            std::vector<double> const & tpnts,
+                            uint nthreads);
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace batch
+} // end namespace steps
+    
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace steps
+{
+namespace solver
+{
+
+class Recorder
+{
+
+public:
+
+    %feature("autodoc", 
+"
+Construction::
+
+    rec = steps.solver.Recorder(sim)
+
+Create a recorder of time series from solver sim (a Wmrk4, Wmdirect or 
+Tetexact object). Observables are added with the add... methods and 
+sampling times with setTimePoints(); run() then advances the solver 
+through all the time points and samples every observable after each, 
+without returning to Python in between. The solver must be kept alive 
+for as long as the recorder is used.
+
+Arguments:
+    * steps.solver.API sim
+");
+    Recorder(steps::solver::API * sim);
+    %feature("autodoc", "1");
+    ~Recorder(void);
+
+    %feature("autodoc", 
+"
+Records the number of molecules of species s in compartment c.
+
+Syntax::
+
+    addCompCount(c, s)
+
+Arguments:
+    * string c
+    * string s
+
+Return:
+    None
+");
+    void addCompCount(std::string const & c, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the concentration (in molar units) of species s in 
+compartment c.
+
+Syntax::
+
+    addCompConc(c, s)
+
+Arguments:
+    * string c
+    * string s
+
+Return:
+    None
+");
+    void addCompConc(std::string const & c, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the number of molecules of species s in patch p.
+
+Syntax::
+
+    addPatchCount(p, s)
+
+Arguments:
+    * string p
+    * string s
+
+Return:
+    None
+");
+    void addPatchCount(std::string const & p, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the number of molecules of species s in tetrahedron 
+tidx.
+
+Syntax::
+
+    addTetCount(tidx, s)
+
+Arguments:
+    * uint tidx
+    * string s
+
+Return:
+    None
+");
+    void addTetCount(unsigned int tidx, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the concentration (in molar units) of species s in 
+tetrahedron tidx.
+
+Syntax::
+
+    addTetConc(tidx, s)
+
+Arguments:
+    * uint tidx
+    * string s
+
+Return:
+    None
+");
+    void addTetConc(unsigned int tidx, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the number of molecules of species s in triangle tidx.
+
+Syntax::
+
+    addTriCount(tidx, s)
+
+Arguments:
+    * uint tidx
+    * string s
+
+Return:
+    None
+");
+    void addTriCount(unsigned int tidx, std::string const & s);
+
+    %feature("autodoc", 
+"
+Records the extent of reaction r in compartment c.
+
+Syntax::
+
+    addCompReacExtent(c, r)
+
+Arguments:
+    * string c
+    * string r
+
+Return:
+    None
+");
+    void addCompReacExtent(std::string const & c, std::string const & r);
+
+    %feature("autodoc", 
+"
+Records the extent of surface reaction sr in patch p.
+
+Syntax::
+
+    addPatchSReacExtent(p, sr)
+
+Arguments:
+    * string p
+    * string sr
+
+Return:
+    None
+");
+    void addPatchSReacExtent(std::string const & p, std::string const & sr);
+
+    %feature("autodoc", 
+"
+Forgets all observables added so far.
+
+Syntax::
+
+    clearObservables()
+
+Arguments:
+    None
+
+Return:
+    None
+");
+    void clearObservables(void);
+
+    %feature("autodoc", 
+"
+Returns the number of observables.
+
+Syntax::
+
+    countObservables()
+
+Arguments:
+    None
+
+Return:
+    uint
+");
+    unsigned int countObservables(void) const;
+
+    %feature("autodoc", 
+"
+Sets the sampling times, which must be non-negative and in 
+non-decreasing order.
+
+Syntax::
+
+    setTimePoints(tpnts)
+
+Arguments:
+    * list<float> tpnts
+
+Return:
+    None
+");
+    void setTimePoints(std::vector<double> const & tpnts);
+
+    %feature("autodoc", 
+"
+Returns the sampling times.
+
+Syntax::
+
+    getTimePoints()
+
+Arguments:
+    None
+
+Return:
+    list<float>
+");
+    std::vector<double> const & getTimePoints(void) const;
+
+    %feature("autodoc", 
+"
+Returns the number of sampling times.
+
+Syntax::
+
+    countTimePoints()
+
+Arguments:
+    None
+
+Return:
+    uint
+");
+    unsigned int countTimePoints(void) const;
+
+    %feature("autodoc", 
+"
+Runs the solver to each time point in turn and returns the observables 
+sampled there, as a flat list which can be reshaped to 
+(countTimePoints(), countObservables()).
+
+Syntax::
+
+    run()
+
+Arguments:
+    None
+
+Return:
+    list<float>
+");
+    std::vector<double> run(void);
+
+    %feature("autodoc", 
+"
+As run(), but writes the samples to counts, a contiguous buffer of 
+countTimePoints() * countObservables() values, e.g. a NumPy array of 
+dtype float64; no copies are made.
+
+Syntax::
+
+    runNP(counts)
+
+Arguments:
+    * buffer<float> counts
+
+Return:
+    None
+");
+    void runNP(double * counts, unsigned int counts_size);
+
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace solver
 } // end namespace steps
-    
\ No newline at end of file
@@ -2730,43 +2730,45 @@ SWIG_Python_MustGetPtr(PyObject *obj, swig_type_info *ty, int argnum, int flags)
 #define SWIGTYPE_p_steps__ArgErr swig_types[42]
 #define SWIGTYPE_p_steps__Err swig_types[43]
 #define SWIGTYPE_p_steps__NotImplErr swig_types[44]
-#define SWIGTYPE_p_steps__model__Diff swig_types[45]
-#define SWIGTYPE_p_steps__model__Model swig_types[46]
-#define SWIGTYPE_p_steps__model__Reac swig_types[47]
-#define SWIGTYPE_p_steps__model__SReac swig_types[48]
-#define SWIGTYPE_p_steps__model__Spec swig_types[49]
-#define SWIGTYPE_p_steps__model__Surfsys swig_types[50]
-#define SWIGTYPE_p_steps__model__Volsys swig_types[51]
-#define SWIGTYPE_p_steps__rng__RNG swig_types[52]
-#define SWIGTYPE_p_steps__solver__API swig_types[53]
-#define SWIGTYPE_p_steps__tetexact__Tetexact swig_types[54]
-#define SWIGTYPE_p_steps__tetmesh__DiffBoundary swig_types[55]
-#define SWIGTYPE_p_steps__tetmesh__Tetmesh swig_types[56]
-#define SWIGTYPE_p_steps__tetmesh__TmComp swig_types[57]
-#define SWIGTYPE_p_steps__tetmesh__TmPatch swig_types[58]
-#define SWIGTYPE_p_steps__wm__Comp swig_types[59]
-#define SWIGTYPE_p_steps__wm__Geom swig_types[60]
-#define SWIGTYPE_p_steps__wm__Patch swig_types[61]
-#define SWIGTYPE_p_steps__wmdirect__Wmdirect swig_types[62]
-#define SWIGTYPE_p_steps__wmrk4__Wmrk4 swig_types[63]
-#define SWIGTYPE_p_swig__SwigPyIterator swig_types[64]
-#define SWIGTYPE_p_unsigned_char swig_types[65]
-#define SWIGTYPE_p_unsigned_int swig_types[66]
-#define SWIGTYPE_p_unsigned_long swig_types[67]
-#define SWIGTYPE_p_unsigned_short swig_types[68]
-#define SWIGTYPE_p_value_type swig_types[69]
-#define SWIGTYPE_std__setT_steps__wm__Patch_p_std__lessT_steps__wm__Patch_p_t_std__allocatorT_steps__wm__Patch_p_t_t__key_type swig_types[70]
-#define SWIGTYPE_std__setT_steps__wm__Patch_p_std__lessT_steps__wm__Patch_p_t_std__allocatorT_steps__wm__Patch_p_t_t__value_type swig_types[71]
-#define SWIGTYPE_std__vectorT_steps__model__Diff_p_std__allocatorT_steps__model__Diff_p_t_t__value_type swig_types[72]
-#define SWIGTYPE_std__vectorT_steps__model__Reac_p_std__allocatorT_steps__model__Reac_p_t_t__value_type swig_types[73]
-#define SWIGTYPE_std__vectorT_steps__model__SReac_p_std__allocatorT_steps__model__SReac_p_t_t__value_type swig_types[74]
-#define SWIGTYPE_std__vectorT_steps__model__Spec_p_std__allocatorT_steps__model__Spec_p_t_t__value_type swig_types[75]
-#define SWIGTYPE_std__vectorT_steps__model__Surfsys_p_std__allocatorT_steps__model__Surfsys_p_t_t__value_type swig_types[76]
-#define SWIGTYPE_std__vectorT_steps__model__Volsys_p_std__allocatorT_steps__model__Volsys_p_t_t__value_type swig_types[77]
-#define SWIGTYPE_std__vectorT_steps__wm__Comp_p_std__allocatorT_steps__wm__Comp_p_t_t__value_type swig_types[78]
-#define SWIGTYPE_std__vectorT_steps__wm__Patch_p_std__allocatorT_steps__wm__Patch_p_t_t__value_type swig_types[79]
-static swig_type_info *swig_types[81];
-static swig_module_info swig_module = {swig_types, 80, 0, 0, 0, 0};
+#define SWIGTYPE_p_steps__batch__Batch swig_types[45]
+#define SWIGTYPE_p_steps__model__Diff swig_types[46]
+#define SWIGTYPE_p_steps__model__Model swig_types[47]
+#define SWIGTYPE_p_steps__model__Reac swig_types[48]
+#define SWIGTYPE_p_steps__model__SReac swig_types[49]
+#define SWIGTYPE_p_steps__model__Spec swig_types[50]
+#define SWIGTYPE_p_steps__model__Surfsys swig_types[51]
+#define SWIGTYPE_p_steps__model__Volsys swig_types[52]
+#define SWIGTYPE_p_steps__rng__RNG swig_types[53]
+#define SWIGTYPE_p_steps__solver__API swig_types[54]
+#define SWIGTYPE_p_steps__solver__Recorder swig_types[55]
+#define SWIGTYPE_p_steps__tetexact__Tetexact swig_types[56]
+#define SWIGTYPE_p_steps__tetmesh__DiffBoundary swig_types[57]
+#define SWIGTYPE_p_steps__tetmesh__Tetmesh swig_types[58]
+#define SWIGTYPE_p_steps__tetmesh__TmComp swig_types[59]
+#define SWIGTYPE_p_steps__tetmesh__TmPatch swig_types[60]
+#define SWIGTYPE_p_steps__wm__Comp swig_types[61]
+#define SWIGTYPE_p_steps__wm__Geom swig_types[62]
+#define SWIGTYPE_p_steps__wm__Patch swig_types[63]
+#define SWIGTYPE_p_steps__wmdirect__Wmdirect swig_types[64]
+#define SWIGTYPE_p_steps__wmrk4__Wmrk4 swig_types[65]
+#define SWIGTYPE_p_swig__SwigPyIterator swig_types[66]
+#define SWIGTYPE_p_unsigned_char swig_types[67]
+#define SWIGTYPE_p_unsigned_int swig_types[68]
+#define SWIGTYPE_p_unsigned_long swig_types[69]
+#define SWIGTYPE_p_unsigned_short swig_types[70]
+#define SWIGTYPE_p_value_type swig_types[71]
+#define SWIGTYPE_std__setT_steps__wm__Patch_p_std__lessT_steps__wm__Patch_p_t_std__allocatorT_steps__wm__Patch_p_t_t__key_type swig_types[72]
+#define SWIGTYPE_std__setT_steps__wm__Patch_p_std__lessT_steps__wm__Patch_p_t_std__allocatorT_steps__wm__Patch_p_t_t__value_type swig_types[73]
+#define SWIGTYPE_std__vectorT_steps__model__Diff_p_std__allocatorT_steps__model__Diff_p_t_t__value_type swig_types[74]
+#define SWIGTYPE_std__vectorT_steps__model__Reac_p_std__allocatorT_steps__model__Reac_p_t_t__value_type swig_types[75]
+#define SWIGTYPE_std__vectorT_steps__model__SReac_p_std__allocatorT_steps__model__SReac_p_t_t__value_type swig_types[76]
+#define SWIGTYPE_std__vectorT_steps__model__Spec_p_std__allocatorT_steps__model__Spec_p_t_t__value_type swig_types[77]
+#define SWIGTYPE_std__vectorT_steps__model__Surfsys_p_std__allocatorT_steps__model__Surfsys_p_t_t__value_type swig_types[78]
+#define SWIGTYPE_std__vectorT_steps__model__Volsys_p_std__allocatorT_steps__model__Volsys_p_t_t__value_type swig_types[79]
+#define SWIGTYPE_std__vectorT_steps__wm__Comp_p_std__allocatorT_steps__wm__Comp_p_t_t__value_type swig_types[80]
+#define SWIGTYPE_std__vectorT_steps__wm__Patch_p_std__allocatorT_steps__wm__Patch_p_t_t__value_type swig_types[81]
+static swig_type_info *swig_types[83];
+static swig_module_info swig_module = {swig_types, 82, 0, 0, 0, 0};
 #define SWIG_TypeQuery(name) SWIG_TypeQueryModule(&swig_module, &swig_module, name)
 #define SWIG_MangledTypeQuery(name) SWIG_MangledTypeQueryModule(&swig_module, &swig_module, name)
 
@@ -5791,11 +5793,142 @@ SWIG_AsVal_float (PyObject * obj, float *val)
 
 #include "../cpp//solver/api.hpp"
 #include "../cpp/solver/statedef.hpp"
+#include "../cpp/solver/recorder.hpp"
 #include "../cpp/wmrk4/wmrk4.hpp"
 #include "../cpp/wmdirect/wmdirect.hpp"
 #include "../cpp/tetexact/tetexact.hpp"
+#include "../cpp/batch/batch.hpp"
 #include "../cpp/error.hpp"
 
+
+static int steps_getbuffer(PyObject * obj, Py_buffer * view,
+                           char const * codes, Py_ssize_t itemsize,
+                           bool writable)
+{
+	int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+	if (writable) flags |= PyBUF_WRITABLE;
+	if (PyObject_GetBuffer(obj, view, flags) != 0) return -1;
+
+	// Skip a byte order prefix if it matches the native one: '<' or '>'
+	// is what ctypes arrays report.
+	unsigned int one = 1;
+	char native = (*reinterpret_cast<char *>(&one) == 1) ? '<' : '>';
+	char const * fmt = view->format;
+	if (fmt != 0 && (fmt[0] == '@' || fmt[0] == '=' || fmt[0] == native)) ++fmt;
+	if (view->itemsize != itemsize || fmt == 0 || fmt[0] == '\0' ||
+	    fmt[1] != '\0' || strchr(codes, fmt[0]) == 0)
+	{
+		PyBuffer_Release(view);
+		PyErr_Format(PyExc_TypeError,
+		             "Expected a contiguous buffer of type '%c'.", codes[0]);
+		return -1;
+	}
+	return 0;
+}
+
+
+typedef struct
+{
+	PyObject_HEAD
+	PyObject          * owner;
+	unsigned int const* data;
+	Py_ssize_t          shape[2];
+	Py_ssize_t          strides[2];
+} steps_PoolView;
+
+static void steps_poolview_dealloc(steps_PoolView * self)
+{
+	Py_XDECREF(self->owner);
+	PyObject_Del(self);
+}
+
+static int steps_poolview_getbuffer(steps_PoolView * self, Py_buffer * view,
+                                    int flags)
+{
+	if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE)
+	{
+		view->obj = 0;
+		PyErr_SetString(PyExc_BufferError, "Count views are read-only.");
+		return -1;
+	}
+	view->buf = const_cast<unsigned int *>(self->data);
+	view->obj = reinterpret_cast<PyObject *>(self);
+	Py_INCREF(self);
+	view->len = self->shape[0] * self->shape[1] * sizeof(unsigned int);
+	view->readonly = 1;
+	view->itemsize = sizeof(unsigned int);
+	view->format = 0;
+	if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+		view->format = const_cast<char *>("I");
+	view->ndim = 1;
+	view->shape = 0;
+	view->strides = 0;
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->ndim = 2;
+		view->shape = self->shape;
+		if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+			view->strides = self->strides;
+	}
+	view->suboffsets = 0;
+	view->internal = 0;
+	return 0;
+}
+
+static PyBufferProcs steps_poolview_as_buffer;
+
+#ifndef Py_TPFLAGS_HAVE_NEWBUFFER
+#define Py_TPFLAGS_HAVE_NEWBUFFER 0
+#endif
+
+static PyTypeObject steps_PoolViewType =
+{
+	PyVarObject_HEAD_INIT(0, 0)
+	"steps_swig.PoolView",                          // tp_name
+	sizeof(steps_PoolView),                         // tp_basicsize
+	0,                                              // tp_itemsize
+	reinterpret_cast<destructor>(steps_poolview_dealloc),
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	&steps_poolview_as_buffer,                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, // tp_flags
+	"Read-only view of a packed count matrix (tets x species)."
+};
+
+static PyObject * steps_poolview_new(PyObject * owner,
+                                     unsigned int const * data,
+                                     unsigned int nrows, unsigned int ncols)
+{
+	if (steps_poolview_as_buffer.bf_getbuffer == 0)
+	{
+		steps_poolview_as_buffer.bf_getbuffer =
+			reinterpret_cast<getbufferproc>(steps_poolview_getbuffer);
+		if (PyType_Ready(&steps_PoolViewType) < 0) return 0;
+	}
+	steps_PoolView * self = PyObject_New(steps_PoolView, &steps_PoolViewType);
+	if (self == 0) return 0;
+	Py_XINCREF(owner);
+	self->owner = owner;
+	self->data = data;
+	self->shape[0] = nrows;
+	self->shape[1] = ncols;
+	self->strides[0] = ncols * sizeof(unsigned int);
+	self->strides[1] = sizeof(unsigned int);
+	return reinterpret_cast<PyObject *>(self);
+}
+
+SWIGINTERN PyObject *steps_tetexact_Tetexact__getCompTetCountsView(steps::tetexact::Tetexact *self,PyObject *owner,std::string const &c){
+            unsigned int ntets = 0, nspecs = 0;
+            unsigned int const * data = self->_getCompTetCounts(c, ntets, nspecs);
+            return steps_poolview_new(owner, data, ntets, nspecs);
+        }
+
+SWIGINTERN PyObject *steps_tetexact_Tetexact__getPatchTriCountsView(steps::tetexact::Tetexact *self,PyObject *owner,std::string const &p){
+            unsigned int ntris = 0, nspecs = 0;
+            unsigned int const * data = self->_getPatchTriCounts(p, ntris, nspecs);
+            return steps_poolview_new(owner, data, ntris, nspecs);
+        }
+
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37685,6 +37818,9 @@ SWIGINTERN PyObject *_wrap_new_Geom(PyObject *SWIGUNUSEDPARM(self), PyObject *ar
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Geom, SWIG_POINTER_NEW |  0 );
@@ -37716,6 +37852,9 @@ SWIGINTERN PyObject *_wrap_delete_Geom(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -37762,6 +37901,9 @@ SWIGINTERN PyObject *_wrap_Geom_getComp(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Comp, 0 |  0 );
@@ -37809,6 +37951,9 @@ SWIGINTERN PyObject *_wrap_Geom_delComp(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -37843,6 +37988,9 @@ SWIGINTERN PyObject *_wrap_Geom_getAllComps(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<steps::wm::Comp*,std::allocator< steps::wm::Comp * > > >(result));
@@ -37889,6 +38037,9 @@ SWIGINTERN PyObject *_wrap_Geom_getPatch(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Patch, 0 |  0 );
@@ -37936,6 +38087,9 @@ SWIGINTERN PyObject *_wrap_Geom_delPatch(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -37970,6 +38124,9 @@ SWIGINTERN PyObject *_wrap_Geom_getAllPatches(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<steps::wm::Patch*,std::allocator< steps::wm::Patch * > > >(result));
@@ -38057,6 +38214,9 @@ SWIGINTERN PyObject *_wrap_new_Patch(PyObject *SWIGUNUSEDPARM(self), PyObject *a
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Patch, SWIG_POINTER_NEW |  0 );
@@ -38090,6 +38250,9 @@ SWIGINTERN PyObject *_wrap_delete_Patch(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38122,6 +38285,9 @@ SWIGINTERN PyObject *_wrap_Patch_getID(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -38167,6 +38333,9 @@ SWIGINTERN PyObject *_wrap_Patch_setID(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38201,6 +38370,9 @@ SWIGINTERN PyObject *_wrap_Patch_getContainer(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
@@ -38233,6 +38405,9 @@ SWIGINTERN PyObject *_wrap_Patch_getArea(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -38273,6 +38448,9 @@ SWIGINTERN PyObject *_wrap_Patch_setArea(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38318,6 +38496,9 @@ SWIGINTERN PyObject *_wrap_Patch_addSurfsys(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38352,6 +38533,9 @@ SWIGINTERN PyObject *_wrap_Patch_getSurfsys(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::set<std::string,std::less< std::string >,std::allocator< std::string > > >(result));
@@ -38397,6 +38581,9 @@ SWIGINTERN PyObject *_wrap_Patch_delSurfsys(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38431,6 +38618,9 @@ SWIGINTERN PyObject *_wrap_Patch_getIComp(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Comp, 0 |  0 );
@@ -38463,6 +38653,9 @@ SWIGINTERN PyObject *_wrap_Patch_getOComp(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Comp, 0 |  0 );
@@ -38530,6 +38723,9 @@ SWIGINTERN PyObject *_wrap_new_Comp(PyObject *SWIGUNUSEDPARM(self), PyObject *ar
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Comp, SWIG_POINTER_NEW |  0 );
@@ -38563,6 +38759,9 @@ SWIGINTERN PyObject *_wrap_delete_Comp(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38595,6 +38794,9 @@ SWIGINTERN PyObject *_wrap_Comp_getID(PyObject *SWIGUNUSEDPARM(self), PyObject *
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -38640,6 +38842,9 @@ SWIGINTERN PyObject *_wrap_Comp_setID(PyObject *SWIGUNUSEDPARM(self), PyObject *
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38674,6 +38879,9 @@ SWIGINTERN PyObject *_wrap_Comp_getContainer(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
@@ -38706,6 +38914,9 @@ SWIGINTERN PyObject *_wrap_Comp_getVol(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -38746,6 +38957,9 @@ SWIGINTERN PyObject *_wrap_Comp_setVol(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38791,6 +39005,9 @@ SWIGINTERN PyObject *_wrap_Comp_addVolsys(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38825,6 +39042,9 @@ SWIGINTERN PyObject *_wrap_Comp_getVolsys(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::set<std::string,std::less< std::string >,std::allocator< std::string > > >(result));
@@ -38870,6 +39090,9 @@ SWIGINTERN PyObject *_wrap_Comp_delVolsys(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -38904,6 +39127,9 @@ SWIGINTERN PyObject *_wrap_Comp_getIPatches(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::set<steps::wm::Patch *,std::less< steps::wm::Patch * >,std::allocator< steps::wm::Patch * > > >(result));
@@ -38936,6 +39162,9 @@ SWIGINTERN PyObject *_wrap_Comp_getOPatches(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::set<steps::wm::Patch *,std::less< steps::wm::Patch * >,std::allocator< steps::wm::Patch * > > >(result));
@@ -38993,6 +39222,9 @@ SWIGINTERN PyObject *_wrap_new_Tetmesh__SWIG_0(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, SWIG_POINTER_NEW |  0 );
@@ -39058,6 +39290,9 @@ SWIGINTERN PyObject *_wrap_new_Tetmesh__SWIG_1(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, SWIG_POINTER_NEW |  0 );
@@ -39115,6 +39350,9 @@ SWIGINTERN PyObject *_wrap_new_Tetmesh__SWIG_2(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, SWIG_POINTER_NEW |  0 );
@@ -39282,6 +39520,9 @@ SWIGINTERN PyObject *_wrap_new_Tetmesh__SWIG_3(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, SWIG_POINTER_NEW |  0 );
@@ -39449,6 +39690,9 @@ SWIGINTERN PyObject *_wrap_delete_Tetmesh(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -39516,6 +39760,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_setVertex(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -39583,6 +39830,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_setTri(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -39659,6 +39909,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_setTet(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -39690,6 +39943,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_setup(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -39722,6 +39978,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_isSetupDone(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -39763,6 +40022,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getVertex(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -39795,6 +40057,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_countVertices(PyObject *SWIGUNUSEDPARM(self),
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -39836,6 +40101,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTri(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -39868,6 +40136,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_countTris(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -39909,6 +40180,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriArea(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -39950,6 +40224,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriBarycenter(PyObject *SWIGUNUSEDPARM(sel
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -39991,6 +40268,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetQualityRER(PyObject *SWIGUNUSEDPARM(sel
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -40032,6 +40312,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriNorm(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -40073,6 +40356,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriPatch(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__TmPatch, 0 |  0 );
@@ -40114,6 +40400,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriDiffBoundary(PyObject *SWIGUNUSEDPARM(s
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__DiffBoundary, 0 |  0 );
@@ -40155,6 +40444,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriTetNeighb(PyObject *SWIGUNUSEDPARM(self
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
@@ -40187,6 +40479,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTriBoundary(PyObject *SWIGUNUSEDPARM(self)
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
@@ -40219,6 +40514,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getSurfTris(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -40260,6 +40558,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTet(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -40292,6 +40593,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_countTets(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -40333,6 +40637,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetVol(PyObject *SWIGUNUSEDPARM(self), PyO
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -40374,6 +40681,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetBarycenter(PyObject *SWIGUNUSEDPARM(sel
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -40415,6 +40725,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetComp(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__TmComp, 0 |  0 );
@@ -40456,6 +40769,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetTriNeighb(PyObject *SWIGUNUSEDPARM(self
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -40497,6 +40813,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getTetTetNeighb(PyObject *SWIGUNUSEDPARM(self
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
@@ -40540,6 +40859,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_findTetByPoint(PyObject *SWIGUNUSEDPARM(self)
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_int(static_cast< int >(result));
@@ -40549,6 +40871,52 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_Tetmesh_findTetsByPoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetmesh::Tetmesh *arg1 = (steps::tetmesh::Tetmesh *) 0 ;
+  std::vector< double,std::allocator< double > > arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::vector< int,std::allocator< int > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetmesh_findTetsByPoints",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetmesh__Tetmesh, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetmesh_findTetsByPoints" "', argument " "1"" of type '" "steps::tetmesh::Tetmesh const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetmesh::Tetmesh * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    int res = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "Tetmesh_findTetsByPoints" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > >""'"); 
+    }
+    arg2 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
+  }
+  {
+    try {
+      result = ((steps::tetmesh::Tetmesh const *)arg1)->findTetsByPoints(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      return NULL;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<int,std::allocator< int > > >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_Tetmesh_getBoundMin(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   steps::tetmesh::Tetmesh *arg1 = (steps::tetmesh::Tetmesh *) 0 ;
@@ -40572,6 +40940,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getBoundMin(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -40604,6 +40975,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getBoundMax(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -40636,6 +41010,9 @@ SWIGINTERN PyObject *_wrap_Tetmesh_getMeshVolume(PyObject *SWIGUNUSEDPARM(self),
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -40652,6 +41029,88 @@ SWIGINTERN PyObject *Tetmesh_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObje
   return SWIG_Py_Void();
 }
 
+SWIGINTERN PyObject *_wrap_saveBinary(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  std::string arg1 ;
+  steps::tetmesh::Tetmesh *arg2 = (steps::tetmesh::Tetmesh *) 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:saveBinary",&obj0,&obj1)) SWIG_fail;
+  {
+    std::string *ptr = (std::string *)0;
+    int res = SWIG_AsPtr_std_string(obj0, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "saveBinary" "', argument " "1"" of type '" "std::string""'"); 
+    }
+    arg1 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
+  }
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__tetmesh__Tetmesh, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "saveBinary" "', argument " "2"" of type '" "steps::tetmesh::Tetmesh *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::tetmesh::Tetmesh * >(argp2);
+  {
+    try {
+      steps::tetmesh::saveBinary(arg1,arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      return NULL;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_loadBinary(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  std::string arg1 ;
+  PyObject * obj0 = 0 ;
+  steps::tetmesh::Tetmesh *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:loadBinary",&obj0)) SWIG_fail;
+  {
+    std::string *ptr = (std::string *)0;
+    int res = SWIG_AsPtr_std_string(obj0, &ptr);
+    if (!SWIG_IsOK(res) || !ptr) {
+      SWIG_exception_fail(SWIG_ArgError((ptr ? res : SWIG_TypeError)), "in method '" "loadBinary" "', argument " "1"" of type '" "std::string""'"); 
+    }
+    arg1 = *ptr;
+    if (SWIG_IsNewObj(res)) delete ptr;
+  }
+  {
+    try {
+      result = (steps::tetmesh::Tetmesh *)steps::tetmesh::loadBinary(arg1);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      return NULL;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, SWIG_POINTER_OWN |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_new_TmComp(PyObject *SWIGUNUSEDPARM(self), PyObject *args, PyObject *kwargs) {
   PyObject *resultobj = 0;
   std::string *arg1 = 0 ;
@@ -40706,6 +41165,9 @@ SWIGINTERN PyObject *_wrap_new_TmComp(PyObject *SWIGUNUSEDPARM(self), PyObject *
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__TmComp, SWIG_POINTER_NEW |  0 );
@@ -40741,6 +41203,9 @@ SWIGINTERN PyObject *_wrap_delete_TmComp(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -40781,6 +41246,9 @@ SWIGINTERN PyObject *_wrap_TmComp_setVol(PyObject *SWIGUNUSEDPARM(self), PyObjec
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -40813,6 +41281,9 @@ SWIGINTERN PyObject *_wrap_TmComp_getAllTetIndices(PyObject *SWIGUNUSEDPARM(self
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -40845,6 +41316,9 @@ SWIGINTERN PyObject *_wrap_TmComp_countTets(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -40888,6 +41362,9 @@ SWIGINTERN PyObject *_wrap_TmComp_isTetInside(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<bool,std::allocator< bool > > >(result));
@@ -40920,6 +41397,9 @@ SWIGINTERN PyObject *_wrap_TmComp_getBoundMin(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -40952,6 +41432,9 @@ SWIGINTERN PyObject *_wrap_TmComp_getBoundMax(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
@@ -41042,6 +41525,9 @@ SWIGINTERN PyObject *_wrap_new_TmPatch(PyObject *SWIGUNUSEDPARM(self), PyObject
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__TmPatch, SWIG_POINTER_NEW |  0 );
@@ -41077,6 +41563,9 @@ SWIGINTERN PyObject *_wrap_delete_TmPatch(PyObject *SWIGUNUSEDPARM(self), PyObje
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -41117,6 +41606,9 @@ SWIGINTERN PyObject *_wrap_TmPatch_setArea(PyObject *SWIGUNUSEDPARM(self), PyObj
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -41149,6 +41641,9 @@ SWIGINTERN PyObject *_wrap_TmPatch_getAllTriIndices(PyObject *SWIGUNUSEDPARM(sel
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -41192,6 +41687,9 @@ SWIGINTERN PyObject *_wrap_TmPatch_isTriInside(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<bool,std::allocator< bool > > >(result));
@@ -41262,6 +41760,9 @@ SWIGINTERN PyObject *_wrap_new_DiffBoundary(PyObject *SWIGUNUSEDPARM(self), PyOb
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__DiffBoundary, SWIG_POINTER_NEW |  0 );
@@ -41297,6 +41798,9 @@ SWIGINTERN PyObject *_wrap_delete_DiffBoundary(PyObject *SWIGUNUSEDPARM(self), P
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -41329,6 +41833,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_getID(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -41374,6 +41881,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_setID(PyObject *SWIGUNUSEDPARM(self), Py
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -41408,6 +41918,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_getContainer(PyObject *SWIGUNUSEDPARM(se
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetmesh__Tetmesh, 0 |  0 );
@@ -41440,6 +41953,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_getComps(PyObject *SWIGUNUSEDPARM(self),
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<steps::wm::Comp*,std::allocator< steps::wm::Comp * > > >(result));
@@ -41483,6 +41999,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_isTriInside(PyObject *SWIGUNUSEDPARM(sel
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<bool,std::allocator< bool > > >(result));
@@ -41515,6 +42034,9 @@ SWIGINTERN PyObject *_wrap_DiffBoundary_getAllTriIndices(PyObject *SWIGUNUSEDPAR
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
       return NULL;
+    } catch (steps::IOErr & ioe) {
+      PyErr_SetString(PyExc_IOError, ioe.getMsg());
+      return NULL;
     }
   }
   resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
@@ -42010,10 +42532,10 @@ SWIGINTERN PyObject *_wrap_delete_API(PyObject *SWIGUNUSEDPARM(self), PyObject *
       delete arg1;
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42042,10 +42564,10 @@ SWIGINTERN PyObject *_wrap_API_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyO
       result = ((steps::solver::API const *)arg1)->getSolverName();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -42074,10 +42596,10 @@ SWIGINTERN PyObject *_wrap_API_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyO
       result = ((steps::solver::API const *)arg1)->getSolverDesc();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -42106,10 +42628,10 @@ SWIGINTERN PyObject *_wrap_API_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self),
       result = ((steps::solver::API const *)arg1)->getSolverAuthors();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -42138,10 +42660,10 @@ SWIGINTERN PyObject *_wrap_API_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), Py
       result = ((steps::solver::API const *)arg1)->getSolverEmail();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -42169,10 +42691,10 @@ SWIGINTERN PyObject *_wrap_API_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *a
       (arg1)->reset();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42214,10 +42736,10 @@ SWIGINTERN PyObject *_wrap_API_checkpoint(PyObject *SWIGUNUSEDPARM(self), PyObje
       (arg1)->checkpoint((std::string const &)*arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42261,10 +42783,10 @@ SWIGINTERN PyObject *_wrap_API_restore(PyObject *SWIGUNUSEDPARM(self), PyObject
       (arg1)->restore((std::string const &)*arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42303,10 +42825,10 @@ SWIGINTERN PyObject *_wrap_API_run(PyObject *SWIGUNUSEDPARM(self), PyObject *arg
       (arg1)->run(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42335,10 +42857,10 @@ SWIGINTERN PyObject *_wrap_API_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject
       result = (double)((steps::solver::API const *)arg1)->getTime();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42375,10 +42897,10 @@ SWIGINTERN PyObject *_wrap_API_advance(PyObject *SWIGUNUSEDPARM(self), PyObject
       (arg1)->advance(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42406,10 +42928,10 @@ SWIGINTERN PyObject *_wrap_API_step(PyObject *SWIGUNUSEDPARM(self), PyObject *ar
       (arg1)->step();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42446,10 +42968,10 @@ SWIGINTERN PyObject *_wrap_API_setRk4DT(PyObject *SWIGUNUSEDPARM(self), PyObject
       (arg1)->setRk4DT(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42486,10 +43008,10 @@ SWIGINTERN PyObject *_wrap_API_setDT(PyObject *SWIGUNUSEDPARM(self), PyObject *a
       (arg1)->setDT(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42518,10 +43040,10 @@ SWIGINTERN PyObject *_wrap_API_getRk4DT(PyObject *SWIGUNUSEDPARM(self), PyObject
       result = (double)((steps::solver::API const *)arg1)->getRk4DT();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42550,10 +43072,10 @@ SWIGINTERN PyObject *_wrap_API_getDT(PyObject *SWIGUNUSEDPARM(self), PyObject *a
       result = (double)((steps::solver::API const *)arg1)->getDT();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42590,10 +43112,10 @@ SWIGINTERN PyObject *_wrap_API_setTime(PyObject *SWIGUNUSEDPARM(self), PyObject
       (arg1)->setTime(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42622,10 +43144,10 @@ SWIGINTERN PyObject *_wrap_API_getA0(PyObject *SWIGUNUSEDPARM(self), PyObject *a
       result = (double)((steps::solver::API const *)arg1)->getA0();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42654,10 +43176,10 @@ SWIGINTERN PyObject *_wrap_API_getNSteps(PyObject *SWIGUNUSEDPARM(self), PyObjec
       result = (unsigned int)((steps::solver::API const *)arg1)->getNSteps();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -42694,10 +43216,10 @@ SWIGINTERN PyObject *_wrap_API_setNSteps(PyObject *SWIGUNUSEDPARM(self), PyObjec
       (arg1)->setNSteps(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42740,10 +43262,10 @@ SWIGINTERN PyObject *_wrap_API_getCompVol(PyObject *SWIGUNUSEDPARM(self), PyObje
       result = (double)((steps::solver::API const *)arg1)->getCompVol((std::string const &)*arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42796,10 +43318,10 @@ SWIGINTERN PyObject *_wrap_API_setCompVol(PyObject *SWIGUNUSEDPARM(self), PyObje
       (arg1)->setCompVol((std::string const &)*arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42858,10 +43380,10 @@ SWIGINTERN PyObject *_wrap_API_getCompCount(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompCount((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -42930,10 +43452,10 @@ SWIGINTERN PyObject *_wrap_API_setCompCount(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setCompCount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -42994,10 +43516,10 @@ SWIGINTERN PyObject *_wrap_API_getCompAmount(PyObject *SWIGUNUSEDPARM(self), PyO
       result = (double)((steps::solver::API const *)arg1)->getCompAmount((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -43066,10 +43588,10 @@ SWIGINTERN PyObject *_wrap_API_setCompAmount(PyObject *SWIGUNUSEDPARM(self), PyO
       (arg1)->setCompAmount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43130,10 +43652,10 @@ SWIGINTERN PyObject *_wrap_API_getCompConc(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getCompConc((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -43202,10 +43724,10 @@ SWIGINTERN PyObject *_wrap_API_setCompConc(PyObject *SWIGUNUSEDPARM(self), PyObj
       (arg1)->setCompConc((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43266,10 +43788,10 @@ SWIGINTERN PyObject *_wrap_API_getCompClamped(PyObject *SWIGUNUSEDPARM(self), Py
       result = (bool)((steps::solver::API const *)arg1)->getCompClamped((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -43338,10 +43860,10 @@ SWIGINTERN PyObject *_wrap_API_setCompClamped(PyObject *SWIGUNUSEDPARM(self), Py
       (arg1)->setCompClamped((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43402,10 +43924,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacK(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompReacK((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -43474,10 +43996,10 @@ SWIGINTERN PyObject *_wrap_API_setCompReacK(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setCompReacK((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43538,10 +44060,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacActive(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getCompReacActive((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -43610,10 +44132,10 @@ SWIGINTERN PyObject *_wrap_API_setCompReacActive(PyObject *SWIGUNUSEDPARM(self),
       (arg1)->setCompReacActive((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43674,10 +44196,10 @@ SWIGINTERN PyObject *_wrap_API_getCompDiffD(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompDiffD((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -43746,10 +44268,10 @@ SWIGINTERN PyObject *_wrap_API_setCompDiffD(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setCompDiffD((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43810,10 +44332,10 @@ SWIGINTERN PyObject *_wrap_API_getCompDiffActive(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getCompDiffActive((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -43882,10 +44404,10 @@ SWIGINTERN PyObject *_wrap_API_setCompDiffActive(PyObject *SWIGUNUSEDPARM(self),
       (arg1)->setCompDiffActive((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -43946,10 +44468,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacC(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompReacC((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44010,10 +44532,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacH(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompReacH((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44074,10 +44596,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacA(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getCompReacA((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44138,10 +44660,10 @@ SWIGINTERN PyObject *_wrap_API_getCompReacExtent(PyObject *SWIGUNUSEDPARM(self),
       result = (unsigned int)((steps::solver::API const *)arg1)->getCompReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -44201,10 +44723,10 @@ SWIGINTERN PyObject *_wrap_API_resetCompReacExtent(PyObject *SWIGUNUSEDPARM(self
       (arg1)->resetCompReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44246,10 +44768,10 @@ SWIGINTERN PyObject *_wrap_API_getTetVol(PyObject *SWIGUNUSEDPARM(self), PyObjec
       result = (double)((steps::solver::API const *)arg1)->getTetVol(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44301,10 +44823,10 @@ SWIGINTERN PyObject *_wrap_API_getTetSpecDefined(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getTetSpecDefined(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -44358,10 +44880,10 @@ SWIGINTERN PyObject *_wrap_API_getTetCount(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetCount(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44423,10 +44945,10 @@ SWIGINTERN PyObject *_wrap_API_setTetCount(PyObject *SWIGUNUSEDPARM(self), PyObj
       (arg1)->setTetCount(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44438,6 +44960,315 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_API_getBatchTetCounts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  std::vector< double,std::allocator< double > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getBatchTetCounts",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getBatchTetCounts" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::vector<unsigned int,std::allocator< unsigned int > > *ptr = (std::vector<unsigned int,std::allocator< unsigned int > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getBatchTetCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTetCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getBatchTetCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTetCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = ((steps::solver::API const *)arg1)->getBatchTetCounts((std::vector< unsigned int,std::allocator< unsigned int > > const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_setBatchTetCounts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_setBatchTetCounts",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setBatchTetCounts" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::vector<unsigned int,std::allocator< unsigned int > > *ptr = (std::vector<unsigned int,std::allocator< unsigned int > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_setBatchTetCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTetCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_setBatchTetCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTetCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_setBatchTetCounts" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTetCounts" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    try {
+      (arg1)->setBatchTetCounts((std::vector< unsigned int,std::allocator< unsigned int > > const &)*arg2,(std::string const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_getBatchTetCountsNP(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int *arg2 = (unsigned int *) 0 ;
+  unsigned int arg3 ;
+  std::string *arg4 = 0 ;
+  double *arg5 = (double *) 0 ;
+  unsigned int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 ;
+  Py_buffer *pview2 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  Py_buffer view5 ;
+  Py_buffer *pview5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_getBatchTetCountsNP",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getBatchTetCountsNP" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    if (steps_getbuffer(obj1, &view2, "IL", sizeof(unsigned int), false) != 0)
+    SWIG_fail;
+    pview2 = &view2;
+    arg2 = static_cast<unsigned int *>(view2.buf);
+    arg3 = static_cast<unsigned int>(view2.len / view2.itemsize);
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_getBatchTetCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTetCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    if (steps_getbuffer(obj3, &view5, "d", sizeof(double), true) != 0)
+    SWIG_fail;
+    pview5 = &view5;
+    arg5 = static_cast<double *>(view5.buf);
+    arg6 = static_cast<unsigned int>(view5.len / view5.itemsize);
+  }
+  {
+    try {
+      ((steps::solver::API const *)arg1)->getBatchTetCountsNP((unsigned int const *)arg2,arg3,(std::string const &)*arg4,arg5,arg6);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return resultobj;
+fail:
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_setBatchTetCountsNP(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int *arg2 = (unsigned int *) 0 ;
+  unsigned int arg3 ;
+  std::string *arg4 = 0 ;
+  double *arg5 = (double *) 0 ;
+  unsigned int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 ;
+  Py_buffer *pview2 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  Py_buffer view5 ;
+  Py_buffer *pview5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_setBatchTetCountsNP",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setBatchTetCountsNP" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    if (steps_getbuffer(obj1, &view2, "IL", sizeof(unsigned int), false) != 0)
+    SWIG_fail;
+    pview2 = &view2;
+    arg2 = static_cast<unsigned int *>(view2.buf);
+    arg3 = static_cast<unsigned int>(view2.len / view2.itemsize);
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_setBatchTetCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTetCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    if (steps_getbuffer(obj3, &view5, "d", sizeof(double), false) != 0)
+    SWIG_fail;
+    pview5 = &view5;
+    arg5 = static_cast<double *>(view5.buf);
+    arg6 = static_cast<unsigned int>(view5.len / view5.itemsize);
+  }
+  {
+    try {
+      (arg1)->setBatchTetCountsNP((unsigned int const *)arg2,arg3,(std::string const &)*arg4,(double const *)arg5,arg6);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return resultobj;
+fail:
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_API_getTetAmount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   steps::solver::API *arg1 = (steps::solver::API *) 0 ;
@@ -44480,10 +45311,10 @@ SWIGINTERN PyObject *_wrap_API_getTetAmount(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTetAmount(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44545,10 +45376,10 @@ SWIGINTERN PyObject *_wrap_API_setTetAmount(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setTetAmount(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44602,10 +45433,10 @@ SWIGINTERN PyObject *_wrap_API_getTetConc(PyObject *SWIGUNUSEDPARM(self), PyObje
       result = (double)((steps::solver::API const *)arg1)->getTetConc(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44667,10 +45498,10 @@ SWIGINTERN PyObject *_wrap_API_setTetConc(PyObject *SWIGUNUSEDPARM(self), PyObje
       (arg1)->setTetConc(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44724,10 +45555,10 @@ SWIGINTERN PyObject *_wrap_API_getTetClamped(PyObject *SWIGUNUSEDPARM(self), PyO
       result = (bool)((steps::solver::API const *)arg1)->getTetClamped(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -44789,10 +45620,10 @@ SWIGINTERN PyObject *_wrap_API_setTetClamped(PyObject *SWIGUNUSEDPARM(self), PyO
       (arg1)->setTetClamped(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44846,10 +45677,10 @@ SWIGINTERN PyObject *_wrap_API_getTetReacK(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetReacK(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -44911,10 +45742,10 @@ SWIGINTERN PyObject *_wrap_API_setTetReacK(PyObject *SWIGUNUSEDPARM(self), PyObj
       (arg1)->setTetReacK(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -44968,10 +45799,10 @@ SWIGINTERN PyObject *_wrap_API_getTetReacActive(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getTetReacActive(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -45033,10 +45864,10 @@ SWIGINTERN PyObject *_wrap_API_setTetReacActive(PyObject *SWIGUNUSEDPARM(self),
       (arg1)->setTetReacActive(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45090,10 +45921,10 @@ SWIGINTERN PyObject *_wrap_API_getTetDiffD(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetDiffD(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45155,10 +45986,10 @@ SWIGINTERN PyObject *_wrap_API_setTetDiffD(PyObject *SWIGUNUSEDPARM(self), PyObj
       (arg1)->setTetDiffD(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45212,10 +46043,10 @@ SWIGINTERN PyObject *_wrap_API_getTetDiffActive(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getTetDiffActive(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -45277,10 +46108,10 @@ SWIGINTERN PyObject *_wrap_API_setTetDiffActive(PyObject *SWIGUNUSEDPARM(self),
       (arg1)->setTetDiffActive(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45334,10 +46165,10 @@ SWIGINTERN PyObject *_wrap_API_getTetReacC(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetReacC(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45391,10 +46222,10 @@ SWIGINTERN PyObject *_wrap_API_getTetReacH(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetReacH(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45448,10 +46279,10 @@ SWIGINTERN PyObject *_wrap_API_getTetReacA(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetReacA(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45505,10 +46336,10 @@ SWIGINTERN PyObject *_wrap_API_getTetDiffA(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTetDiffA(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45553,10 +46384,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchArea(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getPatchArea((std::string const &)*arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45609,10 +46440,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchArea(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setPatchArea((std::string const &)*arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45671,10 +46502,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchCount(PyObject *SWIGUNUSEDPARM(self), PyO
       result = (double)((steps::solver::API const *)arg1)->getPatchCount((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45743,10 +46574,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchCount(PyObject *SWIGUNUSEDPARM(self), PyO
       (arg1)->setPatchCount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45807,10 +46638,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchAmount(PyObject *SWIGUNUSEDPARM(self), Py
       result = (double)((steps::solver::API const *)arg1)->getPatchAmount((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -45879,10 +46710,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchAmount(PyObject *SWIGUNUSEDPARM(self), Py
       (arg1)->setPatchAmount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -45943,10 +46774,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchClamped(PyObject *SWIGUNUSEDPARM(self), P
       result = (bool)((steps::solver::API const *)arg1)->getPatchClamped((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -46015,10 +46846,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchClamped(PyObject *SWIGUNUSEDPARM(self), P
       (arg1)->setPatchClamped((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46079,10 +46910,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacK(PyObject *SWIGUNUSEDPARM(self), Py
       result = (double)((steps::solver::API const *)arg1)->getPatchSReacK((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46151,10 +46982,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchSReacK(PyObject *SWIGUNUSEDPARM(self), Py
       (arg1)->setPatchSReacK((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46215,10 +47046,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacActive(PyObject *SWIGUNUSEDPARM(self
       result = (bool)((steps::solver::API const *)arg1)->getPatchSReacActive((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -46287,10 +47118,10 @@ SWIGINTERN PyObject *_wrap_API_setPatchSReacActive(PyObject *SWIGUNUSEDPARM(self
       (arg1)->setPatchSReacActive((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46351,10 +47182,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacC(PyObject *SWIGUNUSEDPARM(self), Py
       result = (double)((steps::solver::API const *)arg1)->getPatchSReacC((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46415,10 +47246,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacH(PyObject *SWIGUNUSEDPARM(self), Py
       result = (double)((steps::solver::API const *)arg1)->getPatchSReacH((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46479,10 +47310,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacA(PyObject *SWIGUNUSEDPARM(self), Py
       result = (double)((steps::solver::API const *)arg1)->getPatchSReacA((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46543,10 +47374,10 @@ SWIGINTERN PyObject *_wrap_API_getPatchSReacExtent(PyObject *SWIGUNUSEDPARM(self
       result = (unsigned int)((steps::solver::API const *)arg1)->getPatchSReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
@@ -46606,10 +47437,10 @@ SWIGINTERN PyObject *_wrap_API_resetPatchSReacExtent(PyObject *SWIGUNUSEDPARM(se
       (arg1)->resetPatchSReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46678,10 +47509,10 @@ SWIGINTERN PyObject *_wrap_API_setDiffBoundaryDiffusionActive(PyObject *SWIGUNUS
       (arg1)->setDiffBoundaryDiffusionActive((std::string const &)*arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46742,10 +47573,10 @@ SWIGINTERN PyObject *_wrap_API_getDiffBoundaryDiffusionActive(PyObject *SWIGUNUS
       result = (bool)((steps::solver::API const *)arg1)->getDiffBoundaryDiffusionActive((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -46787,10 +47618,10 @@ SWIGINTERN PyObject *_wrap_API_getTriArea(PyObject *SWIGUNUSEDPARM(self), PyObje
       result = (double)((steps::solver::API const *)arg1)->getTriArea(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46842,10 +47673,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSpecDefined(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getTriSpecDefined(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -46899,10 +47730,10 @@ SWIGINTERN PyObject *_wrap_API_getTriCount(PyObject *SWIGUNUSEDPARM(self), PyObj
       result = (double)((steps::solver::API const *)arg1)->getTriCount(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -46964,10 +47795,10 @@ SWIGINTERN PyObject *_wrap_API_setTriCount(PyObject *SWIGUNUSEDPARM(self), PyObj
       (arg1)->setTriCount(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -46979,6 +47810,315 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_API_getBatchTriCounts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  std::vector< double,std::allocator< double > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getBatchTriCounts",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getBatchTriCounts" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::vector<unsigned int,std::allocator< unsigned int > > *ptr = (std::vector<unsigned int,std::allocator< unsigned int > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getBatchTriCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTriCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getBatchTriCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTriCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = ((steps::solver::API const *)arg1)->getBatchTriCounts((std::vector< unsigned int,std::allocator< unsigned int > > const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_setBatchTriCounts(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  std::vector< double,std::allocator< double > > *arg4 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  int res4 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_setBatchTriCounts",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setBatchTriCounts" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::vector<unsigned int,std::allocator< unsigned int > > *ptr = (std::vector<unsigned int,std::allocator< unsigned int > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_setBatchTriCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTriCounts" "', argument " "2"" of type '" "std::vector< unsigned int,std::allocator< unsigned int > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_setBatchTriCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTriCounts" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res4 = swig::asptr(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_setBatchTriCounts" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTriCounts" "', argument " "4"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    try {
+      (arg1)->setBatchTriCounts((std::vector< unsigned int,std::allocator< unsigned int > > const &)*arg2,(std::string const &)*arg3,(std::vector< double,std::allocator< double > > const &)*arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_getBatchTriCountsNP(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int *arg2 = (unsigned int *) 0 ;
+  unsigned int arg3 ;
+  std::string *arg4 = 0 ;
+  double *arg5 = (double *) 0 ;
+  unsigned int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 ;
+  Py_buffer *pview2 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  Py_buffer view5 ;
+  Py_buffer *pview5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_getBatchTriCountsNP",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getBatchTriCountsNP" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    if (steps_getbuffer(obj1, &view2, "IL", sizeof(unsigned int), false) != 0)
+    SWIG_fail;
+    pview2 = &view2;
+    arg2 = static_cast<unsigned int *>(view2.buf);
+    arg3 = static_cast<unsigned int>(view2.len / view2.itemsize);
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_getBatchTriCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getBatchTriCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    if (steps_getbuffer(obj3, &view5, "d", sizeof(double), true) != 0)
+    SWIG_fail;
+    pview5 = &view5;
+    arg5 = static_cast<double *>(view5.buf);
+    arg6 = static_cast<unsigned int>(view5.len / view5.itemsize);
+  }
+  {
+    try {
+      ((steps::solver::API const *)arg1)->getBatchTriCountsNP((unsigned int const *)arg2,arg3,(std::string const &)*arg4,arg5,arg6);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return resultobj;
+fail:
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_setBatchTriCountsNP(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int *arg2 = (unsigned int *) 0 ;
+  unsigned int arg3 ;
+  std::string *arg4 = 0 ;
+  double *arg5 = (double *) 0 ;
+  unsigned int arg6 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 ;
+  Py_buffer *pview2 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  Py_buffer view5 ;
+  Py_buffer *pview5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:API_setBatchTriCountsNP",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setBatchTriCountsNP" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    if (steps_getbuffer(obj1, &view2, "IL", sizeof(unsigned int), false) != 0)
+    SWIG_fail;
+    pview2 = &view2;
+    arg2 = static_cast<unsigned int *>(view2.buf);
+    arg3 = static_cast<unsigned int>(view2.len / view2.itemsize);
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "API_setBatchTriCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_setBatchTriCountsNP" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    if (steps_getbuffer(obj3, &view5, "d", sizeof(double), false) != 0)
+    SWIG_fail;
+    pview5 = &view5;
+    arg5 = static_cast<double *>(view5.buf);
+    arg6 = static_cast<unsigned int>(view5.len / view5.itemsize);
+  }
+  {
+    try {
+      (arg1)->setBatchTriCountsNP((unsigned int const *)arg2,arg3,(std::string const &)*arg4,(double const *)arg5,arg6);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return resultobj;
+fail:
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  {
+    if (pview5) PyBuffer_Release(pview5);
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_API_getTriAmount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   steps::solver::API *arg1 = (steps::solver::API *) 0 ;
@@ -47021,10 +48161,10 @@ SWIGINTERN PyObject *_wrap_API_getTriAmount(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTriAmount(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47086,10 +48226,10 @@ SWIGINTERN PyObject *_wrap_API_setTriAmount(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setTriAmount(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -47143,10 +48283,10 @@ SWIGINTERN PyObject *_wrap_API_getTriClamped(PyObject *SWIGUNUSEDPARM(self), PyO
       result = (bool)((steps::solver::API const *)arg1)->getTriClamped(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -47208,10 +48348,10 @@ SWIGINTERN PyObject *_wrap_API_setTriClamped(PyObject *SWIGUNUSEDPARM(self), PyO
       (arg1)->setTriClamped(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -47265,10 +48405,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSReacK(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTriSReacK(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47330,10 +48470,10 @@ SWIGINTERN PyObject *_wrap_API_setTriSReacK(PyObject *SWIGUNUSEDPARM(self), PyOb
       (arg1)->setTriSReacK(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -47387,10 +48527,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSReacActive(PyObject *SWIGUNUSEDPARM(self),
       result = (bool)((steps::solver::API const *)arg1)->getTriSReacActive(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_bool(static_cast< bool >(result));
@@ -47452,10 +48592,10 @@ SWIGINTERN PyObject *_wrap_API_setTriSReacActive(PyObject *SWIGUNUSEDPARM(self),
       (arg1)->setTriSReacActive(arg2,(std::string const &)*arg3,arg4);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -47509,10 +48649,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSReacC(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTriSReacC(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47566,10 +48706,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSReacH(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTriSReacH(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47623,10 +48763,10 @@ SWIGINTERN PyObject *_wrap_API_getTriSReacA(PyObject *SWIGUNUSEDPARM(self), PyOb
       result = (double)((steps::solver::API const *)arg1)->getTriSReacA(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47638,316 +48778,522 @@ fail:
 }
 
 
-SWIGINTERN PyObject *API_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_steps__solver__API, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_Wmrk4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getCompSpecHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::model::Model *arg1 = (steps::model::Model *) 0 ;
-  steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
-  steps::rng::RNG *arg3 = (steps::rng::RNG *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  steps::wmrk4::Wmrk4 *result = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Wmrk4",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getCompSpecHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Wmrk4" "', argument " "1"" of type '" "steps::model::Model *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getCompSpecHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg1 = reinterpret_cast< steps::model::Model * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Wmrk4" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getCompSpecHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getCompSpecHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
   }
-  arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
-  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Wmrk4" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getCompSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getCompSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
   {
     try {
-      result = (steps::wmrk4::Wmrk4 *)new steps::wmrk4::Wmrk4(arg1,arg2,arg3);
+      result = (uint)(arg1)->getCompSpecHandle((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_Wmrk4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getPatchSpecHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_Wmrk4",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getPatchSpecHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Wmrk4" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getPatchSpecHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getPatchSpecHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getPatchSpecHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getPatchSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getPatchSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      delete arg1;
+      result = (uint)(arg1)->getPatchSpecHandle((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getTetSpecHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverName",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getTetSpecHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverName" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getTetSpecHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getTetSpecHandle" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getTetSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getTetSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverName();
+      result = (uint)(arg1)->getTetSpecHandle(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getTriSpecHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverDesc",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getTriSpecHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverDesc" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getTriSpecHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getTriSpecHandle" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getTriSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getTriSpecHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverDesc();
+      result = (uint)(arg1)->getTriSpecHandle(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getCompReacHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverAuthors",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getCompReacHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverAuthors" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getCompReacHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getCompReacHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getCompReacHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getCompReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getCompReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverAuthors();
+      result = (uint)(arg1)->getCompReacHandle((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getPatchSReacHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverEmail",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getPatchSReacHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverEmail" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getPatchSReacHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "API_getPatchSReacHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getPatchSReacHandle" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getPatchSReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getPatchSReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverEmail();
+      result = (uint)(arg1)->getPatchSReacHandle((std::string const &)*arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getTetReacHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_reset",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getTetReacHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_reset" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getTetReacHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getTetReacHandle" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getTetReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getTetReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      (arg1)->reset();
+      result = (uint)(arg1)->getTetReacHandle(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getTriSReacHandle(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
-  double arg2 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  unsigned int val2 ;
   int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  uint result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Wmrk4_run",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_getTriSReacHandle",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_run" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getTriSReacHandle" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Wmrk4_run" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getTriSReacHandle" "', argument " "2"" of type '" "unsigned int""'");
   } 
-  arg2 = static_cast< double >(val2);
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "API_getTriSReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "API_getTriSReacHandle" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
   {
     try {
-      (arg1)->run(arg2);
+      result = (uint)(arg1)->getTriSReacHandle(arg2,(std::string const &)*arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return resultobj;
 fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmrk4_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getTime",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getCount",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getTime" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getCount" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getCount" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      result = (double)((steps::wmrk4::Wmrk4 const *)arg1)->getTime();
+      result = (double)((steps::solver::API const *)arg1)->getCount(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -47957,244 +49303,316 @@ fail:
 }
 
 
-SWIGINTERN PyObject *Wmrk4_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
-}
-
-SWIGINTERN PyObject *_wrap_new_Wmdirect(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_setCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::model::Model *arg1 = (steps::model::Model *) 0 ;
-  steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
-  steps::rng::RNG *arg3 = (steps::rng::RNG *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  double arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  void *argp2 = 0 ;
-  int res2 = 0 ;
-  void *argp3 = 0 ;
-  int res3 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  steps::wmdirect::Wmdirect *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Wmdirect",&obj0,&obj1,&obj2)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_setCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Wmdirect" "', argument " "1"" of type '" "steps::model::Model *""'"); 
-  }
-  arg1 = reinterpret_cast< steps::model::Model * >(argp1);
-  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
-  if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Wmdirect" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
-  }
-  arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
-  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
-  if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Wmdirect" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setCount" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_setCount" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "API_setCount" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
   {
     try {
-      result = (steps::wmdirect::Wmdirect *)new steps::wmdirect::Wmdirect(arg1,arg2,arg3);
+      (arg1)->setCount(arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_Wmdirect(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getConc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_Wmdirect",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getConc",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Wmdirect" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getConc" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getConc" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      delete arg1;
+      result = (double)((steps::solver::API const *)arg1)->getConc(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_setConc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  double arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverName",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_setConc",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverName" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setConc" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_setConc" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "API_setConc" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
   {
     try {
-      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverName();
+      (arg1)->setConc(arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getClamped(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverDesc",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getClamped",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverDesc" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getClamped" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getClamped" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverDesc();
+      result = (bool)((steps::solver::API const *)arg1)->getClamped(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_setClamped(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  bool arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverAuthors",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_setClamped",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverAuthors" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setClamped" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_setClamped" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  ecode3 = SWIG_AsVal_bool(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "API_setClamped" "', argument " "3"" of type '" "bool""'");
+  } 
+  arg3 = static_cast< bool >(val3);
   {
     try {
-      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverAuthors();
+      (arg1)->setClamped(arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getReacK(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  std::string result;
+  PyObject * obj1 = 0 ;
+  double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverEmail",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getReacK",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverEmail" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getReacK" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getReacK" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverEmail();
+      result = (double)((steps::solver::API const *)arg1)->getReacK(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  resultobj = SWIG_From_double(static_cast< double >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_setReacK(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  double arg3 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
   PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_reset",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_setReacK",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_reset" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setReacK" "', argument " "1"" of type '" "steps::solver::API *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_setReacK" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "API_setReacK" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
   {
     try {
-      (arg1)->reset();
+      (arg1)->setReacK(arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -48204,37 +49622,87 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getReacActive(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
-  double arg2 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  double val2 ;
+  unsigned int val2 ;
   int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  bool result;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Wmdirect_run",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getReacActive",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_run" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getReacActive" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
-  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Wmdirect_run" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getReacActive" "', argument " "2"" of type '" "unsigned int""'");
   } 
-  arg2 = static_cast< double >(val2);
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      (arg1)->run(arg2);
+      result = (bool)((steps::solver::API const *)arg1)->getReacActive(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_API_setReacActive(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  bool arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:API_setReacActive",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_setReacActive" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_setReacActive" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  ecode3 = SWIG_AsVal_bool(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "API_setReacActive" "', argument " "3"" of type '" "bool""'");
+  } 
+  arg3 = static_cast< bool >(val3);
+  {
+    try {
+      (arg1)->setReacActive(arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -48244,46 +49712,95 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Wmdirect_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_getReacExtent(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
   PyObject * obj0 = 0 ;
-  double result;
+  PyObject * obj1 = 0 ;
+  unsigned int result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getTime",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_getReacExtent",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getTime" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_getReacExtent" "', argument " "1"" of type '" "steps::solver::API const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_getReacExtent" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
   {
     try {
-      result = (double)((steps::wmdirect::Wmdirect const *)arg1)->getTime();
+      result = (unsigned int)((steps::solver::API const *)arg1)->getReacExtent(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_From_double(static_cast< double >(result));
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *Wmdirect_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_API_resetReacExtent(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  unsigned int arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:API_resetReacExtent",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "API_resetReacExtent" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "API_resetReacExtent" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    try {
+      (arg1)->resetReacExtent(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *API_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *obj;
   if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_NewClientData(obj));
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__solver__API, SWIG_NewClientData(obj));
   return SWIG_Py_Void();
 }
 
-SWIGINTERN PyObject *_wrap_new_Tetexact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_new_Wmrk4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   steps::model::Model *arg1 = (steps::model::Model *) 0 ;
   steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
@@ -48297,64 +49814,64 @@ SWIGINTERN PyObject *_wrap_new_Tetexact(PyObject *SWIGUNUSEDPARM(self), PyObject
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   PyObject * obj2 = 0 ;
-  steps::tetexact::Tetexact *result = 0 ;
+  steps::wmrk4::Wmrk4 *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Tetexact",&obj0,&obj1,&obj2)) SWIG_fail;
+  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Wmrk4",&obj0,&obj1,&obj2)) SWIG_fail;
   res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Tetexact" "', argument " "1"" of type '" "steps::model::Model *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Wmrk4" "', argument " "1"" of type '" "steps::model::Model *""'"); 
   }
   arg1 = reinterpret_cast< steps::model::Model * >(argp1);
   res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
   if (!SWIG_IsOK(res2)) {
-    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Tetexact" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Wmrk4" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
   }
   arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
   res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
   if (!SWIG_IsOK(res3)) {
-    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Tetexact" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Wmrk4" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
   }
   arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
   {
     try {
-      result = (steps::tetexact::Tetexact *)new steps::tetexact::Tetexact(arg1,arg2,arg3);
+      result = (steps::wmrk4::Wmrk4 *)new steps::wmrk4::Wmrk4(arg1,arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_POINTER_NEW |  0 );
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *_wrap_delete_Tetexact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_delete_Wmrk4(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:delete_Tetexact",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_POINTER_DISOWN |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Wmrk4",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_POINTER_DISOWN |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Tetexact" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Wmrk4" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
       delete arg1;
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -48364,29 +49881,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverName",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverName",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverName" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverName" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverName();
+      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverName();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -48396,29 +49913,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverDesc",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverDesc",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverDesc" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverDesc" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverDesc();
+      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverDesc();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -48428,29 +49945,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverAuthors",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverAuthors",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverAuthors" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverAuthors" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverAuthors();
+      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverAuthors();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -48460,29 +49977,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   std::string result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverEmail",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getSolverEmail",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverEmail" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getSolverEmail" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverEmail();
+      result = ((steps::wmrk4::Wmrk4 const *)arg1)->getSolverEmail();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_std_string(static_cast< std::string >(result));
@@ -48492,28 +50009,28 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_reset",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_reset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_reset" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_reset" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
       (arg1)->reset();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -48523,9 +50040,9 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   double arg2 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
@@ -48534,15 +50051,15 @@ SWIGINTERN PyObject *_wrap_Tetexact_run(PyObject *SWIGUNUSEDPARM(self), PyObject
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_run",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OO:Wmrk4_run",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_run" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_run" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   ecode2 = SWIG_AsVal_double(obj1, &val2);
   if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_run" "', argument " "2"" of type '" "double""'");
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Wmrk4_run" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = static_cast< double >(val2);
   {
@@ -48550,10 +50067,10 @@ SWIGINTERN PyObject *_wrap_Tetexact_run(PyObject *SWIGUNUSEDPARM(self), PyObject
       (arg1)->run(arg2);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_Py_Void();
@@ -48563,29 +50080,29 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *_wrap_Wmrk4_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  steps::wmrk4::Wmrk4 *arg1 = (steps::wmrk4::Wmrk4 *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
   PyObject * obj0 = 0 ;
   double result;
   
-  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getTime",&obj0)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmrk4_getTime",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmrk4__Wmrk4, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getTime" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmrk4_getTime" "', argument " "1"" of type '" "steps::wmrk4::Wmrk4 const *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg1 = reinterpret_cast< steps::wmrk4::Wmrk4 * >(argp1);
   {
     try {
-      result = (double)((steps::tetexact::Tetexact const *)arg1)->getTime();
+      result = (double)((steps::wmrk4::Wmrk4 const *)arg1)->getTime();
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
   resultobj = SWIG_From_double(static_cast< double >(result));
@@ -48595,60 +50112,3798 @@ fail:
 }
 
 
-SWIGINTERN PyObject *_wrap_Tetexact_advanceSteps(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+SWIGINTERN PyObject *Wmrk4_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__wmrk4__Wmrk4, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_Wmdirect(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
-  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
-  uint arg2 ;
+  steps::model::Model *arg1 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
+  steps::rng::RNG *arg3 = (steps::rng::RNG *) 0 ;
   void *argp1 = 0 ;
   int res1 = 0 ;
-  unsigned int val2 ;
-  int ecode2 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  steps::wmdirect::Wmdirect *result = 0 ;
   
-  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_advanceSteps",&obj0,&obj1)) SWIG_fail;
-  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Wmdirect",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
   if (!SWIG_IsOK(res1)) {
-    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_advanceSteps" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Wmdirect" "', argument " "1"" of type '" "steps::model::Model *""'"); 
   }
-  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
-  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
-  if (!SWIG_IsOK(ecode2)) {
-    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_advanceSteps" "', argument " "2"" of type '" "uint""'");
-  } 
-  arg2 = static_cast< uint >(val2);
+  arg1 = reinterpret_cast< steps::model::Model * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Wmdirect" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Wmdirect" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
   {
     try {
-      (arg1)->advanceSteps(arg2);
+      result = (steps::wmdirect::Wmdirect *)new steps::wmdirect::Wmdirect(arg1,arg2,arg3);
     } catch (steps::ArgErr & ae) {
       PyErr_SetString(PyExc_NameError, ae.getMsg());
-      return NULL;
+      SWIG_fail;
     } catch (steps::NotImplErr & nie) {
       PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
-      return NULL;
+      SWIG_fail;
     }
   }
-  resultobj = SWIG_Py_Void();
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_POINTER_NEW |  0 );
   return resultobj;
 fail:
   return NULL;
 }
 
 
-SWIGINTERN PyObject *Tetexact_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
-  PyObject *obj;
-  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
-  SWIG_TypeNewClientData(SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_NewClientData(obj));
-  return SWIG_Py_Void();
+SWIGINTERN PyObject *_wrap_delete_Wmdirect(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Wmdirect",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Wmdirect" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
 }
 
-static PyMethodDef SwigMethods[] = {
-	 { (char *)"SWIG_PyInstanceMethod_New", (PyCFunction)SWIG_PyInstanceMethod_New, METH_O, NULL},
-	 { (char *)"delete_SwigPyIterator", _wrap_delete_SwigPyIterator, METH_VARARGS, NULL},
-	 { (char *)"SwigPyIterator_value", _wrap_SwigPyIterator_value, METH_VARARGS, NULL},
-	 { (char *)"SwigPyIterator_incr", _wrap_SwigPyIterator_incr, METH_VARARGS, NULL},
-	 { (char *)"SwigPyIterator_decr", _wrap_SwigPyIterator_decr, METH_VARARGS, NULL},
-	 { (char *)"SwigPyIterator_distance", _wrap_SwigPyIterator_distance, METH_VARARGS, NULL},
+
+SWIGINTERN PyObject *_wrap_Wmdirect_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverName",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverName" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverName();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverDesc",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverDesc" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverDesc();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverAuthors",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverAuthors" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverAuthors();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getSolverEmail",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getSolverEmail" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      result = ((steps::wmdirect::Wmdirect const *)arg1)->getSolverEmail();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_reset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_reset" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      (arg1)->reset();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Wmdirect_run",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_run" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Wmdirect_run" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->run(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Wmdirect_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::wmdirect::Wmdirect *arg1 = (steps::wmdirect::Wmdirect *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Wmdirect_getTime",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__wmdirect__Wmdirect, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Wmdirect_getTime" "', argument " "1"" of type '" "steps::wmdirect::Wmdirect const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::wmdirect::Wmdirect * >(argp1);
+  {
+    try {
+      result = (double)((steps::wmdirect::Wmdirect const *)arg1)->getTime();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Wmdirect_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__wmdirect__Wmdirect, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_Tetexact__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::model::Model *arg1 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
+  steps::rng::RNG *arg3 = (steps::rng::RNG *) 0 ;
+  bool arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  steps::tetexact::Tetexact *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:new_Tetexact",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Tetexact" "', argument " "1"" of type '" "steps::model::Model *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::model::Model * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Tetexact" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Tetexact" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
+  ecode4 = SWIG_AsVal_bool(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "new_Tetexact" "', argument " "4"" of type '" "bool""'");
+  } 
+  arg4 = static_cast< bool >(val4);
+  {
+    try {
+      result = (steps::tetexact::Tetexact *)new steps::tetexact::Tetexact(arg1,arg2,arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_Tetexact__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::model::Model *arg1 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg2 = (steps::wm::Geom *) 0 ;
+  steps::rng::RNG *arg3 = (steps::rng::RNG *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  steps::tetexact::Tetexact *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Tetexact",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Tetexact" "', argument " "1"" of type '" "steps::model::Model *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::model::Model * >(argp1);
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Tetexact" "', argument " "2"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::wm::Geom * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__rng__RNG, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Tetexact" "', argument " "3"" of type '" "steps::rng::RNG *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::rng::RNG * >(argp3);
+  {
+    try {
+      result = (steps::tetexact::Tetexact *)new steps::tetexact::Tetexact(arg1,arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_Tetexact(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[5];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = (int)PyObject_Length(args);
+  for (ii = 0; (ii < argc) && (ii < 4); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_steps__model__Model, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_steps__wm__Geom, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_steps__rng__RNG, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          return _wrap_new_Tetexact__SWIG_1(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    void *vptr = 0;
+    int res = SWIG_ConvertPtr(argv[0], &vptr, SWIGTYPE_p_steps__model__Model, 0);
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_steps__wm__Geom, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_steps__rng__RNG, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          {
+            int res = SWIG_AsVal_bool(argv[3], NULL);
+            _v = SWIG_CheckState(res);
+          }
+          if (_v) {
+            return _wrap_new_Tetexact__SWIG_0(self, args);
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number of arguments for overloaded function 'new_Tetexact'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    steps::tetexact::Tetexact(steps::model::Model *,steps::wm::Geom *,steps::rng::RNG *,bool)\n"
+    "    steps::tetexact::Tetexact(steps::model::Model *,steps::wm::Geom *,steps::rng::RNG *)\n");
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_Tetexact(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Tetexact",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Tetexact" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getSolverName(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverName",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverName" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverName();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getSolverDesc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverDesc",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverDesc" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverDesc();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getSolverAuthors(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverAuthors",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverAuthors" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverAuthors();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getSolverEmail(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getSolverEmail",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSolverEmail" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getSolverEmail();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_reset(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_reset",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_reset" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      (arg1)->reset();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_run",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_run" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_run" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->run(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getTime(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getTime",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getTime" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (double)((steps::tetexact::Tetexact const *)arg1)->getTime();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_advanceSteps(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  uint arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_advanceSteps",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_advanceSteps" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_advanceSteps" "', argument " "2"" of type '" "uint""'");
+  } 
+  arg2 = static_cast< uint >(val2);
+  {
+    try {
+      (arg1)->advanceSteps(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getA0Renorms(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  uint result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getA0Renorms",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getA0Renorms" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (uint)((steps::tetexact::Tetexact const *)arg1)->getA0Renorms();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getUpdAllocs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  uint result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getUpdAllocs",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getUpdAllocs" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (uint)((steps::tetexact::Tetexact const *)arg1)->getUpdAllocs();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_setEngine(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_setEngine",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_setEngine" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_setEngine" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_setEngine" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setEngine((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getEngine(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::string result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getEngine",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getEngine" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getEngine();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_std_string(static_cast< std::string >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_setParallel(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  uint arg2 ;
+  double arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  double val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact_setParallel",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_setParallel" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_setParallel" "', argument " "2"" of type '" "uint""'");
+  } 
+  arg2 = static_cast< uint >(val2);
+  ecode3 = SWIG_AsVal_double(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Tetexact_setParallel" "', argument " "3"" of type '" "double""'");
+  } 
+  arg3 = static_cast< double >(val3);
+  {
+    try {
+      (arg1)->setParallel(arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getParallelThreads(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  uint result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getParallelThreads",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getParallelThreads" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (uint)((steps::tetexact::Tetexact const *)arg1)->getParallelThreads();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getParallelSyncDT(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getParallelSyncDT",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getParallelSyncDT" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (double)((steps::tetexact::Tetexact const *)arg1)->getParallelSyncDT();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_setDiffLeapDT(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  double arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  double val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_setDiffLeapDT",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_setDiffLeapDT" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  ecode2 = SWIG_AsVal_double(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_setDiffLeapDT" "', argument " "2"" of type '" "double""'");
+  } 
+  arg2 = static_cast< double >(val2);
+  {
+    try {
+      (arg1)->setDiffLeapDT(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getDiffLeapDT(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  double result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getDiffLeapDT",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getDiffLeapDT" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (double)((steps::tetexact::Tetexact const *)arg1)->getDiffLeapDT();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_double(static_cast< double >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_setSpecDiffLeap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  bool arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  bool val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact_setSpecDiffLeap",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_setSpecDiffLeap" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_setSpecDiffLeap" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_setSpecDiffLeap" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_bool(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Tetexact_setSpecDiffLeap" "', argument " "3"" of type '" "bool""'");
+  } 
+  arg3 = static_cast< bool >(val3);
+  {
+    try {
+      (arg1)->setSpecDiffLeap((std::string const &)*arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getSpecDiffLeap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  bool result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_getSpecDiffLeap",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getSpecDiffLeap" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_getSpecDiffLeap" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_getSpecDiffLeap" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = (bool)((steps::tetexact::Tetexact const *)arg1)->getSpecDiffLeap((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_bool(static_cast< bool >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_setDiffLeapThreshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  uint arg2 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_setDiffLeapThreshold",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_setDiffLeapThreshold" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Tetexact_setDiffLeapThreshold" "', argument " "2"" of type '" "uint""'");
+  } 
+  arg2 = static_cast< uint >(val2);
+  {
+    try {
+      (arg1)->setDiffLeapThreshold(arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getDiffLeapThreshold(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  uint result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Tetexact_getDiffLeapThreshold",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getDiffLeapThreshold" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    try {
+      result = (uint)((steps::tetexact::Tetexact const *)arg1)->getDiffLeapThreshold();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getCompTetCountsTets(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_getCompTetCountsTets",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getCompTetCountsTets" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_getCompTetCountsTets" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_getCompTetCountsTets" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getCompTetCountsTets((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getCompTetCountsSpecs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_getCompTetCountsSpecs",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getCompTetCountsSpecs" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_getCompTetCountsSpecs" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_getCompTetCountsSpecs" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getCompTetCountsSpecs((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getPatchTriCountsTris(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_getPatchTriCountsTris",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getPatchTriCountsTris" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_getPatchTriCountsTris" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_getPatchTriCountsTris" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getPatchTriCountsTris((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_getPatchTriCountsSpecs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  std::vector< std::string,std::allocator< std::string > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Tetexact_getPatchTriCountsSpecs",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_getPatchTriCountsSpecs" "', argument " "1"" of type '" "steps::tetexact::Tetexact const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_getPatchTriCountsSpecs" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_getPatchTriCountsSpecs" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      result = ((steps::tetexact::Tetexact const *)arg1)->getPatchTriCountsSpecs((std::string const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<std::string,std::allocator< std::string > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_pickCompTets(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact_pickCompTets",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_pickCompTets" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_pickCompTets" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_pickCompTets" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_unsigned_SS_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Tetexact_pickCompTets" "', argument " "3"" of type '" "unsigned int""'");
+  } 
+  arg3 = static_cast< unsigned int >(val3);
+  {
+    try {
+      result = (arg1)->pickCompTets((std::string const &)*arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact_pickPatchTris(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  std::string *arg2 = 0 ;
+  unsigned int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  unsigned int val3 ;
+  int ecode3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  std::vector< unsigned int,std::allocator< unsigned int > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact_pickPatchTris",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact_pickPatchTris" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Tetexact_pickPatchTris" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact_pickPatchTris" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  ecode3 = SWIG_AsVal_unsigned_SS_int(obj2, &val3);
+  if (!SWIG_IsOK(ecode3)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "Tetexact_pickPatchTris" "', argument " "3"" of type '" "unsigned int""'");
+  } 
+  arg3 = static_cast< unsigned int >(val3);
+  {
+    try {
+      result = (arg1)->pickPatchTris((std::string const &)*arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<unsigned int,std::allocator< unsigned int > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact__getCompTetCountsView(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact__getCompTetCountsView",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact__getCompTetCountsView" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg2 = obj1;
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Tetexact__getCompTetCountsView" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact__getCompTetCountsView" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = (PyObject *)steps_tetexact_Tetexact__getCompTetCountsView(arg1,arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = result;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Tetexact__getPatchTriCountsView(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::tetexact::Tetexact *arg1 = (steps::tetexact::Tetexact *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Tetexact__getPatchTriCountsView",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__tetexact__Tetexact, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Tetexact__getPatchTriCountsView" "', argument " "1"" of type '" "steps::tetexact::Tetexact *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::tetexact::Tetexact * >(argp1);
+  arg2 = obj1;
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Tetexact__getPatchTriCountsView" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Tetexact__getPatchTriCountsView" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      result = (PyObject *)steps_tetexact_Tetexact__getPatchTriCountsView(arg1,arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = result;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Tetexact_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__tetexact__Tetexact, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_Batch__SWIG_0(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  std::string *arg1 = 0 ;
+  steps::model::Model *arg2 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg3 = (steps::wm::Geom *) 0 ;
+  std::string *arg4 = 0 ;
+  uint arg5 ;
+  int res1 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  unsigned int val5 ;
+  int ecode5 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  steps::batch::Batch *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:new_Batch",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  {
+    std::string *ptr = (std::string *)0;
+    res1 = SWIG_AsPtr_std_string(obj0, &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Batch" "', argument " "2"" of type '" "steps::model::Model *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::model::Model * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Batch" "', argument " "3"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::wm::Geom * >(argp3);
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_Batch" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Batch" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  ecode5 = SWIG_AsVal_unsigned_SS_int(obj4, &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "new_Batch" "', argument " "5"" of type '" "uint""'");
+  } 
+  arg5 = static_cast< uint >(val5);
+  {
+    try {
+      result = (steps::batch::Batch *)new steps::batch::Batch((std::string const &)*arg1,arg2,arg3,(std::string const &)*arg4,arg5);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__batch__Batch, SWIG_POINTER_NEW |  0 );
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_Batch__SWIG_1(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  std::string *arg1 = 0 ;
+  steps::model::Model *arg2 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg3 = (steps::wm::Geom *) 0 ;
+  std::string *arg4 = 0 ;
+  int res1 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  int res4 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  steps::batch::Batch *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:new_Batch",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    std::string *ptr = (std::string *)0;
+    res1 = SWIG_AsPtr_std_string(obj0, &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Batch" "', argument " "2"" of type '" "steps::model::Model *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::model::Model * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Batch" "', argument " "3"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::wm::Geom * >(argp3);
+  {
+    std::string *ptr = (std::string *)0;
+    res4 = SWIG_AsPtr_std_string(obj3, &ptr);
+    if (!SWIG_IsOK(res4)) {
+      SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "new_Batch" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Batch" "', argument " "4"" of type '" "std::string const &""'"); 
+    }
+    arg4 = ptr;
+  }
+  {
+    try {
+      result = (steps::batch::Batch *)new steps::batch::Batch((std::string const &)*arg1,arg2,arg3,(std::string const &)*arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__batch__Batch, SWIG_POINTER_NEW |  0 );
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  if (SWIG_IsNewObj(res4)) delete arg4;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_Batch__SWIG_2(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  std::string *arg1 = 0 ;
+  steps::model::Model *arg2 = (steps::model::Model *) 0 ;
+  steps::wm::Geom *arg3 = (steps::wm::Geom *) 0 ;
+  int res1 = SWIG_OLDOBJ ;
+  void *argp2 = 0 ;
+  int res2 = 0 ;
+  void *argp3 = 0 ;
+  int res3 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  steps::batch::Batch *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:new_Batch",&obj0,&obj1,&obj2)) SWIG_fail;
+  {
+    std::string *ptr = (std::string *)0;
+    res1 = SWIG_AsPtr_std_string(obj0, &ptr);
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "new_Batch" "', argument " "1"" of type '" "std::string const &""'"); 
+    }
+    arg1 = ptr;
+  }
+  res2 = SWIG_ConvertPtr(obj1, &argp2,SWIGTYPE_p_steps__model__Model, 0 |  0 );
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "new_Batch" "', argument " "2"" of type '" "steps::model::Model *""'"); 
+  }
+  arg2 = reinterpret_cast< steps::model::Model * >(argp2);
+  res3 = SWIG_ConvertPtr(obj2, &argp3,SWIGTYPE_p_steps__wm__Geom, 0 |  0 );
+  if (!SWIG_IsOK(res3)) {
+    SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "new_Batch" "', argument " "3"" of type '" "steps::wm::Geom *""'"); 
+  }
+  arg3 = reinterpret_cast< steps::wm::Geom * >(argp3);
+  {
+    try {
+      result = (steps::batch::Batch *)new steps::batch::Batch((std::string const &)*arg1,arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__batch__Batch, SWIG_POINTER_NEW |  0 );
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res1)) delete arg1;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_new_Batch(PyObject *self, PyObject *args) {
+  int argc;
+  PyObject *argv[6];
+  int ii;
+  
+  if (!PyTuple_Check(args)) SWIG_fail;
+  argc = (int)PyObject_Length(args);
+  for (ii = 0; (ii < argc) && (ii < 5); ii++) {
+    argv[ii] = PyTuple_GET_ITEM(args,ii);
+  }
+  if (argc == 3) {
+    int _v;
+    int res = SWIG_AsPtr_std_string(argv[0], (std::string**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_steps__model__Model, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_steps__wm__Geom, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          return _wrap_new_Batch__SWIG_2(self, args);
+        }
+      }
+    }
+  }
+  if (argc == 4) {
+    int _v;
+    int res = SWIG_AsPtr_std_string(argv[0], (std::string**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_steps__model__Model, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_steps__wm__Geom, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          int res = SWIG_AsPtr_std_string(argv[3], (std::string**)(0));
+          _v = SWIG_CheckState(res);
+          if (_v) {
+            return _wrap_new_Batch__SWIG_1(self, args);
+          }
+        }
+      }
+    }
+  }
+  if (argc == 5) {
+    int _v;
+    int res = SWIG_AsPtr_std_string(argv[0], (std::string**)(0));
+    _v = SWIG_CheckState(res);
+    if (_v) {
+      void *vptr = 0;
+      int res = SWIG_ConvertPtr(argv[1], &vptr, SWIGTYPE_p_steps__model__Model, 0);
+      _v = SWIG_CheckState(res);
+      if (_v) {
+        void *vptr = 0;
+        int res = SWIG_ConvertPtr(argv[2], &vptr, SWIGTYPE_p_steps__wm__Geom, 0);
+        _v = SWIG_CheckState(res);
+        if (_v) {
+          int res = SWIG_AsPtr_std_string(argv[3], (std::string**)(0));
+          _v = SWIG_CheckState(res);
+          if (_v) {
+            {
+              int res = SWIG_AsVal_unsigned_SS_int(argv[4], NULL);
+              _v = SWIG_CheckState(res);
+            }
+            if (_v) {
+              return _wrap_new_Batch__SWIG_0(self, args);
+            }
+          }
+        }
+      }
+    }
+  }
+  
+fail:
+  SWIG_SetErrorMsg(PyExc_NotImplementedError,"Wrong number of arguments for overloaded function 'new_Batch'.\n"
+    "  Possible C/C++ prototypes are:\n"
+    "    steps::batch::Batch(std::string const &,steps::model::Model *,steps::wm::Geom *,std::string const &,uint)\n"
+    "    steps::batch::Batch(std::string const &,steps::model::Model *,steps::wm::Geom *,std::string const &)\n"
+    "    steps::batch::Batch(std::string const &,steps::model::Model *,steps::wm::Geom *)\n");
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_Batch(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Batch",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Batch" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setCompCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setCompCount",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setCompCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setCompCount" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setCompCount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setCompConc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setCompConc",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setCompConc" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setCompConc" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompConc" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setCompConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setCompConc" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setCompConc((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setCompClamped(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  bool arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setCompClamped",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setCompClamped" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setCompClamped" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompClamped" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setCompClamped" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompClamped" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_bool(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setCompClamped" "', argument " "4"" of type '" "bool""'");
+  } 
+  arg4 = static_cast< bool >(val4);
+  {
+    try {
+      (arg1)->setCompClamped((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setCompReacK(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setCompReacK",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setCompReacK" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setCompReacK" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompReacK" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setCompReacK" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setCompReacK" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setCompReacK" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setCompReacK((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setTetCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  uint arg2 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setTetCount",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setTetCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Batch_setTetCount" "', argument " "2"" of type '" "uint""'");
+  } 
+  arg2 = static_cast< uint >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setTetCount" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setTetCount(arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setPatchCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setPatchCount",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setPatchCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setPatchCount" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setPatchCount((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setPatchClamped(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  bool arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  bool val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setPatchClamped",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setPatchClamped" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setPatchClamped" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchClamped" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setPatchClamped" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchClamped" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_bool(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setPatchClamped" "', argument " "4"" of type '" "bool""'");
+  } 
+  arg4 = static_cast< bool >(val4);
+  {
+    try {
+      (arg1)->setPatchClamped((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_setPatchSReacK(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  double arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  double val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_setPatchSReacK",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_setPatchSReacK" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_setPatchSReacK" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchSReacK" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_setPatchSReacK" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_setPatchSReacK" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_double(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_setPatchSReacK" "', argument " "4"" of type '" "double""'");
+  } 
+  arg4 = static_cast< double >(val4);
+  {
+    try {
+      (arg1)->setPatchSReacK((std::string const &)*arg2,(std::string const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_clearInitialState(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Batch_clearInitialState",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_clearInitialState" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    try {
+      (arg1)->clearInitialState();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_addCompCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Batch_addCompCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_addCompCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_addCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_addCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_addCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_addCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addCompCount((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_addPatchCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Batch_addPatchCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_addPatchCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_addPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_addPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_addPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_addPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addPatchCount((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_addTetCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  uint arg2 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Batch_addTetCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_addTetCount" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Batch_addTetCount" "', argument " "2"" of type '" "uint""'");
+  } 
+  arg2 = static_cast< uint >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_addTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_addTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addTetCount(arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_clearObservables(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Batch_clearObservables",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_clearObservables" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    try {
+      (arg1)->clearObservables();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_countObservables(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  uint result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Batch_countObservables",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_countObservables" "', argument " "1"" of type '" "steps::batch::Batch const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    try {
+      result = (uint)((steps::batch::Batch const *)arg1)->countObservables();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Batch_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::batch::Batch *arg1 = (steps::batch::Batch *) 0 ;
+  std::vector< uint,std::allocator< uint > > *arg2 = 0 ;
+  std::vector< double,std::allocator< double > > *arg3 = 0 ;
+  uint arg4 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  unsigned int val4 ;
+  int ecode4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  std::vector< double,std::allocator< double > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:Batch_run",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__batch__Batch, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Batch_run" "', argument " "1"" of type '" "steps::batch::Batch *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::batch::Batch * >(argp1);
+  {
+    std::vector<uint,std::allocator< uint > > *ptr = (std::vector<uint,std::allocator< uint > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Batch_run" "', argument " "2"" of type '" "std::vector< uint,std::allocator< uint > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_run" "', argument " "2"" of type '" "std::vector< uint,std::allocator< uint > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res3 = swig::asptr(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Batch_run" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Batch_run" "', argument " "3"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  ecode4 = SWIG_AsVal_unsigned_SS_int(obj3, &val4);
+  if (!SWIG_IsOK(ecode4)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode4), "in method '" "Batch_run" "', argument " "4"" of type '" "uint""'");
+  } 
+  arg4 = static_cast< uint >(val4);
+  {
+    try {
+      result = (arg1)->run((std::vector< uint,std::allocator< uint > > const &)*arg2,(std::vector< double,std::allocator< double > > const &)*arg3,arg4);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Batch_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__batch__Batch, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+SWIGINTERN PyObject *_wrap_new_Recorder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::API *arg1 = (steps::solver::API *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  steps::solver::Recorder *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:new_Recorder",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__API, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "new_Recorder" "', argument " "1"" of type '" "steps::solver::API *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::API * >(argp1);
+  {
+    try {
+      result = (steps::solver::Recorder *)new steps::solver::Recorder(arg1);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_steps__solver__Recorder, SWIG_POINTER_NEW |  0 );
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_delete_Recorder(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:delete_Recorder",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, SWIG_POINTER_DISOWN |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "delete_Recorder" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      delete arg1;
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addCompCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addCompCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addCompCount" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_addCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addCompCount((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addCompConc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addCompConc",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addCompConc" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_addCompConc" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompConc" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addCompConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addCompConc((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addPatchCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addPatchCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addPatchCount" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_addPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addPatchCount" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addPatchCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addPatchCount((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addTetCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addTetCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addTetCount" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Recorder_addTetCount" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addTetCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addTetCount(arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addTetConc(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addTetConc",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addTetConc" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Recorder_addTetConc" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addTetConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addTetConc" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addTetConc(arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addTriCount(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  unsigned int arg2 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  unsigned int val2 ;
+  int ecode2 = 0 ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addTriCount",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addTriCount" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  ecode2 = SWIG_AsVal_unsigned_SS_int(obj1, &val2);
+  if (!SWIG_IsOK(ecode2)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "Recorder_addTriCount" "', argument " "2"" of type '" "unsigned int""'");
+  } 
+  arg2 = static_cast< unsigned int >(val2);
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addTriCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addTriCount" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addTriCount(arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addCompReacExtent(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addCompReacExtent",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addCompReacExtent" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_addCompReacExtent" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompReacExtent" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addCompReacExtent" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addCompReacExtent" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addCompReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_addPatchSReacExtent(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::string *arg2 = 0 ;
+  std::string *arg3 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  int res3 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:Recorder_addPatchSReacExtent",&obj0,&obj1,&obj2)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_addPatchSReacExtent" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::string *ptr = (std::string *)0;
+    res2 = SWIG_AsPtr_std_string(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_addPatchSReacExtent" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addPatchSReacExtent" "', argument " "2"" of type '" "std::string const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    std::string *ptr = (std::string *)0;
+    res3 = SWIG_AsPtr_std_string(obj2, &ptr);
+    if (!SWIG_IsOK(res3)) {
+      SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "Recorder_addPatchSReacExtent" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_addPatchSReacExtent" "', argument " "3"" of type '" "std::string const &""'"); 
+    }
+    arg3 = ptr;
+  }
+  {
+    try {
+      (arg1)->addPatchSReacExtent((std::string const &)*arg2,(std::string const &)*arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  if (SWIG_IsNewObj(res3)) delete arg3;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_clearObservables(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Recorder_clearObservables",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_clearObservables" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      (arg1)->clearObservables();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_countObservables(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  unsigned int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Recorder_countObservables",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_countObservables" "', argument " "1"" of type '" "steps::solver::Recorder const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      result = (unsigned int)((steps::solver::Recorder const *)arg1)->countObservables();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_setTimePoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  std::vector< double,std::allocator< double > > *arg2 = 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  int res2 = SWIG_OLDOBJ ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Recorder_setTimePoints",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_setTimePoints" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    std::vector<double,std::allocator< double > > *ptr = (std::vector<double,std::allocator< double > > *)0;
+    res2 = swig::asptr(obj1, &ptr);
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "Recorder_setTimePoints" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    if (!ptr) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "Recorder_setTimePoints" "', argument " "2"" of type '" "std::vector< double,std::allocator< double > > const &""'"); 
+    }
+    arg2 = ptr;
+  }
+  {
+    try {
+      (arg1)->setTimePoints((std::vector< double,std::allocator< double > > const &)*arg2);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return resultobj;
+fail:
+  if (SWIG_IsNewObj(res2)) delete arg2;
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_getTimePoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< double,std::allocator< double > > *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Recorder_getTimePoints",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_getTimePoints" "', argument " "1"" of type '" "steps::solver::Recorder const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      result = (std::vector< double,std::allocator< double > > *) &((steps::solver::Recorder const *)arg1)->getTimePoints();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(*result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_countTimePoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  unsigned int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Recorder_countTimePoints",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_countTimePoints" "', argument " "1"" of type '" "steps::solver::Recorder const *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      result = (unsigned int)((steps::solver::Recorder const *)arg1)->countTimePoints();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_unsigned_SS_int(static_cast< unsigned int >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_run(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  std::vector< double,std::allocator< double > > result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Recorder_run",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_run" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    try {
+      result = (arg1)->run();
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = swig::from(static_cast< std::vector<double,std::allocator< double > > >(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_Recorder_runNP(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  steps::solver::Recorder *arg1 = (steps::solver::Recorder *) 0 ;
+  double *arg2 = (double *) 0 ;
+  unsigned int arg3 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  Py_buffer view2 ;
+  Py_buffer *pview2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OO:Recorder_runNP",&obj0,&obj1)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_steps__solver__Recorder, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Recorder_runNP" "', argument " "1"" of type '" "steps::solver::Recorder *""'"); 
+  }
+  arg1 = reinterpret_cast< steps::solver::Recorder * >(argp1);
+  {
+    if (steps_getbuffer(obj1, &view2, "d", sizeof(double), true) != 0)
+    SWIG_fail;
+    pview2 = &view2;
+    arg2 = static_cast<double *>(view2.buf);
+    arg3 = static_cast<unsigned int>(view2.len / view2.itemsize);
+  }
+  {
+    try {
+      (arg1)->runNP(arg2,arg3);
+    } catch (steps::ArgErr & ae) {
+      PyErr_SetString(PyExc_NameError, ae.getMsg());
+      SWIG_fail;
+    } catch (steps::NotImplErr & nie) {
+      PyErr_SetString(PyExc_NotImplementedError, nie.getMsg());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  return resultobj;
+fail:
+  {
+    if (pview2) PyBuffer_Release(pview2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *Recorder_swigregister(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *obj;
+  if (!PyArg_ParseTuple(args,(char*)"O:swigregister", &obj)) return NULL;
+  SWIG_TypeNewClientData(SWIGTYPE_p_steps__solver__Recorder, SWIG_NewClientData(obj));
+  return SWIG_Py_Void();
+}
+
+static PyMethodDef SwigMethods[] = {
+	 { (char *)"SWIG_PyInstanceMethod_New", (PyCFunction)SWIG_PyInstanceMethod_New, METH_O, NULL},
+	 { (char *)"delete_SwigPyIterator", _wrap_delete_SwigPyIterator, METH_VARARGS, NULL},
+	 { (char *)"SwigPyIterator_value", _wrap_SwigPyIterator_value, METH_VARARGS, NULL},
+	 { (char *)"SwigPyIterator_incr", _wrap_SwigPyIterator_incr, METH_VARARGS, NULL},
+	 { (char *)"SwigPyIterator_decr", _wrap_SwigPyIterator_decr, METH_VARARGS, NULL},
+	 { (char *)"SwigPyIterator_distance", _wrap_SwigPyIterator_distance, METH_VARARGS, NULL},
 	 { (char *)"SwigPyIterator_equal", _wrap_SwigPyIterator_equal, METH_VARARGS, NULL},
 	 { (char *)"SwigPyIterator_copy", _wrap_SwigPyIterator_copy, METH_VARARGS, NULL},
 	 { (char *)"SwigPyIterator_next", _wrap_SwigPyIterator_next, METH_VARARGS, NULL},
@@ -48666,888 +53921,2019 @@ static PyMethodDef SwigMethods[] = {
 		"Err(string msg = \"\")\n"
 		"new_Err() -> Err\n"
 		""},
-	 { (char *)"Err_getMsg", _wrap_Err_getMsg, METH_VARARGS, (char *)"Err_getMsg(Err self) -> char"},
-	 { (char *)"delete_Err", _wrap_delete_Err, METH_VARARGS, (char *)"delete_Err(Err self)"},
-	 { (char *)"Err_swigregister", Err_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_ArgErr", _wrap_new_ArgErr, METH_VARARGS, (char *)"\n"
-		"ArgErr(string msg = \"\")\n"
-		"new_ArgErr() -> ArgErr\n"
+	 { (char *)"Err_getMsg", _wrap_Err_getMsg, METH_VARARGS, (char *)"Err_getMsg(Err self) -> char"},
+	 { (char *)"delete_Err", _wrap_delete_Err, METH_VARARGS, (char *)"delete_Err(Err self)"},
+	 { (char *)"Err_swigregister", Err_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_ArgErr", _wrap_new_ArgErr, METH_VARARGS, (char *)"\n"
+		"ArgErr(string msg = \"\")\n"
+		"new_ArgErr() -> ArgErr\n"
+		""},
+	 { (char *)"delete_ArgErr", _wrap_delete_ArgErr, METH_VARARGS, (char *)"delete_ArgErr(ArgErr self)"},
+	 { (char *)"ArgErr_swigregister", ArgErr_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_NotImplErr", _wrap_new_NotImplErr, METH_VARARGS, (char *)"\n"
+		"NotImplErr(string msg = \"\")\n"
+		"new_NotImplErr() -> NotImplErr\n"
+		""},
+	 { (char *)"delete_NotImplErr", _wrap_delete_NotImplErr, METH_VARARGS, (char *)"delete_NotImplErr(NotImplErr self)"},
+	 { (char *)"NotImplErr_swigregister", NotImplErr_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_str_iterator", _wrap_vector_str_iterator, METH_VARARGS, (char *)"vector_str_iterator(vector_str self) -> SwigPyIterator"},
+	 { (char *)"vector_str___nonzero__", _wrap_vector_str___nonzero__, METH_VARARGS, (char *)"vector_str___nonzero__(vector_str self) -> bool"},
+	 { (char *)"vector_str___bool__", _wrap_vector_str___bool__, METH_VARARGS, (char *)"vector_str___bool__(vector_str self) -> bool"},
+	 { (char *)"vector_str___len__", _wrap_vector_str___len__, METH_VARARGS, (char *)"vector_str___len__(vector_str self) -> size_type"},
+	 { (char *)"vector_str_pop", _wrap_vector_str_pop, METH_VARARGS, (char *)"vector_str_pop(vector_str self) -> value_type"},
+	 { (char *)"vector_str___getslice__", _wrap_vector_str___getslice__, METH_VARARGS, (char *)"vector_str___getslice__(vector_str self, difference_type i, difference_type j) -> vector_str"},
+	 { (char *)"vector_str___setslice__", _wrap_vector_str___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_str___setslice__(vector_str self, difference_type i, difference_type j, \n"
+		"    vector_str v)\n"
+		""},
+	 { (char *)"vector_str___delslice__", _wrap_vector_str___delslice__, METH_VARARGS, (char *)"vector_str___delslice__(vector_str self, difference_type i, difference_type j)"},
+	 { (char *)"vector_str___delitem__", _wrap_vector_str___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_str___delitem__(vector_str self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_str___getitem__", _wrap_vector_str___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_str\n"
+		"vector_str___getitem__(vector_str self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_str___setitem__", _wrap_vector_str___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_str v)\n"
+		"vector_str___setitem__(vector_str self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_str_append", _wrap_vector_str_append, METH_VARARGS, (char *)"vector_str_append(vector_str self, value_type x)"},
+	 { (char *)"vector_str_empty", _wrap_vector_str_empty, METH_VARARGS, (char *)"vector_str_empty(vector_str self) -> bool"},
+	 { (char *)"vector_str_size", _wrap_vector_str_size, METH_VARARGS, (char *)"vector_str_size(vector_str self) -> size_type"},
+	 { (char *)"vector_str_clear", _wrap_vector_str_clear, METH_VARARGS, (char *)"vector_str_clear(vector_str self)"},
+	 { (char *)"vector_str_swap", _wrap_vector_str_swap, METH_VARARGS, (char *)"vector_str_swap(vector_str self, vector_str v)"},
+	 { (char *)"vector_str_get_allocator", _wrap_vector_str_get_allocator, METH_VARARGS, (char *)"vector_str_get_allocator(vector_str self) -> allocator_type"},
+	 { (char *)"vector_str_begin", _wrap_vector_str_begin, METH_VARARGS, (char *)"vector_str_begin(vector_str self) -> const_iterator"},
+	 { (char *)"vector_str_end", _wrap_vector_str_end, METH_VARARGS, (char *)"vector_str_end(vector_str self) -> const_iterator"},
+	 { (char *)"vector_str_rbegin", _wrap_vector_str_rbegin, METH_VARARGS, (char *)"vector_str_rbegin(vector_str self) -> const_reverse_iterator"},
+	 { (char *)"vector_str_rend", _wrap_vector_str_rend, METH_VARARGS, (char *)"vector_str_rend(vector_str self) -> const_reverse_iterator"},
+	 { (char *)"vector_str_pop_back", _wrap_vector_str_pop_back, METH_VARARGS, (char *)"vector_str_pop_back(vector_str self)"},
+	 { (char *)"vector_str_erase", _wrap_vector_str_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_str_erase(vector_str self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_str", _wrap_new_vector_str, METH_VARARGS, (char *)"\n"
+		"vector_str()\n"
+		"vector_str(vector_str arg0)\n"
+		"vector_str(size_type size)\n"
+		"new_vector_str(size_type size, value_type value) -> vector_str\n"
+		""},
+	 { (char *)"vector_str_push_back", _wrap_vector_str_push_back, METH_VARARGS, (char *)"vector_str_push_back(vector_str self, value_type x)"},
+	 { (char *)"vector_str_front", _wrap_vector_str_front, METH_VARARGS, (char *)"vector_str_front(vector_str self) -> value_type"},
+	 { (char *)"vector_str_back", _wrap_vector_str_back, METH_VARARGS, (char *)"vector_str_back(vector_str self) -> value_type"},
+	 { (char *)"vector_str_assign", _wrap_vector_str_assign, METH_VARARGS, (char *)"vector_str_assign(vector_str self, size_type n, value_type x)"},
+	 { (char *)"vector_str_resize", _wrap_vector_str_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_str_resize(vector_str self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_str_insert", _wrap_vector_str_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_str_insert(vector_str self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_str_reserve", _wrap_vector_str_reserve, METH_VARARGS, (char *)"vector_str_reserve(vector_str self, size_type n)"},
+	 { (char *)"vector_str_capacity", _wrap_vector_str_capacity, METH_VARARGS, (char *)"vector_str_capacity(vector_str self) -> size_type"},
+	 { (char *)"delete_vector_str", _wrap_delete_vector_str, METH_VARARGS, (char *)"delete_vector_str(vector_str self)"},
+	 { (char *)"vector_str_swigregister", vector_str_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_spc_iterator", _wrap_vector_spc_iterator, METH_VARARGS, (char *)"vector_spc_iterator(vector_spc self) -> SwigPyIterator"},
+	 { (char *)"vector_spc___nonzero__", _wrap_vector_spc___nonzero__, METH_VARARGS, (char *)"vector_spc___nonzero__(vector_spc self) -> bool"},
+	 { (char *)"vector_spc___bool__", _wrap_vector_spc___bool__, METH_VARARGS, (char *)"vector_spc___bool__(vector_spc self) -> bool"},
+	 { (char *)"vector_spc___len__", _wrap_vector_spc___len__, METH_VARARGS, (char *)"vector_spc___len__(vector_spc self) -> size_type"},
+	 { (char *)"vector_spc_pop", _wrap_vector_spc_pop, METH_VARARGS, (char *)"vector_spc_pop(vector_spc self) -> value_type"},
+	 { (char *)"vector_spc___getslice__", _wrap_vector_spc___getslice__, METH_VARARGS, (char *)"vector_spc___getslice__(vector_spc self, difference_type i, difference_type j) -> vector_spc"},
+	 { (char *)"vector_spc___setslice__", _wrap_vector_spc___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_spc___setslice__(vector_spc self, difference_type i, difference_type j, \n"
+		"    vector_spc v)\n"
+		""},
+	 { (char *)"vector_spc___delslice__", _wrap_vector_spc___delslice__, METH_VARARGS, (char *)"vector_spc___delslice__(vector_spc self, difference_type i, difference_type j)"},
+	 { (char *)"vector_spc___delitem__", _wrap_vector_spc___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_spc___delitem__(vector_spc self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_spc___getitem__", _wrap_vector_spc___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_spc\n"
+		"vector_spc___getitem__(vector_spc self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_spc___setitem__", _wrap_vector_spc___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_spc v)\n"
+		"vector_spc___setitem__(vector_spc self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_spc_append", _wrap_vector_spc_append, METH_VARARGS, (char *)"vector_spc_append(vector_spc self, value_type x)"},
+	 { (char *)"vector_spc_empty", _wrap_vector_spc_empty, METH_VARARGS, (char *)"vector_spc_empty(vector_spc self) -> bool"},
+	 { (char *)"vector_spc_size", _wrap_vector_spc_size, METH_VARARGS, (char *)"vector_spc_size(vector_spc self) -> size_type"},
+	 { (char *)"vector_spc_clear", _wrap_vector_spc_clear, METH_VARARGS, (char *)"vector_spc_clear(vector_spc self)"},
+	 { (char *)"vector_spc_swap", _wrap_vector_spc_swap, METH_VARARGS, (char *)"vector_spc_swap(vector_spc self, vector_spc v)"},
+	 { (char *)"vector_spc_get_allocator", _wrap_vector_spc_get_allocator, METH_VARARGS, (char *)"vector_spc_get_allocator(vector_spc self) -> allocator_type"},
+	 { (char *)"vector_spc_begin", _wrap_vector_spc_begin, METH_VARARGS, (char *)"vector_spc_begin(vector_spc self) -> const_iterator"},
+	 { (char *)"vector_spc_end", _wrap_vector_spc_end, METH_VARARGS, (char *)"vector_spc_end(vector_spc self) -> const_iterator"},
+	 { (char *)"vector_spc_rbegin", _wrap_vector_spc_rbegin, METH_VARARGS, (char *)"vector_spc_rbegin(vector_spc self) -> const_reverse_iterator"},
+	 { (char *)"vector_spc_rend", _wrap_vector_spc_rend, METH_VARARGS, (char *)"vector_spc_rend(vector_spc self) -> const_reverse_iterator"},
+	 { (char *)"vector_spc_pop_back", _wrap_vector_spc_pop_back, METH_VARARGS, (char *)"vector_spc_pop_back(vector_spc self)"},
+	 { (char *)"vector_spc_erase", _wrap_vector_spc_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_spc_erase(vector_spc self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_spc", _wrap_new_vector_spc, METH_VARARGS, (char *)"\n"
+		"vector_spc()\n"
+		"vector_spc(vector_spc arg0)\n"
+		"vector_spc(size_type size)\n"
+		"new_vector_spc(size_type size, value_type value) -> vector_spc\n"
+		""},
+	 { (char *)"vector_spc_push_back", _wrap_vector_spc_push_back, METH_VARARGS, (char *)"vector_spc_push_back(vector_spc self, value_type x)"},
+	 { (char *)"vector_spc_front", _wrap_vector_spc_front, METH_VARARGS, (char *)"vector_spc_front(vector_spc self) -> value_type"},
+	 { (char *)"vector_spc_back", _wrap_vector_spc_back, METH_VARARGS, (char *)"vector_spc_back(vector_spc self) -> value_type"},
+	 { (char *)"vector_spc_assign", _wrap_vector_spc_assign, METH_VARARGS, (char *)"vector_spc_assign(vector_spc self, size_type n, value_type x)"},
+	 { (char *)"vector_spc_resize", _wrap_vector_spc_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_spc_resize(vector_spc self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_spc_insert", _wrap_vector_spc_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_spc_insert(vector_spc self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_spc_reserve", _wrap_vector_spc_reserve, METH_VARARGS, (char *)"vector_spc_reserve(vector_spc self, size_type n)"},
+	 { (char *)"vector_spc_capacity", _wrap_vector_spc_capacity, METH_VARARGS, (char *)"vector_spc_capacity(vector_spc self) -> size_type"},
+	 { (char *)"delete_vector_spc", _wrap_delete_vector_spc, METH_VARARGS, (char *)"delete_vector_spc(vector_spc self)"},
+	 { (char *)"vector_spc_swigregister", vector_spc_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_rec_iterator", _wrap_vector_rec_iterator, METH_VARARGS, (char *)"vector_rec_iterator(vector_rec self) -> SwigPyIterator"},
+	 { (char *)"vector_rec___nonzero__", _wrap_vector_rec___nonzero__, METH_VARARGS, (char *)"vector_rec___nonzero__(vector_rec self) -> bool"},
+	 { (char *)"vector_rec___bool__", _wrap_vector_rec___bool__, METH_VARARGS, (char *)"vector_rec___bool__(vector_rec self) -> bool"},
+	 { (char *)"vector_rec___len__", _wrap_vector_rec___len__, METH_VARARGS, (char *)"vector_rec___len__(vector_rec self) -> size_type"},
+	 { (char *)"vector_rec_pop", _wrap_vector_rec_pop, METH_VARARGS, (char *)"vector_rec_pop(vector_rec self) -> value_type"},
+	 { (char *)"vector_rec___getslice__", _wrap_vector_rec___getslice__, METH_VARARGS, (char *)"vector_rec___getslice__(vector_rec self, difference_type i, difference_type j) -> vector_rec"},
+	 { (char *)"vector_rec___setslice__", _wrap_vector_rec___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_rec___setslice__(vector_rec self, difference_type i, difference_type j, \n"
+		"    vector_rec v)\n"
+		""},
+	 { (char *)"vector_rec___delslice__", _wrap_vector_rec___delslice__, METH_VARARGS, (char *)"vector_rec___delslice__(vector_rec self, difference_type i, difference_type j)"},
+	 { (char *)"vector_rec___delitem__", _wrap_vector_rec___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_rec___delitem__(vector_rec self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_rec___getitem__", _wrap_vector_rec___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_rec\n"
+		"vector_rec___getitem__(vector_rec self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_rec___setitem__", _wrap_vector_rec___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_rec v)\n"
+		"vector_rec___setitem__(vector_rec self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_rec_append", _wrap_vector_rec_append, METH_VARARGS, (char *)"vector_rec_append(vector_rec self, value_type x)"},
+	 { (char *)"vector_rec_empty", _wrap_vector_rec_empty, METH_VARARGS, (char *)"vector_rec_empty(vector_rec self) -> bool"},
+	 { (char *)"vector_rec_size", _wrap_vector_rec_size, METH_VARARGS, (char *)"vector_rec_size(vector_rec self) -> size_type"},
+	 { (char *)"vector_rec_clear", _wrap_vector_rec_clear, METH_VARARGS, (char *)"vector_rec_clear(vector_rec self)"},
+	 { (char *)"vector_rec_swap", _wrap_vector_rec_swap, METH_VARARGS, (char *)"vector_rec_swap(vector_rec self, vector_rec v)"},
+	 { (char *)"vector_rec_get_allocator", _wrap_vector_rec_get_allocator, METH_VARARGS, (char *)"vector_rec_get_allocator(vector_rec self) -> allocator_type"},
+	 { (char *)"vector_rec_begin", _wrap_vector_rec_begin, METH_VARARGS, (char *)"vector_rec_begin(vector_rec self) -> const_iterator"},
+	 { (char *)"vector_rec_end", _wrap_vector_rec_end, METH_VARARGS, (char *)"vector_rec_end(vector_rec self) -> const_iterator"},
+	 { (char *)"vector_rec_rbegin", _wrap_vector_rec_rbegin, METH_VARARGS, (char *)"vector_rec_rbegin(vector_rec self) -> const_reverse_iterator"},
+	 { (char *)"vector_rec_rend", _wrap_vector_rec_rend, METH_VARARGS, (char *)"vector_rec_rend(vector_rec self) -> const_reverse_iterator"},
+	 { (char *)"vector_rec_pop_back", _wrap_vector_rec_pop_back, METH_VARARGS, (char *)"vector_rec_pop_back(vector_rec self)"},
+	 { (char *)"vector_rec_erase", _wrap_vector_rec_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_rec_erase(vector_rec self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_rec", _wrap_new_vector_rec, METH_VARARGS, (char *)"\n"
+		"vector_rec()\n"
+		"vector_rec(vector_rec arg0)\n"
+		"vector_rec(size_type size)\n"
+		"new_vector_rec(size_type size, value_type value) -> vector_rec\n"
+		""},
+	 { (char *)"vector_rec_push_back", _wrap_vector_rec_push_back, METH_VARARGS, (char *)"vector_rec_push_back(vector_rec self, value_type x)"},
+	 { (char *)"vector_rec_front", _wrap_vector_rec_front, METH_VARARGS, (char *)"vector_rec_front(vector_rec self) -> value_type"},
+	 { (char *)"vector_rec_back", _wrap_vector_rec_back, METH_VARARGS, (char *)"vector_rec_back(vector_rec self) -> value_type"},
+	 { (char *)"vector_rec_assign", _wrap_vector_rec_assign, METH_VARARGS, (char *)"vector_rec_assign(vector_rec self, size_type n, value_type x)"},
+	 { (char *)"vector_rec_resize", _wrap_vector_rec_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_rec_resize(vector_rec self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_rec_insert", _wrap_vector_rec_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_rec_insert(vector_rec self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_rec_reserve", _wrap_vector_rec_reserve, METH_VARARGS, (char *)"vector_rec_reserve(vector_rec self, size_type n)"},
+	 { (char *)"vector_rec_capacity", _wrap_vector_rec_capacity, METH_VARARGS, (char *)"vector_rec_capacity(vector_rec self) -> size_type"},
+	 { (char *)"delete_vector_rec", _wrap_delete_vector_rec, METH_VARARGS, (char *)"delete_vector_rec(vector_rec self)"},
+	 { (char *)"vector_rec_swigregister", vector_rec_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_src_iterator", _wrap_vector_src_iterator, METH_VARARGS, (char *)"vector_src_iterator(vector_src self) -> SwigPyIterator"},
+	 { (char *)"vector_src___nonzero__", _wrap_vector_src___nonzero__, METH_VARARGS, (char *)"vector_src___nonzero__(vector_src self) -> bool"},
+	 { (char *)"vector_src___bool__", _wrap_vector_src___bool__, METH_VARARGS, (char *)"vector_src___bool__(vector_src self) -> bool"},
+	 { (char *)"vector_src___len__", _wrap_vector_src___len__, METH_VARARGS, (char *)"vector_src___len__(vector_src self) -> size_type"},
+	 { (char *)"vector_src_pop", _wrap_vector_src_pop, METH_VARARGS, (char *)"vector_src_pop(vector_src self) -> value_type"},
+	 { (char *)"vector_src___getslice__", _wrap_vector_src___getslice__, METH_VARARGS, (char *)"vector_src___getslice__(vector_src self, difference_type i, difference_type j) -> vector_src"},
+	 { (char *)"vector_src___setslice__", _wrap_vector_src___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_src___setslice__(vector_src self, difference_type i, difference_type j, \n"
+		"    vector_src v)\n"
+		""},
+	 { (char *)"vector_src___delslice__", _wrap_vector_src___delslice__, METH_VARARGS, (char *)"vector_src___delslice__(vector_src self, difference_type i, difference_type j)"},
+	 { (char *)"vector_src___delitem__", _wrap_vector_src___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_src___delitem__(vector_src self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_src___getitem__", _wrap_vector_src___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_src\n"
+		"vector_src___getitem__(vector_src self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_src___setitem__", _wrap_vector_src___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_src v)\n"
+		"vector_src___setitem__(vector_src self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_src_append", _wrap_vector_src_append, METH_VARARGS, (char *)"vector_src_append(vector_src self, value_type x)"},
+	 { (char *)"vector_src_empty", _wrap_vector_src_empty, METH_VARARGS, (char *)"vector_src_empty(vector_src self) -> bool"},
+	 { (char *)"vector_src_size", _wrap_vector_src_size, METH_VARARGS, (char *)"vector_src_size(vector_src self) -> size_type"},
+	 { (char *)"vector_src_clear", _wrap_vector_src_clear, METH_VARARGS, (char *)"vector_src_clear(vector_src self)"},
+	 { (char *)"vector_src_swap", _wrap_vector_src_swap, METH_VARARGS, (char *)"vector_src_swap(vector_src self, vector_src v)"},
+	 { (char *)"vector_src_get_allocator", _wrap_vector_src_get_allocator, METH_VARARGS, (char *)"vector_src_get_allocator(vector_src self) -> allocator_type"},
+	 { (char *)"vector_src_begin", _wrap_vector_src_begin, METH_VARARGS, (char *)"vector_src_begin(vector_src self) -> const_iterator"},
+	 { (char *)"vector_src_end", _wrap_vector_src_end, METH_VARARGS, (char *)"vector_src_end(vector_src self) -> const_iterator"},
+	 { (char *)"vector_src_rbegin", _wrap_vector_src_rbegin, METH_VARARGS, (char *)"vector_src_rbegin(vector_src self) -> const_reverse_iterator"},
+	 { (char *)"vector_src_rend", _wrap_vector_src_rend, METH_VARARGS, (char *)"vector_src_rend(vector_src self) -> const_reverse_iterator"},
+	 { (char *)"vector_src_pop_back", _wrap_vector_src_pop_back, METH_VARARGS, (char *)"vector_src_pop_back(vector_src self)"},
+	 { (char *)"vector_src_erase", _wrap_vector_src_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_src_erase(vector_src self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_src", _wrap_new_vector_src, METH_VARARGS, (char *)"\n"
+		"vector_src()\n"
+		"vector_src(vector_src arg0)\n"
+		"vector_src(size_type size)\n"
+		"new_vector_src(size_type size, value_type value) -> vector_src\n"
+		""},
+	 { (char *)"vector_src_push_back", _wrap_vector_src_push_back, METH_VARARGS, (char *)"vector_src_push_back(vector_src self, value_type x)"},
+	 { (char *)"vector_src_front", _wrap_vector_src_front, METH_VARARGS, (char *)"vector_src_front(vector_src self) -> value_type"},
+	 { (char *)"vector_src_back", _wrap_vector_src_back, METH_VARARGS, (char *)"vector_src_back(vector_src self) -> value_type"},
+	 { (char *)"vector_src_assign", _wrap_vector_src_assign, METH_VARARGS, (char *)"vector_src_assign(vector_src self, size_type n, value_type x)"},
+	 { (char *)"vector_src_resize", _wrap_vector_src_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_src_resize(vector_src self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_src_insert", _wrap_vector_src_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_src_insert(vector_src self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_src_reserve", _wrap_vector_src_reserve, METH_VARARGS, (char *)"vector_src_reserve(vector_src self, size_type n)"},
+	 { (char *)"vector_src_capacity", _wrap_vector_src_capacity, METH_VARARGS, (char *)"vector_src_capacity(vector_src self) -> size_type"},
+	 { (char *)"delete_vector_src", _wrap_delete_vector_src, METH_VARARGS, (char *)"delete_vector_src(vector_src self)"},
+	 { (char *)"vector_src_swigregister", vector_src_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_dif_iterator", _wrap_vector_dif_iterator, METH_VARARGS, (char *)"vector_dif_iterator(vector_dif self) -> SwigPyIterator"},
+	 { (char *)"vector_dif___nonzero__", _wrap_vector_dif___nonzero__, METH_VARARGS, (char *)"vector_dif___nonzero__(vector_dif self) -> bool"},
+	 { (char *)"vector_dif___bool__", _wrap_vector_dif___bool__, METH_VARARGS, (char *)"vector_dif___bool__(vector_dif self) -> bool"},
+	 { (char *)"vector_dif___len__", _wrap_vector_dif___len__, METH_VARARGS, (char *)"vector_dif___len__(vector_dif self) -> size_type"},
+	 { (char *)"vector_dif_pop", _wrap_vector_dif_pop, METH_VARARGS, (char *)"vector_dif_pop(vector_dif self) -> value_type"},
+	 { (char *)"vector_dif___getslice__", _wrap_vector_dif___getslice__, METH_VARARGS, (char *)"vector_dif___getslice__(vector_dif self, difference_type i, difference_type j) -> vector_dif"},
+	 { (char *)"vector_dif___setslice__", _wrap_vector_dif___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_dif___setslice__(vector_dif self, difference_type i, difference_type j, \n"
+		"    vector_dif v)\n"
+		""},
+	 { (char *)"vector_dif___delslice__", _wrap_vector_dif___delslice__, METH_VARARGS, (char *)"vector_dif___delslice__(vector_dif self, difference_type i, difference_type j)"},
+	 { (char *)"vector_dif___delitem__", _wrap_vector_dif___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_dif___delitem__(vector_dif self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_dif___getitem__", _wrap_vector_dif___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_dif\n"
+		"vector_dif___getitem__(vector_dif self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_dif___setitem__", _wrap_vector_dif___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_dif v)\n"
+		"vector_dif___setitem__(vector_dif self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_dif_append", _wrap_vector_dif_append, METH_VARARGS, (char *)"vector_dif_append(vector_dif self, value_type x)"},
+	 { (char *)"vector_dif_empty", _wrap_vector_dif_empty, METH_VARARGS, (char *)"vector_dif_empty(vector_dif self) -> bool"},
+	 { (char *)"vector_dif_size", _wrap_vector_dif_size, METH_VARARGS, (char *)"vector_dif_size(vector_dif self) -> size_type"},
+	 { (char *)"vector_dif_clear", _wrap_vector_dif_clear, METH_VARARGS, (char *)"vector_dif_clear(vector_dif self)"},
+	 { (char *)"vector_dif_swap", _wrap_vector_dif_swap, METH_VARARGS, (char *)"vector_dif_swap(vector_dif self, vector_dif v)"},
+	 { (char *)"vector_dif_get_allocator", _wrap_vector_dif_get_allocator, METH_VARARGS, (char *)"vector_dif_get_allocator(vector_dif self) -> allocator_type"},
+	 { (char *)"vector_dif_begin", _wrap_vector_dif_begin, METH_VARARGS, (char *)"vector_dif_begin(vector_dif self) -> const_iterator"},
+	 { (char *)"vector_dif_end", _wrap_vector_dif_end, METH_VARARGS, (char *)"vector_dif_end(vector_dif self) -> const_iterator"},
+	 { (char *)"vector_dif_rbegin", _wrap_vector_dif_rbegin, METH_VARARGS, (char *)"vector_dif_rbegin(vector_dif self) -> const_reverse_iterator"},
+	 { (char *)"vector_dif_rend", _wrap_vector_dif_rend, METH_VARARGS, (char *)"vector_dif_rend(vector_dif self) -> const_reverse_iterator"},
+	 { (char *)"vector_dif_pop_back", _wrap_vector_dif_pop_back, METH_VARARGS, (char *)"vector_dif_pop_back(vector_dif self)"},
+	 { (char *)"vector_dif_erase", _wrap_vector_dif_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_dif_erase(vector_dif self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_dif", _wrap_new_vector_dif, METH_VARARGS, (char *)"\n"
+		"vector_dif()\n"
+		"vector_dif(vector_dif arg0)\n"
+		"vector_dif(size_type size)\n"
+		"new_vector_dif(size_type size, value_type value) -> vector_dif\n"
+		""},
+	 { (char *)"vector_dif_push_back", _wrap_vector_dif_push_back, METH_VARARGS, (char *)"vector_dif_push_back(vector_dif self, value_type x)"},
+	 { (char *)"vector_dif_front", _wrap_vector_dif_front, METH_VARARGS, (char *)"vector_dif_front(vector_dif self) -> value_type"},
+	 { (char *)"vector_dif_back", _wrap_vector_dif_back, METH_VARARGS, (char *)"vector_dif_back(vector_dif self) -> value_type"},
+	 { (char *)"vector_dif_assign", _wrap_vector_dif_assign, METH_VARARGS, (char *)"vector_dif_assign(vector_dif self, size_type n, value_type x)"},
+	 { (char *)"vector_dif_resize", _wrap_vector_dif_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_dif_resize(vector_dif self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_dif_insert", _wrap_vector_dif_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_dif_insert(vector_dif self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_dif_reserve", _wrap_vector_dif_reserve, METH_VARARGS, (char *)"vector_dif_reserve(vector_dif self, size_type n)"},
+	 { (char *)"vector_dif_capacity", _wrap_vector_dif_capacity, METH_VARARGS, (char *)"vector_dif_capacity(vector_dif self) -> size_type"},
+	 { (char *)"delete_vector_dif", _wrap_delete_vector_dif, METH_VARARGS, (char *)"delete_vector_dif(vector_dif self)"},
+	 { (char *)"vector_dif_swigregister", vector_dif_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_vsys_iterator", _wrap_vector_vsys_iterator, METH_VARARGS, (char *)"vector_vsys_iterator(vector_vsys self) -> SwigPyIterator"},
+	 { (char *)"vector_vsys___nonzero__", _wrap_vector_vsys___nonzero__, METH_VARARGS, (char *)"vector_vsys___nonzero__(vector_vsys self) -> bool"},
+	 { (char *)"vector_vsys___bool__", _wrap_vector_vsys___bool__, METH_VARARGS, (char *)"vector_vsys___bool__(vector_vsys self) -> bool"},
+	 { (char *)"vector_vsys___len__", _wrap_vector_vsys___len__, METH_VARARGS, (char *)"vector_vsys___len__(vector_vsys self) -> size_type"},
+	 { (char *)"vector_vsys_pop", _wrap_vector_vsys_pop, METH_VARARGS, (char *)"vector_vsys_pop(vector_vsys self) -> value_type"},
+	 { (char *)"vector_vsys___getslice__", _wrap_vector_vsys___getslice__, METH_VARARGS, (char *)"vector_vsys___getslice__(vector_vsys self, difference_type i, difference_type j) -> vector_vsys"},
+	 { (char *)"vector_vsys___setslice__", _wrap_vector_vsys___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_vsys___setslice__(vector_vsys self, difference_type i, difference_type j, \n"
+		"    vector_vsys v)\n"
+		""},
+	 { (char *)"vector_vsys___delslice__", _wrap_vector_vsys___delslice__, METH_VARARGS, (char *)"vector_vsys___delslice__(vector_vsys self, difference_type i, difference_type j)"},
+	 { (char *)"vector_vsys___delitem__", _wrap_vector_vsys___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_vsys___delitem__(vector_vsys self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_vsys___getitem__", _wrap_vector_vsys___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_vsys\n"
+		"vector_vsys___getitem__(vector_vsys self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_vsys___setitem__", _wrap_vector_vsys___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_vsys v)\n"
+		"vector_vsys___setitem__(vector_vsys self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_vsys_append", _wrap_vector_vsys_append, METH_VARARGS, (char *)"vector_vsys_append(vector_vsys self, value_type x)"},
+	 { (char *)"vector_vsys_empty", _wrap_vector_vsys_empty, METH_VARARGS, (char *)"vector_vsys_empty(vector_vsys self) -> bool"},
+	 { (char *)"vector_vsys_size", _wrap_vector_vsys_size, METH_VARARGS, (char *)"vector_vsys_size(vector_vsys self) -> size_type"},
+	 { (char *)"vector_vsys_clear", _wrap_vector_vsys_clear, METH_VARARGS, (char *)"vector_vsys_clear(vector_vsys self)"},
+	 { (char *)"vector_vsys_swap", _wrap_vector_vsys_swap, METH_VARARGS, (char *)"vector_vsys_swap(vector_vsys self, vector_vsys v)"},
+	 { (char *)"vector_vsys_get_allocator", _wrap_vector_vsys_get_allocator, METH_VARARGS, (char *)"vector_vsys_get_allocator(vector_vsys self) -> allocator_type"},
+	 { (char *)"vector_vsys_begin", _wrap_vector_vsys_begin, METH_VARARGS, (char *)"vector_vsys_begin(vector_vsys self) -> const_iterator"},
+	 { (char *)"vector_vsys_end", _wrap_vector_vsys_end, METH_VARARGS, (char *)"vector_vsys_end(vector_vsys self) -> const_iterator"},
+	 { (char *)"vector_vsys_rbegin", _wrap_vector_vsys_rbegin, METH_VARARGS, (char *)"vector_vsys_rbegin(vector_vsys self) -> const_reverse_iterator"},
+	 { (char *)"vector_vsys_rend", _wrap_vector_vsys_rend, METH_VARARGS, (char *)"vector_vsys_rend(vector_vsys self) -> const_reverse_iterator"},
+	 { (char *)"vector_vsys_pop_back", _wrap_vector_vsys_pop_back, METH_VARARGS, (char *)"vector_vsys_pop_back(vector_vsys self)"},
+	 { (char *)"vector_vsys_erase", _wrap_vector_vsys_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_vsys_erase(vector_vsys self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_vsys", _wrap_new_vector_vsys, METH_VARARGS, (char *)"\n"
+		"vector_vsys()\n"
+		"vector_vsys(vector_vsys arg0)\n"
+		"vector_vsys(size_type size)\n"
+		"new_vector_vsys(size_type size, value_type value) -> vector_vsys\n"
+		""},
+	 { (char *)"vector_vsys_push_back", _wrap_vector_vsys_push_back, METH_VARARGS, (char *)"vector_vsys_push_back(vector_vsys self, value_type x)"},
+	 { (char *)"vector_vsys_front", _wrap_vector_vsys_front, METH_VARARGS, (char *)"vector_vsys_front(vector_vsys self) -> value_type"},
+	 { (char *)"vector_vsys_back", _wrap_vector_vsys_back, METH_VARARGS, (char *)"vector_vsys_back(vector_vsys self) -> value_type"},
+	 { (char *)"vector_vsys_assign", _wrap_vector_vsys_assign, METH_VARARGS, (char *)"vector_vsys_assign(vector_vsys self, size_type n, value_type x)"},
+	 { (char *)"vector_vsys_resize", _wrap_vector_vsys_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_vsys_resize(vector_vsys self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_vsys_insert", _wrap_vector_vsys_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_vsys_insert(vector_vsys self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_vsys_reserve", _wrap_vector_vsys_reserve, METH_VARARGS, (char *)"vector_vsys_reserve(vector_vsys self, size_type n)"},
+	 { (char *)"vector_vsys_capacity", _wrap_vector_vsys_capacity, METH_VARARGS, (char *)"vector_vsys_capacity(vector_vsys self) -> size_type"},
+	 { (char *)"delete_vector_vsys", _wrap_delete_vector_vsys, METH_VARARGS, (char *)"delete_vector_vsys(vector_vsys self)"},
+	 { (char *)"vector_vsys_swigregister", vector_vsys_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_ssys_iterator", _wrap_vector_ssys_iterator, METH_VARARGS, (char *)"vector_ssys_iterator(vector_ssys self) -> SwigPyIterator"},
+	 { (char *)"vector_ssys___nonzero__", _wrap_vector_ssys___nonzero__, METH_VARARGS, (char *)"vector_ssys___nonzero__(vector_ssys self) -> bool"},
+	 { (char *)"vector_ssys___bool__", _wrap_vector_ssys___bool__, METH_VARARGS, (char *)"vector_ssys___bool__(vector_ssys self) -> bool"},
+	 { (char *)"vector_ssys___len__", _wrap_vector_ssys___len__, METH_VARARGS, (char *)"vector_ssys___len__(vector_ssys self) -> size_type"},
+	 { (char *)"vector_ssys_pop", _wrap_vector_ssys_pop, METH_VARARGS, (char *)"vector_ssys_pop(vector_ssys self) -> value_type"},
+	 { (char *)"vector_ssys___getslice__", _wrap_vector_ssys___getslice__, METH_VARARGS, (char *)"vector_ssys___getslice__(vector_ssys self, difference_type i, difference_type j) -> vector_ssys"},
+	 { (char *)"vector_ssys___setslice__", _wrap_vector_ssys___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_ssys___setslice__(vector_ssys self, difference_type i, difference_type j, \n"
+		"    vector_ssys v)\n"
+		""},
+	 { (char *)"vector_ssys___delslice__", _wrap_vector_ssys___delslice__, METH_VARARGS, (char *)"vector_ssys___delslice__(vector_ssys self, difference_type i, difference_type j)"},
+	 { (char *)"vector_ssys___delitem__", _wrap_vector_ssys___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_ssys___delitem__(vector_ssys self, PySliceObject slice)\n"
+		""},
+	 { (char *)"vector_ssys___getitem__", _wrap_vector_ssys___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_ssys\n"
+		"vector_ssys___getitem__(vector_ssys self, difference_type i) -> value_type\n"
+		""},
+	 { (char *)"vector_ssys___setitem__", _wrap_vector_ssys___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_ssys v)\n"
+		"vector_ssys___setitem__(vector_ssys self, difference_type i, value_type x)\n"
+		""},
+	 { (char *)"vector_ssys_append", _wrap_vector_ssys_append, METH_VARARGS, (char *)"vector_ssys_append(vector_ssys self, value_type x)"},
+	 { (char *)"vector_ssys_empty", _wrap_vector_ssys_empty, METH_VARARGS, (char *)"vector_ssys_empty(vector_ssys self) -> bool"},
+	 { (char *)"vector_ssys_size", _wrap_vector_ssys_size, METH_VARARGS, (char *)"vector_ssys_size(vector_ssys self) -> size_type"},
+	 { (char *)"vector_ssys_clear", _wrap_vector_ssys_clear, METH_VARARGS, (char *)"vector_ssys_clear(vector_ssys self)"},
+	 { (char *)"vector_ssys_swap", _wrap_vector_ssys_swap, METH_VARARGS, (char *)"vector_ssys_swap(vector_ssys self, vector_ssys v)"},
+	 { (char *)"vector_ssys_get_allocator", _wrap_vector_ssys_get_allocator, METH_VARARGS, (char *)"vector_ssys_get_allocator(vector_ssys self) -> allocator_type"},
+	 { (char *)"vector_ssys_begin", _wrap_vector_ssys_begin, METH_VARARGS, (char *)"vector_ssys_begin(vector_ssys self) -> const_iterator"},
+	 { (char *)"vector_ssys_end", _wrap_vector_ssys_end, METH_VARARGS, (char *)"vector_ssys_end(vector_ssys self) -> const_iterator"},
+	 { (char *)"vector_ssys_rbegin", _wrap_vector_ssys_rbegin, METH_VARARGS, (char *)"vector_ssys_rbegin(vector_ssys self) -> const_reverse_iterator"},
+	 { (char *)"vector_ssys_rend", _wrap_vector_ssys_rend, METH_VARARGS, (char *)"vector_ssys_rend(vector_ssys self) -> const_reverse_iterator"},
+	 { (char *)"vector_ssys_pop_back", _wrap_vector_ssys_pop_back, METH_VARARGS, (char *)"vector_ssys_pop_back(vector_ssys self)"},
+	 { (char *)"vector_ssys_erase", _wrap_vector_ssys_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_ssys_erase(vector_ssys self, iterator first, iterator last) -> iterator\n"
+		""},
+	 { (char *)"new_vector_ssys", _wrap_new_vector_ssys, METH_VARARGS, (char *)"\n"
+		"vector_ssys()\n"
+		"vector_ssys(vector_ssys arg0)\n"
+		"vector_ssys(size_type size)\n"
+		"new_vector_ssys(size_type size, value_type value) -> vector_ssys\n"
+		""},
+	 { (char *)"vector_ssys_push_back", _wrap_vector_ssys_push_back, METH_VARARGS, (char *)"vector_ssys_push_back(vector_ssys self, value_type x)"},
+	 { (char *)"vector_ssys_front", _wrap_vector_ssys_front, METH_VARARGS, (char *)"vector_ssys_front(vector_ssys self) -> value_type"},
+	 { (char *)"vector_ssys_back", _wrap_vector_ssys_back, METH_VARARGS, (char *)"vector_ssys_back(vector_ssys self) -> value_type"},
+	 { (char *)"vector_ssys_assign", _wrap_vector_ssys_assign, METH_VARARGS, (char *)"vector_ssys_assign(vector_ssys self, size_type n, value_type x)"},
+	 { (char *)"vector_ssys_resize", _wrap_vector_ssys_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_ssys_resize(vector_ssys self, size_type new_size, value_type x)\n"
+		""},
+	 { (char *)"vector_ssys_insert", _wrap_vector_ssys_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_ssys_insert(vector_ssys self, iterator pos, size_type n, value_type x)\n"
+		""},
+	 { (char *)"vector_ssys_reserve", _wrap_vector_ssys_reserve, METH_VARARGS, (char *)"vector_ssys_reserve(vector_ssys self, size_type n)"},
+	 { (char *)"vector_ssys_capacity", _wrap_vector_ssys_capacity, METH_VARARGS, (char *)"vector_ssys_capacity(vector_ssys self) -> size_type"},
+	 { (char *)"delete_vector_ssys", _wrap_delete_vector_ssys, METH_VARARGS, (char *)"delete_vector_ssys(vector_ssys self)"},
+	 { (char *)"vector_ssys_swigregister", vector_ssys_swigregister, METH_VARARGS, NULL},
+	 { (char *)"isValidID", _wrap_isValidID, METH_VARARGS, (char *)"isValidID(string id) -> bool"},
+	 { (char *)"checkID", _wrap_checkID, METH_VARARGS, (char *)"checkID(string id)"},
+	 { (char *)"new_Model", _wrap_new_Model, METH_VARARGS, (char *)"new_Model() -> Model"},
+	 { (char *)"delete_Model", _wrap_delete_Model, METH_VARARGS, (char *)"delete_Model(Model self)"},
+	 { (char *)"Model_getSpec", _wrap_Model_getSpec, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Spec species object with \n"
+		"identifier string spec_id (if defined).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getSpec(spec_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string spec_id\n"
+		"             \n"
+		"Return:\n"
+		"    steps.model.Spec\n"
+		"\n"
+		""},
+	 { (char *)"Model_delSpec", _wrap_Model_delSpec, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.Spec species object with identifier \n"
+		"string spec_id (if defined) from the model.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delSpec(spec_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string spec_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Model_getAllSpecs", _wrap_Model_getAllSpecs, METH_VARARGS, (char *)"\n"
+		"Returns a list of steps.model.Spec object references of all species in the model.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSpecs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
+		""},
+	 { (char *)"Model_getVolsys", _wrap_Model_getVolsys, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Volsys volume system object with \n"
+		"identifier string vsys_id (if defined).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getVolsys(vsys_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string vsys_id\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Volsys\n"
+		"\n"
+		""},
+	 { (char *)"Model_delVolsys", _wrap_Model_delVolsys, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.Volsys volume system object with identifier string \n"
+		"vsys_id (if defined) from the model.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delVolsys(vsys_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string vsys_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Model_getAllVolsyss", _wrap_Model_getAllVolsyss, METH_VARARGS, (char *)"\n"
+		"Returns a list of steps.model.Volsys object references of all volume systems in the model.\n"
+		"             \n"
+		"Syntax::\n"
+		"             \n"
+		"    getAllVolsyss()\n"
+		"             \n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.model.Volsys>\n"
+		"\n"
+		""},
+	 { (char *)"Model_getSurfsys", _wrap_Model_getSurfsys, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Surfsys surface system object with \n"
+		"identifier string ssys_id (if defined).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getSurfsys(ssys_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string ssys_id\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Surfsys\n"
+		"\n"
+		""},
+	 { (char *)"Model_delSurfsys", _wrap_Model_delSurfsys, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.Surfsys surface system object with identifier string \n"
+		"ssys_id (if defined) from the model.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delSurfsys(ssys_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string ssys_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Model_getAllSurfsyss", _wrap_Model_getAllSurfsyss, METH_VARARGS, (char *)"\n"
+		"Returns a list of steps.model.Surfsys object references of all surface systems in the model.\n"
+		"\n"
+		"ax::\n"
+		"\n"
+		"getAllSurfsyss()\n"
+		"\n"
+		"ments:\n"
+		"None\n"
+		"\n"
+		"rn:\n"
+		"list<steps.model.Surfsys>\n"
+		"\n"
+		""},
+	 { (char *)"Model_swigregister", Model_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Spec", _wrap_new_Spec, METH_VARARGS, (char *)"new_Spec(string id, Model model) -> Spec"},
+	 { (char *)"delete_Spec", _wrap_delete_Spec, METH_VARARGS, (char *)"delete_Spec(Spec self)"},
+	 { (char *)"Spec_getID", _wrap_Spec_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the species.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
+		""},
+	 { (char *)"Spec_setID", _wrap_Spec_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the species.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"\n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Spec_getModel", _wrap_Spec_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"    \n"
+		"Attribute:\n"
+		"    model\n"
+		"\n"
+		""},
+	 { (char *)"Spec_swigregister", Spec_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Surfsys", _wrap_new_Surfsys, METH_VARARGS, (char *)"new_Surfsys(string id, Model model) -> Surfsys"},
+	 { (char *)"delete_Surfsys", _wrap_delete_Surfsys, METH_VARARGS, (char *)"delete_Surfsys(Surfsys self)"},
+	 { (char *)"Surfsys_getID", _wrap_Surfsys_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the surface system.\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getID()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_setID", _wrap_Surfsys_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the surface system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_getModel", _wrap_Surfsys_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_getSReac", _wrap_Surfsys_getSReac, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.SReac surface-reaction object \n"
+		"with identifier sreac_id (if defined in the surface system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getSReac(sreac_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string sreac_id\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.SReac\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_delSReac", _wrap_Surfsys_delSReac, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.SReac surface-reaction object with identifier \n"
+		"sreac_id from the surface system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delSReac(sreac_id)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string sreac_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_getAllSReacs", _wrap_Surfsys_getAllSReacs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.SReac surface-reaction \n"
+		"objects defined in the surface system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSReacs()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.SReac>\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_getAllSpecs", _wrap_Surfsys_getAllSpecs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Spec species objects included \n"
+		"in the surface system; that is all reactants and products in the surface \n"
+		"reactions belonging to this surface system. No duplicate member is included.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSpecs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
+		""},
+	 { (char *)"Surfsys_swigregister", Surfsys_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Volsys", _wrap_new_Volsys, METH_VARARGS, (char *)"new_Volsys(string id, Model model) -> Volsys"},
+	 { (char *)"delete_Volsys", _wrap_delete_Volsys, METH_VARARGS, (char *)"delete_Volsys(Volsys self)"},
+	 { (char *)"Volsys_getID", _wrap_Volsys_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the volume system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_setID", _wrap_Volsys_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the volume system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getModel", _wrap_Volsys_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getReac", _wrap_Volsys_getReac, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Reac reaction-rule object with \n"
+		"identifier string reac_id (if defined in the volume system).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getReac(reac_id)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string reac_id\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Reac\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_delReac", _wrap_Volsys_delReac, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.Reac reaction-rule object with identifier reac_id \n"
+		"(if defined) from the volume system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delReac(reac_id)\n"
+		"\n"
+		"Arguments:\n"
+		"    string reac_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getAllReacs", _wrap_Volsys_getAllReacs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Reac objects in this volume \n"
+		"system; that is all the reaction rules belonging to this volume system. \n"
+		"No duplicate member is included.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllReacs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Reac>\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getDiff", _wrap_Volsys_getDiff, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Diff diffusion-rule object with \n"
+		"identifier diff_id (if defined in the volume system).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getDiff(diff_id)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string diff_id\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Diff\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_delDiff", _wrap_Volsys_delDiff, METH_VARARGS, (char *)"\n"
+		"Remove the steps.model.Diff diffusion-rule object with identifier diff_id \n"
+		"from the volume system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    delDiff(diff_id)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string diff_id\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getAllDiffs", _wrap_Volsys_getAllDiffs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Diff diffusion-rule objects \n"
+		"defined in the volume system.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllDiffs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Diff>\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_getAllSpecs", _wrap_Volsys_getAllSpecs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Spec objects in this volume system; \n"
+		"that is all reactants, products or diffusing species in the reaction and diffusion \n"
+		"rules belonging to this volume system. No duplicate member is included.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSpecs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
+		""},
+	 { (char *)"Volsys_swigregister", Volsys_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Diff", (PyCFunction) _wrap_new_Diff, METH_VARARGS | METH_KEYWORDS, (char *)"new_Diff(string id, Volsys volsys, Spec lig, double dcst = 0.0) -> Diff"},
+	 { (char *)"delete_Diff", _wrap_delete_Diff, METH_VARARGS, (char *)"delete_Diff(Diff self)"},
+	 { (char *)"Diff_getID", _wrap_Diff_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the diffusion rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
+		""},
+	 { (char *)"Diff_setID", _wrap_Diff_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the diffusion rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Diff_getVolsys", _wrap_Diff_getVolsys, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Volsys volume system object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getVolsys()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Volsys\n"
+		"\n"
+		""},
+	 { (char *)"Diff_getModel", _wrap_Diff_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"\n"
+		""},
+	 { (char *)"Diff_getLig", _wrap_Diff_getLig, METH_VARARGS, (char *)"\n"
+		"get a reference to the steps.model.Spec species object to which this \n"
+		"diffusion rule is applied.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getLig()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Spec\n"
+		"\n"
+		""},
+	 { (char *)"Diff_setLig", _wrap_Diff_setLig, METH_VARARGS, (char *)"\n"
+		"Set a reference to the steps.model.Spec species object to which this \n"
+		"diffusion rule is applied.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setLig(lig)\n"
+		"    \n"
+		"Arguments:\n"
+		"    steps.model.Spec lig\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Diff_getDcst", _wrap_Diff_getDcst, METH_VARARGS, (char *)"\n"
+		"Get the diffusion constant for the diffusion rule, in s.i. units.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getDcst()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    float\n"
+		"\n"
+		""},
+	 { (char *)"Diff_setDcst", _wrap_Diff_setDcst, METH_VARARGS, (char *)"\n"
+		"Set the diffusion constant for the diffusion rule, in s.i. units.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setDcst(dcst)\n"
+		"    \n"
+		"Arguments:\n"
+		"    float dcst\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Diff_swigregister", Diff_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Reac", (PyCFunction) _wrap_new_Reac, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"new_Reac(string id, Volsys volsys, vector_spc lhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc rhs = std::vector< steps::model::Spec * >(), \n"
+		"    double kcst = 0.0) -> Reac\n"
+		""},
+	 { (char *)"delete_Reac", _wrap_delete_Reac, METH_VARARGS, (char *)"delete_Reac(Reac self)"},
+	 { (char *)"Reac_getID", _wrap_Reac_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the reaction rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
+		""},
+	 { (char *)"Reac_setID", _wrap_Reac_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the reaction rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Reac_getVolsys", _wrap_Reac_getVolsys, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Volsys volume system object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getVolsys()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Volsys\n"
+		"\n"
+		""},
+	 { (char *)"Reac_getModel", _wrap_Reac_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"\n"
+		""},
+	 { (char *)"Reac_getLHS", _wrap_Reac_getLHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects on the \n"
+		"left hand side of the reaction: the reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getLHS()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
+		""},
+	 { (char *)"Reac_setLHS", _wrap_Reac_setLHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects on the \n"
+		"left hand side of the reaction: the reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setLHS(lhs)\n"
+		"\n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> lhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"delete_ArgErr", _wrap_delete_ArgErr, METH_VARARGS, (char *)"delete_ArgErr(ArgErr self)"},
-	 { (char *)"ArgErr_swigregister", ArgErr_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_NotImplErr", _wrap_new_NotImplErr, METH_VARARGS, (char *)"\n"
-		"NotImplErr(string msg = \"\")\n"
-		"new_NotImplErr() -> NotImplErr\n"
+	 { (char *)"Reac_getRHS", _wrap_Reac_getRHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects on the \n"
+		"right hand side of the reaction: the reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getRHS()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"delete_NotImplErr", _wrap_delete_NotImplErr, METH_VARARGS, (char *)"delete_NotImplErr(NotImplErr self)"},
-	 { (char *)"NotImplErr_swigregister", NotImplErr_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_str_iterator", _wrap_vector_str_iterator, METH_VARARGS, (char *)"vector_str_iterator(vector_str self) -> SwigPyIterator"},
-	 { (char *)"vector_str___nonzero__", _wrap_vector_str___nonzero__, METH_VARARGS, (char *)"vector_str___nonzero__(vector_str self) -> bool"},
-	 { (char *)"vector_str___bool__", _wrap_vector_str___bool__, METH_VARARGS, (char *)"vector_str___bool__(vector_str self) -> bool"},
-	 { (char *)"vector_str___len__", _wrap_vector_str___len__, METH_VARARGS, (char *)"vector_str___len__(vector_str self) -> size_type"},
-	 { (char *)"vector_str_pop", _wrap_vector_str_pop, METH_VARARGS, (char *)"vector_str_pop(vector_str self) -> value_type"},
-	 { (char *)"vector_str___getslice__", _wrap_vector_str___getslice__, METH_VARARGS, (char *)"vector_str___getslice__(vector_str self, difference_type i, difference_type j) -> vector_str"},
-	 { (char *)"vector_str___setslice__", _wrap_vector_str___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_str___setslice__(vector_str self, difference_type i, difference_type j, \n"
-		"    vector_str v)\n"
+	 { (char *)"Reac_setRHS", _wrap_Reac_setRHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects on the \n"
+		"right hand side of the reaction: the reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setRHS(rhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> rhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_str___delslice__", _wrap_vector_str___delslice__, METH_VARARGS, (char *)"vector_str___delslice__(vector_str self, difference_type i, difference_type j)"},
-	 { (char *)"vector_str___delitem__", _wrap_vector_str___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_str___delitem__(vector_str self, PySliceObject slice)\n"
+	 { (char *)"Reac_getOrder", _wrap_Reac_getOrder, METH_VARARGS, (char *)"\n"
+		"Returns the order of this reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getOrder()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    int\n"
+		"\n"
 		""},
-	 { (char *)"vector_str___getitem__", _wrap_vector_str___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_str\n"
-		"vector_str___getitem__(vector_str self, difference_type i) -> value_type\n"
+	 { (char *)"Reac_getKcst", _wrap_Reac_getKcst, METH_VARARGS, (char *)"\n"
+		"Get the kinetic reaction rate constant, in s.i. units, \n"
+		"where the actual units depend on the order of the reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getKcst()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    float\n"
+		"\n"
 		""},
-	 { (char *)"vector_str___setitem__", _wrap_vector_str___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_str v)\n"
-		"vector_str___setitem__(vector_str self, difference_type i, value_type x)\n"
+	 { (char *)"Reac_setKcst", _wrap_Reac_setKcst, METH_VARARGS, (char *)"\n"
+		"Set the kinetic reaction rate constant, in s.i. units, \n"
+		"where the actual units depend on the order of the reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setKcst(kcst)\n"
+		"\n"
+		"Arguments:\n"
+		"    float kcst\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_str_append", _wrap_vector_str_append, METH_VARARGS, (char *)"vector_str_append(vector_str self, value_type x)"},
-	 { (char *)"vector_str_empty", _wrap_vector_str_empty, METH_VARARGS, (char *)"vector_str_empty(vector_str self) -> bool"},
-	 { (char *)"vector_str_size", _wrap_vector_str_size, METH_VARARGS, (char *)"vector_str_size(vector_str self) -> size_type"},
-	 { (char *)"vector_str_clear", _wrap_vector_str_clear, METH_VARARGS, (char *)"vector_str_clear(vector_str self)"},
-	 { (char *)"vector_str_swap", _wrap_vector_str_swap, METH_VARARGS, (char *)"vector_str_swap(vector_str self, vector_str v)"},
-	 { (char *)"vector_str_get_allocator", _wrap_vector_str_get_allocator, METH_VARARGS, (char *)"vector_str_get_allocator(vector_str self) -> allocator_type"},
-	 { (char *)"vector_str_begin", _wrap_vector_str_begin, METH_VARARGS, (char *)"vector_str_begin(vector_str self) -> const_iterator"},
-	 { (char *)"vector_str_end", _wrap_vector_str_end, METH_VARARGS, (char *)"vector_str_end(vector_str self) -> const_iterator"},
-	 { (char *)"vector_str_rbegin", _wrap_vector_str_rbegin, METH_VARARGS, (char *)"vector_str_rbegin(vector_str self) -> const_reverse_iterator"},
-	 { (char *)"vector_str_rend", _wrap_vector_str_rend, METH_VARARGS, (char *)"vector_str_rend(vector_str self) -> const_reverse_iterator"},
-	 { (char *)"vector_str_pop_back", _wrap_vector_str_pop_back, METH_VARARGS, (char *)"vector_str_pop_back(vector_str self)"},
-	 { (char *)"vector_str_erase", _wrap_vector_str_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_str_erase(vector_str self, iterator first, iterator last) -> iterator\n"
+	 { (char *)"Reac_getAllSpecs", _wrap_Reac_getAllSpecs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Spec species objects in \n"
+		"the reaction; that is all reactants and products. No duplicate member \n"
+		"is included.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSpecs()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"new_vector_str", _wrap_new_vector_str, METH_VARARGS, (char *)"\n"
-		"vector_str()\n"
-		"vector_str(vector_str arg0)\n"
-		"vector_str(size_type size)\n"
-		"new_vector_str(size_type size, value_type value) -> vector_str\n"
+	 { (char *)"Reac_swigregister", Reac_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_SReac", (PyCFunction) _wrap_new_SReac, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"new_SReac(string id, Surfsys surfsys, vector_spc olhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc ilhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc slhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc irhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc srhs = std::vector< steps::model::Spec * >(), \n"
+		"    vector_spc orhs = std::vector< steps::model::Spec * >(), \n"
+		"    double kcst = 0.0) -> SReac\n"
 		""},
-	 { (char *)"vector_str_push_back", _wrap_vector_str_push_back, METH_VARARGS, (char *)"vector_str_push_back(vector_str self, value_type x)"},
-	 { (char *)"vector_str_front", _wrap_vector_str_front, METH_VARARGS, (char *)"vector_str_front(vector_str self) -> value_type"},
-	 { (char *)"vector_str_back", _wrap_vector_str_back, METH_VARARGS, (char *)"vector_str_back(vector_str self) -> value_type"},
-	 { (char *)"vector_str_assign", _wrap_vector_str_assign, METH_VARARGS, (char *)"vector_str_assign(vector_str self, size_type n, value_type x)"},
-	 { (char *)"vector_str_resize", _wrap_vector_str_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_str_resize(vector_str self, size_type new_size, value_type x)\n"
+	 { (char *)"delete_SReac", _wrap_delete_SReac, METH_VARARGS, (char *)"delete_SReac(SReac self)"},
+	 { (char *)"SReac_getID", _wrap_SReac_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the surface reaction rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
 		""},
-	 { (char *)"vector_str_insert", _wrap_vector_str_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_str_insert(vector_str self, iterator pos, size_type n, value_type x)\n"
+	 { (char *)"SReac_setID", _wrap_SReac_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the surface reaction rule.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setID(name)\n"
+		"    \n"
+		"Arguments:\n"
+		"    string name\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_str_reserve", _wrap_vector_str_reserve, METH_VARARGS, (char *)"vector_str_reserve(vector_str self, size_type n)"},
-	 { (char *)"vector_str_capacity", _wrap_vector_str_capacity, METH_VARARGS, (char *)"vector_str_capacity(vector_str self) -> size_type"},
-	 { (char *)"delete_vector_str", _wrap_delete_vector_str, METH_VARARGS, (char *)"delete_vector_str(vector_str self)"},
-	 { (char *)"vector_str_swigregister", vector_str_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_spc_iterator", _wrap_vector_spc_iterator, METH_VARARGS, (char *)"vector_spc_iterator(vector_spc self) -> SwigPyIterator"},
-	 { (char *)"vector_spc___nonzero__", _wrap_vector_spc___nonzero__, METH_VARARGS, (char *)"vector_spc___nonzero__(vector_spc self) -> bool"},
-	 { (char *)"vector_spc___bool__", _wrap_vector_spc___bool__, METH_VARARGS, (char *)"vector_spc___bool__(vector_spc self) -> bool"},
-	 { (char *)"vector_spc___len__", _wrap_vector_spc___len__, METH_VARARGS, (char *)"vector_spc___len__(vector_spc self) -> size_type"},
-	 { (char *)"vector_spc_pop", _wrap_vector_spc_pop, METH_VARARGS, (char *)"vector_spc_pop(vector_spc self) -> value_type"},
-	 { (char *)"vector_spc___getslice__", _wrap_vector_spc___getslice__, METH_VARARGS, (char *)"vector_spc___getslice__(vector_spc self, difference_type i, difference_type j) -> vector_spc"},
-	 { (char *)"vector_spc___setslice__", _wrap_vector_spc___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_spc___setslice__(vector_spc self, difference_type i, difference_type j, \n"
-		"    vector_spc v)\n"
+	 { (char *)"SReac_getSurfsys", _wrap_SReac_getSurfsys, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Surfsys surface system object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getSurfsys()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Surfsys\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc___delslice__", _wrap_vector_spc___delslice__, METH_VARARGS, (char *)"vector_spc___delslice__(vector_spc self, difference_type i, difference_type j)"},
-	 { (char *)"vector_spc___delitem__", _wrap_vector_spc___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_spc___delitem__(vector_spc self, PySliceObject slice)\n"
+	 { (char *)"SReac_getModel", _wrap_SReac_getModel, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.model.Model container object.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getModel()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.model.Model\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc___getitem__", _wrap_vector_spc___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_spc\n"
-		"vector_spc___getitem__(vector_spc self, difference_type i) -> value_type\n"
+	 { (char *)"SReac_getInner", _wrap_SReac_getInner, METH_VARARGS, (char *)"Obsolete"},
+	 { (char *)"SReac_getOuter", _wrap_SReac_getOuter, METH_VARARGS, (char *)"Obsolete"},
+	 { (char *)"SReac_getOLHS", _wrap_SReac_getOLHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the left hand side outer volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getOLHS()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc___setitem__", _wrap_vector_spc___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_spc v)\n"
-		"vector_spc___setitem__(vector_spc self, difference_type i, value_type x)\n"
+	 { (char *)"SReac_setOLHS", _wrap_SReac_setOLHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects; \n"
+		"the left hand side outer volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setOLHS(olhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec) olhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc_append", _wrap_vector_spc_append, METH_VARARGS, (char *)"vector_spc_append(vector_spc self, value_type x)"},
-	 { (char *)"vector_spc_empty", _wrap_vector_spc_empty, METH_VARARGS, (char *)"vector_spc_empty(vector_spc self) -> bool"},
-	 { (char *)"vector_spc_size", _wrap_vector_spc_size, METH_VARARGS, (char *)"vector_spc_size(vector_spc self) -> size_type"},
-	 { (char *)"vector_spc_clear", _wrap_vector_spc_clear, METH_VARARGS, (char *)"vector_spc_clear(vector_spc self)"},
-	 { (char *)"vector_spc_swap", _wrap_vector_spc_swap, METH_VARARGS, (char *)"vector_spc_swap(vector_spc self, vector_spc v)"},
-	 { (char *)"vector_spc_get_allocator", _wrap_vector_spc_get_allocator, METH_VARARGS, (char *)"vector_spc_get_allocator(vector_spc self) -> allocator_type"},
-	 { (char *)"vector_spc_begin", _wrap_vector_spc_begin, METH_VARARGS, (char *)"vector_spc_begin(vector_spc self) -> const_iterator"},
-	 { (char *)"vector_spc_end", _wrap_vector_spc_end, METH_VARARGS, (char *)"vector_spc_end(vector_spc self) -> const_iterator"},
-	 { (char *)"vector_spc_rbegin", _wrap_vector_spc_rbegin, METH_VARARGS, (char *)"vector_spc_rbegin(vector_spc self) -> const_reverse_iterator"},
-	 { (char *)"vector_spc_rend", _wrap_vector_spc_rend, METH_VARARGS, (char *)"vector_spc_rend(vector_spc self) -> const_reverse_iterator"},
-	 { (char *)"vector_spc_pop_back", _wrap_vector_spc_pop_back, METH_VARARGS, (char *)"vector_spc_pop_back(vector_spc self)"},
-	 { (char *)"vector_spc_erase", _wrap_vector_spc_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_spc_erase(vector_spc self, iterator first, iterator last) -> iterator\n"
+	 { (char *)"SReac_getILHS", _wrap_SReac_getILHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the left hand side inner volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getILHS()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"new_vector_spc", _wrap_new_vector_spc, METH_VARARGS, (char *)"\n"
-		"vector_spc()\n"
-		"vector_spc(vector_spc arg0)\n"
-		"vector_spc(size_type size)\n"
-		"new_vector_spc(size_type size, value_type value) -> vector_spc\n"
+	 { (char *)"SReac_setILHS", _wrap_SReac_setILHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects; \n"
+		"the left hand side inner volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setILHS(ilhs)\n"
+		"\n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> ilhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc_push_back", _wrap_vector_spc_push_back, METH_VARARGS, (char *)"vector_spc_push_back(vector_spc self, value_type x)"},
-	 { (char *)"vector_spc_front", _wrap_vector_spc_front, METH_VARARGS, (char *)"vector_spc_front(vector_spc self) -> value_type"},
-	 { (char *)"vector_spc_back", _wrap_vector_spc_back, METH_VARARGS, (char *)"vector_spc_back(vector_spc self) -> value_type"},
-	 { (char *)"vector_spc_assign", _wrap_vector_spc_assign, METH_VARARGS, (char *)"vector_spc_assign(vector_spc self, size_type n, value_type x)"},
-	 { (char *)"vector_spc_resize", _wrap_vector_spc_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_spc_resize(vector_spc self, size_type new_size, value_type x)\n"
+	 { (char *)"SReac_getSLHS", _wrap_SReac_getSLHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the left hand side surface reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getSLHS()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc_insert", _wrap_vector_spc_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_spc_insert(vector_spc self, iterator pos, size_type n, value_type x)\n"
+	 { (char *)"SReac_setSLHS", _wrap_SReac_setSLHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects; \n"
+		"the left hand side surface reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setSLHS(slhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> slhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_spc_reserve", _wrap_vector_spc_reserve, METH_VARARGS, (char *)"vector_spc_reserve(vector_spc self, size_type n)"},
-	 { (char *)"vector_spc_capacity", _wrap_vector_spc_capacity, METH_VARARGS, (char *)"vector_spc_capacity(vector_spc self) -> size_type"},
-	 { (char *)"delete_vector_spc", _wrap_delete_vector_spc, METH_VARARGS, (char *)"delete_vector_spc(vector_spc self)"},
-	 { (char *)"vector_spc_swigregister", vector_spc_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_rec_iterator", _wrap_vector_rec_iterator, METH_VARARGS, (char *)"vector_rec_iterator(vector_rec self) -> SwigPyIterator"},
-	 { (char *)"vector_rec___nonzero__", _wrap_vector_rec___nonzero__, METH_VARARGS, (char *)"vector_rec___nonzero__(vector_rec self) -> bool"},
-	 { (char *)"vector_rec___bool__", _wrap_vector_rec___bool__, METH_VARARGS, (char *)"vector_rec___bool__(vector_rec self) -> bool"},
-	 { (char *)"vector_rec___len__", _wrap_vector_rec___len__, METH_VARARGS, (char *)"vector_rec___len__(vector_rec self) -> size_type"},
-	 { (char *)"vector_rec_pop", _wrap_vector_rec_pop, METH_VARARGS, (char *)"vector_rec_pop(vector_rec self) -> value_type"},
-	 { (char *)"vector_rec___getslice__", _wrap_vector_rec___getslice__, METH_VARARGS, (char *)"vector_rec___getslice__(vector_rec self, difference_type i, difference_type j) -> vector_rec"},
-	 { (char *)"vector_rec___setslice__", _wrap_vector_rec___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_rec___setslice__(vector_rec self, difference_type i, difference_type j, \n"
-		"    vector_rec v)\n"
+	 { (char *)"SReac_getIRHS", _wrap_SReac_getIRHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the right hand side inner volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getIRHS()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"vector_rec___delslice__", _wrap_vector_rec___delslice__, METH_VARARGS, (char *)"vector_rec___delslice__(vector_rec self, difference_type i, difference_type j)"},
-	 { (char *)"vector_rec___delitem__", _wrap_vector_rec___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_rec___delitem__(vector_rec self, PySliceObject slice)\n"
+	 { (char *)"SReac_setIRHS", _wrap_SReac_setIRHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects; \n"
+		"the right hand side inner volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setIRHS(irhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> irhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_rec___getitem__", _wrap_vector_rec___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_rec\n"
-		"vector_rec___getitem__(vector_rec self, difference_type i) -> value_type\n"
+	 { (char *)"SReac_getSRHS", _wrap_SReac_getSRHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the right hand side surface reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getSRHS()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"vector_rec___setitem__", _wrap_vector_rec___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_rec v)\n"
-		"vector_rec___setitem__(vector_rec self, difference_type i, value_type x)\n"
+	 { (char *)"SReac_setSRHS", _wrap_SReac_setSRHS, METH_VARARGS, (char *)"\n"
+		"Set a list of references to steps.model.Spec species objects; \n"
+		"the right hand side surface reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setSRHS(srhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> srhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"SReac_getORHS", _wrap_SReac_getORHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the right hand side outer volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getORHS()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
+		""},
+	 { (char *)"SReac_setORHS", _wrap_SReac_setORHS, METH_VARARGS, (char *)"\n"
+		"Get a list of references to steps.model.Spec species objects; \n"
+		"the right hand side outer volume reactants.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setORHS(orhs)\n"
+		"    \n"
+		"Arguments:\n"
+		"    list<steps.model.Spec> orhs\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"SReac_getOrder", _wrap_SReac_getOrder, METH_VARARGS, (char *)"\n"
+		"Returns the order of this surface reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getOrder()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    int\n"
+		"\n"
+		""},
+	 { (char *)"SReac_getKcst", _wrap_SReac_getKcst, METH_VARARGS, (char *)"\n"
+		"Get the kinetic reaction rate constant, in s.i. units, \n"
+		"where the actual units depend on the order of the surface reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getKcst()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    float\n"
+		"\n"
+		""},
+	 { (char *)"SReac_setKcst", _wrap_SReac_setKcst, METH_VARARGS, (char *)"\n"
+		"Set the kinetic reaction rate constant, in s.i. units, \n"
+		"where the actual units depend on the order of the surface reaction.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setKcst(kcst)\n"
+		"    \n"
+		"Arguments:\n"
+		"    float kcst\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_rec_append", _wrap_vector_rec_append, METH_VARARGS, (char *)"vector_rec_append(vector_rec self, value_type x)"},
-	 { (char *)"vector_rec_empty", _wrap_vector_rec_empty, METH_VARARGS, (char *)"vector_rec_empty(vector_rec self) -> bool"},
-	 { (char *)"vector_rec_size", _wrap_vector_rec_size, METH_VARARGS, (char *)"vector_rec_size(vector_rec self) -> size_type"},
-	 { (char *)"vector_rec_clear", _wrap_vector_rec_clear, METH_VARARGS, (char *)"vector_rec_clear(vector_rec self)"},
-	 { (char *)"vector_rec_swap", _wrap_vector_rec_swap, METH_VARARGS, (char *)"vector_rec_swap(vector_rec self, vector_rec v)"},
-	 { (char *)"vector_rec_get_allocator", _wrap_vector_rec_get_allocator, METH_VARARGS, (char *)"vector_rec_get_allocator(vector_rec self) -> allocator_type"},
-	 { (char *)"vector_rec_begin", _wrap_vector_rec_begin, METH_VARARGS, (char *)"vector_rec_begin(vector_rec self) -> const_iterator"},
-	 { (char *)"vector_rec_end", _wrap_vector_rec_end, METH_VARARGS, (char *)"vector_rec_end(vector_rec self) -> const_iterator"},
-	 { (char *)"vector_rec_rbegin", _wrap_vector_rec_rbegin, METH_VARARGS, (char *)"vector_rec_rbegin(vector_rec self) -> const_reverse_iterator"},
-	 { (char *)"vector_rec_rend", _wrap_vector_rec_rend, METH_VARARGS, (char *)"vector_rec_rend(vector_rec self) -> const_reverse_iterator"},
-	 { (char *)"vector_rec_pop_back", _wrap_vector_rec_pop_back, METH_VARARGS, (char *)"vector_rec_pop_back(vector_rec self)"},
-	 { (char *)"vector_rec_erase", _wrap_vector_rec_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_rec_erase(vector_rec self, iterator first, iterator last) -> iterator\n"
+	 { (char *)"SReac_getAllSpecs", _wrap_SReac_getAllSpecs, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.model.Spec species objects in \n"
+		"the surface reaction; that is all reactants and products. No duplicate member \n"
+		"is included.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllSpecs()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    list<steps.model.Spec>\n"
+		"\n"
 		""},
-	 { (char *)"new_vector_rec", _wrap_new_vector_rec, METH_VARARGS, (char *)"\n"
-		"vector_rec()\n"
-		"vector_rec(vector_rec arg0)\n"
-		"vector_rec(size_type size)\n"
-		"new_vector_rec(size_type size, value_type value) -> vector_rec\n"
+	 { (char *)"SReac_swigregister", SReac_swigregister, METH_VARARGS, NULL},
+	 { (char *)"set_str_iterator", _wrap_set_str_iterator, METH_VARARGS, (char *)"set_str_iterator(set_str self) -> SwigPyIterator"},
+	 { (char *)"set_str___nonzero__", _wrap_set_str___nonzero__, METH_VARARGS, (char *)"set_str___nonzero__(set_str self) -> bool"},
+	 { (char *)"set_str___bool__", _wrap_set_str___bool__, METH_VARARGS, (char *)"set_str___bool__(set_str self) -> bool"},
+	 { (char *)"set_str___len__", _wrap_set_str___len__, METH_VARARGS, (char *)"set_str___len__(set_str self) -> size_type"},
+	 { (char *)"set_str_append", _wrap_set_str_append, METH_VARARGS, (char *)"set_str_append(set_str self, value_type x)"},
+	 { (char *)"set_str___contains__", _wrap_set_str___contains__, METH_VARARGS, (char *)"set_str___contains__(set_str self, value_type x) -> bool"},
+	 { (char *)"set_str___getitem__", _wrap_set_str___getitem__, METH_VARARGS, (char *)"set_str___getitem__(set_str self, difference_type i) -> value_type"},
+	 { (char *)"new_set_str", _wrap_new_set_str, METH_VARARGS, (char *)"\n"
+		"set_str(std::less<(std::string)> arg0)\n"
+		"set_str()\n"
+		"new_set_str(set_str arg0) -> set_str\n"
 		""},
-	 { (char *)"vector_rec_push_back", _wrap_vector_rec_push_back, METH_VARARGS, (char *)"vector_rec_push_back(vector_rec self, value_type x)"},
-	 { (char *)"vector_rec_front", _wrap_vector_rec_front, METH_VARARGS, (char *)"vector_rec_front(vector_rec self) -> value_type"},
-	 { (char *)"vector_rec_back", _wrap_vector_rec_back, METH_VARARGS, (char *)"vector_rec_back(vector_rec self) -> value_type"},
-	 { (char *)"vector_rec_assign", _wrap_vector_rec_assign, METH_VARARGS, (char *)"vector_rec_assign(vector_rec self, size_type n, value_type x)"},
-	 { (char *)"vector_rec_resize", _wrap_vector_rec_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_rec_resize(vector_rec self, size_type new_size, value_type x)\n"
+	 { (char *)"set_str_empty", _wrap_set_str_empty, METH_VARARGS, (char *)"set_str_empty(set_str self) -> bool"},
+	 { (char *)"set_str_size", _wrap_set_str_size, METH_VARARGS, (char *)"set_str_size(set_str self) -> size_type"},
+	 { (char *)"set_str_clear", _wrap_set_str_clear, METH_VARARGS, (char *)"set_str_clear(set_str self)"},
+	 { (char *)"set_str_swap", _wrap_set_str_swap, METH_VARARGS, (char *)"set_str_swap(set_str self, set_str v)"},
+	 { (char *)"set_str_count", _wrap_set_str_count, METH_VARARGS, (char *)"set_str_count(set_str self, key_type x) -> size_type"},
+	 { (char *)"set_str_begin", _wrap_set_str_begin, METH_VARARGS, (char *)"set_str_begin(set_str self) -> iterator"},
+	 { (char *)"set_str_end", _wrap_set_str_end, METH_VARARGS, (char *)"set_str_end(set_str self) -> iterator"},
+	 { (char *)"set_str_rbegin", _wrap_set_str_rbegin, METH_VARARGS, (char *)"set_str_rbegin(set_str self) -> reverse_iterator"},
+	 { (char *)"set_str_rend", _wrap_set_str_rend, METH_VARARGS, (char *)"set_str_rend(set_str self) -> reverse_iterator"},
+	 { (char *)"set_str_erase", _wrap_set_str_erase, METH_VARARGS, (char *)"\n"
+		"erase(key_type x) -> size_type\n"
+		"erase(iterator pos)\n"
+		"set_str_erase(set_str self, iterator first, iterator last)\n"
 		""},
-	 { (char *)"vector_rec_insert", _wrap_vector_rec_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_rec_insert(vector_rec self, iterator pos, size_type n, value_type x)\n"
+	 { (char *)"set_str_find", _wrap_set_str_find, METH_VARARGS, (char *)"set_str_find(set_str self, key_type x) -> iterator"},
+	 { (char *)"set_str_lower_bound", _wrap_set_str_lower_bound, METH_VARARGS, (char *)"set_str_lower_bound(set_str self, key_type x) -> iterator"},
+	 { (char *)"set_str_upper_bound", _wrap_set_str_upper_bound, METH_VARARGS, (char *)"set_str_upper_bound(set_str self, key_type x) -> iterator"},
+	 { (char *)"set_str_equal_range", _wrap_set_str_equal_range, METH_VARARGS, (char *)"set_str_equal_range(set_str self, key_type x) -> std::pair<(std::set<(std::string)>::iterator,std::set<(std::string)>::iterator)>"},
+	 { (char *)"set_str_insert", _wrap_set_str_insert, METH_VARARGS, (char *)"set_str_insert(set_str self, value_type __x) -> std::pair<(std::set<(std::string)>::iterator,bool)>"},
+	 { (char *)"delete_set_str", _wrap_delete_set_str, METH_VARARGS, (char *)"delete_set_str(set_str self)"},
+	 { (char *)"set_str_swigregister", set_str_swigregister, METH_VARARGS, NULL},
+	 { (char *)"set_ptc_iterator", _wrap_set_ptc_iterator, METH_VARARGS, (char *)"set_ptc_iterator(set_ptc self) -> SwigPyIterator"},
+	 { (char *)"set_ptc___nonzero__", _wrap_set_ptc___nonzero__, METH_VARARGS, (char *)"set_ptc___nonzero__(set_ptc self) -> bool"},
+	 { (char *)"set_ptc___bool__", _wrap_set_ptc___bool__, METH_VARARGS, (char *)"set_ptc___bool__(set_ptc self) -> bool"},
+	 { (char *)"set_ptc___len__", _wrap_set_ptc___len__, METH_VARARGS, (char *)"set_ptc___len__(set_ptc self) -> size_type"},
+	 { (char *)"set_ptc_append", _wrap_set_ptc_append, METH_VARARGS, (char *)"set_ptc_append(set_ptc self, value_type x)"},
+	 { (char *)"set_ptc___contains__", _wrap_set_ptc___contains__, METH_VARARGS, (char *)"set_ptc___contains__(set_ptc self, value_type x) -> bool"},
+	 { (char *)"set_ptc___getitem__", _wrap_set_ptc___getitem__, METH_VARARGS, (char *)"set_ptc___getitem__(set_ptc self, difference_type i) -> value_type"},
+	 { (char *)"new_set_ptc", _wrap_new_set_ptc, METH_VARARGS, (char *)"\n"
+		"set_ptc(std::less<(p.steps::wm::Patch)> arg0)\n"
+		"set_ptc()\n"
+		"new_set_ptc(set_ptc arg0) -> set_ptc\n"
 		""},
-	 { (char *)"vector_rec_reserve", _wrap_vector_rec_reserve, METH_VARARGS, (char *)"vector_rec_reserve(vector_rec self, size_type n)"},
-	 { (char *)"vector_rec_capacity", _wrap_vector_rec_capacity, METH_VARARGS, (char *)"vector_rec_capacity(vector_rec self) -> size_type"},
-	 { (char *)"delete_vector_rec", _wrap_delete_vector_rec, METH_VARARGS, (char *)"delete_vector_rec(vector_rec self)"},
-	 { (char *)"vector_rec_swigregister", vector_rec_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_src_iterator", _wrap_vector_src_iterator, METH_VARARGS, (char *)"vector_src_iterator(vector_src self) -> SwigPyIterator"},
-	 { (char *)"vector_src___nonzero__", _wrap_vector_src___nonzero__, METH_VARARGS, (char *)"vector_src___nonzero__(vector_src self) -> bool"},
-	 { (char *)"vector_src___bool__", _wrap_vector_src___bool__, METH_VARARGS, (char *)"vector_src___bool__(vector_src self) -> bool"},
-	 { (char *)"vector_src___len__", _wrap_vector_src___len__, METH_VARARGS, (char *)"vector_src___len__(vector_src self) -> size_type"},
-	 { (char *)"vector_src_pop", _wrap_vector_src_pop, METH_VARARGS, (char *)"vector_src_pop(vector_src self) -> value_type"},
-	 { (char *)"vector_src___getslice__", _wrap_vector_src___getslice__, METH_VARARGS, (char *)"vector_src___getslice__(vector_src self, difference_type i, difference_type j) -> vector_src"},
-	 { (char *)"vector_src___setslice__", _wrap_vector_src___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_src___setslice__(vector_src self, difference_type i, difference_type j, \n"
-		"    vector_src v)\n"
+	 { (char *)"set_ptc_empty", _wrap_set_ptc_empty, METH_VARARGS, (char *)"set_ptc_empty(set_ptc self) -> bool"},
+	 { (char *)"set_ptc_size", _wrap_set_ptc_size, METH_VARARGS, (char *)"set_ptc_size(set_ptc self) -> size_type"},
+	 { (char *)"set_ptc_clear", _wrap_set_ptc_clear, METH_VARARGS, (char *)"set_ptc_clear(set_ptc self)"},
+	 { (char *)"set_ptc_swap", _wrap_set_ptc_swap, METH_VARARGS, (char *)"set_ptc_swap(set_ptc self, set_ptc v)"},
+	 { (char *)"set_ptc_count", _wrap_set_ptc_count, METH_VARARGS, (char *)"set_ptc_count(set_ptc self, key_type x) -> size_type"},
+	 { (char *)"set_ptc_begin", _wrap_set_ptc_begin, METH_VARARGS, (char *)"set_ptc_begin(set_ptc self) -> iterator"},
+	 { (char *)"set_ptc_end", _wrap_set_ptc_end, METH_VARARGS, (char *)"set_ptc_end(set_ptc self) -> iterator"},
+	 { (char *)"set_ptc_rbegin", _wrap_set_ptc_rbegin, METH_VARARGS, (char *)"set_ptc_rbegin(set_ptc self) -> reverse_iterator"},
+	 { (char *)"set_ptc_rend", _wrap_set_ptc_rend, METH_VARARGS, (char *)"set_ptc_rend(set_ptc self) -> reverse_iterator"},
+	 { (char *)"set_ptc_erase", _wrap_set_ptc_erase, METH_VARARGS, (char *)"\n"
+		"erase(key_type x) -> size_type\n"
+		"erase(iterator pos)\n"
+		"set_ptc_erase(set_ptc self, iterator first, iterator last)\n"
 		""},
-	 { (char *)"vector_src___delslice__", _wrap_vector_src___delslice__, METH_VARARGS, (char *)"vector_src___delslice__(vector_src self, difference_type i, difference_type j)"},
-	 { (char *)"vector_src___delitem__", _wrap_vector_src___delitem__, METH_VARARGS, (char *)"\n"
+	 { (char *)"set_ptc_find", _wrap_set_ptc_find, METH_VARARGS, (char *)"set_ptc_find(set_ptc self, key_type x) -> iterator"},
+	 { (char *)"set_ptc_lower_bound", _wrap_set_ptc_lower_bound, METH_VARARGS, (char *)"set_ptc_lower_bound(set_ptc self, key_type x) -> iterator"},
+	 { (char *)"set_ptc_upper_bound", _wrap_set_ptc_upper_bound, METH_VARARGS, (char *)"set_ptc_upper_bound(set_ptc self, key_type x) -> iterator"},
+	 { (char *)"set_ptc_equal_range", _wrap_set_ptc_equal_range, METH_VARARGS, (char *)"set_ptc_equal_range(set_ptc self, key_type x) -> std::pair<(std::set<(p.steps::wm::Patch)>::iterator,std::set<(p.steps::wm::Patch)>::iterator)>"},
+	 { (char *)"set_ptc_insert", _wrap_set_ptc_insert, METH_VARARGS, (char *)"set_ptc_insert(set_ptc self, value_type __x) -> std::pair<(std::set<(p.steps::wm::Patch)>::iterator,bool)>"},
+	 { (char *)"delete_set_ptc", _wrap_delete_set_ptc, METH_VARARGS, (char *)"delete_set_ptc(set_ptc self)"},
+	 { (char *)"set_ptc_swigregister", set_ptc_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_ptc_iterator", _wrap_vector_ptc_iterator, METH_VARARGS, (char *)"vector_ptc_iterator(vector_ptc self) -> SwigPyIterator"},
+	 { (char *)"vector_ptc___nonzero__", _wrap_vector_ptc___nonzero__, METH_VARARGS, (char *)"vector_ptc___nonzero__(vector_ptc self) -> bool"},
+	 { (char *)"vector_ptc___bool__", _wrap_vector_ptc___bool__, METH_VARARGS, (char *)"vector_ptc___bool__(vector_ptc self) -> bool"},
+	 { (char *)"vector_ptc___len__", _wrap_vector_ptc___len__, METH_VARARGS, (char *)"vector_ptc___len__(vector_ptc self) -> size_type"},
+	 { (char *)"vector_ptc_pop", _wrap_vector_ptc_pop, METH_VARARGS, (char *)"vector_ptc_pop(vector_ptc self) -> value_type"},
+	 { (char *)"vector_ptc___getslice__", _wrap_vector_ptc___getslice__, METH_VARARGS, (char *)"vector_ptc___getslice__(vector_ptc self, difference_type i, difference_type j) -> vector_ptc"},
+	 { (char *)"vector_ptc___setslice__", _wrap_vector_ptc___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_ptc___setslice__(vector_ptc self, difference_type i, difference_type j, \n"
+		"    vector_ptc v)\n"
+		""},
+	 { (char *)"vector_ptc___delslice__", _wrap_vector_ptc___delslice__, METH_VARARGS, (char *)"vector_ptc___delslice__(vector_ptc self, difference_type i, difference_type j)"},
+	 { (char *)"vector_ptc___delitem__", _wrap_vector_ptc___delitem__, METH_VARARGS, (char *)"\n"
 		"__delitem__(difference_type i)\n"
-		"vector_src___delitem__(vector_src self, PySliceObject slice)\n"
+		"vector_ptc___delitem__(vector_ptc self, PySliceObject slice)\n"
 		""},
-	 { (char *)"vector_src___getitem__", _wrap_vector_src___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_src\n"
-		"vector_src___getitem__(vector_src self, difference_type i) -> value_type\n"
+	 { (char *)"vector_ptc___getitem__", _wrap_vector_ptc___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_ptc\n"
+		"vector_ptc___getitem__(vector_ptc self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"vector_src___setitem__", _wrap_vector_src___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_src v)\n"
-		"vector_src___setitem__(vector_src self, difference_type i, value_type x)\n"
+	 { (char *)"vector_ptc___setitem__", _wrap_vector_ptc___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_ptc v)\n"
+		"vector_ptc___setitem__(vector_ptc self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"vector_src_append", _wrap_vector_src_append, METH_VARARGS, (char *)"vector_src_append(vector_src self, value_type x)"},
-	 { (char *)"vector_src_empty", _wrap_vector_src_empty, METH_VARARGS, (char *)"vector_src_empty(vector_src self) -> bool"},
-	 { (char *)"vector_src_size", _wrap_vector_src_size, METH_VARARGS, (char *)"vector_src_size(vector_src self) -> size_type"},
-	 { (char *)"vector_src_clear", _wrap_vector_src_clear, METH_VARARGS, (char *)"vector_src_clear(vector_src self)"},
-	 { (char *)"vector_src_swap", _wrap_vector_src_swap, METH_VARARGS, (char *)"vector_src_swap(vector_src self, vector_src v)"},
-	 { (char *)"vector_src_get_allocator", _wrap_vector_src_get_allocator, METH_VARARGS, (char *)"vector_src_get_allocator(vector_src self) -> allocator_type"},
-	 { (char *)"vector_src_begin", _wrap_vector_src_begin, METH_VARARGS, (char *)"vector_src_begin(vector_src self) -> const_iterator"},
-	 { (char *)"vector_src_end", _wrap_vector_src_end, METH_VARARGS, (char *)"vector_src_end(vector_src self) -> const_iterator"},
-	 { (char *)"vector_src_rbegin", _wrap_vector_src_rbegin, METH_VARARGS, (char *)"vector_src_rbegin(vector_src self) -> const_reverse_iterator"},
-	 { (char *)"vector_src_rend", _wrap_vector_src_rend, METH_VARARGS, (char *)"vector_src_rend(vector_src self) -> const_reverse_iterator"},
-	 { (char *)"vector_src_pop_back", _wrap_vector_src_pop_back, METH_VARARGS, (char *)"vector_src_pop_back(vector_src self)"},
-	 { (char *)"vector_src_erase", _wrap_vector_src_erase, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_ptc_append", _wrap_vector_ptc_append, METH_VARARGS, (char *)"vector_ptc_append(vector_ptc self, value_type x)"},
+	 { (char *)"vector_ptc_empty", _wrap_vector_ptc_empty, METH_VARARGS, (char *)"vector_ptc_empty(vector_ptc self) -> bool"},
+	 { (char *)"vector_ptc_size", _wrap_vector_ptc_size, METH_VARARGS, (char *)"vector_ptc_size(vector_ptc self) -> size_type"},
+	 { (char *)"vector_ptc_clear", _wrap_vector_ptc_clear, METH_VARARGS, (char *)"vector_ptc_clear(vector_ptc self)"},
+	 { (char *)"vector_ptc_swap", _wrap_vector_ptc_swap, METH_VARARGS, (char *)"vector_ptc_swap(vector_ptc self, vector_ptc v)"},
+	 { (char *)"vector_ptc_get_allocator", _wrap_vector_ptc_get_allocator, METH_VARARGS, (char *)"vector_ptc_get_allocator(vector_ptc self) -> allocator_type"},
+	 { (char *)"vector_ptc_begin", _wrap_vector_ptc_begin, METH_VARARGS, (char *)"vector_ptc_begin(vector_ptc self) -> const_iterator"},
+	 { (char *)"vector_ptc_end", _wrap_vector_ptc_end, METH_VARARGS, (char *)"vector_ptc_end(vector_ptc self) -> const_iterator"},
+	 { (char *)"vector_ptc_rbegin", _wrap_vector_ptc_rbegin, METH_VARARGS, (char *)"vector_ptc_rbegin(vector_ptc self) -> const_reverse_iterator"},
+	 { (char *)"vector_ptc_rend", _wrap_vector_ptc_rend, METH_VARARGS, (char *)"vector_ptc_rend(vector_ptc self) -> const_reverse_iterator"},
+	 { (char *)"vector_ptc_pop_back", _wrap_vector_ptc_pop_back, METH_VARARGS, (char *)"vector_ptc_pop_back(vector_ptc self)"},
+	 { (char *)"vector_ptc_erase", _wrap_vector_ptc_erase, METH_VARARGS, (char *)"\n"
 		"erase(iterator pos) -> iterator\n"
-		"vector_src_erase(vector_src self, iterator first, iterator last) -> iterator\n"
+		"vector_ptc_erase(vector_ptc self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"new_vector_src", _wrap_new_vector_src, METH_VARARGS, (char *)"\n"
-		"vector_src()\n"
-		"vector_src(vector_src arg0)\n"
-		"vector_src(size_type size)\n"
-		"new_vector_src(size_type size, value_type value) -> vector_src\n"
+	 { (char *)"new_vector_ptc", _wrap_new_vector_ptc, METH_VARARGS, (char *)"\n"
+		"vector_ptc()\n"
+		"vector_ptc(vector_ptc arg0)\n"
+		"vector_ptc(size_type size)\n"
+		"new_vector_ptc(size_type size, value_type value) -> vector_ptc\n"
 		""},
-	 { (char *)"vector_src_push_back", _wrap_vector_src_push_back, METH_VARARGS, (char *)"vector_src_push_back(vector_src self, value_type x)"},
-	 { (char *)"vector_src_front", _wrap_vector_src_front, METH_VARARGS, (char *)"vector_src_front(vector_src self) -> value_type"},
-	 { (char *)"vector_src_back", _wrap_vector_src_back, METH_VARARGS, (char *)"vector_src_back(vector_src self) -> value_type"},
-	 { (char *)"vector_src_assign", _wrap_vector_src_assign, METH_VARARGS, (char *)"vector_src_assign(vector_src self, size_type n, value_type x)"},
-	 { (char *)"vector_src_resize", _wrap_vector_src_resize, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_ptc_push_back", _wrap_vector_ptc_push_back, METH_VARARGS, (char *)"vector_ptc_push_back(vector_ptc self, value_type x)"},
+	 { (char *)"vector_ptc_front", _wrap_vector_ptc_front, METH_VARARGS, (char *)"vector_ptc_front(vector_ptc self) -> value_type"},
+	 { (char *)"vector_ptc_back", _wrap_vector_ptc_back, METH_VARARGS, (char *)"vector_ptc_back(vector_ptc self) -> value_type"},
+	 { (char *)"vector_ptc_assign", _wrap_vector_ptc_assign, METH_VARARGS, (char *)"vector_ptc_assign(vector_ptc self, size_type n, value_type x)"},
+	 { (char *)"vector_ptc_resize", _wrap_vector_ptc_resize, METH_VARARGS, (char *)"\n"
 		"resize(size_type new_size)\n"
-		"vector_src_resize(vector_src self, size_type new_size, value_type x)\n"
+		"vector_ptc_resize(vector_ptc self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"vector_src_insert", _wrap_vector_src_insert, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_ptc_insert", _wrap_vector_ptc_insert, METH_VARARGS, (char *)"\n"
 		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_src_insert(vector_src self, iterator pos, size_type n, value_type x)\n"
+		"vector_ptc_insert(vector_ptc self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"vector_src_reserve", _wrap_vector_src_reserve, METH_VARARGS, (char *)"vector_src_reserve(vector_src self, size_type n)"},
-	 { (char *)"vector_src_capacity", _wrap_vector_src_capacity, METH_VARARGS, (char *)"vector_src_capacity(vector_src self) -> size_type"},
-	 { (char *)"delete_vector_src", _wrap_delete_vector_src, METH_VARARGS, (char *)"delete_vector_src(vector_src self)"},
-	 { (char *)"vector_src_swigregister", vector_src_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_dif_iterator", _wrap_vector_dif_iterator, METH_VARARGS, (char *)"vector_dif_iterator(vector_dif self) -> SwigPyIterator"},
-	 { (char *)"vector_dif___nonzero__", _wrap_vector_dif___nonzero__, METH_VARARGS, (char *)"vector_dif___nonzero__(vector_dif self) -> bool"},
-	 { (char *)"vector_dif___bool__", _wrap_vector_dif___bool__, METH_VARARGS, (char *)"vector_dif___bool__(vector_dif self) -> bool"},
-	 { (char *)"vector_dif___len__", _wrap_vector_dif___len__, METH_VARARGS, (char *)"vector_dif___len__(vector_dif self) -> size_type"},
-	 { (char *)"vector_dif_pop", _wrap_vector_dif_pop, METH_VARARGS, (char *)"vector_dif_pop(vector_dif self) -> value_type"},
-	 { (char *)"vector_dif___getslice__", _wrap_vector_dif___getslice__, METH_VARARGS, (char *)"vector_dif___getslice__(vector_dif self, difference_type i, difference_type j) -> vector_dif"},
-	 { (char *)"vector_dif___setslice__", _wrap_vector_dif___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_dif___setslice__(vector_dif self, difference_type i, difference_type j, \n"
-		"    vector_dif v)\n"
+	 { (char *)"vector_ptc_reserve", _wrap_vector_ptc_reserve, METH_VARARGS, (char *)"vector_ptc_reserve(vector_ptc self, size_type n)"},
+	 { (char *)"vector_ptc_capacity", _wrap_vector_ptc_capacity, METH_VARARGS, (char *)"vector_ptc_capacity(vector_ptc self) -> size_type"},
+	 { (char *)"delete_vector_ptc", _wrap_delete_vector_ptc, METH_VARARGS, (char *)"delete_vector_ptc(vector_ptc self)"},
+	 { (char *)"vector_ptc_swigregister", vector_ptc_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_cmp_iterator", _wrap_vector_cmp_iterator, METH_VARARGS, (char *)"vector_cmp_iterator(vector_cmp self) -> SwigPyIterator"},
+	 { (char *)"vector_cmp___nonzero__", _wrap_vector_cmp___nonzero__, METH_VARARGS, (char *)"vector_cmp___nonzero__(vector_cmp self) -> bool"},
+	 { (char *)"vector_cmp___bool__", _wrap_vector_cmp___bool__, METH_VARARGS, (char *)"vector_cmp___bool__(vector_cmp self) -> bool"},
+	 { (char *)"vector_cmp___len__", _wrap_vector_cmp___len__, METH_VARARGS, (char *)"vector_cmp___len__(vector_cmp self) -> size_type"},
+	 { (char *)"vector_cmp_pop", _wrap_vector_cmp_pop, METH_VARARGS, (char *)"vector_cmp_pop(vector_cmp self) -> value_type"},
+	 { (char *)"vector_cmp___getslice__", _wrap_vector_cmp___getslice__, METH_VARARGS, (char *)"vector_cmp___getslice__(vector_cmp self, difference_type i, difference_type j) -> vector_cmp"},
+	 { (char *)"vector_cmp___setslice__", _wrap_vector_cmp___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_cmp___setslice__(vector_cmp self, difference_type i, difference_type j, \n"
+		"    vector_cmp v)\n"
 		""},
-	 { (char *)"vector_dif___delslice__", _wrap_vector_dif___delslice__, METH_VARARGS, (char *)"vector_dif___delslice__(vector_dif self, difference_type i, difference_type j)"},
-	 { (char *)"vector_dif___delitem__", _wrap_vector_dif___delitem__, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_cmp___delslice__", _wrap_vector_cmp___delslice__, METH_VARARGS, (char *)"vector_cmp___delslice__(vector_cmp self, difference_type i, difference_type j)"},
+	 { (char *)"vector_cmp___delitem__", _wrap_vector_cmp___delitem__, METH_VARARGS, (char *)"\n"
 		"__delitem__(difference_type i)\n"
-		"vector_dif___delitem__(vector_dif self, PySliceObject slice)\n"
+		"vector_cmp___delitem__(vector_cmp self, PySliceObject slice)\n"
 		""},
-	 { (char *)"vector_dif___getitem__", _wrap_vector_dif___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_dif\n"
-		"vector_dif___getitem__(vector_dif self, difference_type i) -> value_type\n"
+	 { (char *)"vector_cmp___getitem__", _wrap_vector_cmp___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_cmp\n"
+		"vector_cmp___getitem__(vector_cmp self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"vector_dif___setitem__", _wrap_vector_dif___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_dif v)\n"
-		"vector_dif___setitem__(vector_dif self, difference_type i, value_type x)\n"
+	 { (char *)"vector_cmp___setitem__", _wrap_vector_cmp___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_cmp v)\n"
+		"vector_cmp___setitem__(vector_cmp self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"vector_dif_append", _wrap_vector_dif_append, METH_VARARGS, (char *)"vector_dif_append(vector_dif self, value_type x)"},
-	 { (char *)"vector_dif_empty", _wrap_vector_dif_empty, METH_VARARGS, (char *)"vector_dif_empty(vector_dif self) -> bool"},
-	 { (char *)"vector_dif_size", _wrap_vector_dif_size, METH_VARARGS, (char *)"vector_dif_size(vector_dif self) -> size_type"},
-	 { (char *)"vector_dif_clear", _wrap_vector_dif_clear, METH_VARARGS, (char *)"vector_dif_clear(vector_dif self)"},
-	 { (char *)"vector_dif_swap", _wrap_vector_dif_swap, METH_VARARGS, (char *)"vector_dif_swap(vector_dif self, vector_dif v)"},
-	 { (char *)"vector_dif_get_allocator", _wrap_vector_dif_get_allocator, METH_VARARGS, (char *)"vector_dif_get_allocator(vector_dif self) -> allocator_type"},
-	 { (char *)"vector_dif_begin", _wrap_vector_dif_begin, METH_VARARGS, (char *)"vector_dif_begin(vector_dif self) -> const_iterator"},
-	 { (char *)"vector_dif_end", _wrap_vector_dif_end, METH_VARARGS, (char *)"vector_dif_end(vector_dif self) -> const_iterator"},
-	 { (char *)"vector_dif_rbegin", _wrap_vector_dif_rbegin, METH_VARARGS, (char *)"vector_dif_rbegin(vector_dif self) -> const_reverse_iterator"},
-	 { (char *)"vector_dif_rend", _wrap_vector_dif_rend, METH_VARARGS, (char *)"vector_dif_rend(vector_dif self) -> const_reverse_iterator"},
-	 { (char *)"vector_dif_pop_back", _wrap_vector_dif_pop_back, METH_VARARGS, (char *)"vector_dif_pop_back(vector_dif self)"},
-	 { (char *)"vector_dif_erase", _wrap_vector_dif_erase, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_cmp_append", _wrap_vector_cmp_append, METH_VARARGS, (char *)"vector_cmp_append(vector_cmp self, value_type x)"},
+	 { (char *)"vector_cmp_empty", _wrap_vector_cmp_empty, METH_VARARGS, (char *)"vector_cmp_empty(vector_cmp self) -> bool"},
+	 { (char *)"vector_cmp_size", _wrap_vector_cmp_size, METH_VARARGS, (char *)"vector_cmp_size(vector_cmp self) -> size_type"},
+	 { (char *)"vector_cmp_clear", _wrap_vector_cmp_clear, METH_VARARGS, (char *)"vector_cmp_clear(vector_cmp self)"},
+	 { (char *)"vector_cmp_swap", _wrap_vector_cmp_swap, METH_VARARGS, (char *)"vector_cmp_swap(vector_cmp self, vector_cmp v)"},
+	 { (char *)"vector_cmp_get_allocator", _wrap_vector_cmp_get_allocator, METH_VARARGS, (char *)"vector_cmp_get_allocator(vector_cmp self) -> allocator_type"},
+	 { (char *)"vector_cmp_begin", _wrap_vector_cmp_begin, METH_VARARGS, (char *)"vector_cmp_begin(vector_cmp self) -> const_iterator"},
+	 { (char *)"vector_cmp_end", _wrap_vector_cmp_end, METH_VARARGS, (char *)"vector_cmp_end(vector_cmp self) -> const_iterator"},
+	 { (char *)"vector_cmp_rbegin", _wrap_vector_cmp_rbegin, METH_VARARGS, (char *)"vector_cmp_rbegin(vector_cmp self) -> const_reverse_iterator"},
+	 { (char *)"vector_cmp_rend", _wrap_vector_cmp_rend, METH_VARARGS, (char *)"vector_cmp_rend(vector_cmp self) -> const_reverse_iterator"},
+	 { (char *)"vector_cmp_pop_back", _wrap_vector_cmp_pop_back, METH_VARARGS, (char *)"vector_cmp_pop_back(vector_cmp self)"},
+	 { (char *)"vector_cmp_erase", _wrap_vector_cmp_erase, METH_VARARGS, (char *)"\n"
 		"erase(iterator pos) -> iterator\n"
-		"vector_dif_erase(vector_dif self, iterator first, iterator last) -> iterator\n"
+		"vector_cmp_erase(vector_cmp self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"new_vector_dif", _wrap_new_vector_dif, METH_VARARGS, (char *)"\n"
-		"vector_dif()\n"
-		"vector_dif(vector_dif arg0)\n"
-		"vector_dif(size_type size)\n"
-		"new_vector_dif(size_type size, value_type value) -> vector_dif\n"
+	 { (char *)"new_vector_cmp", _wrap_new_vector_cmp, METH_VARARGS, (char *)"\n"
+		"vector_cmp()\n"
+		"vector_cmp(vector_cmp arg0)\n"
+		"vector_cmp(size_type size)\n"
+		"new_vector_cmp(size_type size, value_type value) -> vector_cmp\n"
 		""},
-	 { (char *)"vector_dif_push_back", _wrap_vector_dif_push_back, METH_VARARGS, (char *)"vector_dif_push_back(vector_dif self, value_type x)"},
-	 { (char *)"vector_dif_front", _wrap_vector_dif_front, METH_VARARGS, (char *)"vector_dif_front(vector_dif self) -> value_type"},
-	 { (char *)"vector_dif_back", _wrap_vector_dif_back, METH_VARARGS, (char *)"vector_dif_back(vector_dif self) -> value_type"},
-	 { (char *)"vector_dif_assign", _wrap_vector_dif_assign, METH_VARARGS, (char *)"vector_dif_assign(vector_dif self, size_type n, value_type x)"},
-	 { (char *)"vector_dif_resize", _wrap_vector_dif_resize, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_cmp_push_back", _wrap_vector_cmp_push_back, METH_VARARGS, (char *)"vector_cmp_push_back(vector_cmp self, value_type x)"},
+	 { (char *)"vector_cmp_front", _wrap_vector_cmp_front, METH_VARARGS, (char *)"vector_cmp_front(vector_cmp self) -> value_type"},
+	 { (char *)"vector_cmp_back", _wrap_vector_cmp_back, METH_VARARGS, (char *)"vector_cmp_back(vector_cmp self) -> value_type"},
+	 { (char *)"vector_cmp_assign", _wrap_vector_cmp_assign, METH_VARARGS, (char *)"vector_cmp_assign(vector_cmp self, size_type n, value_type x)"},
+	 { (char *)"vector_cmp_resize", _wrap_vector_cmp_resize, METH_VARARGS, (char *)"\n"
 		"resize(size_type new_size)\n"
-		"vector_dif_resize(vector_dif self, size_type new_size, value_type x)\n"
+		"vector_cmp_resize(vector_cmp self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"vector_dif_insert", _wrap_vector_dif_insert, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_cmp_insert", _wrap_vector_cmp_insert, METH_VARARGS, (char *)"\n"
 		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_dif_insert(vector_dif self, iterator pos, size_type n, value_type x)\n"
+		"vector_cmp_insert(vector_cmp self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"vector_dif_reserve", _wrap_vector_dif_reserve, METH_VARARGS, (char *)"vector_dif_reserve(vector_dif self, size_type n)"},
-	 { (char *)"vector_dif_capacity", _wrap_vector_dif_capacity, METH_VARARGS, (char *)"vector_dif_capacity(vector_dif self) -> size_type"},
-	 { (char *)"delete_vector_dif", _wrap_delete_vector_dif, METH_VARARGS, (char *)"delete_vector_dif(vector_dif self)"},
-	 { (char *)"vector_dif_swigregister", vector_dif_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_vsys_iterator", _wrap_vector_vsys_iterator, METH_VARARGS, (char *)"vector_vsys_iterator(vector_vsys self) -> SwigPyIterator"},
-	 { (char *)"vector_vsys___nonzero__", _wrap_vector_vsys___nonzero__, METH_VARARGS, (char *)"vector_vsys___nonzero__(vector_vsys self) -> bool"},
-	 { (char *)"vector_vsys___bool__", _wrap_vector_vsys___bool__, METH_VARARGS, (char *)"vector_vsys___bool__(vector_vsys self) -> bool"},
-	 { (char *)"vector_vsys___len__", _wrap_vector_vsys___len__, METH_VARARGS, (char *)"vector_vsys___len__(vector_vsys self) -> size_type"},
-	 { (char *)"vector_vsys_pop", _wrap_vector_vsys_pop, METH_VARARGS, (char *)"vector_vsys_pop(vector_vsys self) -> value_type"},
-	 { (char *)"vector_vsys___getslice__", _wrap_vector_vsys___getslice__, METH_VARARGS, (char *)"vector_vsys___getslice__(vector_vsys self, difference_type i, difference_type j) -> vector_vsys"},
-	 { (char *)"vector_vsys___setslice__", _wrap_vector_vsys___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_vsys___setslice__(vector_vsys self, difference_type i, difference_type j, \n"
-		"    vector_vsys v)\n"
+	 { (char *)"vector_cmp_reserve", _wrap_vector_cmp_reserve, METH_VARARGS, (char *)"vector_cmp_reserve(vector_cmp self, size_type n)"},
+	 { (char *)"vector_cmp_capacity", _wrap_vector_cmp_capacity, METH_VARARGS, (char *)"vector_cmp_capacity(vector_cmp self) -> size_type"},
+	 { (char *)"delete_vector_cmp", _wrap_delete_vector_cmp, METH_VARARGS, (char *)"delete_vector_cmp(vector_cmp self)"},
+	 { (char *)"vector_cmp_swigregister", vector_cmp_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_int_iterator", _wrap_vector_int_iterator, METH_VARARGS, (char *)"vector_int_iterator(vector_int self) -> SwigPyIterator"},
+	 { (char *)"vector_int___nonzero__", _wrap_vector_int___nonzero__, METH_VARARGS, (char *)"vector_int___nonzero__(vector_int self) -> bool"},
+	 { (char *)"vector_int___bool__", _wrap_vector_int___bool__, METH_VARARGS, (char *)"vector_int___bool__(vector_int self) -> bool"},
+	 { (char *)"vector_int___len__", _wrap_vector_int___len__, METH_VARARGS, (char *)"vector_int___len__(vector_int self) -> size_type"},
+	 { (char *)"vector_int_pop", _wrap_vector_int_pop, METH_VARARGS, (char *)"vector_int_pop(vector_int self) -> value_type"},
+	 { (char *)"vector_int___getslice__", _wrap_vector_int___getslice__, METH_VARARGS, (char *)"vector_int___getslice__(vector_int self, difference_type i, difference_type j) -> vector_int"},
+	 { (char *)"vector_int___setslice__", _wrap_vector_int___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_int___setslice__(vector_int self, difference_type i, difference_type j, \n"
+		"    vector_int v)\n"
 		""},
-	 { (char *)"vector_vsys___delslice__", _wrap_vector_vsys___delslice__, METH_VARARGS, (char *)"vector_vsys___delslice__(vector_vsys self, difference_type i, difference_type j)"},
-	 { (char *)"vector_vsys___delitem__", _wrap_vector_vsys___delitem__, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_int___delslice__", _wrap_vector_int___delslice__, METH_VARARGS, (char *)"vector_int___delslice__(vector_int self, difference_type i, difference_type j)"},
+	 { (char *)"vector_int___delitem__", _wrap_vector_int___delitem__, METH_VARARGS, (char *)"\n"
 		"__delitem__(difference_type i)\n"
-		"vector_vsys___delitem__(vector_vsys self, PySliceObject slice)\n"
+		"vector_int___delitem__(vector_int self, PySliceObject slice)\n"
 		""},
-	 { (char *)"vector_vsys___getitem__", _wrap_vector_vsys___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_vsys\n"
-		"vector_vsys___getitem__(vector_vsys self, difference_type i) -> value_type\n"
+	 { (char *)"vector_int___getitem__", _wrap_vector_int___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_int\n"
+		"vector_int___getitem__(vector_int self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"vector_vsys___setitem__", _wrap_vector_vsys___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_vsys v)\n"
-		"vector_vsys___setitem__(vector_vsys self, difference_type i, value_type x)\n"
+	 { (char *)"vector_int___setitem__", _wrap_vector_int___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_int v)\n"
+		"vector_int___setitem__(vector_int self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"vector_vsys_append", _wrap_vector_vsys_append, METH_VARARGS, (char *)"vector_vsys_append(vector_vsys self, value_type x)"},
-	 { (char *)"vector_vsys_empty", _wrap_vector_vsys_empty, METH_VARARGS, (char *)"vector_vsys_empty(vector_vsys self) -> bool"},
-	 { (char *)"vector_vsys_size", _wrap_vector_vsys_size, METH_VARARGS, (char *)"vector_vsys_size(vector_vsys self) -> size_type"},
-	 { (char *)"vector_vsys_clear", _wrap_vector_vsys_clear, METH_VARARGS, (char *)"vector_vsys_clear(vector_vsys self)"},
-	 { (char *)"vector_vsys_swap", _wrap_vector_vsys_swap, METH_VARARGS, (char *)"vector_vsys_swap(vector_vsys self, vector_vsys v)"},
-	 { (char *)"vector_vsys_get_allocator", _wrap_vector_vsys_get_allocator, METH_VARARGS, (char *)"vector_vsys_get_allocator(vector_vsys self) -> allocator_type"},
-	 { (char *)"vector_vsys_begin", _wrap_vector_vsys_begin, METH_VARARGS, (char *)"vector_vsys_begin(vector_vsys self) -> const_iterator"},
-	 { (char *)"vector_vsys_end", _wrap_vector_vsys_end, METH_VARARGS, (char *)"vector_vsys_end(vector_vsys self) -> const_iterator"},
-	 { (char *)"vector_vsys_rbegin", _wrap_vector_vsys_rbegin, METH_VARARGS, (char *)"vector_vsys_rbegin(vector_vsys self) -> const_reverse_iterator"},
-	 { (char *)"vector_vsys_rend", _wrap_vector_vsys_rend, METH_VARARGS, (char *)"vector_vsys_rend(vector_vsys self) -> const_reverse_iterator"},
-	 { (char *)"vector_vsys_pop_back", _wrap_vector_vsys_pop_back, METH_VARARGS, (char *)"vector_vsys_pop_back(vector_vsys self)"},
-	 { (char *)"vector_vsys_erase", _wrap_vector_vsys_erase, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_int_append", _wrap_vector_int_append, METH_VARARGS, (char *)"vector_int_append(vector_int self, value_type x)"},
+	 { (char *)"vector_int_empty", _wrap_vector_int_empty, METH_VARARGS, (char *)"vector_int_empty(vector_int self) -> bool"},
+	 { (char *)"vector_int_size", _wrap_vector_int_size, METH_VARARGS, (char *)"vector_int_size(vector_int self) -> size_type"},
+	 { (char *)"vector_int_clear", _wrap_vector_int_clear, METH_VARARGS, (char *)"vector_int_clear(vector_int self)"},
+	 { (char *)"vector_int_swap", _wrap_vector_int_swap, METH_VARARGS, (char *)"vector_int_swap(vector_int self, vector_int v)"},
+	 { (char *)"vector_int_get_allocator", _wrap_vector_int_get_allocator, METH_VARARGS, (char *)"vector_int_get_allocator(vector_int self) -> allocator_type"},
+	 { (char *)"vector_int_begin", _wrap_vector_int_begin, METH_VARARGS, (char *)"vector_int_begin(vector_int self) -> const_iterator"},
+	 { (char *)"vector_int_end", _wrap_vector_int_end, METH_VARARGS, (char *)"vector_int_end(vector_int self) -> const_iterator"},
+	 { (char *)"vector_int_rbegin", _wrap_vector_int_rbegin, METH_VARARGS, (char *)"vector_int_rbegin(vector_int self) -> const_reverse_iterator"},
+	 { (char *)"vector_int_rend", _wrap_vector_int_rend, METH_VARARGS, (char *)"vector_int_rend(vector_int self) -> const_reverse_iterator"},
+	 { (char *)"vector_int_pop_back", _wrap_vector_int_pop_back, METH_VARARGS, (char *)"vector_int_pop_back(vector_int self)"},
+	 { (char *)"vector_int_erase", _wrap_vector_int_erase, METH_VARARGS, (char *)"\n"
 		"erase(iterator pos) -> iterator\n"
-		"vector_vsys_erase(vector_vsys self, iterator first, iterator last) -> iterator\n"
+		"vector_int_erase(vector_int self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"new_vector_vsys", _wrap_new_vector_vsys, METH_VARARGS, (char *)"\n"
-		"vector_vsys()\n"
-		"vector_vsys(vector_vsys arg0)\n"
-		"vector_vsys(size_type size)\n"
-		"new_vector_vsys(size_type size, value_type value) -> vector_vsys\n"
+	 { (char *)"new_vector_int", _wrap_new_vector_int, METH_VARARGS, (char *)"\n"
+		"vector_int()\n"
+		"vector_int(vector_int arg0)\n"
+		"vector_int(size_type size)\n"
+		"new_vector_int(size_type size, value_type value) -> vector_int\n"
 		""},
-	 { (char *)"vector_vsys_push_back", _wrap_vector_vsys_push_back, METH_VARARGS, (char *)"vector_vsys_push_back(vector_vsys self, value_type x)"},
-	 { (char *)"vector_vsys_front", _wrap_vector_vsys_front, METH_VARARGS, (char *)"vector_vsys_front(vector_vsys self) -> value_type"},
-	 { (char *)"vector_vsys_back", _wrap_vector_vsys_back, METH_VARARGS, (char *)"vector_vsys_back(vector_vsys self) -> value_type"},
-	 { (char *)"vector_vsys_assign", _wrap_vector_vsys_assign, METH_VARARGS, (char *)"vector_vsys_assign(vector_vsys self, size_type n, value_type x)"},
-	 { (char *)"vector_vsys_resize", _wrap_vector_vsys_resize, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_int_push_back", _wrap_vector_int_push_back, METH_VARARGS, (char *)"vector_int_push_back(vector_int self, value_type x)"},
+	 { (char *)"vector_int_front", _wrap_vector_int_front, METH_VARARGS, (char *)"vector_int_front(vector_int self) -> value_type"},
+	 { (char *)"vector_int_back", _wrap_vector_int_back, METH_VARARGS, (char *)"vector_int_back(vector_int self) -> value_type"},
+	 { (char *)"vector_int_assign", _wrap_vector_int_assign, METH_VARARGS, (char *)"vector_int_assign(vector_int self, size_type n, value_type x)"},
+	 { (char *)"vector_int_resize", _wrap_vector_int_resize, METH_VARARGS, (char *)"\n"
 		"resize(size_type new_size)\n"
-		"vector_vsys_resize(vector_vsys self, size_type new_size, value_type x)\n"
+		"vector_int_resize(vector_int self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"vector_vsys_insert", _wrap_vector_vsys_insert, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_int_insert", _wrap_vector_int_insert, METH_VARARGS, (char *)"\n"
 		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_vsys_insert(vector_vsys self, iterator pos, size_type n, value_type x)\n"
+		"vector_int_insert(vector_int self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"vector_vsys_reserve", _wrap_vector_vsys_reserve, METH_VARARGS, (char *)"vector_vsys_reserve(vector_vsys self, size_type n)"},
-	 { (char *)"vector_vsys_capacity", _wrap_vector_vsys_capacity, METH_VARARGS, (char *)"vector_vsys_capacity(vector_vsys self) -> size_type"},
-	 { (char *)"delete_vector_vsys", _wrap_delete_vector_vsys, METH_VARARGS, (char *)"delete_vector_vsys(vector_vsys self)"},
-	 { (char *)"vector_vsys_swigregister", vector_vsys_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_ssys_iterator", _wrap_vector_ssys_iterator, METH_VARARGS, (char *)"vector_ssys_iterator(vector_ssys self) -> SwigPyIterator"},
-	 { (char *)"vector_ssys___nonzero__", _wrap_vector_ssys___nonzero__, METH_VARARGS, (char *)"vector_ssys___nonzero__(vector_ssys self) -> bool"},
-	 { (char *)"vector_ssys___bool__", _wrap_vector_ssys___bool__, METH_VARARGS, (char *)"vector_ssys___bool__(vector_ssys self) -> bool"},
-	 { (char *)"vector_ssys___len__", _wrap_vector_ssys___len__, METH_VARARGS, (char *)"vector_ssys___len__(vector_ssys self) -> size_type"},
-	 { (char *)"vector_ssys_pop", _wrap_vector_ssys_pop, METH_VARARGS, (char *)"vector_ssys_pop(vector_ssys self) -> value_type"},
-	 { (char *)"vector_ssys___getslice__", _wrap_vector_ssys___getslice__, METH_VARARGS, (char *)"vector_ssys___getslice__(vector_ssys self, difference_type i, difference_type j) -> vector_ssys"},
-	 { (char *)"vector_ssys___setslice__", _wrap_vector_ssys___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_ssys___setslice__(vector_ssys self, difference_type i, difference_type j, \n"
-		"    vector_ssys v)\n"
+	 { (char *)"vector_int_reserve", _wrap_vector_int_reserve, METH_VARARGS, (char *)"vector_int_reserve(vector_int self, size_type n)"},
+	 { (char *)"vector_int_capacity", _wrap_vector_int_capacity, METH_VARARGS, (char *)"vector_int_capacity(vector_int self) -> size_type"},
+	 { (char *)"delete_vector_int", _wrap_delete_vector_int, METH_VARARGS, (char *)"delete_vector_int(vector_int self)"},
+	 { (char *)"vector_int_swigregister", vector_int_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_uint_iterator", _wrap_vector_uint_iterator, METH_VARARGS, (char *)"vector_uint_iterator(vector_uint self) -> SwigPyIterator"},
+	 { (char *)"vector_uint___nonzero__", _wrap_vector_uint___nonzero__, METH_VARARGS, (char *)"vector_uint___nonzero__(vector_uint self) -> bool"},
+	 { (char *)"vector_uint___bool__", _wrap_vector_uint___bool__, METH_VARARGS, (char *)"vector_uint___bool__(vector_uint self) -> bool"},
+	 { (char *)"vector_uint___len__", _wrap_vector_uint___len__, METH_VARARGS, (char *)"vector_uint___len__(vector_uint self) -> size_type"},
+	 { (char *)"vector_uint_pop", _wrap_vector_uint_pop, METH_VARARGS, (char *)"vector_uint_pop(vector_uint self) -> value_type"},
+	 { (char *)"vector_uint___getslice__", _wrap_vector_uint___getslice__, METH_VARARGS, (char *)"vector_uint___getslice__(vector_uint self, difference_type i, difference_type j) -> vector_uint"},
+	 { (char *)"vector_uint___setslice__", _wrap_vector_uint___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_uint___setslice__(vector_uint self, difference_type i, difference_type j, \n"
+		"    vector_uint v)\n"
 		""},
-	 { (char *)"vector_ssys___delslice__", _wrap_vector_ssys___delslice__, METH_VARARGS, (char *)"vector_ssys___delslice__(vector_ssys self, difference_type i, difference_type j)"},
-	 { (char *)"vector_ssys___delitem__", _wrap_vector_ssys___delitem__, METH_VARARGS, (char *)"\n"
+	 { (char *)"vector_uint___delslice__", _wrap_vector_uint___delslice__, METH_VARARGS, (char *)"vector_uint___delslice__(vector_uint self, difference_type i, difference_type j)"},
+	 { (char *)"vector_uint___delitem__", _wrap_vector_uint___delitem__, METH_VARARGS, (char *)"\n"
 		"__delitem__(difference_type i)\n"
-		"vector_ssys___delitem__(vector_ssys self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_ssys___getitem__", _wrap_vector_ssys___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_ssys\n"
-		"vector_ssys___getitem__(vector_ssys self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_ssys___setitem__", _wrap_vector_ssys___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_ssys v)\n"
-		"vector_ssys___setitem__(vector_ssys self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_ssys_append", _wrap_vector_ssys_append, METH_VARARGS, (char *)"vector_ssys_append(vector_ssys self, value_type x)"},
-	 { (char *)"vector_ssys_empty", _wrap_vector_ssys_empty, METH_VARARGS, (char *)"vector_ssys_empty(vector_ssys self) -> bool"},
-	 { (char *)"vector_ssys_size", _wrap_vector_ssys_size, METH_VARARGS, (char *)"vector_ssys_size(vector_ssys self) -> size_type"},
-	 { (char *)"vector_ssys_clear", _wrap_vector_ssys_clear, METH_VARARGS, (char *)"vector_ssys_clear(vector_ssys self)"},
-	 { (char *)"vector_ssys_swap", _wrap_vector_ssys_swap, METH_VARARGS, (char *)"vector_ssys_swap(vector_ssys self, vector_ssys v)"},
-	 { (char *)"vector_ssys_get_allocator", _wrap_vector_ssys_get_allocator, METH_VARARGS, (char *)"vector_ssys_get_allocator(vector_ssys self) -> allocator_type"},
-	 { (char *)"vector_ssys_begin", _wrap_vector_ssys_begin, METH_VARARGS, (char *)"vector_ssys_begin(vector_ssys self) -> const_iterator"},
-	 { (char *)"vector_ssys_end", _wrap_vector_ssys_end, METH_VARARGS, (char *)"vector_ssys_end(vector_ssys self) -> const_iterator"},
-	 { (char *)"vector_ssys_rbegin", _wrap_vector_ssys_rbegin, METH_VARARGS, (char *)"vector_ssys_rbegin(vector_ssys self) -> const_reverse_iterator"},
-	 { (char *)"vector_ssys_rend", _wrap_vector_ssys_rend, METH_VARARGS, (char *)"vector_ssys_rend(vector_ssys self) -> const_reverse_iterator"},
-	 { (char *)"vector_ssys_pop_back", _wrap_vector_ssys_pop_back, METH_VARARGS, (char *)"vector_ssys_pop_back(vector_ssys self)"},
-	 { (char *)"vector_ssys_erase", _wrap_vector_ssys_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_ssys_erase(vector_ssys self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_ssys", _wrap_new_vector_ssys, METH_VARARGS, (char *)"\n"
-		"vector_ssys()\n"
-		"vector_ssys(vector_ssys arg0)\n"
-		"vector_ssys(size_type size)\n"
-		"new_vector_ssys(size_type size, value_type value) -> vector_ssys\n"
-		""},
-	 { (char *)"vector_ssys_push_back", _wrap_vector_ssys_push_back, METH_VARARGS, (char *)"vector_ssys_push_back(vector_ssys self, value_type x)"},
-	 { (char *)"vector_ssys_front", _wrap_vector_ssys_front, METH_VARARGS, (char *)"vector_ssys_front(vector_ssys self) -> value_type"},
-	 { (char *)"vector_ssys_back", _wrap_vector_ssys_back, METH_VARARGS, (char *)"vector_ssys_back(vector_ssys self) -> value_type"},
-	 { (char *)"vector_ssys_assign", _wrap_vector_ssys_assign, METH_VARARGS, (char *)"vector_ssys_assign(vector_ssys self, size_type n, value_type x)"},
-	 { (char *)"vector_ssys_resize", _wrap_vector_ssys_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_ssys_resize(vector_ssys self, size_type new_size, value_type x)\n"
+		"vector_uint___delitem__(vector_uint self, PySliceObject slice)\n"
 		""},
-	 { (char *)"vector_ssys_insert", _wrap_vector_ssys_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_ssys_insert(vector_ssys self, iterator pos, size_type n, value_type x)\n"
+	 { (char *)"vector_uint___getitem__", _wrap_vector_uint___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_uint\n"
+		"vector_uint___getitem__(vector_uint self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"vector_ssys_reserve", _wrap_vector_ssys_reserve, METH_VARARGS, (char *)"vector_ssys_reserve(vector_ssys self, size_type n)"},
-	 { (char *)"vector_ssys_capacity", _wrap_vector_ssys_capacity, METH_VARARGS, (char *)"vector_ssys_capacity(vector_ssys self) -> size_type"},
-	 { (char *)"delete_vector_ssys", _wrap_delete_vector_ssys, METH_VARARGS, (char *)"delete_vector_ssys(vector_ssys self)"},
-	 { (char *)"vector_ssys_swigregister", vector_ssys_swigregister, METH_VARARGS, NULL},
-	 { (char *)"isValidID", _wrap_isValidID, METH_VARARGS, (char *)"isValidID(string id) -> bool"},
-	 { (char *)"checkID", _wrap_checkID, METH_VARARGS, (char *)"checkID(string id)"},
-	 { (char *)"new_Model", _wrap_new_Model, METH_VARARGS, (char *)"new_Model() -> Model"},
-	 { (char *)"delete_Model", _wrap_delete_Model, METH_VARARGS, (char *)"delete_Model(Model self)"},
-	 { (char *)"Model_getSpec", _wrap_Model_getSpec, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Spec species object with \n"
-		"identifier string spec_id (if defined).\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getSpec(spec_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string spec_id\n"
-		"             \n"
-		"Return:\n"
-		"    steps.model.Spec\n"
-		"\n"
+	 { (char *)"vector_uint___setitem__", _wrap_vector_uint___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_uint v)\n"
+		"vector_uint___setitem__(vector_uint self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"Model_delSpec", _wrap_Model_delSpec, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.Spec species object with identifier \n"
-		"string spec_id (if defined) from the model.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    delSpec(spec_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string spec_id\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_uint_append", _wrap_vector_uint_append, METH_VARARGS, (char *)"vector_uint_append(vector_uint self, value_type x)"},
+	 { (char *)"vector_uint_empty", _wrap_vector_uint_empty, METH_VARARGS, (char *)"vector_uint_empty(vector_uint self) -> bool"},
+	 { (char *)"vector_uint_size", _wrap_vector_uint_size, METH_VARARGS, (char *)"vector_uint_size(vector_uint self) -> size_type"},
+	 { (char *)"vector_uint_clear", _wrap_vector_uint_clear, METH_VARARGS, (char *)"vector_uint_clear(vector_uint self)"},
+	 { (char *)"vector_uint_swap", _wrap_vector_uint_swap, METH_VARARGS, (char *)"vector_uint_swap(vector_uint self, vector_uint v)"},
+	 { (char *)"vector_uint_get_allocator", _wrap_vector_uint_get_allocator, METH_VARARGS, (char *)"vector_uint_get_allocator(vector_uint self) -> allocator_type"},
+	 { (char *)"vector_uint_begin", _wrap_vector_uint_begin, METH_VARARGS, (char *)"vector_uint_begin(vector_uint self) -> const_iterator"},
+	 { (char *)"vector_uint_end", _wrap_vector_uint_end, METH_VARARGS, (char *)"vector_uint_end(vector_uint self) -> const_iterator"},
+	 { (char *)"vector_uint_rbegin", _wrap_vector_uint_rbegin, METH_VARARGS, (char *)"vector_uint_rbegin(vector_uint self) -> const_reverse_iterator"},
+	 { (char *)"vector_uint_rend", _wrap_vector_uint_rend, METH_VARARGS, (char *)"vector_uint_rend(vector_uint self) -> const_reverse_iterator"},
+	 { (char *)"vector_uint_pop_back", _wrap_vector_uint_pop_back, METH_VARARGS, (char *)"vector_uint_pop_back(vector_uint self)"},
+	 { (char *)"vector_uint_erase", _wrap_vector_uint_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_uint_erase(vector_uint self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"Model_getAllSpecs", _wrap_Model_getAllSpecs, METH_VARARGS, (char *)"\n"
-		"Returns a list of steps.model.Spec object references of all species in the model.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getAllSpecs()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"             \n"
-		"Return:\n"
-		"    list<steps.model.Spec>\n"
-		"\n"
+	 { (char *)"new_vector_uint", _wrap_new_vector_uint, METH_VARARGS, (char *)"\n"
+		"vector_uint()\n"
+		"vector_uint(vector_uint arg0)\n"
+		"vector_uint(size_type size)\n"
+		"new_vector_uint(size_type size, value_type value) -> vector_uint\n"
 		""},
-	 { (char *)"Model_getVolsys", _wrap_Model_getVolsys, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Volsys volume system object with \n"
-		"identifier string vsys_id (if defined).\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getVolsys(vsys_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string vsys_id\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.Volsys\n"
-		"\n"
+	 { (char *)"vector_uint_push_back", _wrap_vector_uint_push_back, METH_VARARGS, (char *)"vector_uint_push_back(vector_uint self, value_type x)"},
+	 { (char *)"vector_uint_front", _wrap_vector_uint_front, METH_VARARGS, (char *)"vector_uint_front(vector_uint self) -> value_type"},
+	 { (char *)"vector_uint_back", _wrap_vector_uint_back, METH_VARARGS, (char *)"vector_uint_back(vector_uint self) -> value_type"},
+	 { (char *)"vector_uint_assign", _wrap_vector_uint_assign, METH_VARARGS, (char *)"vector_uint_assign(vector_uint self, size_type n, value_type x)"},
+	 { (char *)"vector_uint_resize", _wrap_vector_uint_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_uint_resize(vector_uint self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"Model_delVolsys", _wrap_Model_delVolsys, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.Volsys volume system object with identifier string \n"
-		"vsys_id (if defined) from the model.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    delVolsys(vsys_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string vsys_id\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_uint_insert", _wrap_vector_uint_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_uint_insert(vector_uint self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"Model_getAllVolsyss", _wrap_Model_getAllVolsyss, METH_VARARGS, (char *)"\n"
-		"Returns a list of steps.model.Volsys object references of all volume systems in the model.\n"
-		"             \n"
-		"Syntax::\n"
-		"             \n"
-		"    getAllVolsyss()\n"
-		"             \n"
-		"Arguments:\n"
-		"    None\n"
-		"             \n"
-		"Return:\n"
-		"    list<steps.model.Volsys>\n"
-		"\n"
+	 { (char *)"vector_uint_reserve", _wrap_vector_uint_reserve, METH_VARARGS, (char *)"vector_uint_reserve(vector_uint self, size_type n)"},
+	 { (char *)"vector_uint_capacity", _wrap_vector_uint_capacity, METH_VARARGS, (char *)"vector_uint_capacity(vector_uint self) -> size_type"},
+	 { (char *)"delete_vector_uint", _wrap_delete_vector_uint, METH_VARARGS, (char *)"delete_vector_uint(vector_uint self)"},
+	 { (char *)"vector_uint_swigregister", vector_uint_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_dbl_iterator", _wrap_vector_dbl_iterator, METH_VARARGS, (char *)"vector_dbl_iterator(vector_dbl self) -> SwigPyIterator"},
+	 { (char *)"vector_dbl___nonzero__", _wrap_vector_dbl___nonzero__, METH_VARARGS, (char *)"vector_dbl___nonzero__(vector_dbl self) -> bool"},
+	 { (char *)"vector_dbl___bool__", _wrap_vector_dbl___bool__, METH_VARARGS, (char *)"vector_dbl___bool__(vector_dbl self) -> bool"},
+	 { (char *)"vector_dbl___len__", _wrap_vector_dbl___len__, METH_VARARGS, (char *)"vector_dbl___len__(vector_dbl self) -> size_type"},
+	 { (char *)"vector_dbl_pop", _wrap_vector_dbl_pop, METH_VARARGS, (char *)"vector_dbl_pop(vector_dbl self) -> value_type"},
+	 { (char *)"vector_dbl___getslice__", _wrap_vector_dbl___getslice__, METH_VARARGS, (char *)"vector_dbl___getslice__(vector_dbl self, difference_type i, difference_type j) -> vector_dbl"},
+	 { (char *)"vector_dbl___setslice__", _wrap_vector_dbl___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_dbl___setslice__(vector_dbl self, difference_type i, difference_type j, \n"
+		"    vector_dbl v)\n"
 		""},
-	 { (char *)"Model_getSurfsys", _wrap_Model_getSurfsys, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Surfsys surface system object with \n"
-		"identifier string ssys_id (if defined).\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getSurfsys(ssys_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string ssys_id\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.Surfsys\n"
-		"\n"
+	 { (char *)"vector_dbl___delslice__", _wrap_vector_dbl___delslice__, METH_VARARGS, (char *)"vector_dbl___delslice__(vector_dbl self, difference_type i, difference_type j)"},
+	 { (char *)"vector_dbl___delitem__", _wrap_vector_dbl___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_dbl___delitem__(vector_dbl self, PySliceObject slice)\n"
 		""},
-	 { (char *)"Model_delSurfsys", _wrap_Model_delSurfsys, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.Surfsys surface system object with identifier string \n"
-		"ssys_id (if defined) from the model.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    delSurfsys(ssys_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string ssys_id\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_dbl___getitem__", _wrap_vector_dbl___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_dbl\n"
+		"vector_dbl___getitem__(vector_dbl self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"Model_getAllSurfsyss", _wrap_Model_getAllSurfsyss, METH_VARARGS, (char *)"\n"
-		"Returns a list of steps.model.Surfsys object references of all surface systems in the model.\n"
-		"\n"
-		"ax::\n"
-		"\n"
-		"getAllSurfsyss()\n"
-		"\n"
-		"ments:\n"
-		"None\n"
-		"\n"
-		"rn:\n"
-		"list<steps.model.Surfsys>\n"
-		"\n"
+	 { (char *)"vector_dbl___setitem__", _wrap_vector_dbl___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_dbl v)\n"
+		"vector_dbl___setitem__(vector_dbl self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"Model_swigregister", Model_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Spec", _wrap_new_Spec, METH_VARARGS, (char *)"new_Spec(string id, Model model) -> Spec"},
-	 { (char *)"delete_Spec", _wrap_delete_Spec, METH_VARARGS, (char *)"delete_Spec(Spec self)"},
-	 { (char *)"Spec_getID", _wrap_Spec_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the species.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getID()\n"
-		"\n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    string\n"
-		"\n"
+	 { (char *)"vector_dbl_append", _wrap_vector_dbl_append, METH_VARARGS, (char *)"vector_dbl_append(vector_dbl self, value_type x)"},
+	 { (char *)"vector_dbl_empty", _wrap_vector_dbl_empty, METH_VARARGS, (char *)"vector_dbl_empty(vector_dbl self) -> bool"},
+	 { (char *)"vector_dbl_size", _wrap_vector_dbl_size, METH_VARARGS, (char *)"vector_dbl_size(vector_dbl self) -> size_type"},
+	 { (char *)"vector_dbl_clear", _wrap_vector_dbl_clear, METH_VARARGS, (char *)"vector_dbl_clear(vector_dbl self)"},
+	 { (char *)"vector_dbl_swap", _wrap_vector_dbl_swap, METH_VARARGS, (char *)"vector_dbl_swap(vector_dbl self, vector_dbl v)"},
+	 { (char *)"vector_dbl_get_allocator", _wrap_vector_dbl_get_allocator, METH_VARARGS, (char *)"vector_dbl_get_allocator(vector_dbl self) -> allocator_type"},
+	 { (char *)"vector_dbl_begin", _wrap_vector_dbl_begin, METH_VARARGS, (char *)"vector_dbl_begin(vector_dbl self) -> const_iterator"},
+	 { (char *)"vector_dbl_end", _wrap_vector_dbl_end, METH_VARARGS, (char *)"vector_dbl_end(vector_dbl self) -> const_iterator"},
+	 { (char *)"vector_dbl_rbegin", _wrap_vector_dbl_rbegin, METH_VARARGS, (char *)"vector_dbl_rbegin(vector_dbl self) -> const_reverse_iterator"},
+	 { (char *)"vector_dbl_rend", _wrap_vector_dbl_rend, METH_VARARGS, (char *)"vector_dbl_rend(vector_dbl self) -> const_reverse_iterator"},
+	 { (char *)"vector_dbl_pop_back", _wrap_vector_dbl_pop_back, METH_VARARGS, (char *)"vector_dbl_pop_back(vector_dbl self)"},
+	 { (char *)"vector_dbl_erase", _wrap_vector_dbl_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_dbl_erase(vector_dbl self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"Spec_setID", _wrap_Spec_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the species.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    setID(name)\n"
-		"\n"
-		"Arguments:\n"
-		"    string name\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"new_vector_dbl", _wrap_new_vector_dbl, METH_VARARGS, (char *)"\n"
+		"vector_dbl()\n"
+		"vector_dbl(vector_dbl arg0)\n"
+		"vector_dbl(size_type size)\n"
+		"new_vector_dbl(size_type size, value_type value) -> vector_dbl\n"
 		""},
-	 { (char *)"Spec_getModel", _wrap_Spec_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getModel()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.Model\n"
-		"    \n"
-		"Attribute:\n"
-		"    model\n"
-		"\n"
+	 { (char *)"vector_dbl_push_back", _wrap_vector_dbl_push_back, METH_VARARGS, (char *)"vector_dbl_push_back(vector_dbl self, value_type x)"},
+	 { (char *)"vector_dbl_front", _wrap_vector_dbl_front, METH_VARARGS, (char *)"vector_dbl_front(vector_dbl self) -> value_type"},
+	 { (char *)"vector_dbl_back", _wrap_vector_dbl_back, METH_VARARGS, (char *)"vector_dbl_back(vector_dbl self) -> value_type"},
+	 { (char *)"vector_dbl_assign", _wrap_vector_dbl_assign, METH_VARARGS, (char *)"vector_dbl_assign(vector_dbl self, size_type n, value_type x)"},
+	 { (char *)"vector_dbl_resize", _wrap_vector_dbl_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_dbl_resize(vector_dbl self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"Spec_swigregister", Spec_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Surfsys", _wrap_new_Surfsys, METH_VARARGS, (char *)"new_Surfsys(string id, Model model) -> Surfsys"},
-	 { (char *)"delete_Surfsys", _wrap_delete_Surfsys, METH_VARARGS, (char *)"delete_Surfsys(Surfsys self)"},
-	 { (char *)"Surfsys_getID", _wrap_Surfsys_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the surface system.\n"
-		"\n"
-		"Syntax::\n"
-		"    \n"
-		"    getID()\n"
-		"\n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    string\n"
-		"\n"
+	 { (char *)"vector_dbl_insert", _wrap_vector_dbl_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_dbl_insert(vector_dbl self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"Surfsys_setID", _wrap_Surfsys_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the surface system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    setID(name)\n"
-		"    \n"
-		"Arguments:\n"
-		"    string name\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_dbl_reserve", _wrap_vector_dbl_reserve, METH_VARARGS, (char *)"vector_dbl_reserve(vector_dbl self, size_type n)"},
+	 { (char *)"vector_dbl_capacity", _wrap_vector_dbl_capacity, METH_VARARGS, (char *)"vector_dbl_capacity(vector_dbl self) -> size_type"},
+	 { (char *)"delete_vector_dbl", _wrap_delete_vector_dbl, METH_VARARGS, (char *)"delete_vector_dbl(vector_dbl self)"},
+	 { (char *)"vector_dbl_swigregister", vector_dbl_swigregister, METH_VARARGS, NULL},
+	 { (char *)"vector_bool_iterator", _wrap_vector_bool_iterator, METH_VARARGS, (char *)"vector_bool_iterator(vector_bool self) -> SwigPyIterator"},
+	 { (char *)"vector_bool___nonzero__", _wrap_vector_bool___nonzero__, METH_VARARGS, (char *)"vector_bool___nonzero__(vector_bool self) -> bool"},
+	 { (char *)"vector_bool___bool__", _wrap_vector_bool___bool__, METH_VARARGS, (char *)"vector_bool___bool__(vector_bool self) -> bool"},
+	 { (char *)"vector_bool___len__", _wrap_vector_bool___len__, METH_VARARGS, (char *)"vector_bool___len__(vector_bool self) -> size_type"},
+	 { (char *)"vector_bool_pop", _wrap_vector_bool_pop, METH_VARARGS, (char *)"vector_bool_pop(vector_bool self) -> value_type"},
+	 { (char *)"vector_bool___getslice__", _wrap_vector_bool___getslice__, METH_VARARGS, (char *)"vector_bool___getslice__(vector_bool self, difference_type i, difference_type j) -> vector_bool"},
+	 { (char *)"vector_bool___setslice__", _wrap_vector_bool___setslice__, METH_VARARGS, (char *)"\n"
+		"vector_bool___setslice__(vector_bool self, difference_type i, difference_type j, \n"
+		"    vector_bool v)\n"
 		""},
-	 { (char *)"Surfsys_getModel", _wrap_Surfsys_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getModel()\n"
-		"\n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.Model\n"
-		"\n"
+	 { (char *)"vector_bool___delslice__", _wrap_vector_bool___delslice__, METH_VARARGS, (char *)"vector_bool___delslice__(vector_bool self, difference_type i, difference_type j)"},
+	 { (char *)"vector_bool___delitem__", _wrap_vector_bool___delitem__, METH_VARARGS, (char *)"\n"
+		"__delitem__(difference_type i)\n"
+		"vector_bool___delitem__(vector_bool self, PySliceObject slice)\n"
 		""},
-	 { (char *)"Surfsys_getSReac", _wrap_Surfsys_getSReac, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.SReac surface-reaction object \n"
-		"with identifier sreac_id (if defined in the surface system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getSReac(sreac_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string sreac_id\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.SReac\n"
-		"\n"
+	 { (char *)"vector_bool___getitem__", _wrap_vector_bool___getitem__, METH_VARARGS, (char *)"\n"
+		"__getitem__(PySliceObject slice) -> vector_bool\n"
+		"vector_bool___getitem__(vector_bool self, difference_type i) -> value_type\n"
 		""},
-	 { (char *)"Surfsys_delSReac", _wrap_Surfsys_delSReac, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.SReac surface-reaction object with identifier \n"
-		"sreac_id from the surface system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    delSReac(sreac_id)\n"
-		"    \n"
-		"Arguments:\n"
-		"    string sreac_id\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_bool___setitem__", _wrap_vector_bool___setitem__, METH_VARARGS, (char *)"\n"
+		"__setitem__(PySliceObject slice, vector_bool v)\n"
+		"vector_bool___setitem__(vector_bool self, difference_type i, value_type x)\n"
 		""},
-	 { (char *)"Surfsys_getAllSReacs", _wrap_Surfsys_getAllSReacs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.SReac surface-reaction \n"
-		"objects defined in the surface system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getAllSReacs()\n"
-		"\n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    list<steps.model.SReac>\n"
-		"\n"
+	 { (char *)"vector_bool_append", _wrap_vector_bool_append, METH_VARARGS, (char *)"vector_bool_append(vector_bool self, value_type x)"},
+	 { (char *)"vector_bool_empty", _wrap_vector_bool_empty, METH_VARARGS, (char *)"vector_bool_empty(vector_bool self) -> bool"},
+	 { (char *)"vector_bool_size", _wrap_vector_bool_size, METH_VARARGS, (char *)"vector_bool_size(vector_bool self) -> size_type"},
+	 { (char *)"vector_bool_clear", _wrap_vector_bool_clear, METH_VARARGS, (char *)"vector_bool_clear(vector_bool self)"},
+	 { (char *)"vector_bool_swap", _wrap_vector_bool_swap, METH_VARARGS, (char *)"vector_bool_swap(vector_bool self, vector_bool v)"},
+	 { (char *)"vector_bool_get_allocator", _wrap_vector_bool_get_allocator, METH_VARARGS, (char *)"vector_bool_get_allocator(vector_bool self) -> allocator_type"},
+	 { (char *)"vector_bool_begin", _wrap_vector_bool_begin, METH_VARARGS, (char *)"vector_bool_begin(vector_bool self) -> const_iterator"},
+	 { (char *)"vector_bool_end", _wrap_vector_bool_end, METH_VARARGS, (char *)"vector_bool_end(vector_bool self) -> const_iterator"},
+	 { (char *)"vector_bool_rbegin", _wrap_vector_bool_rbegin, METH_VARARGS, (char *)"vector_bool_rbegin(vector_bool self) -> const_reverse_iterator"},
+	 { (char *)"vector_bool_rend", _wrap_vector_bool_rend, METH_VARARGS, (char *)"vector_bool_rend(vector_bool self) -> const_reverse_iterator"},
+	 { (char *)"vector_bool_pop_back", _wrap_vector_bool_pop_back, METH_VARARGS, (char *)"vector_bool_pop_back(vector_bool self)"},
+	 { (char *)"vector_bool_erase", _wrap_vector_bool_erase, METH_VARARGS, (char *)"\n"
+		"erase(iterator pos) -> iterator\n"
+		"vector_bool_erase(vector_bool self, iterator first, iterator last) -> iterator\n"
 		""},
-	 { (char *)"Surfsys_getAllSpecs", _wrap_Surfsys_getAllSpecs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Spec species objects included \n"
-		"in the surface system; that is all reactants and products in the surface \n"
-		"reactions belonging to this surface system. No duplicate member is included.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getAllSpecs()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    list<steps.model.Spec>\n"
-		"\n"
+	 { (char *)"new_vector_bool", _wrap_new_vector_bool, METH_VARARGS, (char *)"\n"
+		"vector_bool()\n"
+		"vector_bool(vector_bool arg0)\n"
+		"vector_bool(size_type size)\n"
+		"new_vector_bool(size_type size, value_type value) -> vector_bool\n"
 		""},
-	 { (char *)"Surfsys_swigregister", Surfsys_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Volsys", _wrap_new_Volsys, METH_VARARGS, (char *)"new_Volsys(string id, Model model) -> Volsys"},
-	 { (char *)"delete_Volsys", _wrap_delete_Volsys, METH_VARARGS, (char *)"delete_Volsys(Volsys self)"},
-	 { (char *)"Volsys_getID", _wrap_Volsys_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the volume system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getID()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    string\n"
-		"\n"
+	 { (char *)"vector_bool_push_back", _wrap_vector_bool_push_back, METH_VARARGS, (char *)"vector_bool_push_back(vector_bool self, value_type x)"},
+	 { (char *)"vector_bool_front", _wrap_vector_bool_front, METH_VARARGS, (char *)"vector_bool_front(vector_bool self) -> value_type"},
+	 { (char *)"vector_bool_back", _wrap_vector_bool_back, METH_VARARGS, (char *)"vector_bool_back(vector_bool self) -> value_type"},
+	 { (char *)"vector_bool_assign", _wrap_vector_bool_assign, METH_VARARGS, (char *)"vector_bool_assign(vector_bool self, size_type n, value_type x)"},
+	 { (char *)"vector_bool_resize", _wrap_vector_bool_resize, METH_VARARGS, (char *)"\n"
+		"resize(size_type new_size)\n"
+		"vector_bool_resize(vector_bool self, size_type new_size, value_type x)\n"
 		""},
-	 { (char *)"Volsys_setID", _wrap_Volsys_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the volume system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    setID(name)\n"
-		"    \n"
-		"Arguments:\n"
-		"    string name\n"
-		"\n"
-		"Return:\n"
-		"    None\n"
-		"\n"
+	 { (char *)"vector_bool_insert", _wrap_vector_bool_insert, METH_VARARGS, (char *)"\n"
+		"insert(iterator pos, value_type x) -> iterator\n"
+		"vector_bool_insert(vector_bool self, iterator pos, size_type n, value_type x)\n"
 		""},
-	 { (char *)"Volsys_getModel", _wrap_Volsys_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
+	 { (char *)"vector_bool_reserve", _wrap_vector_bool_reserve, METH_VARARGS, (char *)"vector_bool_reserve(vector_bool self, size_type n)"},
+	 { (char *)"vector_bool_capacity", _wrap_vector_bool_capacity, METH_VARARGS, (char *)"vector_bool_capacity(vector_bool self) -> size_type"},
+	 { (char *)"delete_vector_bool", _wrap_delete_vector_bool, METH_VARARGS, (char *)"delete_vector_bool(vector_bool self)"},
+	 { (char *)"vector_bool_swigregister", vector_bool_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Geom", _wrap_new_Geom, METH_VARARGS, (char *)"new_Geom() -> Geom"},
+	 { (char *)"delete_Geom", _wrap_delete_Geom, METH_VARARGS, (char *)"delete_Geom(Geom self)"},
+	 { (char *)"Geom_getComp", _wrap_Geom_getComp, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.model.Comp compartment object with \n"
+		"identifier string comp_id (if defined).\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getModel()\n"
+		"    getComp(comp_id)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"\n"
+		"    string comp_id\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Model\n"
+		"    steps.model.Comp\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_getReac", _wrap_Volsys_getReac, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Reac reaction-rule object with \n"
-		"identifier string reac_id (if defined in the volume system).\n"
+	 { (char *)"Geom_delComp", _wrap_Geom_delComp, METH_VARARGS, (char *)"\n"
+		"Removes the steps.geom.Comp object with identifier string comp_id (if defined) \n"
+		"from the geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getReac(reac_id)\n"
+		"    delComp(comp_id)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string reac_id\n"
-		"\n"
-		"Return:\n"
-		"    steps.model.Reac\n"
-		"\n"
-		""},
-	 { (char *)"Volsys_delReac", _wrap_Volsys_delReac, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.Reac reaction-rule object with identifier reac_id \n"
-		"(if defined) from the volume system.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    delReac(reac_id)\n"
-		"\n"
-		"Arguments:\n"
-		"    string reac_id\n"
-		"\n"
+		"    string comp_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_getAllReacs", _wrap_Volsys_getAllReacs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Reac objects in this volume \n"
-		"system; that is all the reaction rules belonging to this volume system. \n"
-		"No duplicate member is included.\n"
+	 { (char *)"Geom_getAllComps", _wrap_Geom_getAllComps, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.geom.Comp compartment objects in the \n"
+		"geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getAllReacs()\n"
+		"    getAllComps()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Reac>\n"
+		"    list<steps.geom.Comp>\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_getDiff", _wrap_Volsys_getDiff, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Diff diffusion-rule object with \n"
-		"identifier diff_id (if defined in the volume system).\n"
+	 { (char *)"Geom_getPatch", _wrap_Geom_getPatch, METH_VARARGS, (char *)"\n"
+		"Removes the steps.geom.Patch object with identifier string patch_id (if defined) \n"
+		"from the geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getDiff(diff_id)\n"
+		"    getPatch(patch_id)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string diff_id\n"
-		"\n"
+		"    string patch_id\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Diff\n"
+		"    steps.geom.Patch\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_delDiff", _wrap_Volsys_delDiff, METH_VARARGS, (char *)"\n"
-		"Remove the steps.model.Diff diffusion-rule object with identifier diff_id \n"
-		"from the volume system.\n"
+	 { (char *)"Geom_delPatch", _wrap_Geom_delPatch, METH_VARARGS, (char *)"\n"
+		"Removes the steps.geom.Patch object with identifier string patch_id (if defined) \n"
+		"from the geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    delDiff(diff_id)\n"
+		"    delPatch(patch_id)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string diff_id\n"
-		"\n"
+		"    string patch_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_getAllDiffs", _wrap_Volsys_getAllDiffs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Diff diffusion-rule objects \n"
-		"defined in the volume system.\n"
+	 { (char *)"Geom_getAllPatches", _wrap_Geom_getAllPatches, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getAllDiffs()\n"
+		"    getAllPatches()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Diff>\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
 		""},
-	 { (char *)"Volsys_getAllSpecs", _wrap_Volsys_getAllSpecs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Spec objects in this volume system; \n"
-		"that is all reactants, products or diffusing species in the reaction and diffusion \n"
-		"rules belonging to this volume system. No duplicate member is included.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getAllSpecs()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    list<steps.model.Spec>\n"
-		"\n"
+	 { (char *)"Geom_swigregister", Geom_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Patch", (PyCFunction) _wrap_new_Patch, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"new_Patch(string id, Geom container, Comp icomp, Comp ocomp = None, \n"
+		"    double area = 0.0) -> Patch\n"
 		""},
-	 { (char *)"Volsys_swigregister", Volsys_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Diff", (PyCFunction) _wrap_new_Diff, METH_VARARGS | METH_KEYWORDS, (char *)"new_Diff(string id, Volsys volsys, Spec lig, double dcst = 0.0) -> Diff"},
-	 { (char *)"delete_Diff", _wrap_delete_Diff, METH_VARARGS, (char *)"delete_Diff(Diff self)"},
-	 { (char *)"Diff_getID", _wrap_Diff_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the diffusion rule.\n"
+	 { (char *)"delete_Patch", _wrap_delete_Patch, METH_VARARGS, (char *)"delete_Patch(Patch self)"},
+	 { (char *)"Patch_getID", _wrap_Patch_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
@@ -49555,13 +55941,13 @@ static PyMethodDef SwigMethods[] = {
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
 		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Diff_setID", _wrap_Diff_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the diffusion rule.\n"
+	 { (char *)"Patch_setID", _wrap_Patch_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
@@ -49569,1121 +55955,1014 @@ static PyMethodDef SwigMethods[] = {
 		"    \n"
 		"Arguments:\n"
 		"    string name\n"
-		"\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Diff_getVolsys", _wrap_Diff_getVolsys, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Volsys volume system object.\n"
+	 { (char *)"Patch_getContainer", _wrap_Patch_getContainer, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.geom.Geom container object.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getVolsys()\n"
+		"    getContainer()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Volsys\n"
+		"    steps.geom.Geom\n"
 		"\n"
 		""},
-	 { (char *)"Diff_getModel", _wrap_Diff_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
+	 { (char *)"Patch_getArea", _wrap_Patch_getArea, METH_VARARGS, (char *)"\n"
+		"Get the area of the patch (in m^2).\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getModel()\n"
-		"    \n"
+		"    getArea()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Model\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Diff_getLig", _wrap_Diff_getLig, METH_VARARGS, (char *)"\n"
-		"get a reference to the steps.model.Spec species object to which this \n"
-		"diffusion rule is applied.\n"
+	 { (char *)"Patch_setArea", _wrap_Patch_setArea, METH_VARARGS, (char *)"\n"
+		"Set the area of the patch (in m^2).\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getLig()\n"
+		"    setArea(area)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"\n"
+		"    float area\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Spec\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Diff_setLig", _wrap_Diff_setLig, METH_VARARGS, (char *)"\n"
-		"Set a reference to the steps.model.Spec species object to which this \n"
-		"diffusion rule is applied.\n"
+	 { (char *)"Patch_addSurfsys", _wrap_Patch_addSurfsys, METH_VARARGS, (char *)"\n"
+		"Add surface system identifier string surfsys_id to the patch object.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setLig(lig)\n"
+		"    addSurfsys(surfsys_id)\n"
 		"    \n"
 		"Arguments:\n"
-		"    steps.model.Spec lig\n"
-		"\n"
+		"    string surfsys_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Diff_getDcst", _wrap_Diff_getDcst, METH_VARARGS, (char *)"\n"
-		"Get the diffusion constant for the diffusion rule, in s.i. units.\n"
+	 { (char *)"Patch_getSurfsys", _wrap_Patch_getSurfsys, METH_VARARGS, (char *)"\n"
+		"Returns a list of the surface system identifier strings which have \n"
+		"been added to the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getDcst()\n"
+		"    getSurfsys()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    float\n"
+		"    list<string>\n"
 		"\n"
 		""},
-	 { (char *)"Diff_setDcst", _wrap_Diff_setDcst, METH_VARARGS, (char *)"\n"
-		"Set the diffusion constant for the diffusion rule, in s.i. units.\n"
+	 { (char *)"Patch_delSurfsys", _wrap_Patch_delSurfsys, METH_VARARGS, (char *)"\n"
+		"Removes surface system identifier string surfsys_id from this patch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setDcst(dcst)\n"
-		"    \n"
-		"Arguments:\n"
-		"    float dcst\n"
+		"    delSurfsys(surfsys_id)\n"
 		"\n"
+		"Arguments:\n"
+		"    string surfsys_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Diff_swigregister", Diff_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Reac", (PyCFunction) _wrap_new_Reac, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
-		"new_Reac(string id, Volsys volsys, vector_spc lhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc rhs = std::vector< steps::model::Spec * >(), \n"
-		"    double kcst = 0.0) -> Reac\n"
-		""},
-	 { (char *)"delete_Reac", _wrap_delete_Reac, METH_VARARGS, (char *)"delete_Reac(Reac self)"},
-	 { (char *)"Reac_getID", _wrap_Reac_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the reaction rule.\n"
+	 { (char *)"Patch_getIComp", _wrap_Patch_getIComp, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.geom.Comp compartment object representing\n"
+		"the inner compartment.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getID()\n"
+		"    getIComp()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    steps.geom.Comp\n"
+		"\n"
+		""},
+	 { (char *)"Patch_getOComp", _wrap_Patch_getOComp, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.geom.Comp compartment object representing\n"
+		"the outer compartment.\n"
+		"\n"
+		"Syntax::\n"
 		"    \n"
+		"    getOComp()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    steps.geom.Comp\n"
+		"\n"
+		""},
+	 { (char *)"Patch_swigregister", Patch_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Comp", (PyCFunction) _wrap_new_Comp, METH_VARARGS | METH_KEYWORDS, (char *)"new_Comp(string id, Geom container, double vol = 0.0) -> Comp"},
+	 { (char *)"delete_Comp", _wrap_delete_Comp, METH_VARARGS, (char *)"delete_Comp(Comp self)"},
+	 { (char *)"Comp_getID", _wrap_Comp_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the compartment.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getID()\n"
 		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
 		"Return:\n"
 		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Reac_setID", _wrap_Reac_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the reaction rule.\n"
+	 { (char *)"Comp_setID", _wrap_Comp_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the compartment.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
 		"    setID(name)\n"
-		"    \n"
+		"\n"
 		"Arguments:\n"
 		"    string name\n"
-		"\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getVolsys", _wrap_Reac_getVolsys, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Volsys volume system object.\n"
+	 { (char *)"Comp_getContainer", _wrap_Comp_getContainer, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.geom.Geom container object.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getVolsys()\n"
-		"    \n"
+		"    getContainer()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Volsys\n"
+		"    steps.geom.Geom\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getModel", _wrap_Reac_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
+	 { (char *)"Comp_getVol", _wrap_Comp_getVol, METH_VARARGS, (char *)"\n"
+		"Get the volume of the compartment (in m^3).\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getModel()\n"
+		"    getVol()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Model\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getLHS", _wrap_Reac_getLHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects on the \n"
-		"left hand side of the reaction: the reactants.\n"
+	 { (char *)"Comp_setVol", _wrap_Comp_setVol, METH_VARARGS, (char *)"\n"
+		"Set the volume of the compartment (in m^3).\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getLHS()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
+		"    setVol(vol)\n"
 		"\n"
+		"Arguments:\n"
+		"    float vol\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Reac_setLHS", _wrap_Reac_setLHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects on the \n"
-		"left hand side of the reaction: the reactants.\n"
+	 { (char *)"Comp_addVolsys", _wrap_Comp_addVolsys, METH_VARARGS, (char *)"\n"
+		"Add volume system identifier string volsys_id to the compartment object.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setLHS(lhs)\n"
+		"    addVolsys(volsys_id)\n"
 		"\n"
 		"Arguments:\n"
-		"    list<steps.model.Spec> lhs\n"
-		"\n"
+		"    string volsys_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getRHS", _wrap_Reac_getRHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects on the \n"
-		"right hand side of the reaction: the reactants.\n"
+	 { (char *)"Comp_getVolsys", _wrap_Comp_getVolsys, METH_VARARGS, (char *)"\n"
+		"Returns a list of the volume system identifier strings which have been \n"
+		"added to the compartment.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getRHS()\n"
+		"    getVolsys()\n"
 		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    list<string>\n"
 		"\n"
 		""},
-	 { (char *)"Reac_setRHS", _wrap_Reac_setRHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects on the \n"
-		"right hand side of the reaction: the reactants.\n"
+	 { (char *)"Comp_delVolsys", _wrap_Comp_delVolsys, METH_VARARGS, (char *)"\n"
+		"Removes volume system identifier string volsys_id from this compartment.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setRHS(rhs)\n"
-		"    \n"
-		"Arguments:\n"
-		"    list<steps.model.Spec> rhs\n"
+		"    delVolsys(volsys_id)\n"
 		"\n"
+		"Arguments:\n"
+		"    string volsys_id\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getOrder", _wrap_Reac_getOrder, METH_VARARGS, (char *)"\n"
-		"Returns the order of this reaction.\n"
+	 { (char *)"Comp_getIPatches", _wrap_Comp_getIPatches, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to steps.geom.Patch patch objects: \n"
+		"the 'inner' patches.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getOrder()\n"
-		"    \n"
+		"    getIPatches()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    int\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
 		""},
-	 { (char *)"Reac_getKcst", _wrap_Reac_getKcst, METH_VARARGS, (char *)"\n"
-		"Get the kinetic reaction rate constant, in s.i. units, \n"
-		"where the actual units depend on the order of the reaction.\n"
+	 { (char *)"Comp_getOPatches", _wrap_Comp_getOPatches, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to steps.geom.Patch patch objects: \n"
+		"the 'outer' patches.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getKcst()\n"
+		"\n"
+		"    getOPatches()\n"
 		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    float\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
 		""},
-	 { (char *)"Reac_setKcst", _wrap_Reac_setKcst, METH_VARARGS, (char *)"\n"
-		"Set the kinetic reaction rate constant, in s.i. units, \n"
-		"where the actual units depend on the order of the reaction.\n"
+	 { (char *)"Comp_swigregister", Comp_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Tetmesh", _wrap_new_Tetmesh, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    setKcst(kcst)\n"
 		"\n"
+		"    getAllPatches()\n"
+		"    \n"
 		"Arguments:\n"
-		"    float kcst\n"
-		"\n"
-		"Return:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
-		""},
-	 { (char *)"Reac_getAllSpecs", _wrap_Reac_getAllSpecs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Spec species objects in \n"
-		"the reaction; that is all reactants and products. No duplicate member \n"
-		"is included.\n"
 		"\n"
-		"Syntax::\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
 		"\n"
-		"    getAllSpecs()\n"
+		"Syntax::\n"
 		"\n"
+		"    getAllPatches()\n"
+		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
-		""},
-	 { (char *)"Reac_swigregister", Reac_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_SReac", (PyCFunction) _wrap_new_SReac, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
-		"new_SReac(string id, Surfsys surfsys, vector_spc olhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc ilhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc slhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc irhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc srhs = std::vector< steps::model::Spec * >(), \n"
-		"    vector_spc orhs = std::vector< steps::model::Spec * >(), \n"
-		"    double kcst = 0.0) -> SReac\n"
-		""},
-	 { (char *)"delete_SReac", _wrap_delete_SReac, METH_VARARGS, (char *)"delete_SReac(SReac self)"},
-	 { (char *)"SReac_getID", _wrap_SReac_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the surface reaction rule.\n"
+		"\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getID()\n"
+		"    getAllPatches()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.geom.Patch>\n"
+		"\n"
+		"\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
+		"\n"
+		"Syntax::\n"
 		"\n"
+		"    getAllPatches()\n"
+		"    \n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
 		"Return:\n"
-		"    string\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setID", _wrap_SReac_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the surface reaction rule.\n"
+	 { (char *)"delete_Tetmesh", _wrap_delete_Tetmesh, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
+		"geometry container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setID(name)\n"
+		"    getAllPatches()\n"
 		"    \n"
 		"Arguments:\n"
-		"    string name\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.geom.Patch>\n"
+		"\n"
+		""},
+	 { (char *)"Tetmesh_setVertex", _wrap_Tetmesh_setVertex, METH_VARARGS, (char *)"\n"
+		"Set a vertex with index vidx to coordinates x, y, z. Should be used nverts \n"
+		"number of times to supply all vertex information if the second constructor \n"
+		"is used. Cannot be called after setup() has been called.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setVertex(vidx, x, y, z)\n"
 		"\n"
+		"Arguments:\n"
+		"    * uint vidx\n"
+		"    * float x\n"
+		"    * float y\n"
+		"    * float z\n"
+		"             \n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getSurfsys", _wrap_SReac_getSurfsys, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Surfsys surface system object.\n"
+	 { (char *)"Tetmesh_setTri", _wrap_Tetmesh_setTri, METH_VARARGS, (char *)"\n"
+		"Set the triangle with index tidx formed by vertices vidx0, vidx1, vidx2. \n"
+		"Should be called ntris number of times to supply triangle information if the \n"
+		"second constructor is used. Cannot be called after setup() has been called.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getSurfsys()\n"
-		"    \n"
+		"    setTri(tidx, vidx0, vidx1, vidx2)\n"
+		"                \n"
 		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * uint vidx0\n"
+		"    * uint vidx1\n"
+		"    * uint vidx2\n"
+		"             \n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Tetmesh_setTet", _wrap_Tetmesh_setTet, METH_VARARGS, (char *)"\n"
+		"Set the tetrahedron with index tidx formed by vertices vidx0, vidx1, \n"
+		"vidx2, vidx3. Should be called ntets number of times to supply tetrahedron \n"
+		"information if the second constructor is used. Cannot be called after setup() \n"
+		"has been called. \n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setTet(tidx, vidx0, vidx1, vidx2, vidx3)\n"
+		"\n"
+		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * uint vidx0\n"
+		"    * uint vidx1\n"
+		"    * uint vidx2\n"
+		"    * uint vidx3\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Surfsys\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getModel", _wrap_SReac_getModel, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.model.Model container object.\n"
+	 { (char *)"Tetmesh_setup", _wrap_Tetmesh_setup, METH_VARARGS, (char *)"\n"
+		"Setup the Tetmesh object by computing the auxiliary data. This method should \n"
+		"be called when the second constructor is used and all vertex, tetrahedron and \n"
+		"triangle information has been supplied with the set methods. The first constructor \n"
+		"calls this method internally, so setup does not have to be called when using the \n"
+		"first constructor.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getModel()\n"
-		"    \n"
+		"    setup()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    steps.model.Model\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getInner", _wrap_SReac_getInner, METH_VARARGS, (char *)"Obsolete"},
-	 { (char *)"SReac_getOuter", _wrap_SReac_getOuter, METH_VARARGS, (char *)"Obsolete"},
-	 { (char *)"SReac_getOLHS", _wrap_SReac_getOLHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the left hand side outer volume reactants.\n"
+	 { (char *)"Tetmesh_isSetupDone", _wrap_Tetmesh_isSetupDone, METH_VARARGS, (char *)"\n"
+		"Check if setup() has been called, either internally by the first constructor, \n"
+		"or by the user if the second constructor was used.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getOLHS()\n"
-		"    \n"
+		"    isSetupDone()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    True if setup is done.\n"
+		"    False if setup is not done.\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setOLHS", _wrap_SReac_setOLHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects; \n"
-		"the left hand side outer volume reactants.\n"
+	 { (char *)"Tetmesh_getVertex", _wrap_Tetmesh_getVertex, METH_VARARGS, (char *)"\n"
+		"Returns the coordinates of vertex with index vidx in the container.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setOLHS(olhs)\n"
-		"    \n"
-		"Arguments:\n"
-		"    list<steps.model.Spec) olhs\n"
+		"    getVertex(vidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint vidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    list<float, length = 3>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getILHS", _wrap_SReac_getILHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the left hand side inner volume reactants.\n"
+	 { (char *)"Tetmesh_countVertices", _wrap_Tetmesh_countVertices, METH_VARARGS, (char *)"\n"
+		"Returns the total number of vertices in the mesh.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getILHS()\n"
+		"\n"
+		"    countVertices()\n"
 		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setILHS", _wrap_SReac_setILHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects; \n"
-		"the left hand side inner volume reactants.\n"
+	 { (char *)"Tetmesh_getTri", _wrap_Tetmesh_getTri, METH_VARARGS, (char *)"\n"
+		"Returns the triangle with index tidx in the container by its three vertex indices.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setILHS(ilhs)\n"
+		"    getTri(tidx)\n"
 		"\n"
 		"Arguments:\n"
-		"    list<steps.model.Spec> ilhs\n"
-		"\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    list<uint, length = 3>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getSLHS", _wrap_SReac_getSLHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the left hand side surface reactants.\n"
+	 { (char *)"Tetmesh_countTris", _wrap_Tetmesh_countTris, METH_VARARGS, (char *)"\n"
+		"Returns the total number of triangles in the mesh.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getSLHS()\n"
-		"    \n"
+		"    countTris()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setSLHS", _wrap_SReac_setSLHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects; \n"
-		"the left hand side surface reactants.\n"
+	 { (char *)"Tetmesh_getTriArea", _wrap_Tetmesh_getTriArea, METH_VARARGS, (char *)"\n"
+		"Returns the area of the triangle with index tidx.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setSLHS(slhs)\n"
-		"    \n"
-		"Arguments:\n"
-		"    list<steps.model.Spec> slhs\n"
+		"    getTriArea(tidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getIRHS", _wrap_SReac_getIRHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the right hand side inner volume reactants.\n"
+	 { (char *)"Tetmesh_getTriBarycenter", _wrap_Tetmesh_getTriBarycenter, METH_VARARGS, (char *)"\n"
+		"Returns the Cartesian coordinates of the barycenter of triangle with index tidx.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getIRHS()\n"
+		"    getTriBarycenter(tidx)\n"
+		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    list<float, length = 3>\n"
+		"\n"
+		""},
+	 { (char *)"Tetmesh_getTetQualityRER", _wrap_Tetmesh_getTetQualityRER, METH_VARARGS, (char *)"\n"
+		"Returns the radius-edge-ratio (a quality measurement) of tetrahedron with index tidx.\n"
+		"\n"
+		"Syntax::\n"
 		"    \n"
+		"    getTetQualityRER(tidx)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    float\n"
+		"\n"
+		""},
+	 { (char *)"Tetmesh_getTriNorm", _wrap_Tetmesh_getTriNorm, METH_VARARGS, (char *)"\n"
+		"Returns the normal vector of the triangle with index tidx.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getTriNorm(tidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    list<float, length = 3>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setIRHS", _wrap_SReac_setIRHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects; \n"
-		"the right hand side inner volume reactants.\n"
+	 { (char *)"Tetmesh_getTriPatch", _wrap_Tetmesh_getTriPatch, METH_VARARGS, (char *)"\n"
+		"Returns a reference to a step.geom.TmPatch object: the patch which triangle \n"
+		"with index tidx belongs to. Returns None if triangle not assigned to a patch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setIRHS(irhs)\n"
-		"    \n"
+		"    getTriPatch(tidx)\n"
+		"\n"
 		"Arguments:\n"
-		"    list<steps.model.Spec> irhs\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    steps.geom.TmPatch\n"
 		"\n"
+		""},
+	 { (char *)"Tetmesh_getTriDiffBoundary", _wrap_Tetmesh_getTriDiffBoundary, METH_VARARGS, (char *)"\n"
+		"Returns a reference to a step.geom.Diffboundary object: the diffusion boundary triangle \n"
+		"with index tidx belongs to. Returns None if triangle not assigned to a diffusion boundary.\n"
+		"             \n"
+		"Syntax::\n"
+		"             \n"
+		"    getTriDiffBoundary(tidx)\n"
+		"             \n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    steps.geom.DiffBoundary\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getSRHS", _wrap_SReac_getSRHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the right hand side surface reactants.\n"
+	 { (char *)"Tetmesh_getTriTetNeighb", _wrap_Tetmesh_getTriTetNeighb, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the two neighbouring tetrahedrons of triangle with \n"
+		"index tidx. An index of -1 indicates no neighbour (triangle is on the mesh border). \n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSRHS()\n"
 		"\n"
-		"Arguments:\n"
-		"    None\n"
+		"    getTriTetNeighb(tidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    list<int, length = 2>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setSRHS", _wrap_SReac_setSRHS, METH_VARARGS, (char *)"\n"
-		"Set a list of references to steps.model.Spec species objects; \n"
-		"the right hand side surface reactants.\n"
+	 { (char *)"Tetmesh_getTriBoundary", _wrap_Tetmesh_getTriBoundary, METH_VARARGS, (char *)"\n"
+		"Returns a list of triangles that form the mesh boundary.\n"
+		"Support function for steps.utilities.visual.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setSRHS(srhs)\n"
-		"    \n"
-		"Arguments:\n"
-		"    list<steps.model.Spec> srhs\n"
+		"    getTriBoundary()\n"
 		"\n"
-		"Return:\n"
+		"Arguments:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<int>\n"
+		"    \n"
+		"Status: Obsolete. rename as getTriSurfs()\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getORHS", _wrap_SReac_getORHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the right hand side outer volume reactants.\n"
+	 { (char *)"Tetmesh_getSurfTris", _wrap_Tetmesh_getSurfTris, METH_VARARGS, (char *)"\n"
+		"Returns a list of triangles that form the mesh boundary.\n"
+		"Support function for steps.utilities.visual.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getORHS()\n"
-		"    \n"
+		"    getSurfTris()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    list<unsigned int>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setORHS", _wrap_SReac_setORHS, METH_VARARGS, (char *)"\n"
-		"Get a list of references to steps.model.Spec species objects; \n"
-		"the right hand side outer volume reactants.\n"
+	 { (char *)"Tetmesh_getTet", _wrap_Tetmesh_getTet, METH_VARARGS, (char *)"\n"
+		"Returns the tetrahedron with index tidx in the container by its four vertex indices.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setORHS(orhs)\n"
+		"    getTet(tidx)\n"
 		"    \n"
 		"Arguments:\n"
-		"    list<steps.model.Spec> orhs\n"
-		"\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    list<uint, length = 4>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getOrder", _wrap_SReac_getOrder, METH_VARARGS, (char *)"\n"
-		"Returns the order of this surface reaction.\n"
+	 { (char *)"Tetmesh_countTets", _wrap_Tetmesh_countTets, METH_VARARGS, (char *)"\n"
+		"Returns the total number of tetrahedrons in the mesh.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getOrder()\n"
-		"    \n"
+		"    countTets()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"\n"
+		"             \n"
 		"Return:\n"
-		"    int\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getKcst", _wrap_SReac_getKcst, METH_VARARGS, (char *)"\n"
-		"Get the kinetic reaction rate constant, in s.i. units, \n"
-		"where the actual units depend on the order of the surface reaction.\n"
+	 { (char *)"Tetmesh_getTetVol", _wrap_Tetmesh_getTetVol, METH_VARARGS, (char *)"\n"
+		"Returns the volume of the tetrahedron with index tidx.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getKcst()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
+		"    getTetVol(tidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"SReac_setKcst", _wrap_SReac_setKcst, METH_VARARGS, (char *)"\n"
-		"Set the kinetic reaction rate constant, in s.i. units, \n"
-		"where the actual units depend on the order of the surface reaction.\n"
+	 { (char *)"Tetmesh_getTetBarycenter", _wrap_Tetmesh_getTetBarycenter, METH_VARARGS, (char *)"\n"
+		"Returns the barycenter of the tetrahedron with index tidx.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    setKcst(kcst)\n"
-		"    \n"
-		"Arguments:\n"
-		"    float kcst\n"
+		"    getTetBarycenter(tidx)\n"
 		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    list<float, length = 3>\n"
 		"\n"
 		""},
-	 { (char *)"SReac_getAllSpecs", _wrap_SReac_getAllSpecs, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.model.Spec species objects in \n"
-		"the surface reaction; that is all reactants and products. No duplicate member \n"
-		"is included.\n"
+	 { (char *)"Tetmesh_getTetComp", _wrap_Tetmesh_getTetComp, METH_VARARGS, (char *)"\n"
+		"Returns a reference to a steps.geom.Comp object: the compartment which \n"
+		"tetrahedron with index tidx belongs to. Returns None if tetrahedron not \n"
+		"assigned to a compartment.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getAllSpecs()\n"
-		"    \n"
-		"Arguments:\n"
-		"    None\n"
-		"\n"
-		"Return:\n"
-		"    list<steps.model.Spec>\n"
+		"    getTetComp(tidx)\n"
+		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    steps.geom.TmComp\n"
 		"\n"
 		""},
-	 { (char *)"SReac_swigregister", SReac_swigregister, METH_VARARGS, NULL},
-	 { (char *)"set_str_iterator", _wrap_set_str_iterator, METH_VARARGS, (char *)"set_str_iterator(set_str self) -> SwigPyIterator"},
-	 { (char *)"set_str___nonzero__", _wrap_set_str___nonzero__, METH_VARARGS, (char *)"set_str___nonzero__(set_str self) -> bool"},
-	 { (char *)"set_str___bool__", _wrap_set_str___bool__, METH_VARARGS, (char *)"set_str___bool__(set_str self) -> bool"},
-	 { (char *)"set_str___len__", _wrap_set_str___len__, METH_VARARGS, (char *)"set_str___len__(set_str self) -> size_type"},
-	 { (char *)"set_str_append", _wrap_set_str_append, METH_VARARGS, (char *)"set_str_append(set_str self, value_type x)"},
-	 { (char *)"set_str___contains__", _wrap_set_str___contains__, METH_VARARGS, (char *)"set_str___contains__(set_str self, value_type x) -> bool"},
-	 { (char *)"set_str___getitem__", _wrap_set_str___getitem__, METH_VARARGS, (char *)"set_str___getitem__(set_str self, difference_type i) -> value_type"},
-	 { (char *)"new_set_str", _wrap_new_set_str, METH_VARARGS, (char *)"\n"
-		"set_str(std::less<(std::string)> arg0)\n"
-		"set_str()\n"
-		"new_set_str(set_str arg0) -> set_str\n"
-		""},
-	 { (char *)"set_str_empty", _wrap_set_str_empty, METH_VARARGS, (char *)"set_str_empty(set_str self) -> bool"},
-	 { (char *)"set_str_size", _wrap_set_str_size, METH_VARARGS, (char *)"set_str_size(set_str self) -> size_type"},
-	 { (char *)"set_str_clear", _wrap_set_str_clear, METH_VARARGS, (char *)"set_str_clear(set_str self)"},
-	 { (char *)"set_str_swap", _wrap_set_str_swap, METH_VARARGS, (char *)"set_str_swap(set_str self, set_str v)"},
-	 { (char *)"set_str_count", _wrap_set_str_count, METH_VARARGS, (char *)"set_str_count(set_str self, key_type x) -> size_type"},
-	 { (char *)"set_str_begin", _wrap_set_str_begin, METH_VARARGS, (char *)"set_str_begin(set_str self) -> iterator"},
-	 { (char *)"set_str_end", _wrap_set_str_end, METH_VARARGS, (char *)"set_str_end(set_str self) -> iterator"},
-	 { (char *)"set_str_rbegin", _wrap_set_str_rbegin, METH_VARARGS, (char *)"set_str_rbegin(set_str self) -> reverse_iterator"},
-	 { (char *)"set_str_rend", _wrap_set_str_rend, METH_VARARGS, (char *)"set_str_rend(set_str self) -> reverse_iterator"},
-	 { (char *)"set_str_erase", _wrap_set_str_erase, METH_VARARGS, (char *)"\n"
-		"erase(key_type x) -> size_type\n"
-		"erase(iterator pos)\n"
-		"set_str_erase(set_str self, iterator first, iterator last)\n"
-		""},
-	 { (char *)"set_str_find", _wrap_set_str_find, METH_VARARGS, (char *)"set_str_find(set_str self, key_type x) -> iterator"},
-	 { (char *)"set_str_lower_bound", _wrap_set_str_lower_bound, METH_VARARGS, (char *)"set_str_lower_bound(set_str self, key_type x) -> iterator"},
-	 { (char *)"set_str_upper_bound", _wrap_set_str_upper_bound, METH_VARARGS, (char *)"set_str_upper_bound(set_str self, key_type x) -> iterator"},
-	 { (char *)"set_str_equal_range", _wrap_set_str_equal_range, METH_VARARGS, (char *)"set_str_equal_range(set_str self, key_type x) -> std::pair<(std::set<(std::string)>::iterator,std::set<(std::string)>::iterator)>"},
-	 { (char *)"set_str_insert", _wrap_set_str_insert, METH_VARARGS, (char *)"set_str_insert(set_str self, value_type __x) -> std::pair<(std::set<(std::string)>::iterator,bool)>"},
-	 { (char *)"delete_set_str", _wrap_delete_set_str, METH_VARARGS, (char *)"delete_set_str(set_str self)"},
-	 { (char *)"set_str_swigregister", set_str_swigregister, METH_VARARGS, NULL},
-	 { (char *)"set_ptc_iterator", _wrap_set_ptc_iterator, METH_VARARGS, (char *)"set_ptc_iterator(set_ptc self) -> SwigPyIterator"},
-	 { (char *)"set_ptc___nonzero__", _wrap_set_ptc___nonzero__, METH_VARARGS, (char *)"set_ptc___nonzero__(set_ptc self) -> bool"},
-	 { (char *)"set_ptc___bool__", _wrap_set_ptc___bool__, METH_VARARGS, (char *)"set_ptc___bool__(set_ptc self) -> bool"},
-	 { (char *)"set_ptc___len__", _wrap_set_ptc___len__, METH_VARARGS, (char *)"set_ptc___len__(set_ptc self) -> size_type"},
-	 { (char *)"set_ptc_append", _wrap_set_ptc_append, METH_VARARGS, (char *)"set_ptc_append(set_ptc self, value_type x)"},
-	 { (char *)"set_ptc___contains__", _wrap_set_ptc___contains__, METH_VARARGS, (char *)"set_ptc___contains__(set_ptc self, value_type x) -> bool"},
-	 { (char *)"set_ptc___getitem__", _wrap_set_ptc___getitem__, METH_VARARGS, (char *)"set_ptc___getitem__(set_ptc self, difference_type i) -> value_type"},
-	 { (char *)"new_set_ptc", _wrap_new_set_ptc, METH_VARARGS, (char *)"\n"
-		"set_ptc(std::less<(p.steps::wm::Patch)> arg0)\n"
-		"set_ptc()\n"
-		"new_set_ptc(set_ptc arg0) -> set_ptc\n"
-		""},
-	 { (char *)"set_ptc_empty", _wrap_set_ptc_empty, METH_VARARGS, (char *)"set_ptc_empty(set_ptc self) -> bool"},
-	 { (char *)"set_ptc_size", _wrap_set_ptc_size, METH_VARARGS, (char *)"set_ptc_size(set_ptc self) -> size_type"},
-	 { (char *)"set_ptc_clear", _wrap_set_ptc_clear, METH_VARARGS, (char *)"set_ptc_clear(set_ptc self)"},
-	 { (char *)"set_ptc_swap", _wrap_set_ptc_swap, METH_VARARGS, (char *)"set_ptc_swap(set_ptc self, set_ptc v)"},
-	 { (char *)"set_ptc_count", _wrap_set_ptc_count, METH_VARARGS, (char *)"set_ptc_count(set_ptc self, key_type x) -> size_type"},
-	 { (char *)"set_ptc_begin", _wrap_set_ptc_begin, METH_VARARGS, (char *)"set_ptc_begin(set_ptc self) -> iterator"},
-	 { (char *)"set_ptc_end", _wrap_set_ptc_end, METH_VARARGS, (char *)"set_ptc_end(set_ptc self) -> iterator"},
-	 { (char *)"set_ptc_rbegin", _wrap_set_ptc_rbegin, METH_VARARGS, (char *)"set_ptc_rbegin(set_ptc self) -> reverse_iterator"},
-	 { (char *)"set_ptc_rend", _wrap_set_ptc_rend, METH_VARARGS, (char *)"set_ptc_rend(set_ptc self) -> reverse_iterator"},
-	 { (char *)"set_ptc_erase", _wrap_set_ptc_erase, METH_VARARGS, (char *)"\n"
-		"erase(key_type x) -> size_type\n"
-		"erase(iterator pos)\n"
-		"set_ptc_erase(set_ptc self, iterator first, iterator last)\n"
-		""},
-	 { (char *)"set_ptc_find", _wrap_set_ptc_find, METH_VARARGS, (char *)"set_ptc_find(set_ptc self, key_type x) -> iterator"},
-	 { (char *)"set_ptc_lower_bound", _wrap_set_ptc_lower_bound, METH_VARARGS, (char *)"set_ptc_lower_bound(set_ptc self, key_type x) -> iterator"},
-	 { (char *)"set_ptc_upper_bound", _wrap_set_ptc_upper_bound, METH_VARARGS, (char *)"set_ptc_upper_bound(set_ptc self, key_type x) -> iterator"},
-	 { (char *)"set_ptc_equal_range", _wrap_set_ptc_equal_range, METH_VARARGS, (char *)"set_ptc_equal_range(set_ptc self, key_type x) -> std::pair<(std::set<(p.steps::wm::Patch)>::iterator,std::set<(p.steps::wm::Patch)>::iterator)>"},
-	 { (char *)"set_ptc_insert", _wrap_set_ptc_insert, METH_VARARGS, (char *)"set_ptc_insert(set_ptc self, value_type __x) -> std::pair<(std::set<(p.steps::wm::Patch)>::iterator,bool)>"},
-	 { (char *)"delete_set_ptc", _wrap_delete_set_ptc, METH_VARARGS, (char *)"delete_set_ptc(set_ptc self)"},
-	 { (char *)"set_ptc_swigregister", set_ptc_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_ptc_iterator", _wrap_vector_ptc_iterator, METH_VARARGS, (char *)"vector_ptc_iterator(vector_ptc self) -> SwigPyIterator"},
-	 { (char *)"vector_ptc___nonzero__", _wrap_vector_ptc___nonzero__, METH_VARARGS, (char *)"vector_ptc___nonzero__(vector_ptc self) -> bool"},
-	 { (char *)"vector_ptc___bool__", _wrap_vector_ptc___bool__, METH_VARARGS, (char *)"vector_ptc___bool__(vector_ptc self) -> bool"},
-	 { (char *)"vector_ptc___len__", _wrap_vector_ptc___len__, METH_VARARGS, (char *)"vector_ptc___len__(vector_ptc self) -> size_type"},
-	 { (char *)"vector_ptc_pop", _wrap_vector_ptc_pop, METH_VARARGS, (char *)"vector_ptc_pop(vector_ptc self) -> value_type"},
-	 { (char *)"vector_ptc___getslice__", _wrap_vector_ptc___getslice__, METH_VARARGS, (char *)"vector_ptc___getslice__(vector_ptc self, difference_type i, difference_type j) -> vector_ptc"},
-	 { (char *)"vector_ptc___setslice__", _wrap_vector_ptc___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_ptc___setslice__(vector_ptc self, difference_type i, difference_type j, \n"
-		"    vector_ptc v)\n"
-		""},
-	 { (char *)"vector_ptc___delslice__", _wrap_vector_ptc___delslice__, METH_VARARGS, (char *)"vector_ptc___delslice__(vector_ptc self, difference_type i, difference_type j)"},
-	 { (char *)"vector_ptc___delitem__", _wrap_vector_ptc___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_ptc___delitem__(vector_ptc self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_ptc___getitem__", _wrap_vector_ptc___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_ptc\n"
-		"vector_ptc___getitem__(vector_ptc self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_ptc___setitem__", _wrap_vector_ptc___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_ptc v)\n"
-		"vector_ptc___setitem__(vector_ptc self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_ptc_append", _wrap_vector_ptc_append, METH_VARARGS, (char *)"vector_ptc_append(vector_ptc self, value_type x)"},
-	 { (char *)"vector_ptc_empty", _wrap_vector_ptc_empty, METH_VARARGS, (char *)"vector_ptc_empty(vector_ptc self) -> bool"},
-	 { (char *)"vector_ptc_size", _wrap_vector_ptc_size, METH_VARARGS, (char *)"vector_ptc_size(vector_ptc self) -> size_type"},
-	 { (char *)"vector_ptc_clear", _wrap_vector_ptc_clear, METH_VARARGS, (char *)"vector_ptc_clear(vector_ptc self)"},
-	 { (char *)"vector_ptc_swap", _wrap_vector_ptc_swap, METH_VARARGS, (char *)"vector_ptc_swap(vector_ptc self, vector_ptc v)"},
-	 { (char *)"vector_ptc_get_allocator", _wrap_vector_ptc_get_allocator, METH_VARARGS, (char *)"vector_ptc_get_allocator(vector_ptc self) -> allocator_type"},
-	 { (char *)"vector_ptc_begin", _wrap_vector_ptc_begin, METH_VARARGS, (char *)"vector_ptc_begin(vector_ptc self) -> const_iterator"},
-	 { (char *)"vector_ptc_end", _wrap_vector_ptc_end, METH_VARARGS, (char *)"vector_ptc_end(vector_ptc self) -> const_iterator"},
-	 { (char *)"vector_ptc_rbegin", _wrap_vector_ptc_rbegin, METH_VARARGS, (char *)"vector_ptc_rbegin(vector_ptc self) -> const_reverse_iterator"},
-	 { (char *)"vector_ptc_rend", _wrap_vector_ptc_rend, METH_VARARGS, (char *)"vector_ptc_rend(vector_ptc self) -> const_reverse_iterator"},
-	 { (char *)"vector_ptc_pop_back", _wrap_vector_ptc_pop_back, METH_VARARGS, (char *)"vector_ptc_pop_back(vector_ptc self)"},
-	 { (char *)"vector_ptc_erase", _wrap_vector_ptc_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_ptc_erase(vector_ptc self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_ptc", _wrap_new_vector_ptc, METH_VARARGS, (char *)"\n"
-		"vector_ptc()\n"
-		"vector_ptc(vector_ptc arg0)\n"
-		"vector_ptc(size_type size)\n"
-		"new_vector_ptc(size_type size, value_type value) -> vector_ptc\n"
-		""},
-	 { (char *)"vector_ptc_push_back", _wrap_vector_ptc_push_back, METH_VARARGS, (char *)"vector_ptc_push_back(vector_ptc self, value_type x)"},
-	 { (char *)"vector_ptc_front", _wrap_vector_ptc_front, METH_VARARGS, (char *)"vector_ptc_front(vector_ptc self) -> value_type"},
-	 { (char *)"vector_ptc_back", _wrap_vector_ptc_back, METH_VARARGS, (char *)"vector_ptc_back(vector_ptc self) -> value_type"},
-	 { (char *)"vector_ptc_assign", _wrap_vector_ptc_assign, METH_VARARGS, (char *)"vector_ptc_assign(vector_ptc self, size_type n, value_type x)"},
-	 { (char *)"vector_ptc_resize", _wrap_vector_ptc_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_ptc_resize(vector_ptc self, size_type new_size, value_type x)\n"
-		""},
-	 { (char *)"vector_ptc_insert", _wrap_vector_ptc_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_ptc_insert(vector_ptc self, iterator pos, size_type n, value_type x)\n"
-		""},
-	 { (char *)"vector_ptc_reserve", _wrap_vector_ptc_reserve, METH_VARARGS, (char *)"vector_ptc_reserve(vector_ptc self, size_type n)"},
-	 { (char *)"vector_ptc_capacity", _wrap_vector_ptc_capacity, METH_VARARGS, (char *)"vector_ptc_capacity(vector_ptc self) -> size_type"},
-	 { (char *)"delete_vector_ptc", _wrap_delete_vector_ptc, METH_VARARGS, (char *)"delete_vector_ptc(vector_ptc self)"},
-	 { (char *)"vector_ptc_swigregister", vector_ptc_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_cmp_iterator", _wrap_vector_cmp_iterator, METH_VARARGS, (char *)"vector_cmp_iterator(vector_cmp self) -> SwigPyIterator"},
-	 { (char *)"vector_cmp___nonzero__", _wrap_vector_cmp___nonzero__, METH_VARARGS, (char *)"vector_cmp___nonzero__(vector_cmp self) -> bool"},
-	 { (char *)"vector_cmp___bool__", _wrap_vector_cmp___bool__, METH_VARARGS, (char *)"vector_cmp___bool__(vector_cmp self) -> bool"},
-	 { (char *)"vector_cmp___len__", _wrap_vector_cmp___len__, METH_VARARGS, (char *)"vector_cmp___len__(vector_cmp self) -> size_type"},
-	 { (char *)"vector_cmp_pop", _wrap_vector_cmp_pop, METH_VARARGS, (char *)"vector_cmp_pop(vector_cmp self) -> value_type"},
-	 { (char *)"vector_cmp___getslice__", _wrap_vector_cmp___getslice__, METH_VARARGS, (char *)"vector_cmp___getslice__(vector_cmp self, difference_type i, difference_type j) -> vector_cmp"},
-	 { (char *)"vector_cmp___setslice__", _wrap_vector_cmp___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_cmp___setslice__(vector_cmp self, difference_type i, difference_type j, \n"
-		"    vector_cmp v)\n"
-		""},
-	 { (char *)"vector_cmp___delslice__", _wrap_vector_cmp___delslice__, METH_VARARGS, (char *)"vector_cmp___delslice__(vector_cmp self, difference_type i, difference_type j)"},
-	 { (char *)"vector_cmp___delitem__", _wrap_vector_cmp___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_cmp___delitem__(vector_cmp self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_cmp___getitem__", _wrap_vector_cmp___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_cmp\n"
-		"vector_cmp___getitem__(vector_cmp self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_cmp___setitem__", _wrap_vector_cmp___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_cmp v)\n"
-		"vector_cmp___setitem__(vector_cmp self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_cmp_append", _wrap_vector_cmp_append, METH_VARARGS, (char *)"vector_cmp_append(vector_cmp self, value_type x)"},
-	 { (char *)"vector_cmp_empty", _wrap_vector_cmp_empty, METH_VARARGS, (char *)"vector_cmp_empty(vector_cmp self) -> bool"},
-	 { (char *)"vector_cmp_size", _wrap_vector_cmp_size, METH_VARARGS, (char *)"vector_cmp_size(vector_cmp self) -> size_type"},
-	 { (char *)"vector_cmp_clear", _wrap_vector_cmp_clear, METH_VARARGS, (char *)"vector_cmp_clear(vector_cmp self)"},
-	 { (char *)"vector_cmp_swap", _wrap_vector_cmp_swap, METH_VARARGS, (char *)"vector_cmp_swap(vector_cmp self, vector_cmp v)"},
-	 { (char *)"vector_cmp_get_allocator", _wrap_vector_cmp_get_allocator, METH_VARARGS, (char *)"vector_cmp_get_allocator(vector_cmp self) -> allocator_type"},
-	 { (char *)"vector_cmp_begin", _wrap_vector_cmp_begin, METH_VARARGS, (char *)"vector_cmp_begin(vector_cmp self) -> const_iterator"},
-	 { (char *)"vector_cmp_end", _wrap_vector_cmp_end, METH_VARARGS, (char *)"vector_cmp_end(vector_cmp self) -> const_iterator"},
-	 { (char *)"vector_cmp_rbegin", _wrap_vector_cmp_rbegin, METH_VARARGS, (char *)"vector_cmp_rbegin(vector_cmp self) -> const_reverse_iterator"},
-	 { (char *)"vector_cmp_rend", _wrap_vector_cmp_rend, METH_VARARGS, (char *)"vector_cmp_rend(vector_cmp self) -> const_reverse_iterator"},
-	 { (char *)"vector_cmp_pop_back", _wrap_vector_cmp_pop_back, METH_VARARGS, (char *)"vector_cmp_pop_back(vector_cmp self)"},
-	 { (char *)"vector_cmp_erase", _wrap_vector_cmp_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_cmp_erase(vector_cmp self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_cmp", _wrap_new_vector_cmp, METH_VARARGS, (char *)"\n"
-		"vector_cmp()\n"
-		"vector_cmp(vector_cmp arg0)\n"
-		"vector_cmp(size_type size)\n"
-		"new_vector_cmp(size_type size, value_type value) -> vector_cmp\n"
-		""},
-	 { (char *)"vector_cmp_push_back", _wrap_vector_cmp_push_back, METH_VARARGS, (char *)"vector_cmp_push_back(vector_cmp self, value_type x)"},
-	 { (char *)"vector_cmp_front", _wrap_vector_cmp_front, METH_VARARGS, (char *)"vector_cmp_front(vector_cmp self) -> value_type"},
-	 { (char *)"vector_cmp_back", _wrap_vector_cmp_back, METH_VARARGS, (char *)"vector_cmp_back(vector_cmp self) -> value_type"},
-	 { (char *)"vector_cmp_assign", _wrap_vector_cmp_assign, METH_VARARGS, (char *)"vector_cmp_assign(vector_cmp self, size_type n, value_type x)"},
-	 { (char *)"vector_cmp_resize", _wrap_vector_cmp_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_cmp_resize(vector_cmp self, size_type new_size, value_type x)\n"
-		""},
-	 { (char *)"vector_cmp_insert", _wrap_vector_cmp_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_cmp_insert(vector_cmp self, iterator pos, size_type n, value_type x)\n"
-		""},
-	 { (char *)"vector_cmp_reserve", _wrap_vector_cmp_reserve, METH_VARARGS, (char *)"vector_cmp_reserve(vector_cmp self, size_type n)"},
-	 { (char *)"vector_cmp_capacity", _wrap_vector_cmp_capacity, METH_VARARGS, (char *)"vector_cmp_capacity(vector_cmp self) -> size_type"},
-	 { (char *)"delete_vector_cmp", _wrap_delete_vector_cmp, METH_VARARGS, (char *)"delete_vector_cmp(vector_cmp self)"},
-	 { (char *)"vector_cmp_swigregister", vector_cmp_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_int_iterator", _wrap_vector_int_iterator, METH_VARARGS, (char *)"vector_int_iterator(vector_int self) -> SwigPyIterator"},
-	 { (char *)"vector_int___nonzero__", _wrap_vector_int___nonzero__, METH_VARARGS, (char *)"vector_int___nonzero__(vector_int self) -> bool"},
-	 { (char *)"vector_int___bool__", _wrap_vector_int___bool__, METH_VARARGS, (char *)"vector_int___bool__(vector_int self) -> bool"},
-	 { (char *)"vector_int___len__", _wrap_vector_int___len__, METH_VARARGS, (char *)"vector_int___len__(vector_int self) -> size_type"},
-	 { (char *)"vector_int_pop", _wrap_vector_int_pop, METH_VARARGS, (char *)"vector_int_pop(vector_int self) -> value_type"},
-	 { (char *)"vector_int___getslice__", _wrap_vector_int___getslice__, METH_VARARGS, (char *)"vector_int___getslice__(vector_int self, difference_type i, difference_type j) -> vector_int"},
-	 { (char *)"vector_int___setslice__", _wrap_vector_int___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_int___setslice__(vector_int self, difference_type i, difference_type j, \n"
-		"    vector_int v)\n"
-		""},
-	 { (char *)"vector_int___delslice__", _wrap_vector_int___delslice__, METH_VARARGS, (char *)"vector_int___delslice__(vector_int self, difference_type i, difference_type j)"},
-	 { (char *)"vector_int___delitem__", _wrap_vector_int___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_int___delitem__(vector_int self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_int___getitem__", _wrap_vector_int___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_int\n"
-		"vector_int___getitem__(vector_int self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_int___setitem__", _wrap_vector_int___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_int v)\n"
-		"vector_int___setitem__(vector_int self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_int_append", _wrap_vector_int_append, METH_VARARGS, (char *)"vector_int_append(vector_int self, value_type x)"},
-	 { (char *)"vector_int_empty", _wrap_vector_int_empty, METH_VARARGS, (char *)"vector_int_empty(vector_int self) -> bool"},
-	 { (char *)"vector_int_size", _wrap_vector_int_size, METH_VARARGS, (char *)"vector_int_size(vector_int self) -> size_type"},
-	 { (char *)"vector_int_clear", _wrap_vector_int_clear, METH_VARARGS, (char *)"vector_int_clear(vector_int self)"},
-	 { (char *)"vector_int_swap", _wrap_vector_int_swap, METH_VARARGS, (char *)"vector_int_swap(vector_int self, vector_int v)"},
-	 { (char *)"vector_int_get_allocator", _wrap_vector_int_get_allocator, METH_VARARGS, (char *)"vector_int_get_allocator(vector_int self) -> allocator_type"},
-	 { (char *)"vector_int_begin", _wrap_vector_int_begin, METH_VARARGS, (char *)"vector_int_begin(vector_int self) -> const_iterator"},
-	 { (char *)"vector_int_end", _wrap_vector_int_end, METH_VARARGS, (char *)"vector_int_end(vector_int self) -> const_iterator"},
-	 { (char *)"vector_int_rbegin", _wrap_vector_int_rbegin, METH_VARARGS, (char *)"vector_int_rbegin(vector_int self) -> const_reverse_iterator"},
-	 { (char *)"vector_int_rend", _wrap_vector_int_rend, METH_VARARGS, (char *)"vector_int_rend(vector_int self) -> const_reverse_iterator"},
-	 { (char *)"vector_int_pop_back", _wrap_vector_int_pop_back, METH_VARARGS, (char *)"vector_int_pop_back(vector_int self)"},
-	 { (char *)"vector_int_erase", _wrap_vector_int_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_int_erase(vector_int self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_int", _wrap_new_vector_int, METH_VARARGS, (char *)"\n"
-		"vector_int()\n"
-		"vector_int(vector_int arg0)\n"
-		"vector_int(size_type size)\n"
-		"new_vector_int(size_type size, value_type value) -> vector_int\n"
-		""},
-	 { (char *)"vector_int_push_back", _wrap_vector_int_push_back, METH_VARARGS, (char *)"vector_int_push_back(vector_int self, value_type x)"},
-	 { (char *)"vector_int_front", _wrap_vector_int_front, METH_VARARGS, (char *)"vector_int_front(vector_int self) -> value_type"},
-	 { (char *)"vector_int_back", _wrap_vector_int_back, METH_VARARGS, (char *)"vector_int_back(vector_int self) -> value_type"},
-	 { (char *)"vector_int_assign", _wrap_vector_int_assign, METH_VARARGS, (char *)"vector_int_assign(vector_int self, size_type n, value_type x)"},
-	 { (char *)"vector_int_resize", _wrap_vector_int_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_int_resize(vector_int self, size_type new_size, value_type x)\n"
-		""},
-	 { (char *)"vector_int_insert", _wrap_vector_int_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_int_insert(vector_int self, iterator pos, size_type n, value_type x)\n"
-		""},
-	 { (char *)"vector_int_reserve", _wrap_vector_int_reserve, METH_VARARGS, (char *)"vector_int_reserve(vector_int self, size_type n)"},
-	 { (char *)"vector_int_capacity", _wrap_vector_int_capacity, METH_VARARGS, (char *)"vector_int_capacity(vector_int self) -> size_type"},
-	 { (char *)"delete_vector_int", _wrap_delete_vector_int, METH_VARARGS, (char *)"delete_vector_int(vector_int self)"},
-	 { (char *)"vector_int_swigregister", vector_int_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_uint_iterator", _wrap_vector_uint_iterator, METH_VARARGS, (char *)"vector_uint_iterator(vector_uint self) -> SwigPyIterator"},
-	 { (char *)"vector_uint___nonzero__", _wrap_vector_uint___nonzero__, METH_VARARGS, (char *)"vector_uint___nonzero__(vector_uint self) -> bool"},
-	 { (char *)"vector_uint___bool__", _wrap_vector_uint___bool__, METH_VARARGS, (char *)"vector_uint___bool__(vector_uint self) -> bool"},
-	 { (char *)"vector_uint___len__", _wrap_vector_uint___len__, METH_VARARGS, (char *)"vector_uint___len__(vector_uint self) -> size_type"},
-	 { (char *)"vector_uint_pop", _wrap_vector_uint_pop, METH_VARARGS, (char *)"vector_uint_pop(vector_uint self) -> value_type"},
-	 { (char *)"vector_uint___getslice__", _wrap_vector_uint___getslice__, METH_VARARGS, (char *)"vector_uint___getslice__(vector_uint self, difference_type i, difference_type j) -> vector_uint"},
-	 { (char *)"vector_uint___setslice__", _wrap_vector_uint___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_uint___setslice__(vector_uint self, difference_type i, difference_type j, \n"
-		"    vector_uint v)\n"
-		""},
-	 { (char *)"vector_uint___delslice__", _wrap_vector_uint___delslice__, METH_VARARGS, (char *)"vector_uint___delslice__(vector_uint self, difference_type i, difference_type j)"},
-	 { (char *)"vector_uint___delitem__", _wrap_vector_uint___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_uint___delitem__(vector_uint self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_uint___getitem__", _wrap_vector_uint___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_uint\n"
-		"vector_uint___getitem__(vector_uint self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_uint___setitem__", _wrap_vector_uint___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_uint v)\n"
-		"vector_uint___setitem__(vector_uint self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_uint_append", _wrap_vector_uint_append, METH_VARARGS, (char *)"vector_uint_append(vector_uint self, value_type x)"},
-	 { (char *)"vector_uint_empty", _wrap_vector_uint_empty, METH_VARARGS, (char *)"vector_uint_empty(vector_uint self) -> bool"},
-	 { (char *)"vector_uint_size", _wrap_vector_uint_size, METH_VARARGS, (char *)"vector_uint_size(vector_uint self) -> size_type"},
-	 { (char *)"vector_uint_clear", _wrap_vector_uint_clear, METH_VARARGS, (char *)"vector_uint_clear(vector_uint self)"},
-	 { (char *)"vector_uint_swap", _wrap_vector_uint_swap, METH_VARARGS, (char *)"vector_uint_swap(vector_uint self, vector_uint v)"},
-	 { (char *)"vector_uint_get_allocator", _wrap_vector_uint_get_allocator, METH_VARARGS, (char *)"vector_uint_get_allocator(vector_uint self) -> allocator_type"},
-	 { (char *)"vector_uint_begin", _wrap_vector_uint_begin, METH_VARARGS, (char *)"vector_uint_begin(vector_uint self) -> const_iterator"},
-	 { (char *)"vector_uint_end", _wrap_vector_uint_end, METH_VARARGS, (char *)"vector_uint_end(vector_uint self) -> const_iterator"},
-	 { (char *)"vector_uint_rbegin", _wrap_vector_uint_rbegin, METH_VARARGS, (char *)"vector_uint_rbegin(vector_uint self) -> const_reverse_iterator"},
-	 { (char *)"vector_uint_rend", _wrap_vector_uint_rend, METH_VARARGS, (char *)"vector_uint_rend(vector_uint self) -> const_reverse_iterator"},
-	 { (char *)"vector_uint_pop_back", _wrap_vector_uint_pop_back, METH_VARARGS, (char *)"vector_uint_pop_back(vector_uint self)"},
-	 { (char *)"vector_uint_erase", _wrap_vector_uint_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_uint_erase(vector_uint self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_uint", _wrap_new_vector_uint, METH_VARARGS, (char *)"\n"
-		"vector_uint()\n"
-		"vector_uint(vector_uint arg0)\n"
-		"vector_uint(size_type size)\n"
-		"new_vector_uint(size_type size, value_type value) -> vector_uint\n"
-		""},
-	 { (char *)"vector_uint_push_back", _wrap_vector_uint_push_back, METH_VARARGS, (char *)"vector_uint_push_back(vector_uint self, value_type x)"},
-	 { (char *)"vector_uint_front", _wrap_vector_uint_front, METH_VARARGS, (char *)"vector_uint_front(vector_uint self) -> value_type"},
-	 { (char *)"vector_uint_back", _wrap_vector_uint_back, METH_VARARGS, (char *)"vector_uint_back(vector_uint self) -> value_type"},
-	 { (char *)"vector_uint_assign", _wrap_vector_uint_assign, METH_VARARGS, (char *)"vector_uint_assign(vector_uint self, size_type n, value_type x)"},
-	 { (char *)"vector_uint_resize", _wrap_vector_uint_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_uint_resize(vector_uint self, size_type new_size, value_type x)\n"
-		""},
-	 { (char *)"vector_uint_insert", _wrap_vector_uint_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_uint_insert(vector_uint self, iterator pos, size_type n, value_type x)\n"
-		""},
-	 { (char *)"vector_uint_reserve", _wrap_vector_uint_reserve, METH_VARARGS, (char *)"vector_uint_reserve(vector_uint self, size_type n)"},
-	 { (char *)"vector_uint_capacity", _wrap_vector_uint_capacity, METH_VARARGS, (char *)"vector_uint_capacity(vector_uint self) -> size_type"},
-	 { (char *)"delete_vector_uint", _wrap_delete_vector_uint, METH_VARARGS, (char *)"delete_vector_uint(vector_uint self)"},
-	 { (char *)"vector_uint_swigregister", vector_uint_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_dbl_iterator", _wrap_vector_dbl_iterator, METH_VARARGS, (char *)"vector_dbl_iterator(vector_dbl self) -> SwigPyIterator"},
-	 { (char *)"vector_dbl___nonzero__", _wrap_vector_dbl___nonzero__, METH_VARARGS, (char *)"vector_dbl___nonzero__(vector_dbl self) -> bool"},
-	 { (char *)"vector_dbl___bool__", _wrap_vector_dbl___bool__, METH_VARARGS, (char *)"vector_dbl___bool__(vector_dbl self) -> bool"},
-	 { (char *)"vector_dbl___len__", _wrap_vector_dbl___len__, METH_VARARGS, (char *)"vector_dbl___len__(vector_dbl self) -> size_type"},
-	 { (char *)"vector_dbl_pop", _wrap_vector_dbl_pop, METH_VARARGS, (char *)"vector_dbl_pop(vector_dbl self) -> value_type"},
-	 { (char *)"vector_dbl___getslice__", _wrap_vector_dbl___getslice__, METH_VARARGS, (char *)"vector_dbl___getslice__(vector_dbl self, difference_type i, difference_type j) -> vector_dbl"},
-	 { (char *)"vector_dbl___setslice__", _wrap_vector_dbl___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_dbl___setslice__(vector_dbl self, difference_type i, difference_type j, \n"
-		"    vector_dbl v)\n"
-		""},
-	 { (char *)"vector_dbl___delslice__", _wrap_vector_dbl___delslice__, METH_VARARGS, (char *)"vector_dbl___delslice__(vector_dbl self, difference_type i, difference_type j)"},
-	 { (char *)"vector_dbl___delitem__", _wrap_vector_dbl___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_dbl___delitem__(vector_dbl self, PySliceObject slice)\n"
-		""},
-	 { (char *)"vector_dbl___getitem__", _wrap_vector_dbl___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_dbl\n"
-		"vector_dbl___getitem__(vector_dbl self, difference_type i) -> value_type\n"
-		""},
-	 { (char *)"vector_dbl___setitem__", _wrap_vector_dbl___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_dbl v)\n"
-		"vector_dbl___setitem__(vector_dbl self, difference_type i, value_type x)\n"
-		""},
-	 { (char *)"vector_dbl_append", _wrap_vector_dbl_append, METH_VARARGS, (char *)"vector_dbl_append(vector_dbl self, value_type x)"},
-	 { (char *)"vector_dbl_empty", _wrap_vector_dbl_empty, METH_VARARGS, (char *)"vector_dbl_empty(vector_dbl self) -> bool"},
-	 { (char *)"vector_dbl_size", _wrap_vector_dbl_size, METH_VARARGS, (char *)"vector_dbl_size(vector_dbl self) -> size_type"},
-	 { (char *)"vector_dbl_clear", _wrap_vector_dbl_clear, METH_VARARGS, (char *)"vector_dbl_clear(vector_dbl self)"},
-	 { (char *)"vector_dbl_swap", _wrap_vector_dbl_swap, METH_VARARGS, (char *)"vector_dbl_swap(vector_dbl self, vector_dbl v)"},
-	 { (char *)"vector_dbl_get_allocator", _wrap_vector_dbl_get_allocator, METH_VARARGS, (char *)"vector_dbl_get_allocator(vector_dbl self) -> allocator_type"},
-	 { (char *)"vector_dbl_begin", _wrap_vector_dbl_begin, METH_VARARGS, (char *)"vector_dbl_begin(vector_dbl self) -> const_iterator"},
-	 { (char *)"vector_dbl_end", _wrap_vector_dbl_end, METH_VARARGS, (char *)"vector_dbl_end(vector_dbl self) -> const_iterator"},
-	 { (char *)"vector_dbl_rbegin", _wrap_vector_dbl_rbegin, METH_VARARGS, (char *)"vector_dbl_rbegin(vector_dbl self) -> const_reverse_iterator"},
-	 { (char *)"vector_dbl_rend", _wrap_vector_dbl_rend, METH_VARARGS, (char *)"vector_dbl_rend(vector_dbl self) -> const_reverse_iterator"},
-	 { (char *)"vector_dbl_pop_back", _wrap_vector_dbl_pop_back, METH_VARARGS, (char *)"vector_dbl_pop_back(vector_dbl self)"},
-	 { (char *)"vector_dbl_erase", _wrap_vector_dbl_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_dbl_erase(vector_dbl self, iterator first, iterator last) -> iterator\n"
-		""},
-	 { (char *)"new_vector_dbl", _wrap_new_vector_dbl, METH_VARARGS, (char *)"\n"
-		"vector_dbl()\n"
-		"vector_dbl(vector_dbl arg0)\n"
-		"vector_dbl(size_type size)\n"
-		"new_vector_dbl(size_type size, value_type value) -> vector_dbl\n"
-		""},
-	 { (char *)"vector_dbl_push_back", _wrap_vector_dbl_push_back, METH_VARARGS, (char *)"vector_dbl_push_back(vector_dbl self, value_type x)"},
-	 { (char *)"vector_dbl_front", _wrap_vector_dbl_front, METH_VARARGS, (char *)"vector_dbl_front(vector_dbl self) -> value_type"},
-	 { (char *)"vector_dbl_back", _wrap_vector_dbl_back, METH_VARARGS, (char *)"vector_dbl_back(vector_dbl self) -> value_type"},
-	 { (char *)"vector_dbl_assign", _wrap_vector_dbl_assign, METH_VARARGS, (char *)"vector_dbl_assign(vector_dbl self, size_type n, value_type x)"},
-	 { (char *)"vector_dbl_resize", _wrap_vector_dbl_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_dbl_resize(vector_dbl self, size_type new_size, value_type x)\n"
-		""},
-	 { (char *)"vector_dbl_insert", _wrap_vector_dbl_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_dbl_insert(vector_dbl self, iterator pos, size_type n, value_type x)\n"
-		""},
-	 { (char *)"vector_dbl_reserve", _wrap_vector_dbl_reserve, METH_VARARGS, (char *)"vector_dbl_reserve(vector_dbl self, size_type n)"},
-	 { (char *)"vector_dbl_capacity", _wrap_vector_dbl_capacity, METH_VARARGS, (char *)"vector_dbl_capacity(vector_dbl self) -> size_type"},
-	 { (char *)"delete_vector_dbl", _wrap_delete_vector_dbl, METH_VARARGS, (char *)"delete_vector_dbl(vector_dbl self)"},
-	 { (char *)"vector_dbl_swigregister", vector_dbl_swigregister, METH_VARARGS, NULL},
-	 { (char *)"vector_bool_iterator", _wrap_vector_bool_iterator, METH_VARARGS, (char *)"vector_bool_iterator(vector_bool self) -> SwigPyIterator"},
-	 { (char *)"vector_bool___nonzero__", _wrap_vector_bool___nonzero__, METH_VARARGS, (char *)"vector_bool___nonzero__(vector_bool self) -> bool"},
-	 { (char *)"vector_bool___bool__", _wrap_vector_bool___bool__, METH_VARARGS, (char *)"vector_bool___bool__(vector_bool self) -> bool"},
-	 { (char *)"vector_bool___len__", _wrap_vector_bool___len__, METH_VARARGS, (char *)"vector_bool___len__(vector_bool self) -> size_type"},
-	 { (char *)"vector_bool_pop", _wrap_vector_bool_pop, METH_VARARGS, (char *)"vector_bool_pop(vector_bool self) -> value_type"},
-	 { (char *)"vector_bool___getslice__", _wrap_vector_bool___getslice__, METH_VARARGS, (char *)"vector_bool___getslice__(vector_bool self, difference_type i, difference_type j) -> vector_bool"},
-	 { (char *)"vector_bool___setslice__", _wrap_vector_bool___setslice__, METH_VARARGS, (char *)"\n"
-		"vector_bool___setslice__(vector_bool self, difference_type i, difference_type j, \n"
-		"    vector_bool v)\n"
+	 { (char *)"Tetmesh_getTetTriNeighb", _wrap_Tetmesh_getTetTriNeighb, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the four neighbouring triangles of tetrahedron with index tidx.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getTetTriNeighb(tidx)\n"
+		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    list<uint, length = 4>\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool___delslice__", _wrap_vector_bool___delslice__, METH_VARARGS, (char *)"vector_bool___delslice__(vector_bool self, difference_type i, difference_type j)"},
-	 { (char *)"vector_bool___delitem__", _wrap_vector_bool___delitem__, METH_VARARGS, (char *)"\n"
-		"__delitem__(difference_type i)\n"
-		"vector_bool___delitem__(vector_bool self, PySliceObject slice)\n"
+	 { (char *)"Tetmesh_getTetTetNeighb", _wrap_Tetmesh_getTetTetNeighb, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the four neighbouring tetrahedrons of tetrahedron with index tidx. \n"
+		"An index of -1 indicates no neighbour (tetrahedron is on the mesh border).\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getTetTetNeighb(tidx)\n"
+		"\n"
+		"Arguments:\n"
+		"    uint tidx\n"
+		"             \n"
+		"Return:\n"
+		"    list<int, length = 4>\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool___getitem__", _wrap_vector_bool___getitem__, METH_VARARGS, (char *)"\n"
-		"__getitem__(PySliceObject slice) -> vector_bool\n"
-		"vector_bool___getitem__(vector_bool self, difference_type i) -> value_type\n"
+	 { (char *)"Tetmesh_findTetByPoint", _wrap_Tetmesh_findTetByPoint, METH_VARARGS, (char *)"\n"
+		"Returns the index of the tetrahedron which encompasses a given point \n"
+		"p (given in Cartesian coordinates x,y,z). Returns -1 if p is a position \n"
+		"outside the mesh.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    findTetByPoint(p)\n"
+		"\n"
+		"Arguments:\n"
+		"    list<float, length = 3> p\n"
+		"             \n"
+		"Return:\n"
+		"    int\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool___setitem__", _wrap_vector_bool___setitem__, METH_VARARGS, (char *)"\n"
-		"__setitem__(PySliceObject slice, vector_bool v)\n"
-		"vector_bool___setitem__(vector_bool self, difference_type i, value_type x)\n"
+	 { (char *)"Tetmesh_findTetsByPoints", _wrap_Tetmesh_findTetsByPoints, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the tetrahedra which encompass a list of points \n"
+		"p, given as a flat list of Cartesian coordinates x0,y0,z0,x1,y1,z1,... \n"
+		"For each point the result is the same as findTetByPoint; -1 is returned \n"
+		"for points outside the mesh.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    findTetsByPoints(p)\n"
+		"\n"
+		"Arguments:\n"
+		"    list<float, length = 3 * n> p\n"
+		"             \n"
+		"Return:\n"
+		"    list<int, length = n>\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool_append", _wrap_vector_bool_append, METH_VARARGS, (char *)"vector_bool_append(vector_bool self, value_type x)"},
-	 { (char *)"vector_bool_empty", _wrap_vector_bool_empty, METH_VARARGS, (char *)"vector_bool_empty(vector_bool self) -> bool"},
-	 { (char *)"vector_bool_size", _wrap_vector_bool_size, METH_VARARGS, (char *)"vector_bool_size(vector_bool self) -> size_type"},
-	 { (char *)"vector_bool_clear", _wrap_vector_bool_clear, METH_VARARGS, (char *)"vector_bool_clear(vector_bool self)"},
-	 { (char *)"vector_bool_swap", _wrap_vector_bool_swap, METH_VARARGS, (char *)"vector_bool_swap(vector_bool self, vector_bool v)"},
-	 { (char *)"vector_bool_get_allocator", _wrap_vector_bool_get_allocator, METH_VARARGS, (char *)"vector_bool_get_allocator(vector_bool self) -> allocator_type"},
-	 { (char *)"vector_bool_begin", _wrap_vector_bool_begin, METH_VARARGS, (char *)"vector_bool_begin(vector_bool self) -> const_iterator"},
-	 { (char *)"vector_bool_end", _wrap_vector_bool_end, METH_VARARGS, (char *)"vector_bool_end(vector_bool self) -> const_iterator"},
-	 { (char *)"vector_bool_rbegin", _wrap_vector_bool_rbegin, METH_VARARGS, (char *)"vector_bool_rbegin(vector_bool self) -> const_reverse_iterator"},
-	 { (char *)"vector_bool_rend", _wrap_vector_bool_rend, METH_VARARGS, (char *)"vector_bool_rend(vector_bool self) -> const_reverse_iterator"},
-	 { (char *)"vector_bool_pop_back", _wrap_vector_bool_pop_back, METH_VARARGS, (char *)"vector_bool_pop_back(vector_bool self)"},
-	 { (char *)"vector_bool_erase", _wrap_vector_bool_erase, METH_VARARGS, (char *)"\n"
-		"erase(iterator pos) -> iterator\n"
-		"vector_bool_erase(vector_bool self, iterator first, iterator last) -> iterator\n"
+	 { (char *)"Tetmesh_getBoundMin", _wrap_Tetmesh_getBoundMin, METH_VARARGS, (char *)"\n"
+		"Returns the minimal Cartesian coordinate of the rectangular bounding box of the mesh. \n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getBoundMin()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<float, length = 3>\n"
+		"\n"
 		""},
-	 { (char *)"new_vector_bool", _wrap_new_vector_bool, METH_VARARGS, (char *)"\n"
-		"vector_bool()\n"
-		"vector_bool(vector_bool arg0)\n"
-		"vector_bool(size_type size)\n"
-		"new_vector_bool(size_type size, value_type value) -> vector_bool\n"
+	 { (char *)"Tetmesh_getBoundMax", _wrap_Tetmesh_getBoundMax, METH_VARARGS, (char *)"\n"
+		"Returns the maximal Cartesian coordinate of the rectangular bounding box of the mesh. \n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getBoundMax()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<float, length = 3>\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool_push_back", _wrap_vector_bool_push_back, METH_VARARGS, (char *)"vector_bool_push_back(vector_bool self, value_type x)"},
-	 { (char *)"vector_bool_front", _wrap_vector_bool_front, METH_VARARGS, (char *)"vector_bool_front(vector_bool self) -> value_type"},
-	 { (char *)"vector_bool_back", _wrap_vector_bool_back, METH_VARARGS, (char *)"vector_bool_back(vector_bool self) -> value_type"},
-	 { (char *)"vector_bool_assign", _wrap_vector_bool_assign, METH_VARARGS, (char *)"vector_bool_assign(vector_bool self, size_type n, value_type x)"},
-	 { (char *)"vector_bool_resize", _wrap_vector_bool_resize, METH_VARARGS, (char *)"\n"
-		"resize(size_type new_size)\n"
-		"vector_bool_resize(vector_bool self, size_type new_size, value_type x)\n"
+	 { (char *)"Tetmesh_getMeshVolume", _wrap_Tetmesh_getMeshVolume, METH_VARARGS, (char *)"\n"
+		"Returns the total volume of the mesh. \n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getMeshVolume()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    float\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool_insert", _wrap_vector_bool_insert, METH_VARARGS, (char *)"\n"
-		"insert(iterator pos, value_type x) -> iterator\n"
-		"vector_bool_insert(vector_bool self, iterator pos, size_type n, value_type x)\n"
+	 { (char *)"Tetmesh_swigregister", Tetmesh_swigregister, METH_VARARGS, NULL},
+	 { (char *)"saveBinary", _wrap_saveBinary, METH_VARARGS, (char *)"\n"
+		"Saves a Tetmesh, with its compartments and patches, to a binary file \n"
+		"which can be loaded by loadBinary. The file holds all the data the \n"
+		"Tetmesh constructor would otherwise compute, in a layout that can be \n"
+		"memory-mapped.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    saveBinary(pathname, mesh)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string pathname\n"
+		"    * steps.geom.Tetmesh mesh\n"
+		"             \n"
+		"Return:\n"
+		"    None\n"
+		"\n"
 		""},
-	 { (char *)"vector_bool_reserve", _wrap_vector_bool_reserve, METH_VARARGS, (char *)"vector_bool_reserve(vector_bool self, size_type n)"},
-	 { (char *)"vector_bool_capacity", _wrap_vector_bool_capacity, METH_VARARGS, (char *)"vector_bool_capacity(vector_bool self) -> size_type"},
-	 { (char *)"delete_vector_bool", _wrap_delete_vector_bool, METH_VARARGS, (char *)"delete_vector_bool(vector_bool self)"},
-	 { (char *)"vector_bool_swigregister", vector_bool_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Geom", _wrap_new_Geom, METH_VARARGS, (char *)"new_Geom() -> Geom"},
-	 { (char *)"delete_Geom", _wrap_delete_Geom, METH_VARARGS, (char *)"delete_Geom(Geom self)"},
-	 { (char *)"Geom_getComp", _wrap_Geom_getComp, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.model.Comp compartment object with \n"
-		"identifier string comp_id (if defined).\n"
+	 { (char *)"loadBinary", _wrap_loadBinary, METH_VARARGS, (char *)"\n"
+		"Loads a Tetmesh, with its compartments and patches, from a binary file \n"
+		"written by saveBinary. The file is memory-mapped and the mesh uses the \n"
+		"mapped data in place, so loading does not depend on the number of \n"
+		"elements and processes loading the same file share one copy of it.\n"
+		"Compartments and patches can be retrieved with getComp and getPatch.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getComp(comp_id)\n"
-		"    \n"
+		"    loadBinary(pathname)\n"
+		"\n"
 		"Arguments:\n"
-		"    string comp_id\n"
+		"    string pathname\n"
 		"             \n"
 		"Return:\n"
-		"    steps.model.Comp\n"
+		"    steps.geom.Tetmesh\n"
 		"\n"
 		""},
-	 { (char *)"Geom_delComp", _wrap_Geom_delComp, METH_VARARGS, (char *)"\n"
-		"Removes the steps.geom.Comp object with identifier string comp_id (if defined) \n"
-		"from the geometry container.\n"
+	 { (char *)"new_TmComp", (PyCFunction) _wrap_new_TmComp, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"Returns a list of references to steps.geom.Patch patch objects: \n"
+		"the 'outer' patches.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    delComp(comp_id)\n"
-		"    \n"
+		"    getOPatches()\n"
+		"\n"
 		"Arguments:\n"
-		"    string comp_id\n"
+		"    None\n"
 		"             \n"
 		"Return:\n"
+		"    list<steps.geom.Patch>\n"
+		"\n"
+		""},
+	 { (char *)"delete_TmComp", _wrap_delete_TmComp, METH_VARARGS, (char *)"\n"
+		"Returns a list of references to steps.geom.Patch patch objects: \n"
+		"the 'outer' patches.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getOPatches()\n"
+		"\n"
+		"Arguments:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<steps.geom.Patch>\n"
 		"\n"
 		""},
-	 { (char *)"Geom_getAllComps", _wrap_Geom_getAllComps, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.geom.Comp compartment objects in the \n"
-		"geometry container.\n"
+	 { (char *)"TmComp_setVol", _wrap_TmComp_setVol, METH_VARARGS, (char *)"Obsolete"},
+	 { (char *)"TmComp_getAllTetIndices", _wrap_TmComp_getAllTetIndices, METH_VARARGS, (char *)"\n"
+		"Returns a list of indices of all tetrahedrons assigned to the compartment. \n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getAllComps()\n"
-		"    \n"
+		"    getAllTetIndices()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"             \n"
 		"Return:\n"
-		"    list<steps.geom.Comp>\n"
+		"    list<uint>\n"
 		"\n"
 		""},
-	 { (char *)"Geom_getPatch", _wrap_Geom_getPatch, METH_VARARGS, (char *)"\n"
-		"Removes the steps.geom.Patch object with identifier string patch_id (if defined) \n"
-		"from the geometry container.\n"
+	 { (char *)"TmComp_countTets", _wrap_TmComp_countTets, METH_VARARGS, (char *)"\n"
+		"Returns the number of tetrahedrons assigned to the compartment. \n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getPatch(patch_id)\n"
+		"    countTets()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    uint\n"
+		"\n"
+		""},
+	 { (char *)"TmComp_isTetInside", _wrap_TmComp_isTetInside, METH_VARARGS, (char *)"\n"
+		"Returns a list of Booleans describing if tetrahedrons tets are \n"
+		"assigned to the compartment.\n"
+		"\n"
+		"Syntax::\n"
 		"    \n"
+		"    isTetInside(tets)\n"
+		"\n"
 		"Arguments:\n"
-		"    string patch_id\n"
+		"    list<uint> tets\n"
 		"             \n"
 		"Return:\n"
-		"    steps.geom.Patch\n"
+		"    list<bool, length = length(tets)>\n"
 		"\n"
 		""},
-	 { (char *)"Geom_delPatch", _wrap_Geom_delPatch, METH_VARARGS, (char *)"\n"
-		"Removes the steps.geom.Patch object with identifier string patch_id (if defined) \n"
-		"from the geometry container.\n"
+	 { (char *)"TmComp_getBoundMin", _wrap_TmComp_getBoundMin, METH_VARARGS, (char *)"\n"
+		"Returns the minimal Cartesian coordinate of the rectangular bounding box \n"
+		"of the compartment. \n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    delPatch(patch_id)\n"
-		"    \n"
+		"    getBoundMin()\n"
+		"\n"
 		"Arguments:\n"
-		"    string patch_id\n"
+		"    None\n"
 		"             \n"
 		"Return:\n"
+		"    list<float, length = 3>\n"
+		"\n"
+		""},
+	 { (char *)"TmComp_getBoundMax", _wrap_TmComp_getBoundMax, METH_VARARGS, (char *)"\n"
+		"Returns the maximal Cartesian coordinate of the rectangular bounding box \n"
+		"of the compartment. \n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getBoundMax()\n"
+		"\n"
+		"Arguments:\n"
 		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<float, length = 3>\n"
 		"\n"
 		""},
-	 { (char *)"Geom_getAllPatches", _wrap_Geom_getAllPatches, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+	 { (char *)"TmComp_swigregister", TmComp_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_TmPatch", (PyCFunction) _wrap_new_TmPatch, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
+		"Returns a reference to the steps.geom.Comp compartment object representing\n"
+		"the outer compartment.\n"
 		"\n"
 		"Syntax::\n"
+		"    \n"
+		"    getOComp()\n"
 		"\n"
-		"    getAllPatches()\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    steps.geom.Comp\n"
+		"\n"
+		""},
+	 { (char *)"delete_TmPatch", _wrap_delete_TmPatch, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the steps.geom.Comp compartment object representing\n"
+		"the outer compartment.\n"
+		"\n"
+		"Syntax::\n"
 		"    \n"
+		"    getOComp()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"             \n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    steps.geom.Comp\n"
 		"\n"
 		""},
-	 { (char *)"Geom_swigregister", Geom_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Patch", (PyCFunction) _wrap_new_Patch, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
-		"new_Patch(string id, Geom container, Comp icomp, Comp ocomp = None, \n"
-		"    double area = 0.0) -> Patch\n"
+	 { (char *)"TmPatch_setArea", _wrap_TmPatch_setArea, METH_VARARGS, (char *)"Obsolete"},
+	 { (char *)"TmPatch_getAllTriIndices", _wrap_TmPatch_getAllTriIndices, METH_VARARGS, (char *)"\n"
+		"Returns a list of indices of all triangles assigned to the patch.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    getAllTriIndices()\n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<uint>\n"
+		"\n"
 		""},
-	 { (char *)"delete_Patch", _wrap_delete_Patch, METH_VARARGS, (char *)"delete_Patch(Patch self)"},
-	 { (char *)"Patch_getID", _wrap_Patch_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the patch.\n"
+	 { (char *)"TmPatch_isTriInside", _wrap_TmPatch_isTriInside, METH_VARARGS, (char *)"\n"
+		"Returns a list of Booleans describing if triangles tris are \n"
+		"assigned to the patch.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    isTriInside(tris)\n"
+		"\n"
+		"Arguments:\n"
+		"    list<uint> tris\n"
+		"             \n"
+		"Return:\n"
+		"    list<bool, length = length(tris)>\n"
+		"\n"
+		""},
+	 { (char *)"TmPatch_swigregister", TmPatch_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_DiffBoundary", (PyCFunction) _wrap_new_DiffBoundary, METH_VARARGS | METH_KEYWORDS, (char *)"new_DiffBoundary(string id, Tetmesh container, vector_uint tris) -> DiffBoundary"},
+	 { (char *)"delete_DiffBoundary", _wrap_delete_DiffBoundary, METH_VARARGS, (char *)"delete_DiffBoundary(DiffBoundary self)"},
+	 { (char *)"DiffBoundary_getID", _wrap_DiffBoundary_getID, METH_VARARGS, (char *)"\n"
+		"Get the identifier string of the diffusion boundary.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
 		"    getID()\n"
-		"    \n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"             \n"
@@ -50691,1754 +56970,2074 @@ static PyMethodDef SwigMethods[] = {
 		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Patch_setID", _wrap_Patch_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the patch.\n"
+	 { (char *)"DiffBoundary_setID", _wrap_DiffBoundary_setID, METH_VARARGS, (char *)"\n"
+		"Set the identifier string of the diffusion boundary.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
 		"    setID(name)\n"
-		"    \n"
+		"\n"
 		"Arguments:\n"
 		"    string name\n"
-		"             \n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_getContainer", _wrap_Patch_getContainer, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.geom.Geom container object.\n"
+	 { (char *)"DiffBoundary_getContainer", _wrap_DiffBoundary_getContainer, METH_VARARGS, (char *)"\n"
+		"Returns a reference to the parent steps.geom.Tetmesh container object.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
 		"    getContainer()\n"
-		"    \n"
+		"\n"
+		"Arguments:\n"
+		"    None\n"
+		"\n"
+		"Return:\n"
+		"    steps.geom.Tetmesh\n"
+		"\n"
+		""},
+	 { (char *)"DiffBoundary_getComps", _wrap_DiffBoundary_getComps, METH_VARARGS, (char *)"\n"
+		"Returns a list of the two compartments this diffusion boundary connects.\n"
+		"             \n"
+		"Syntax::\n"
+		"             \n"
+		"    getComps()\n"
+		"             \n"
 		"Arguments:\n"
 		"    None\n"
 		"             \n"
 		"Return:\n"
-		"    steps.geom.Geom\n"
+		"    list<steps::wm::Comp, length = 2>\n"
 		"\n"
 		""},
-	 { (char *)"Patch_getArea", _wrap_Patch_getArea, METH_VARARGS, (char *)"\n"
-		"Get the area of the patch (in m^2).\n"
+	 { (char *)"DiffBoundary_isTriInside", _wrap_DiffBoundary_isTriInside, METH_VARARGS, (char *)"\n"
+		"Returns a list of Booleans describing if triangles tris are \n"
+		"assigned to the Diffusion Boundary.\n"
+		"             \n"
+		"Syntax::\n"
+		"             \n"
+		"    isTriInside(tris)\n"
+		"             \n"
+		"Arguments:\n"
+		"    list<uint> tris\n"
+		"             \n"
+		"Return:\n"
+		"    list<bool, length = length(tris)>\n"
 		"\n"
+		""},
+	 { (char *)"DiffBoundary_getAllTriIndices", _wrap_DiffBoundary_getAllTriIndices, METH_VARARGS, (char *)"\n"
+		"Returns a list of indices of all triangles assigned to the patch.\n"
+		"             \n"
 		"Syntax::\n"
+		"             \n"
+		"    getAllTriIndices()\n"
+		"             \n"
+		"Arguments:\n"
+		"    None\n"
+		"             \n"
+		"Return:\n"
+		"    list<uint>\n"
 		"\n"
-		"    getArea()\n"
+		""},
+	 { (char *)"DiffBoundary_swigregister", DiffBoundary_swigregister, METH_VARARGS, NULL},
+	 { (char *)"delete_RNG", _wrap_delete_RNG, METH_VARARGS, (char *)"delete_RNG(RNG self)"},
+	 { (char *)"RNG_initialize", _wrap_RNG_initialize, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
 		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
 		"Arguments:\n"
+		"    uint seed\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
-		"             \n"
+		"\n"
+		""},
+	 { (char *)"RNG_get", _wrap_RNG_get, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
+		"Arguments:\n"
+		"    uint seed\n"
+		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_setArea", _wrap_Patch_setArea, METH_VARARGS, (char *)"\n"
-		"Set the area of the patch (in m^2).\n"
+	 { (char *)"RNG_getUnfII", _wrap_RNG_getUnfII, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
 		"\n"
 		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
+		"Arguments:\n"
+		"    uint seed\n"
 		"\n"
-		"    setArea(area)\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"RNG_getUnfIE", _wrap_RNG_getUnfIE, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
 		"    \n"
 		"Arguments:\n"
-		"    float area\n"
-		"             \n"
+		"    uint seed\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_addSurfsys", _wrap_Patch_addSurfsys, METH_VARARGS, (char *)"\n"
-		"Add surface system identifier string surfsys_id to the patch object.\n"
+	 { (char *)"RNG_getUnfEE", _wrap_RNG_getUnfEE, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
 		"\n"
 		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
+		"Arguments:\n"
+		"    uint seed\n"
 		"\n"
-		"    addSurfsys(surfsys_id)\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"RNG_getUnfIE53", _wrap_RNG_getUnfIE53, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string surfsys_id\n"
-		"             \n"
+		"    uint seed\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_getSurfsys", _wrap_Patch_getSurfsys, METH_VARARGS, (char *)"\n"
-		"Returns a list of the surface system identifier strings which have \n"
-		"been added to the patch.\n"
+	 { (char *)"RNG_getStdExp", _wrap_RNG_getStdExp, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
 		"\n"
 		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
+		"Arguments:\n"
+		"    uint seed\n"
 		"\n"
-		"    getSurfsys()\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"RNG_getExp", _wrap_RNG_getExp, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
 		"    \n"
 		"Arguments:\n"
+		"    uint seed\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
-		"             \n"
+		"\n"
+		""},
+	 { (char *)"RNG_getPsn", _wrap_RNG_getPsn, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
+		"\n"
+		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
+		"Arguments:\n"
+		"    uint seed\n"
+		"\n"
 		"Return:\n"
-		"    list<string>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_delSurfsys", _wrap_Patch_delSurfsys, METH_VARARGS, (char *)"\n"
-		"Removes surface system identifier string surfsys_id from this patch.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"RNG_getStdNrm", _wrap_RNG_getStdNrm, METH_VARARGS, (char *)"\n"
+		"Initialize the random number generator with given seed value.\n"
 		"\n"
-		"    delSurfsys(surfsys_id)\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    initialize(seed)\n"
+		"    \n"
 		"Arguments:\n"
-		"    string surfsys_id\n"
-		"             \n"
+		"    uint seed\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Patch_getIComp", _wrap_Patch_getIComp, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.geom.Comp compartment object representing\n"
-		"the inner compartment.\n"
+	 { (char *)"RNG_swigregister", RNG_swigregister, METH_VARARGS, NULL},
+	 { (char *)"create_mt19937", _wrap_create_mt19937, METH_VARARGS, (char *)"\n"
+		"Equivalent to: create('mt19937', buffer_size)\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getIComp()\n"
-		"\n"
+		"    create_mt19937(buffer_size)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    uint buffer_size\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.Comp\n"
+		"    steps.rng.RNG\n"
 		"\n"
 		""},
-	 { (char *)"Patch_getOComp", _wrap_Patch_getOComp, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.geom.Comp compartment object representing\n"
-		"the outer compartment.\n"
+	 { (char *)"create", _wrap_create, METH_VARARGS, (char *)"\n"
+		"Creates and returns a reference to a steps.rng.RNG random number generator object, \n"
+		"which is specified by type and pre-allocates a buffer list with size of buffer_size.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getOComp()\n"
+		"    create(type, buffer_size)\n"
 		"\n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string type\n"
+		"    * uint buffer_size\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.Comp\n"
+		"    steps.rng.RNG\n"
 		"\n"
 		""},
-	 { (char *)"Patch_swigregister", Patch_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Comp", (PyCFunction) _wrap_new_Comp, METH_VARARGS | METH_KEYWORDS, (char *)"new_Comp(string id, Geom container, double vol = 0.0) -> Comp"},
-	 { (char *)"delete_Comp", _wrap_delete_Comp, METH_VARARGS, (char *)"delete_Comp(Comp self)"},
-	 { (char *)"Comp_getID", _wrap_Comp_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the compartment.\n"
+	 { (char *)"delete_API", _wrap_delete_API, METH_VARARGS, (char *)"delete_API(API self)"},
+	 { (char *)"API_getSolverName", _wrap_API_getSolverName, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver's name.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getID()\n"
-		"\n"
+		"    \n"
+		"    getSolverName()\n"
+		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
 		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Comp_setID", _wrap_Comp_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the compartment.\n"
+	 { (char *)"API_getSolverDesc", _wrap_API_getSolverDesc, METH_VARARGS, (char *)"\n"
+		"Returns a string giving a short description of the solver.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setID(name)\n"
-		"\n"
+		"    \n"
+		"    getSolverDesc()\n"
+		"    \n"
 		"Arguments:\n"
-		"    string name\n"
-		"             \n"
-		"Return:\n"
 		"    None\n"
 		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
 		""},
-	 { (char *)"Comp_getContainer", _wrap_Comp_getContainer, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.geom.Geom container object.\n"
+	 { (char *)"API_getSolverAuthors", _wrap_API_getSolverAuthors, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver authors names.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getContainer()\n"
-		"\n"
+		"    \n"
+		"    getSolverAuthors()\n"
+		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.Geom\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Comp_getVol", _wrap_Comp_getVol, METH_VARARGS, (char *)"\n"
-		"Get the volume of the compartment (in m^3).\n"
+	 { (char *)"API_getSolverEmail", _wrap_API_getSolverEmail, METH_VARARGS, (char *)"\n"
+		"Returns a string giving the author's email address.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getVol()\n"
+		"    \n"
+		"    getSolverEmail()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"Comp_setVol", _wrap_Comp_setVol, METH_VARARGS, (char *)"\n"
-		"Set the volume of the compartment (in m^3).\n"
+	 { (char *)"API_reset", _wrap_API_reset, METH_VARARGS, (char *)"\n"
+		"Reset the simulation to the state the solver was initialised to. \n"
+		"Typically, this resets all concentrations of all chemical species in \n"
+		"all elements (whether compartments and patches in a well-mixed solver \n"
+		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
+		"resets the simulation time to zero and resets reaction (and diffusion) \n"
+		"rates to the default values described in the steps.model objects. \n"
+		"All reaction (and diffusion) rules are reset to active and all \n"
+		"compartment volumes and patch areas are reset to default values \n"
+		"described in steps.geom objects (for well-mixed solvers). \n"
+		"Usually, this method should be called before starting each simulation iteration.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setVol(vol)\n"
-		"\n"
+		"    \n"
+		"    reset()\n"
+		"    \n"
 		"Arguments:\n"
-		"    float vol\n"
-		"             \n"
+		"    None\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Comp_addVolsys", _wrap_Comp_addVolsys, METH_VARARGS, (char *)"\n"
-		"Add volume system identifier string volsys_id to the compartment object.\n"
+	 { (char *)"API_checkpoint", _wrap_API_checkpoint, METH_VARARGS, (char *)"\n"
+		"Checkpoint the simulation state to a file.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    addVolsys(volsys_id)\n"
-		"\n"
+		"    \n"
+		"    checkpoint(file_name)\n"
+		"    \n"
 		"Arguments:\n"
-		"    string volsys_id\n"
-		"             \n"
+		"    string file_name\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Comp_getVolsys", _wrap_Comp_getVolsys, METH_VARARGS, (char *)"\n"
-		"Returns a list of the volume system identifier strings which have been \n"
-		"added to the compartment.\n"
+	 { (char *)"API_restore", _wrap_API_restore, METH_VARARGS, (char *)"\n"
+		"Restore the simulation state from a file.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getVolsys()\n"
-		"\n"
+		"    \n"
+		"    restore(file_name)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    string file_name\n"
+		"\n"
 		"Return:\n"
-		"    list<string>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Comp_delVolsys", _wrap_Comp_delVolsys, METH_VARARGS, (char *)"\n"
-		"Removes volume system identifier string volsys_id from this compartment.\n"
+	 { (char *)"API_run", _wrap_API_run, METH_VARARGS, (char *)"\n"
+		"Advance the simulation until endtime (given in seconds) is reached. \n"
+		"The endtime must be larger or equal to the current simulation time.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    delVolsys(volsys_id)\n"
-		"\n"
+		"    \n"
+		"    run(endtime)\n"
+		"    \n"
 		"Arguments:\n"
-		"    string volsys_id\n"
-		"             \n"
+		"    float endtime\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Comp_getIPatches", _wrap_Comp_getIPatches, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to steps.geom.Patch patch objects: \n"
-		"the 'inner' patches.\n"
+	 { (char *)"API_getTime", _wrap_API_getTime, METH_VARARGS, (char *)"\n"
+		"Returns the current simulation time in seconds.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getIPatches()\n"
-		"\n"
+		"    \n"
+		"    getTime()\n"
+		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Comp_getOPatches", _wrap_Comp_getOPatches, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to steps.geom.Patch patch objects: \n"
-		"the 'outer' patches.\n"
+	 { (char *)"API_advance", _wrap_API_advance, METH_VARARGS, (char *)"\n"
+		"Advance the simulation for secs seconds. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getOPatches()\n"
-		"\n"
+		"    \n"
+		"    advance(adv)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    float adv\n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Comp_swigregister", Comp_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Tetmesh", _wrap_new_Tetmesh, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+	 { (char *)"API_step", _wrap_API_step, METH_VARARGS, (char *)"\n"
+		"Advance the simulation for one 'step'. In stochastic solvers this is one \n"
+		"'realization' of the Gillespie SSA (one reaction 'event'). \n"
+		"In numerical solvers (currently Wmrk4) this is one time-step, with the \n"
+		"stepsize defined with the setDT method.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getAllPatches()\n"
+		"    \n"
+		"    step()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
-		"Return:\n"
-		"    list<steps.geom.Patch>\n"
 		"\n"
+		"Return:\n"
+		"    None\n"
 		"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+		""},
+	 { (char *)"API_setRk4DT", _wrap_API_setRk4DT, METH_VARARGS, (char *)"\n"
+		"Set the stepsize for numerical solvers. Must be called before running a \n"
+		"simulation with these solvers (currently Wmrk4) since there is no default \n"
+		"stepsize. The deterministic solver Wmrk4 implements a fixed stepsize \n"
+		"(i.e. not adaptive), although the stepsize can be altered at any point \n"
+		"during the simulation with this method.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getAllPatches()\n"
+		"    \n"
+		"    setRk4DT(dt)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
-		"Return:\n"
-		"    list<steps.geom.Patch>\n"
-		"\n"
+		"    float dt\n"
 		"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+		"Return:\n"
+		"    None\n"
 		"\n"
+		""},
+	 { (char *)"API_setDT", _wrap_API_setDT, METH_VARARGS, (char *)"\n"
+		"Set the stepsize for numerical solvers. Superceded by setRk4DT, but\n"
+		"Included for backwards compatability.\n"
+		" \n"
 		"Syntax::\n"
-		"\n"
-		"    getAllPatches()\n"
-		"    \n"
+		" \n"
+		"    setDT(dt)\n"
+		" \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    float dt\n"
+		" \n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
-		"\n"
+		"    None\n"
 		"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+		""},
+	 { (char *)"API_getRk4DT", _wrap_API_getRk4DT, METH_VARARGS, (char *)"\n"
+		"Returns the stepsize for numerical solvers.\n"
 		"\n"
 		"Syntax::\n"
 		"\n"
-		"    getAllPatches()\n"
-		"    \n"
+		"    getRk4DT()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"delete_Tetmesh", _wrap_delete_Tetmesh, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to all steps.geom.Patch patch objects in the \n"
-		"geometry container.\n"
+	 { (char *)"API_getDT", _wrap_API_getDT, METH_VARARGS, (char *)"\n"
+		"Returns the stepsize for numerical solvers.\n"
+		"Superceded by getRk4DT, but included for backwards compatibility.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getAllPatches()\n"
+		"    \n"
+		"    getDT()\n"
 		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_setVertex", _wrap_Tetmesh_setVertex, METH_VARARGS, (char *)"\n"
-		"Set a vertex with index vidx to coordinates x, y, z. Should be used nverts \n"
-		"number of times to supply all vertex information if the second constructor \n"
-		"is used. Cannot be called after setup() has been called.\n"
+	 { (char *)"API_setTime", _wrap_API_setTime, METH_VARARGS, (char *)"\n"
+		"Set the current simulation time.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setVertex(vidx, x, y, z)\n"
-		"\n"
+		"    \n"
+		"    setTime(time)\n"
+		"    \n"
 		"Arguments:\n"
-		"    * uint vidx\n"
-		"    * float x\n"
-		"    * float y\n"
-		"    * float z\n"
-		"             \n"
+		"    folat time\n"
+		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_setTri", _wrap_Tetmesh_setTri, METH_VARARGS, (char *)"\n"
-		"Set the triangle with index tidx formed by vertices vidx0, vidx1, vidx2. \n"
-		"Should be called ntris number of times to supply triangle information if the \n"
-		"second constructor is used. Cannot be called after setup() has been called.\n"
+	 { (char *)"API_getA0", _wrap_API_getA0, METH_VARARGS, (char *)"\n"
+		"Returns the total propensity of the current simulation state \n"
+		"(the total propensity multiplied by an infinitesimally small \n"
+		"time dt gives the probability that a reaction will occur in that dt). \n"
+		"For Tetexact this includes the propensity from the extension of the SSA \n"
+		"for diffusive flux between tetrahedral elements in the mesh.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setTri(tidx, vidx0, vidx1, vidx2)\n"
-		"                \n"
+		"    \n"
+		"    getA0()\n"
+		"    \n"
 		"Arguments:\n"
-		"    * uint tidx\n"
-		"    * uint vidx0\n"
-		"    * uint vidx1\n"
-		"    * uint vidx2\n"
-		"             \n"
-		"Return:\n"
 		"    None\n"
 		"\n"
-		""},
-	 { (char *)"Tetmesh_setTet", _wrap_Tetmesh_setTet, METH_VARARGS, (char *)"\n"
-		"Set the tetrahedron with index tidx formed by vertices vidx0, vidx1, \n"
-		"vidx2, vidx3. Should be called ntets number of times to supply tetrahedron \n"
-		"information if the second constructor is used. Cannot be called after setup() \n"
-		"has been called. \n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    setTet(tidx, vidx0, vidx1, vidx2, vidx3)\n"
-		"\n"
-		"Arguments:\n"
-		"    * uint tidx\n"
-		"    * uint vidx0\n"
-		"    * uint vidx1\n"
-		"    * uint vidx2\n"
-		"    * uint vidx3\n"
-		"             \n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_setup", _wrap_Tetmesh_setup, METH_VARARGS, (char *)"\n"
-		"Setup the Tetmesh object by computing the auxiliary data. This method should \n"
-		"be called when the second constructor is used and all vertex, tetrahedron and \n"
-		"triangle information has been supplied with the set methods. The first constructor \n"
-		"calls this method internally, so setup does not have to be called when using the \n"
-		"first constructor.\n"
+	 { (char *)"API_getNSteps", _wrap_API_getNSteps, METH_VARARGS, (char *)"\n"
+		"Return the number of 'realizations' of the SSA, the number of reaction \n"
+		"(and diffusion) events in stochastic solvers.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setup()\n"
-		"\n"
+		"    \n"
+		"    getNSteps()\n"
+		"    \n"
 		"Arguments:\n"
 		"    None\n"
-		"             \n"
+		"\n"
 		"Return:\n"
-		"    None\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_isSetupDone", _wrap_Tetmesh_isSetupDone, METH_VARARGS, (char *)"\n"
-		"Check if setup() has been called, either internally by the first constructor, \n"
-		"or by the user if the second constructor was used.\n"
+	 { (char *)"API_setNSteps", _wrap_API_setNSteps, METH_VARARGS, (char *)"\n"
+		"Set the number of 'realizations' of the SSA, the number of reaction \n"
+		"(and diffusion) events in stochastic solvers.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    isSetupDone()\n"
-		"\n"
+		"    \n"
+		"    setNSteps(nsteps)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    uint nsteps\n"
+		"\n"
 		"Return:\n"
-		"    True if setup is done.\n"
-		"    False if setup is not done.\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getVertex", _wrap_Tetmesh_getVertex, METH_VARARGS, (char *)"\n"
-		"Returns the coordinates of vertex with index vidx in the container.\n"
+	 { (char *)"API_getCompVol", _wrap_API_getCompVol, METH_VARARGS, (char *)"\n"
+		"Returns the volume of compartment with identifier string comp (in m^3).\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getVertex(vidx)\n"
-		"\n"
+		"    \n"
+		"    getCompVol(comp)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint vidx\n"
-		"             \n"
+		"    string comp\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_countVertices", _wrap_Tetmesh_countVertices, METH_VARARGS, (char *)"\n"
-		"Returns the total number of vertices in the mesh.\n"
+	 { (char *)"API_setCompVol", _wrap_API_setCompVol, METH_VARARGS, (char *)"\n"
+		"Set the volume of compartment with identifier string comp (in m^3).\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    countVertices()\n"
-		"\n"
+		"    \n"
+		"    setCompVol(comp, vol)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * float vol\n"
+		"\n"
 		"Return:\n"
-		"    uint\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTri", _wrap_Tetmesh_getTri, METH_VARARGS, (char *)"\n"
-		"Returns the triangle with index tidx in the container by its three vertex indices.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_getCompCount", _wrap_API_getCompCount, METH_VARARGS, (char *)"\n"
+		"Returns the number of molecules of a species with identifier string spec \n"
+		"in compartment with identifier string comp.\n"
 		"\n"
-		"    getTri(tidx)\n"
+		"In a mesh-based simulation (i.e. Tetexact) this is the combined count from \n"
+		"all tetrahedral elements in the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompCount(comp, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    list<uint, length = 3>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_countTris", _wrap_Tetmesh_countTris, METH_VARARGS, (char *)"\n"
-		"Returns the total number of triangles in the mesh.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setCompCount", _wrap_API_setCompCount, METH_VARARGS, (char *)"\n"
+		"Set the number of molecules of a species with identifier string spec \n"
+		"in compartment with identifier string comp.\n"
 		"\n"
-		"    countTris()\n"
+		"In a mesh-based simulation (i.e. Tetexact) this is the combined count from \n"
+		"all tetrahedral elements in the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setCompCount(comp, spec, nspec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"    * uint nspec\n"
+		"\n"
 		"Return:\n"
-		"    uint\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriArea", _wrap_Tetmesh_getTriArea, METH_VARARGS, (char *)"\n"
-		"Returns the area of the triangle with index tidx.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_getCompAmount", _wrap_API_getCompAmount, METH_VARARGS, (char *)"\n"
+		"Returns the amount (in mols) of species with identifier string spec in compartment \n"
+		"with identifier string comp.\n"
 		"\n"
-		"    getTriArea(tidx)\n"
+		"In a mesh-based simulation (i.e. Tetexact) this is the combined amount from all \n"
+		"tetrahedral elements in the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompAmount(comp, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriBarycenter", _wrap_Tetmesh_getTriBarycenter, METH_VARARGS, (char *)"\n"
-		"Returns the Cartesian coordinates of the barycenter of triangle with index tidx.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setCompAmount", _wrap_API_setCompAmount, METH_VARARGS, (char *)"\n"
+		"Set the amount (in mols) of species with identifier string spec in compartment \n"
+		"with identifier string comp.\n"
 		"\n"
-		"    getTriBarycenter(tidx)\n"
+		"In a mesh-based simulation (i.e. Tetexact) this is the combined amount from all \n"
+		"tetrahedral elements in the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setCompAmount(comp, spec, amount)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"    * float amount\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"API_getCompConc", _wrap_API_getCompConc, METH_VARARGS, (char *)"\n"
+		"Returns the concentration (in Molar units) of species with identifier string spec \n"
+		"in compartment with identifier string comp.\n"
 		"\n"
-		""},
-	 { (char *)"Tetmesh_getTetQualityRER", _wrap_Tetmesh_getTetQualityRER, METH_VARARGS, (char *)"\n"
-		"Returns the radius-edge-ratio (a quality measurement) of tetrahedron with index tidx.\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) this is calculated from the combined \n"
+		"number of molecules from all tetrahedral elements in the compartment and the total \n"
+		"volume of the tetrahedrons.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetQualityRER(tidx)\n"
-		"\n"
+		"    getCompConc(comp, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriNorm", _wrap_Tetmesh_getTriNorm, METH_VARARGS, (char *)"\n"
-		"Returns the normal vector of the triangle with index tidx.\n"
+	 { (char *)"API_setCompConc", _wrap_API_setCompConc, METH_VARARGS, (char *)"\n"
+		"Sets the concentration (in Molar units) of species with identifier string spec \n"
+		"in compartment with identifier string comp to conc. In a discrete solver the \n"
+		"continuous concentration is converted to a discrete number of \n"
+		"molecules.\n"
 		"\n"
-		"Syntax::\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as \n"
+		"equally as possible over all tetrahedral elements in the compartment (i.e. a \n"
+		"uniform distribution).\n"
 		"\n"
-		"    getTriNorm(tidx)\n"
+		"Syntax::\n"
 		"\n"
+		"    setCompConc(comp, spec, conc)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"    * float conc\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriPatch", _wrap_Tetmesh_getTriPatch, METH_VARARGS, (char *)"\n"
-		"Returns a reference to a step.geom.TmPatch object: the patch which triangle \n"
-		"with index tidx belongs to. Returns None if triangle not assigned to a patch.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getTriPatch(tidx)\n"
+	 { (char *)"API_getCompClamped", _wrap_API_getCompClamped, METH_VARARGS, (char *)"\n"
+		"Returns True if species with identifier string spec in compartment with identifier \n"
+		"string comp is clamped (buffered), which means the concentration remains the same \n"
+		"regardless of reactions that consume or produce molecules of this species. \n"
+		"Returns False if not.\n"
 		"\n"
-		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
-		"Return:\n"
-		"    steps.geom.TmPatch\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) it returns True only if the species \n"
+		"is clamped in all tetrahedral elements of the compartment.\n"
 		"\n"
-		""},
-	 { (char *)"Tetmesh_getTriDiffBoundary", _wrap_Tetmesh_getTriDiffBoundary, METH_VARARGS, (char *)"\n"
-		"Returns a reference to a step.geom.Diffboundary object: the diffusion boundary triangle \n"
-		"with index tidx belongs to. Returns None if triangle not assigned to a diffusion boundary.\n"
-		"             \n"
 		"Syntax::\n"
-		"             \n"
-		"    getTriDiffBoundary(tidx)\n"
-		"             \n"
+		"    \n"
+		"    getCompClamped(comp, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.DiffBoundary\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriTetNeighb", _wrap_Tetmesh_getTriTetNeighb, METH_VARARGS, (char *)"\n"
-		"Returns the indices of the two neighbouring tetrahedrons of triangle with \n"
-		"index tidx. An index of -1 indicates no neighbour (triangle is on the mesh border). \n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setCompClamped", _wrap_API_setCompClamped, METH_VARARGS, (char *)"\n"
+		"Sets whether the concentration of species with identifier string spec in compartment \n"
+		"with identifier string comp is clamped (clamped = True) or not (clamped = False). \n"
+		"If a species is clamped the concentration stays the same regardless of reactions \n"
+		"that consume or produce molecules of the species.\n"
 		"\n"
-		"    getTriTetNeighb(tidx)\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) this will set the species to be \n"
+		"clamped or not in all tetrahedral elements of the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setCompClamped(comp, spec, clamped)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string spec\n"
+		"    * bool clamped\n"
+		"\n"
 		"Return:\n"
-		"    list<int, length = 2>\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTriBoundary", _wrap_Tetmesh_getTriBoundary, METH_VARARGS, (char *)"\n"
-		"Returns a list of triangles that form the mesh boundary.\n"
-		"Support function for steps.utilities.visual.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_getCompReacK", _wrap_API_getCompReacK, METH_VARARGS, (char *)"\n"
+		"Returns the macroscopic reaction constant of reaction with identifier string reac \n"
+		"in compartment with identifier string comp. The unit of the reaction constant depends \n"
+		"on the order of the reaction.\n"
 		"\n"
-		"    getTriBoundary()\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) the value for the compartment is \n"
+		"returned, although individual tetrahedral elements may have different values \n"
+		"(set with setTetReacK).\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompReacK(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<int>\n"
-		"    \n"
-		"Status: Obsolete. rename as getTriSurfs()\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getSurfTris", _wrap_Tetmesh_getSurfTris, METH_VARARGS, (char *)"\n"
-		"Returns a list of triangles that form the mesh boundary.\n"
-		"Support function for steps.utilities.visual.\n"
+	 { (char *)"API_setCompReacK", _wrap_API_setCompReacK, METH_VARARGS, (char *)"\n"
+		"Sets the macroscopic reaction constant of reaction with identifier string reac \n"
+		"in compartment with identifier string comp to kf. The unit of the reaction constant \n"
+		"depends on the order of the reaction.\n"
 		"\n"
-		"Syntax::\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this method sets the reaction \n"
+		"constant in all tetrahedral elements of the compartment to kf\n"
 		"\n"
-		"    getSurfTris()\n"
+		"Note: The default value still comes from the steps.model description, so \n"
+		"calling reset() will return the reaction constant to that value.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setCompReacK(comp, reac, kf)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"    * float kf\n"
+		"\n"
 		"Return:\n"
-		"    list<unsigned int>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTet", _wrap_Tetmesh_getTet, METH_VARARGS, (char *)"\n"
-		"Returns the tetrahedron with index tidx in the container by its four vertex indices.\n"
+	 { (char *)"API_getCompReacActive", _wrap_API_getCompReacActive, METH_VARARGS, (char *)"\n"
+		"Returns whether a reaction with identifier string reac in compartment with identifier \n"
+		"string comp is active (True) or not (False). If it's not active this means that a \n"
+		"reaction will never occur regardless of whether the reactants are present in \n"
+		"sufficient numbers or not. \n"
+		"\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this method will return True only \n"
+		"if the reaction is active in all tetrahedral elements in the compartment. \n"
 		"\n"
 		"Syntax::\n"
-		"    getTet(tidx)\n"
+		"    \n"
+		"    getCompReacActive(comp, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<uint, length = 4>\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_countTets", _wrap_Tetmesh_countTets, METH_VARARGS, (char *)"\n"
-		"Returns the total number of tetrahedrons in the mesh.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setCompReacActive", _wrap_API_setCompReacActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) a reaction with identifier \n"
+		"string reac in compartment with identifier string comp. If a reaction is not active \n"
+		"this means that a reaction will never occur regardless of whether the reactants are \n"
+		"present in sufficient numbers or not.\n"
 		"\n"
-		"    countTets()\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this will activate/deactivate the \n"
+		"reaction in all tetrahedral elements in the compartment. \n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setCompReacActive(comp, reac, active)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"    * bool active\n"
+		"\n"
 		"Return:\n"
-		"    uint\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTetVol", _wrap_Tetmesh_getTetVol, METH_VARARGS, (char *)"\n"
-		"Returns the volume of the tetrahedron with index tidx.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_getCompDiffD", _wrap_API_getCompDiffD, METH_VARARGS, (char *)"\n"
+		"Returns the diffusion constant of diffusion rule with identifier string diff \n"
+		"in compartment with identifier string comp. This constant is in units m^2/s.\n"
 		"\n"
-		"    getTetVol(tidx)\n"
+		"Note: In a mesh-based solver (i.e. Tetexact) the value for the compartment is \n"
+		"returned, although individual or groups of tetrahedral elements may have different \n"
+		"values (set with setTetDiffD). \n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompDiffD(comp, diff)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string diff\n"
+		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTetBarycenter", _wrap_Tetmesh_getTetBarycenter, METH_VARARGS, (char *)"\n"
-		"Returns the barycenter of the tetrahedron with index tidx.\n"
-		"\n"
-		"Syntax::\n"
-		"\n"
-		"    getTetBarycenter(tidx)\n"
+	 { (char *)"API_setCompDiffD", _wrap_API_setCompDiffD, METH_VARARGS, (char *)"\n"
+		"Sets the diffusion constant of diffusion rule with identifier string diff \n"
+		"in compartment with identifier string comp to dcst (in m^2/s).\n"
 		"\n"
-		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
-		"Return:\n"
-		"    list<float, length = 3>\n"
+		"Note: This method will set the diffusion constant in all tetrahedral elements \n"
+		"in the compartment.\n"
 		"\n"
-		""},
-	 { (char *)"Tetmesh_getTetComp", _wrap_Tetmesh_getTetComp, METH_VARARGS, (char *)"\n"
-		"Returns a reference to a steps.geom.Comp object: the compartment which \n"
-		"tetrahedron with index tidx belongs to. Returns None if tetrahedron not \n"
-		"assigned to a compartment.\n"
+		"Note: The default value still comes from the steps.model description, \n"
+		"so calling reset() will return the diffusion constants to that value. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getTetComp(tidx)\n"
-		"\n"
+		"    \n"
+		"    setCompDiffD(comp, diff, dcst)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string diff\n"
+		"    * float dcst\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.TmComp\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTetTriNeighb", _wrap_Tetmesh_getTetTriNeighb, METH_VARARGS, (char *)"\n"
-		"Returns the indices of the four neighbouring triangles of tetrahedron with index tidx.\n"
+	 { (char *)"API_getCompDiffActive", _wrap_API_getCompDiffActive, METH_VARARGS, (char *)"\n"
+		"Returns whether a diffusion rule with identifier string diff in compartment with \n"
+		"identifier string comp is active (True) or not (False). If diffusion of a species \n"
+		"is inactive this means the molecules will remain in place and has the same effect \n"
+		"as a diffusion constant of zero. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getTetTriNeighb(tidx)\n"
-		"\n"
+		"    \n"
+		"    getCompDiffActive(comp, diff)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string diff\n"
+		"\n"
 		"Return:\n"
-		"    list<uint, length = 4>\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getTetTetNeighb", _wrap_Tetmesh_getTetTetNeighb, METH_VARARGS, (char *)"\n"
-		"Returns the indices of the four neighbouring tetrahedrons of tetrahedron with index tidx. \n"
-		"An index of -1 indicates no neighbour (tetrahedron is on the mesh border).\n"
+	 { (char *)"API_setCompDiffActive", _wrap_API_setCompDiffActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) a diffusion rule with \n"
+		"identifier string diff in compartment with identifier string comp. If diffusion \n"
+		"of a species is inactive this means the molecules will remain in place and is \n"
+		"effectively the same as setting the diffusion constant to zero\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getTetTetNeighb(tidx)\n"
-		"\n"
+		"    \n"
+		"    setCompDiffActive(comp, diff, active)\n"
+		"    \n"
 		"Arguments:\n"
-		"    uint tidx\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string diff\n"
+		"    * bool active\n"
+		"\n"
 		"Return:\n"
-		"    list<int, length = 4>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_findTetByPoint", _wrap_Tetmesh_findTetByPoint, METH_VARARGS, (char *)"\n"
-		"Returns the index of the tetrahedron which encompasses a given point \n"
-		"p (given in Cartesian coordinates x,y,z). Returns -1 if p is a position \n"
-		"outside the mesh.\n"
+	 { (char *)"API_getCompReacC", _wrap_API_getCompReacC, METH_VARARGS, (char *)"\n"
+		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
+		"of reaction with identifier string reac in compartment with identifier string comp.\n"
 		"\n"
-		"Syntax::\n"
+		"The 'stochastic reaction constant' multiplied by infinitesimal time interval dt \n"
+		"gives the average probability that one reaction channel of this reaction type \n"
+		"will react accordingly in dt.\n"
 		"\n"
-		"    findTetByPoint(p)\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), the stochastic reaction constant \n"
+		"is computed as the weighted mean of the stochastic reaction constants in all \n"
+		"tetrahedral elements of the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompReacC(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    list<float, length = 3> p\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    int\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getBoundMin", _wrap_Tetmesh_getBoundMin, METH_VARARGS, (char *)"\n"
-		"Returns the minimal Cartesian coordinate of the rectangular bounding box of the mesh. \n"
+	 { (char *)"API_getCompReacH", _wrap_API_getCompReacH, METH_VARARGS, (char *)"\n"
+		"Returns h_mu, the distinct number of ways in which reaction with identifier string \n"
+		"reac can occur in compartment with identifier string comp, by computing the product \n"
+		"of its reactants. Note: in a mesh-based simulation (i.e. Tetexact), returns the sum \n"
+		"of the h_mu's over all tetrahedral elements in the compartment. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getBoundMin()\n"
-		"\n"
+		"    \n"
+		"    getCompReacH(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getBoundMax", _wrap_Tetmesh_getBoundMax, METH_VARARGS, (char *)"\n"
-		"Returns the maximal Cartesian coordinate of the rectangular bounding box of the mesh. \n"
+	 { (char *)"API_getCompReacA", _wrap_API_getCompReacA, METH_VARARGS, (char *)"\n"
+		"Returns the propensity of reaction with identifier string reac in compartment \n"
+		"with identifier string comp. \n"
 		"\n"
-		"Syntax::\n"
+		"The propensity of a reaction is a function of state and is defined as the \n"
+		"function whose product with infinitesimal time dt gives the probability \n"
+		"that the reaction will occur in the next dt. It is the 'stochastic reaction \n"
+		"constant' multiplied by 'h_mu'. \n"
 		"\n"
-		"    getBoundMax()\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), the propensity of a reaction \n"
+		"in a compartment is computed as the sum of the propensities in all tetrahedral \n"
+		"elements of the compartment. \n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompReacA(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_getMeshVolume", _wrap_Tetmesh_getMeshVolume, METH_VARARGS, (char *)"\n"
-		"Returns the total volume of the mesh. \n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_getCompReacExtent", _wrap_API_getCompReacExtent, METH_VARARGS, (char *)"\n"
+		"Return the extent of reaction with identifier string reac in compartment with \n"
+		"identifier string comp, that is the number of times the reaction has occurred up \n"
+		"to the current simulation time. \n"
 		"\n"
-		"    getMeshVolume()\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), returns the sum of the reaction \n"
+		"extents in all tetrahedral elements of the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    getCompReacExtent(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"Tetmesh_swigregister", Tetmesh_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_TmComp", (PyCFunction) _wrap_new_TmComp, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
-		"Returns a list of references to steps.geom.Patch patch objects: \n"
-		"the 'outer' patches.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_resetCompReacExtent", _wrap_API_resetCompReacExtent, METH_VARARGS, (char *)"\n"
+		"Resets the extent of reaction with identifier string reac in compartment with \n"
+		"identifier string comp to zero. \n"
 		"\n"
-		"    getOPatches()\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), \n"
+		"resets the extents of the reaction in all tetrahedral elements of the compartment.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    resetCompReacExtent(comp, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * string comp\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"delete_TmComp", _wrap_delete_TmComp, METH_VARARGS, (char *)"\n"
-		"Returns a list of references to steps.geom.Patch patch objects: \n"
-		"the 'outer' patches.\n"
+	 { (char *)"API_getTetVol", _wrap_API_getTetVol, METH_VARARGS, (char *)"\n"
+		"Returns the volume (in m^3) of the tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getOPatches()\n"
-		"\n"
+		"    \n"
+		"    getTetVol(idx)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"\n"
 		"Return:\n"
-		"    list<steps.geom.Patch>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_setVol", _wrap_TmComp_setVol, METH_VARARGS, (char *)"Obsolete"},
-	 { (char *)"TmComp_getAllTetIndices", _wrap_TmComp_getAllTetIndices, METH_VARARGS, (char *)"\n"
-		"Returns a list of indices of all tetrahedrons assigned to the compartment. \n"
+	 { (char *)"API_getTetSpecDefined", _wrap_API_getTetSpecDefined, METH_VARARGS, (char *)"\n"
+		"Returns whether species with identifier string spec is defined\n"
+		"in the tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getAllTetIndices()\n"
-		"\n"
+		"    \n"
+		"    getTetSpecDefined(idx, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    list<uint>\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_countTets", _wrap_TmComp_countTets, METH_VARARGS, (char *)"\n"
-		"Returns the number of tetrahedrons assigned to the compartment. \n"
+	 { (char *)"API_getTetCount", _wrap_API_getTetCount, METH_VARARGS, (char *)"\n"
+		"Returns the number of molecules of species with identifier string spec \n"
+		"in the tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    countTets()\n"
-		"\n"
+		"    \n"
+		"    getTetCount(idx, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
 		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_isTetInside", _wrap_TmComp_isTetInside, METH_VARARGS, (char *)"\n"
-		"Returns a list of Booleans describing if tetrahedrons tets are \n"
-		"assigned to the compartment.\n"
+	 { (char *)"API_setTetCount", _wrap_API_setTetCount, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"tetrahedral element with index idx to n.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    isTetInside(tets)\n"
-		"\n"
+		"    setTetCount(idx, spec, n)\n"
+		"    \n"
 		"Arguments:\n"
-		"    list<uint> tets\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"    * uint n\n"
+		"\n"
 		"Return:\n"
-		"    list<bool, length = length(tets)>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_getBoundMin", _wrap_TmComp_getBoundMin, METH_VARARGS, (char *)"\n"
-		"Returns the minimal Cartesian coordinate of the rectangular bounding box \n"
-		"of the compartment. \n"
+	 { (char *)"API_getBatchTetCounts", _wrap_API_getBatchTetCounts, METH_VARARGS, (char *)"\n"
+		"Returns the numbers of molecules of species with identifier string spec \n"
+		"in the tetrahedral elements with indices in list idxs.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getBoundMin()\n"
-		"\n"
+		"    \n"
+		"    getBatchTetCounts(idxs, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * list<uint> idxs\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    list<float>\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_getBoundMax", _wrap_TmComp_getBoundMax, METH_VARARGS, (char *)"\n"
-		"Returns the maximal Cartesian coordinate of the rectangular bounding box \n"
-		"of the compartment. \n"
+	 { (char *)"API_setBatchTetCounts", _wrap_API_setBatchTetCounts, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"each tetrahedral element with index idxs[i] to counts[i]. Nothing is changed if any \n"
+		"index or count is invalid.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getBoundMax()\n"
-		"\n"
+		"    \n"
+		"    setBatchTetCounts(idxs, spec, counts)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * list<uint> idxs\n"
+		"    * string spec\n"
+		"    * list<float> counts\n"
+		"\n"
 		"Return:\n"
-		"    list<float, length = 3>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"TmComp_swigregister", TmComp_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_TmPatch", (PyCFunction) _wrap_new_TmPatch, METH_VARARGS | METH_KEYWORDS, (char *)"\n"
-		"Returns a reference to the steps.geom.Comp compartment object representing\n"
-		"the outer compartment.\n"
+	 { (char *)"API_getBatchTetCountsNP", _wrap_API_getBatchTetCountsNP, METH_VARARGS, (char *)"\n"
+		"Fills counts[i] with the number of molecules of species with identifier \n"
+		"string spec in the tetrahedral element with index idxs[i]. idxs and counts are \n"
+		"contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 \n"
+		"and float64; no copies are made.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getOComp()\n"
-		"\n"
+		"    getBatchTetCountsNP(idxs, spec, counts)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * buffer<uint> idxs\n"
+		"    * string spec\n"
+		"    * buffer<float> counts\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.Comp\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"delete_TmPatch", _wrap_delete_TmPatch, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the steps.geom.Comp compartment object representing\n"
-		"the outer compartment.\n"
+	 { (char *)"API_setBatchTetCountsNP", _wrap_API_setBatchTetCountsNP, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"the tetrahedral element with index idxs[i] to counts[i]. idxs and counts are \n"
+		"contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 \n"
+		"and float64; no copies are made.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getOComp()\n"
-		"\n"
+		"    setBatchTetCountsNP(idxs, spec, counts)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * buffer<uint> idxs\n"
+		"    * string spec\n"
+		"    * buffer<float> counts\n"
+		"\n"
 		"Return:\n"
-		"    steps.geom.Comp\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"TmPatch_setArea", _wrap_TmPatch_setArea, METH_VARARGS, (char *)"Obsolete"},
-	 { (char *)"TmPatch_getAllTriIndices", _wrap_TmPatch_getAllTriIndices, METH_VARARGS, (char *)"\n"
-		"Returns a list of indices of all triangles assigned to the patch.\n"
+	 { (char *)"API_getTetAmount", _wrap_API_getTetAmount, METH_VARARGS, (char *)"\n"
+		"Returns the amount (in mols) of species with identifier string spec in \n"
+		"tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getAllTriIndices()\n"
-		"\n"
+		"    \n"
+		"    getTetAmount(idx, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    list<uint>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"TmPatch_isTriInside", _wrap_TmPatch_isTriInside, METH_VARARGS, (char *)"\n"
-		"Returns a list of Booleans describing if triangles tris are \n"
-		"assigned to the patch.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setTetAmount", _wrap_API_setTetAmount, METH_VARARGS, (char *)"\n"
+		"Sets the amount (in mols) of species with identifier string spec in tetrahedral \n"
+		"element with index idx to a. This continuous value must be converted internally \n"
+		"to a discrete number of molecules by multiplication with Avogadro's \n"
+		"number. \n"
 		"\n"
-		"    isTriInside(tris)\n"
+		"Due to the small volumes of tetrahedral elements the difference \n"
+		"between 'rounding up' and 'rounding down' can be a significant difference in \n"
+		"concentration.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setTetAmount(idx, spec, a)\n"
+		"    \n"
 		"Arguments:\n"
-		"    list<uint> tris\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"    * float a\n"
+		"\n"
 		"Return:\n"
-		"    list<bool, length = length(tris)>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"TmPatch_swigregister", TmPatch_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_DiffBoundary", (PyCFunction) _wrap_new_DiffBoundary, METH_VARARGS | METH_KEYWORDS, (char *)"new_DiffBoundary(string id, Tetmesh container, vector_uint tris) -> DiffBoundary"},
-	 { (char *)"delete_DiffBoundary", _wrap_delete_DiffBoundary, METH_VARARGS, (char *)"delete_DiffBoundary(DiffBoundary self)"},
-	 { (char *)"DiffBoundary_getID", _wrap_DiffBoundary_getID, METH_VARARGS, (char *)"\n"
-		"Get the identifier string of the diffusion boundary.\n"
+	 { (char *)"API_getTetConc", _wrap_API_getTetConc, METH_VARARGS, (char *)"\n"
+		"Returns the concentration (in Molar units) of species with identifier \n"
+		"string spec in a tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getID()\n"
-		"\n"
+		"    \n"
+		"    getTetConc(idx, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"DiffBoundary_setID", _wrap_DiffBoundary_setID, METH_VARARGS, (char *)"\n"
-		"Set the identifier string of the diffusion boundary.\n"
-		"\n"
-		"Syntax::\n"
+	 { (char *)"API_setTetConc", _wrap_API_setTetConc, METH_VARARGS, (char *)"\n"
+		"Sets the concentration (in Molar units) of species with identifier string spec \n"
+		"in a tetrahedral element with index idx to conc.This continuous value must be \n"
+		"converted internally to a discrete number of molecules. \n"
 		"\n"
-		"    setID(name)\n"
+		"Due to the small volumes of tetrahedral elements the difference between 'rounding \n"
+		"up' and 'rounding down' can be a large difference in concentration.\n"
 		"\n"
+		"Syntax::\n"
+		"    \n"
+		"    setTetConc(idx, spec, conc)\n"
+		"    \n"
 		"Arguments:\n"
-		"    string name\n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"    * conc\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"DiffBoundary_getContainer", _wrap_DiffBoundary_getContainer, METH_VARARGS, (char *)"\n"
-		"Returns a reference to the parent steps.geom.Tetmesh container object.\n"
+	 { (char *)"API_getTetClamped", _wrap_API_getTetClamped, METH_VARARGS, (char *)"\n"
+		"Returns True if concentration of species with identifier string spec in tetrahedral \n"
+		"element with index idx is clamped (buffered), which means the concentration stays the \n"
+		"same regardless of reactions that consume or produce molecules of this species or \n"
+		"diffusion of this species into or out of the tetrahedral element. Returns False if \n"
+		"not.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getContainer()\n"
-		"\n"
+		"    \n"
+		"    getTetClamped(idx, spec)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * uint idx\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    steps.geom.Tetmesh\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"DiffBoundary_getComps", _wrap_DiffBoundary_getComps, METH_VARARGS, (char *)"\n"
-		"Returns a list of the two compartments this diffusion boundary connects.\n"
-		"             \n"
-		"Syntax::\n"
-		"             \n"
-		"    getComps()\n"
-		"             \n"
-		"Arguments:\n"
-		"    None\n"
-		"             \n"
-		"Return:\n"
-		"    list<steps::wm::Comp, length = 2>\n"
+	 { (char *)"API_setTetClamped", _wrap_API_setTetClamped, METH_VARARGS, (char *)"\n"
+		"Sets whether the concentration of species spec in tetrahedral element with \n"
+		"index idx is clamped (clamped = True) or not (clamped = False). \n"
+		"If a species is clamped the concentration stays the same regardless \n"
+		"of reactions that consume or produce molecules of the species or \n"
+		"diffusion of the species into or out of the tetrahedral element.\n"
 		"\n"
-		""},
-	 { (char *)"DiffBoundary_isTriInside", _wrap_DiffBoundary_isTriInside, METH_VARARGS, (char *)"\n"
-		"Returns a list of Booleans describing if triangles tris are \n"
-		"assigned to the Diffusion Boundary.\n"
-		"             \n"
 		"Syntax::\n"
-		"             \n"
-		"    isTriInside(tris)\n"
-		"             \n"
+		"    \n"
+		"    setTetClamped(idx, spec, clamped)\n"
+		"    \n"
 		"Arguments:\n"
-		"    list<uint> tris\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"    * bool clamped\n"
+		"\n"
 		"Return:\n"
-		"    list<bool, length = length(tris)>\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"DiffBoundary_getAllTriIndices", _wrap_DiffBoundary_getAllTriIndices, METH_VARARGS, (char *)"\n"
-		"Returns a list of indices of all triangles assigned to the patch.\n"
-		"             \n"
+	 { (char *)"API_getTetReacK", _wrap_API_getTetReacK, METH_VARARGS, (char *)"\n"
+		"Returns the macroscopic reaction constant of reaction with identifier string reac \n"
+		"in tetrahedral element with index idx. The unit of the reaction constant depends \n"
+		"on the order of the reaction.\n"
+		"\n"
 		"Syntax::\n"
-		"             \n"
-		"    getAllTriIndices()\n"
-		"             \n"
+		"    \n"
+		"    getTetReacK(idx, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"             \n"
+		"    * uint idx\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    list<uint>\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"DiffBoundary_swigregister", DiffBoundary_swigregister, METH_VARARGS, NULL},
-	 { (char *)"delete_RNG", _wrap_delete_RNG, METH_VARARGS, (char *)"delete_RNG(RNG self)"},
-	 { (char *)"RNG_initialize", _wrap_RNG_initialize, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_setTetReacK", _wrap_API_setTetReacK, METH_VARARGS, (char *)"\n"
+		"Sets the macroscopic reaction constant of reaction with identifier string reac \n"
+		"in tetrahedral element with index idx to kf. The units of the reaction constant \n"
+		"depends on the order of the reaction.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    setTetReacK(idx, reac, kf)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
+		"    * float kf\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"RNG_get", _wrap_RNG_get, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetReacActive", _wrap_API_getTetReacActive, METH_VARARGS, (char *)"\n"
+		"Returns whether reaction with identifier string reac in tetrahedral element \n"
+		"with index idx is active (True) or not (False). If it's not active this means \n"
+		"that the reaction will never occur regardless of whether reactants are present \n"
+		"in sufficient numbers or not.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetReacActive(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getUnfII", _wrap_RNG_getUnfII, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_setTetReacActive", _wrap_API_setTetReacActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) a reaction with identifier \n"
+		"string reac in tetrahedral element with index idx. If it's not active this means \n"
+		"that the reaction will never occur regardless of whether reactants are present \n"
+		"in sufficient numbers or not.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    setTetReacActive(idx, reac, active)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
+		"    * bool active\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getUnfIE", _wrap_RNG_getUnfIE, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetDiffD", _wrap_API_getTetDiffD, METH_VARARGS, (char *)"\n"
+		"Returns the diffusion constant of diffusion rule with identifier string diff \n"
+		"in tetrahedral element with index idx. This constant is in units m^2/s. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetDiffD(idx, diff)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string diff\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getUnfEE", _wrap_RNG_getUnfEE, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_setTetDiffD", _wrap_API_setTetDiffD, METH_VARARGS, (char *)"\n"
+		"Sets the diffusion constant of diffusion rule with identifier string diff in \n"
+		"tetrahedral element with index idx to dcst (in m^2/s).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    setTetDiffD(idx, diff, dcst)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string diff\n"
+		"    * dcst\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getUnfIE53", _wrap_RNG_getUnfIE53, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetDiffActive", _wrap_API_getTetDiffActive, METH_VARARGS, (char *)"\n"
+		"Returns whether diffusion with identifier string diff in tetrahedral element \n"
+		"with index idx is active (True) or not (False). If diffusion of a species \n"
+		"is inactive this means the molecules will never diffuse out of the tetrahedron \n"
+		"and has the same effect as a diffusion constant of zero.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetDiffActive(idx, diff)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string diff\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getStdExp", _wrap_RNG_getStdExp, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_setTetDiffActive", _wrap_API_setTetDiffActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) diffusion rule with \n"
+		"identifier string diff in tetrahedral element with index idx. If diffusion of \n"
+		"a species is inactive this means the molecules will never diffuse out of the \n"
+		"tetrahedron and has the same effect as a diffusion constant of zero. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    setTetDiffActive(idx, diff, active)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string diff\n"
+		"    * bool active\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getExp", _wrap_RNG_getExp, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetReacC", _wrap_API_getTetReacC, METH_VARARGS, (char *)"\n"
+		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
+		"of reaction with identifier string reac in tetrahedral element with index idx.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetReacC(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getPsn", _wrap_RNG_getPsn, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetReacH", _wrap_API_getTetReacH, METH_VARARGS, (char *)"\n"
+		"Returns h_mu, the distinct number of ways in which reaction with identifier string \n"
+		"reac can occur in tetrahedral element with index idx, by computing the product of \n"
+		"its reactants.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetReacH(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"RNG_getStdNrm", _wrap_RNG_getStdNrm, METH_VARARGS, (char *)"\n"
-		"Initialize the random number generator with given seed value.\n"
-		"\n"
+	 { (char *)"API_getTetReacA", _wrap_API_getTetReacA, METH_VARARGS, (char *)"\n"
+		"Returns the propensity of reaction with identifier string reac in tetrahedral \n"
+		"element with index idx.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    initialize(seed)\n"
+		"    getTetReacA(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint seed\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"RNG_swigregister", RNG_swigregister, METH_VARARGS, NULL},
-	 { (char *)"create_mt19937", _wrap_create_mt19937, METH_VARARGS, (char *)"\n"
-		"Equivalent to: create('mt19937', buffer_size)\n"
+	 { (char *)"API_getTetDiffA", _wrap_API_getTetDiffA, METH_VARARGS, (char *)"\n"
+		"Returns the propensityof diffusion rule with identifier string diff in \n"
+		"tetrahedral element with index idx. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    create_mt19937(buffer_size)\n"
+		"    \n"
+		"    getTetDiffA(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint buffer_size\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    steps.rng.RNG\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"create", _wrap_create, METH_VARARGS, (char *)"\n"
-		"Creates and returns a reference to a steps.rng.RNG random number generator object, \n"
-		"which is specified by type and pre-allocates a buffer list with size of buffer_size.\n"
+	 { (char *)"API_getPatchArea", _wrap_API_getPatchArea, METH_VARARGS, (char *)"\n"
+		"Returns the area of patch with identifier string pat (in m^2).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    create(type, buffer_size)\n"
-		"\n"
+		"    getPatchArea(pat)\n"
+		"    \n"
 		"Arguments:\n"
-		"    * string type\n"
-		"    * uint buffer_size\n"
+		"    * string pat\n"
 		"\n"
 		"Return:\n"
-		"    steps.rng.RNG\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"delete_API", _wrap_delete_API, METH_VARARGS, (char *)"delete_API(API self)"},
-	 { (char *)"API_getSolverName", _wrap_API_getSolverName, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver's name.\n"
+	 { (char *)"API_setPatchArea", _wrap_API_setPatchArea, METH_VARARGS, (char *)"\n"
+		"Sets the area of patch with identifier string pat to area a (in m^2).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getSolverName()\n"
+		"    setPatchArea(pat, area)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * float area\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getSolverDesc", _wrap_API_getSolverDesc, METH_VARARGS, (char *)"\n"
-		"Returns a string giving a short description of the solver.\n"
+	 { (char *)"API_getPatchCount", _wrap_API_getPatchCount, METH_VARARGS, (char *)"\n"
+		"Returns the number of molecules of species with identifier string spec in patch \n"
+		"with identifier string pat.Note: in a mesh-based simulation (i.e. Tetexact) this \n"
+		"is the combined count from all triangular elements in the patch. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getSolverDesc()\n"
+		"    getPatchCount(pat, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getSolverAuthors", _wrap_API_getSolverAuthors, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver authors names.\n"
+	 { (char *)"API_setPatchCount", _wrap_API_setPatchCount, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in patch \n"
+		"with identifier string pat to n. Note: in a mesh-based simulation (i.e. Tetexact) \n"
+		"the molecules are divided as equally as possible over all triangular elements in \n"
+		"the patch (i.e. a uniform distribution). \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getSolverAuthors()\n"
+		"    setPatchCount(pat, spec, n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string spec\n"
+		"    * uint n\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getSolverEmail", _wrap_API_getSolverEmail, METH_VARARGS, (char *)"\n"
-		"Returns a string giving the author's email address.\n"
+	 { (char *)"API_getPatchAmount", _wrap_API_getPatchAmount, METH_VARARGS, (char *)"\n"
+		"Returns the amount (in mols) of species with identifier string spec in patch \n"
+		"with identifier string pat.\n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) this is the combined amount \n"
+		"from all triangular elements in the patch. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getSolverEmail()\n"
+		"    getPatchAmount(pat, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_reset", _wrap_API_reset, METH_VARARGS, (char *)"\n"
-		"Reset the simulation to the state the solver was initialised to. \n"
-		"Typically, this resets all concentrations of all chemical species in \n"
-		"all elements (whether compartments and patches in a well-mixed solver \n"
-		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
-		"resets the simulation time to zero and resets reaction (and diffusion) \n"
-		"rates to the default values described in the steps.model objects. \n"
-		"All reaction (and diffusion) rules are reset to active and all \n"
-		"compartment volumes and patch areas are reset to default values \n"
-		"described in steps.geom objects (for well-mixed solvers). \n"
-		"Usually, this method should be called before starting each simulation iteration.\n"
+	 { (char *)"API_setPatchAmount", _wrap_API_setPatchAmount, METH_VARARGS, (char *)"\n"
+		"Sets the amount (in mols) of species with identifier string spec in patch with \n"
+		"identifier string pat to a. In a discrete solver, such as Wmdirect and Tetexact, \n"
+		"this continuous value is converted internally into a discrete number of molecules \n"
+		"by multiplication with Avogadro's number. \n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as \n"
+		"equally as possible over all triangular elements in the patch (i.e. a uniform \n"
+		"distribution).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    reset()\n"
+		"    setPatchAmount(pat, spec, a)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string spec\n"
+		"    * float a\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_checkpoint", _wrap_API_checkpoint, METH_VARARGS, (char *)"\n"
-		"Checkpoint the simulation state to a file.\n"
+	 { (char *)"API_getPatchClamped", _wrap_API_getPatchClamped, METH_VARARGS, (char *)"\n"
+		"Sets the amount (in mols) of species with identifier string spec in patch with \n"
+		"identifier string pat to a. In a discrete solver, such as Wmdirect and Tetexact, \n"
+		"this continuous value is converted internally into a discrete number of molecules \n"
+		"by multiplication with Avogadro's number. \n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as equally \n"
+		"as possible over all triangular elements in the patch (i.e. a uniform distribution).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    checkpoint(file_name)\n"
+		"    getPatchClamped(pat, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string file_name\n"
+		"    * string pat\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_restore", _wrap_API_restore, METH_VARARGS, (char *)"\n"
-		"Restore the simulation state from a file.\n"
+	 { (char *)"API_setPatchClamped", _wrap_API_setPatchClamped, METH_VARARGS, (char *)"\n"
+		"Sets whether the species with identifier string spec in patch with identifier \n"
+		"string pat is clamped (clamped = True) or not (clamped = False). If a species \n"
+		"is clamped the number of molecules stays the same regardless of surface reactions \n"
+		"that consume or produce molecules of the species.\n"
+		"\n"
+		"Note: in a mesh-based simulation this will set the species to be clamped in all \n"
+		"triangular elements of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    restore(file_name)\n"
+		"    setPatchClamped(pat, spec, clamped)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string file_name\n"
+		"    * string pat\n"
+		"    * string spec\n"
+		"    * bool clamped\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_run", _wrap_API_run, METH_VARARGS, (char *)"\n"
-		"Advance the simulation until endtime (given in seconds) is reached. \n"
-		"The endtime must be larger or equal to the current simulation time.\n"
+	 { (char *)"API_getPatchSReacK", _wrap_API_getPatchSReacK, METH_VARARGS, (char *)"\n"
+		"Returns the macroscopic reaction constant of surface reaction with identifier \n"
+		"string sreac in patch with identifier string pat. The unit of the reaction constant \n"
+		"depends on the order of the reaction.\n"
+		"\n"
+		"Note: In a mesh-based solver (i.e. Tetexact) the value for the patch is returned, \n"
+		"although individual triangle elements may have different values \n"
+		"(set with setTriSReacK).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    run(endtime)\n"
+		"    getPatchSReacK(pat, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    float endtime\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getTime", _wrap_API_getTime, METH_VARARGS, (char *)"\n"
-		"Returns the current simulation time in seconds.\n"
+	 { (char *)"API_setPatchSReacK", _wrap_API_setPatchSReacK, METH_VARARGS, (char *)"\n"
+		"Sets the macroscopic reaction constant of surface reaction with identifier \n"
+		"string sreac in patch with identifier string pat to kf. The unit of the reaction \n"
+		"constant depends on the order of the reaction. \n"
+		"\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this method sets the surface \n"
+		"reaction constant in all triangular elements of the patch to kf.\n"
+		"\n"
+		"Note: The default value still comes from the steps.model description, so calling \n"
+		"reset() will return the surface reaction constant to that value.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTime()\n"
+		"    setPatchSReacK(pat, reac, kf)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string reac\n"
+		"    * float kf\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_advance", _wrap_API_advance, METH_VARARGS, (char *)"\n"
-		"Advance the simulation for secs seconds. \n"
+	 { (char *)"API_getPatchSReacActive", _wrap_API_getPatchSReacActive, METH_VARARGS, (char *)"\n"
+		"Returns whether a surface reaction with identifier string sreac in patch with \n"
+		"identifier string pat is active (True) or not (False). If it's not active this means \n"
+		"that a surface reaction will never occur regardless of whether the reactants are \n"
+		"present in sufficient numbers or not. \n"
+		"\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this method will return True only \n"
+		"if the surface reaction is active in all triangular elements in the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    advance(adv)\n"
+		"    getPatchSReacActive(pat, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    float adv\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_step", _wrap_API_step, METH_VARARGS, (char *)"\n"
-		"Advance the simulation for one 'step'. In stochastic solvers this is one \n"
-		"'realization' of the Gillespie SSA (one reaction 'event'). \n"
-		"In numerical solvers (currently Wmrk4) this is one time-step, with the \n"
-		"stepsize defined with the setDT method.\n"
+	 { (char *)"API_setPatchSReacActive", _wrap_API_setPatchSReacActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) a surface reaction with \n"
+		"identifier string sreac in patch with identifier string pat. If a surface reaction \n"
+		"is not active this means that a reaction will never occur regardless of whether the \n"
+		"reactants are present in sufficient numbers or not.\n"
+		"\n"
+		"Note: In a mesh-based simulation (i.e. Tetexact) this will activate/ deactivate the \n"
+		"reaction in all triangular elements in the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    step()\n"
+		"    setPatchSReacActive(pat, reac, active)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string reac\n"
+		"    * bool active\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setRk4DT", _wrap_API_setRk4DT, METH_VARARGS, (char *)"\n"
-		"Set the stepsize for numerical solvers. Must be called before running a \n"
-		"simulation with these solvers (currently Wmrk4) since there is no default \n"
-		"stepsize. The deterministic solver Wmrk4 implements a fixed stepsize \n"
-		"(i.e. not adaptive), although the stepsize can be altered at any point \n"
-		"during the simulation with this method.\n"
+	 { (char *)"API_getPatchSReacC", _wrap_API_getPatchSReacC, METH_VARARGS, (char *)"\n"
+		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
+		"of surface reaction with identifier string sreac in patch with identifier string pat.\n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), the stochastic reaction constant is \n"
+		"computed as the weighted mean of the stochastic reaction constants in all triangular \n"
+		"elements of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setRk4DT(dt)\n"
+		"    getPatchSReacC(pat, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    float dt\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setDT", _wrap_API_setDT, METH_VARARGS, (char *)"\n"
-		"Set the stepsize for numerical solvers. Superceded by setRk4DT, but\n"
-		"Included for backwards compatability.\n"
-		" \n"
+	 { (char *)"API_getPatchSReacH", _wrap_API_getPatchSReacH, METH_VARARGS, (char *)"\n"
+		"Returns h_mu, the distinct number of ways in which surface reaction with identifier \n"
+		"string sreac can occur in patch with identifier string pat, by computing the product \n"
+		"of its reactants. Note: in a mesh-based simulation (i.e. Tetexact), returns the sum \n"
+		"of the h_mu's over all triangular elements in the patch. \n"
+		"\n"
 		"Syntax::\n"
-		" \n"
-		"    setDT(dt)\n"
-		" \n"
+		"    \n"
+		"    getPatchSReacH(pat, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    float dt\n"
-		" \n"
+		"    * string pat\n"
+		"    * string reac\n"
+		"\n"
 		"Return:\n"
-		"    None\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getRk4DT", _wrap_API_getRk4DT, METH_VARARGS, (char *)"\n"
-		"Returns the stepsize for numerical solvers.\n"
+	 { (char *)"API_getPatchSReacA", _wrap_API_getPatchSReacA, METH_VARARGS, (char *)"\n"
+		"Returns the propensity of surface reaction with identifier string sreac in patch \n"
+		"with identifier string pat. Note: in a mesh-based simulation (i.e. Tetexact), \n"
+		"the propensity of a surface reaction in a patch is computed as the sum of the \n"
+		"propensities in all triangular elements of the patch.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getRk4DT()\n"
-		"\n"
+		"    \n"
+		"    getPatchSReacA(pat, reac)\n"
+		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getDT", _wrap_API_getDT, METH_VARARGS, (char *)"\n"
-		"Returns the stepsize for numerical solvers.\n"
-		"Superceded by getRk4DT, but included for backwards compatibility.\n"
+	 { (char *)"API_getPatchSReacExtent", _wrap_API_getPatchSReacExtent, METH_VARARGS, (char *)"\n"
+		"Returns the extent of surface reaction with identifier string sreac in patch \n"
+		"with identifier string pat, that is the number of times the surface reaction \n"
+		"has occurred up to the current simulation time. \n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), returns the sum of the reaction \n"
+		"extents in all triangular elements of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getDT()\n"
+		"    getPatchSReacExtent(pat,reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_setTime", _wrap_API_setTime, METH_VARARGS, (char *)"\n"
-		"Set the current simulation time.\n"
+	 { (char *)"API_resetPatchSReacExtent", _wrap_API_resetPatchSReacExtent, METH_VARARGS, (char *)"\n"
+		"Resets the extent of reaction with identifier string sreac in patch with identifier \n"
+		"string pat to zero. \n"
+		"\n"
+		"Note: in a mesh-based simulation (i.e. Tetexact), resets the extents of the reaction \n"
+		"in all triangular elements of the patch.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTime(time)\n"
+		"    resetPatchSReacExtent(pat, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    folat time\n"
+		"    * string pat\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getA0", _wrap_API_getA0, METH_VARARGS, (char *)"\n"
-		"Returns the total propensity of the current simulation state \n"
-		"(the total propensity multiplied by an infinitesimally small \n"
-		"time dt gives the probability that a reaction will occur in that dt). \n"
-		"For Tetexact this includes the propensity from the extension of the SSA \n"
-		"for diffusive flux between tetrahedral elements in the mesh.\n"
+	 { (char *)"API_setDiffBoundaryDiffusionActive", _wrap_API_setDiffBoundaryDiffusionActive, METH_VARARGS, (char *)"\n"
+		"Activates or inactivates diffusion across a diffusion boundary for a species.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getA0()\n"
+		"        \n"
+		"    setDiffBoundaryDiffusionActive(diffb, spec, act)\n"
 		"    \n"
 		"Arguments:\n"
-		"    None\n"
-		"\n"
+		"    * string diffb\n"
+		"    * string spec\n"
+		"    * bool act\n"
+		"             \n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getNSteps", _wrap_API_getNSteps, METH_VARARGS, (char *)"\n"
-		"Return the number of 'realizations' of the SSA, the number of reaction \n"
-		"(and diffusion) events in stochastic solvers.\n"
+	 { (char *)"API_getDiffBoundaryDiffusionActive", _wrap_API_getDiffBoundaryDiffusionActive, METH_VARARGS, (char *)"\n"
+		"Returns whether diffusion is active across a diffusion boundary for a species.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getNSteps()\n"
-		"    \n"
+		"\n"
+		"    getDiffBoundaryDiffusionActive(diffb, spec)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string diffb\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    uint\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setNSteps", _wrap_API_setNSteps, METH_VARARGS, (char *)"\n"
-		"Set the number of 'realizations' of the SSA, the number of reaction \n"
-		"(and diffusion) events in stochastic solvers.\n"
+	 { (char *)"API_getTriArea", _wrap_API_getTriArea, METH_VARARGS, (char *)"\n"
+		"Returns the area (in m^2) of the triangular element with index idx.\n"
+		"         \n"
+		"ax::\n"
+		"         \n"
+		"getTriArea(idx)\n"
+		"         \n"
+		"ments:\n"
+		"* uint idx\n"
+		"         \n"
+		"rn:\n"
+		"float\n"
+		"\n"
+		""},
+	 { (char *)"API_getTriSpecDefined", _wrap_API_getTriSpecDefined, METH_VARARGS, (char *)"\n"
+		"Returns whether species with identifier string spec is defined\n"
+		"in the triangle element with index idx.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setNSteps(nsteps)\n"
+		"    getTriSpecDefined(idx, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    uint nsteps\n"
+		"    * uint idx\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompVol", _wrap_API_getCompVol, METH_VARARGS, (char *)"\n"
-		"Returns the volume of compartment with identifier string comp (in m^3).\n"
+	 { (char *)"API_getTriCount", _wrap_API_getTriCount, METH_VARARGS, (char *)"\n"
+		"Returns the number of molecules of species with identifier string spec \n"
+		"in the triangular element with index idx.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompVol(comp)\n"
+		"    getTriCount(idx, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    string comp\n"
+		"    * uint idx\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompVol", _wrap_API_setCompVol, METH_VARARGS, (char *)"\n"
-		"Set the volume of compartment with identifier string comp (in m^3).\n"
+	 { (char *)"API_setTriCount", _wrap_API_setTriCount, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"triangular element with index idx to n. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompVol(comp, vol)\n"
+		"    setTriCount(idx, spec, n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * float vol\n"
+		"    * uint idx\n"
+		"    * string spec\n"
+		"    * uint n\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompCount", _wrap_API_getCompCount, METH_VARARGS, (char *)"\n"
-		"Returns the number of molecules of a species with identifier string spec \n"
-		"in compartment with identifier string comp.\n"
-		"\n"
-		"In a mesh-based simulation (i.e. Tetexact) this is the combined count from \n"
-		"all tetrahedral elements in the compartment.\n"
+	 { (char *)"API_getBatchTriCounts", _wrap_API_getBatchTriCounts, METH_VARARGS, (char *)"\n"
+		"Returns the numbers of molecules of species with identifier string spec \n"
+		"in the triangular elements with indices in list idxs.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompCount(comp, spec)\n"
+		"    getBatchTriCounts(idxs, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * list<uint> idxs\n"
 		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    list<float>\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompCount", _wrap_API_setCompCount, METH_VARARGS, (char *)"\n"
-		"Set the number of molecules of a species with identifier string spec \n"
-		"in compartment with identifier string comp.\n"
-		"\n"
-		"In a mesh-based simulation (i.e. Tetexact) this is the combined count from \n"
-		"all tetrahedral elements in the compartment.\n"
+	 { (char *)"API_setBatchTriCounts", _wrap_API_setBatchTriCounts, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"each triangular element with index idxs[i] to counts[i]. Nothing is changed if any \n"
+		"index or count is invalid.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompCount(comp, spec, nspec)\n"
+		"    setBatchTriCounts(idxs, spec, counts)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * list<uint> idxs\n"
 		"    * string spec\n"
-		"    * uint nspec\n"
+		"    * list<float> counts\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompAmount", _wrap_API_getCompAmount, METH_VARARGS, (char *)"\n"
-		"Returns the amount (in mols) of species with identifier string spec in compartment \n"
-		"with identifier string comp.\n"
-		"\n"
-		"In a mesh-based simulation (i.e. Tetexact) this is the combined amount from all \n"
-		"tetrahedral elements in the compartment.\n"
+	 { (char *)"API_getBatchTriCountsNP", _wrap_API_getBatchTriCountsNP, METH_VARARGS, (char *)"\n"
+		"Fills counts[i] with the number of molecules of species with identifier \n"
+		"string spec in the triangular element with index idxs[i]. idxs and counts are \n"
+		"contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 \n"
+		"and float64; no copies are made.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompAmount(comp, spec)\n"
+		"    getBatchTriCountsNP(idxs, spec, counts)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * buffer<uint> idxs\n"
 		"    * string spec\n"
+		"    * buffer<float> counts\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompAmount", _wrap_API_setCompAmount, METH_VARARGS, (char *)"\n"
-		"Set the amount (in mols) of species with identifier string spec in compartment \n"
-		"with identifier string comp.\n"
-		"\n"
-		"In a mesh-based simulation (i.e. Tetexact) this is the combined amount from all \n"
-		"tetrahedral elements in the compartment.\n"
+	 { (char *)"API_setBatchTriCountsNP", _wrap_API_setBatchTriCountsNP, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules of species with identifier string spec in \n"
+		"the triangular element with index idxs[i] to counts[i]. idxs and counts are \n"
+		"contiguous buffers of equal length, e.g. NumPy arrays of dtype uint32 \n"
+		"and float64; no copies are made.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompAmount(comp, spec, amount)\n"
+		"    setBatchTriCountsNP(idxs, spec, counts)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * buffer<uint> idxs\n"
 		"    * string spec\n"
-		"    * float amount\n"
+		"    * buffer<float> counts\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompConc", _wrap_API_getCompConc, METH_VARARGS, (char *)"\n"
-		"Returns the concentration (in Molar units) of species with identifier string spec \n"
-		"in compartment with identifier string comp.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) this is calculated from the combined \n"
-		"number of molecules from all tetrahedral elements in the compartment and the total \n"
-		"volume of the tetrahedrons.\n"
+	 { (char *)"API_getTriAmount", _wrap_API_getTriAmount, METH_VARARGS, (char *)"\n"
+		"Returns the amount (in mols) of species with identifier string spec in triangular \n"
+		"element with index idx.  \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompConc(comp, spec)\n"
+		"    getTriAmount(idx, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string spec\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompConc", _wrap_API_setCompConc, METH_VARARGS, (char *)"\n"
-		"Sets the concentration (in Molar units) of species with identifier string spec \n"
-		"in compartment with identifier string comp to conc. In a discrete solver the \n"
-		"continuous concentration is converted to a discrete number of \n"
-		"molecules.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as \n"
-		"equally as possible over all tetrahedral elements in the compartment (i.e. a \n"
-		"uniform distribution).\n"
+	 { (char *)"API_setTriAmount", _wrap_API_setTriAmount, METH_VARARGS, (char *)"\n"
+		"Sets the amount (in mols) of species with identifier string spec in triangular \n"
+		"element with index idx to a. This continuous value must be converted internally \n"
+		"to a discrete number of molecules by multiplication with Avogadro's number. \n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    setCompConc(comp, spec, conc)\n"
+		"    \n"
+		"    setTriAmount(idx, spec, a)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string spec\n"
-		"    * float conc\n"
+		"    * float a\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompClamped", _wrap_API_getCompClamped, METH_VARARGS, (char *)"\n"
-		"Returns True if species with identifier string spec in compartment with identifier \n"
-		"string comp is clamped (buffered), which means the concentration remains the same \n"
-		"regardless of reactions that consume or produce molecules of this species. \n"
+	 { (char *)"API_getTriClamped", _wrap_API_getTriClamped, METH_VARARGS, (char *)"\n"
+		"Returns True if the species with identifier string spec in triangular element \n"
+		"with index idx is clamped (buffered), which means the number of molecules stays \n"
+		"the same regardless of reactions that consume or produce molecules of this species. \n"
 		"Returns False if not.\n"
 		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) it returns True only if the species \n"
-		"is clamped in all tetrahedral elements of the compartment.\n"
-		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompClamped(comp, spec)\n"
+		"    getTriClamped(idx, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string spec\n"
 		"\n"
 		"Return:\n"
 		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompClamped", _wrap_API_setCompClamped, METH_VARARGS, (char *)"\n"
-		"Sets whether the concentration of species with identifier string spec in compartment \n"
-		"with identifier string comp is clamped (clamped = True) or not (clamped = False). \n"
-		"If a species is clamped the concentration stays the same regardless of reactions \n"
-		"that consume or produce molecules of the species.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) this will set the species to be \n"
-		"clamped or not in all tetrahedral elements of the compartment.\n"
+	 { (char *)"API_setTriClamped", _wrap_API_setTriClamped, METH_VARARGS, (char *)"\n"
+		"Sets whether the concentration of species spec in triangular element with index idx \n"
+		"is clamped (clamped = True) or not (clamped = False). If a species is clamped the \n"
+		"concentration stays the same regardless of reactions that consume or produce \n"
+		"molecules of the species. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompClamped(comp, spec, clamped)\n"
+		"    setTriClamped(idx, spec, clamped)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string spec\n"
 		"    * bool clamped\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacK", _wrap_API_getCompReacK, METH_VARARGS, (char *)"\n"
-		"Returns the macroscopic reaction constant of reaction with identifier string reac \n"
-		"in compartment with identifier string comp. The unit of the reaction constant depends \n"
-		"on the order of the reaction.\n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) the value for the compartment is \n"
-		"returned, although individual tetrahedral elements may have different values \n"
-		"(set with setTetReacK).\n"
+	 { (char *)"API_getTriSReacK", _wrap_API_getTriSReacK, METH_VARARGS, (char *)"\n"
+		"Returns the macroscopic reaction constant of surface reaction with identifier \n"
+		"string sreac in triangular element with index idx. The units of the reaction \n"
+		"constant depends on the order of the reaction. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacK(comp, reac)\n"
+		"    getTriSReacK(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string reac\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompReacK", _wrap_API_setCompReacK, METH_VARARGS, (char *)"\n"
-		"Sets the macroscopic reaction constant of reaction with identifier string reac \n"
-		"in compartment with identifier string comp to kf. The unit of the reaction constant \n"
-		"depends on the order of the reaction.\n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this method sets the reaction \n"
-		"constant in all tetrahedral elements of the compartment to kf\n"
-		"\n"
-		"Note: The default value still comes from the steps.model description, so \n"
-		"calling reset() will return the reaction constant to that value.\n"
+	 { (char *)"API_setTriSReacK", _wrap_API_setTriSReacK, METH_VARARGS, (char *)"\n"
+		"Sets the macroscopic reaction constant of surface reaction with identifier \n"
+		"string sreac in triangular element with index idx to kf. The units of the \n"
+		"reaction constant depends on the order of the reaction.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompReacK(comp, reac, kf)\n"
+		"    setTriSReacK(idx, reac, kf)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string reac\n"
 		"    * float kf\n"
 		"\n"
@@ -52446,1314 +59045,1313 @@ static PyMethodDef SwigMethods[] = {
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacActive", _wrap_API_getCompReacActive, METH_VARARGS, (char *)"\n"
-		"Returns whether a reaction with identifier string reac in compartment with identifier \n"
-		"string comp is active (True) or not (False). If it's not active this means that a \n"
-		"reaction will never occur regardless of whether the reactants are present in \n"
-		"sufficient numbers or not. \n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this method will return True only \n"
-		"if the reaction is active in all tetrahedral elements in the compartment. \n"
+	 { (char *)"API_getTriSReacActive", _wrap_API_getTriSReacActive, METH_VARARGS, (char *)"\n"
+		"Returns whether surface reaction with identifier string sreac in triangular \n"
+		"element with index idx is active (True) or not (False). If it's not active \n"
+		"this means that the surface reaction will never occur regardless of whether \n"
+		"reactants are present in sufficient numbers or not. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacActive(comp, reac)\n"
+		"    getTriSReacActive(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string reac\n"
 		"\n"
 		"Return:\n"
 		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompReacActive", _wrap_API_setCompReacActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) a reaction with identifier \n"
-		"string reac in compartment with identifier string comp. If a reaction is not active \n"
-		"this means that a reaction will never occur regardless of whether the reactants are \n"
-		"present in sufficient numbers or not.\n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this will activate/deactivate the \n"
-		"reaction in all tetrahedral elements in the compartment. \n"
+	 { (char *)"API_setTriSReacActive", _wrap_API_setTriSReacActive, METH_VARARGS, (char *)"\n"
+		"Activate (active = True) or deactivate (active = False) a surface reaction \n"
+		"with identifier string sreac in triangular element with index idx. If it's \n"
+		"not active this means that the surface reaction will never occur regardless \n"
+		"of whether reactants are present in sufficient numbers or not.  \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompReacActive(comp, reac, active)\n"
+		"    setTriSReacActive(idx, reac, active)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string reac\n"
-		"    * bool active\n"
+		"    * active\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompDiffD", _wrap_API_getCompDiffD, METH_VARARGS, (char *)"\n"
-		"Returns the diffusion constant of diffusion rule with identifier string diff \n"
-		"in compartment with identifier string comp. This constant is in units m^2/s.\n"
-		"\n"
-		"Note: In a mesh-based solver (i.e. Tetexact) the value for the compartment is \n"
-		"returned, although individual or groups of tetrahedral elements may have different \n"
-		"values (set with setTetDiffD). \n"
+	 { (char *)"API_getTriSReacC", _wrap_API_getTriSReacC, METH_VARARGS, (char *)"\n"
+		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
+		"of surface reaction with identifier string sreac in triangular element with index idx.  \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompDiffD(comp, diff)\n"
+		"    getTriSReacC(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string diff\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"   float\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompDiffD", _wrap_API_setCompDiffD, METH_VARARGS, (char *)"\n"
-		"Sets the diffusion constant of diffusion rule with identifier string diff \n"
-		"in compartment with identifier string comp to dcst (in m^2/s).\n"
-		"\n"
-		"Note: This method will set the diffusion constant in all tetrahedral elements \n"
-		"in the compartment.\n"
-		"\n"
-		"Note: The default value still comes from the steps.model description, \n"
-		"so calling reset() will return the diffusion constants to that value. \n"
+	 { (char *)"API_getTriSReacH", _wrap_API_getTriSReacH, METH_VARARGS, (char *)"\n"
+		"Returns h_mu, the distinct number of ways in which surface reaction with identifier \n"
+		"string sreac can occur in triangular element with index idx, by computing the product \n"
+		"of its reactants. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompDiffD(comp, diff, dcst)\n"
+		"    getTriSReacH(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string diff\n"
-		"    * float dcst\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"   float\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompDiffActive", _wrap_API_getCompDiffActive, METH_VARARGS, (char *)"\n"
-		"Returns whether a diffusion rule with identifier string diff in compartment with \n"
-		"identifier string comp is active (True) or not (False). If diffusion of a species \n"
-		"is inactive this means the molecules will remain in place and has the same effect \n"
-		"as a diffusion constant of zero. \n"
+	 { (char *)"API_getTriSReacA", _wrap_API_getTriSReacA, METH_VARARGS, (char *)"\n"
+		"Returns the propensity of surface reaction with identifier string sreac \n"
+		"in triangular element with index idx. \n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompDiffActive(comp, diff)\n"
+		"    getTriSReacA(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string diff\n"
+		"    * uint idx\n"
+		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"   float\n"
 		"\n"
 		""},
-	 { (char *)"API_setCompDiffActive", _wrap_API_setCompDiffActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) a diffusion rule with \n"
-		"identifier string diff in compartment with identifier string comp. If diffusion \n"
-		"of a species is inactive this means the molecules will remain in place and is \n"
-		"effectively the same as setting the diffusion constant to zero\n"
+	 { (char *)"API_getCompSpecHandle", _wrap_API_getCompSpecHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the species with identifier string spec in compartment with \n"
+		"identifier string comp into a handle for getCount, setReacK and the \n"
+		"other handle-based methods, which skip the name lookups. Handles stay \n"
+		"valid for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setCompDiffActive(comp, diff, active)\n"
+		"    getCompSpecHandle(comp, spec)\n"
 		"    \n"
 		"Arguments:\n"
 		"    * string comp\n"
-		"    * string diff\n"
-		"    * bool active\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacC", _wrap_API_getCompReacC, METH_VARARGS, (char *)"\n"
-		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
-		"of reaction with identifier string reac in compartment with identifier string comp.\n"
-		"\n"
-		"The 'stochastic reaction constant' multiplied by infinitesimal time interval dt \n"
-		"gives the average probability that one reaction channel of this reaction type \n"
-		"will react accordingly in dt.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), the stochastic reaction constant \n"
-		"is computed as the weighted mean of the stochastic reaction constants in all \n"
-		"tetrahedral elements of the compartment.\n"
+	 { (char *)"API_getPatchSpecHandle", _wrap_API_getPatchSpecHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the species with identifier string spec in patch with \n"
+		"identifier string patch into a handle for getCount, setReacK and the \n"
+		"other handle-based methods, which skip the name lookups. Handles stay \n"
+		"valid for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacC(comp, reac)\n"
+		"    getPatchSpecHandle(patch, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string reac\n"
+		"    * string patch\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacH", _wrap_API_getCompReacH, METH_VARARGS, (char *)"\n"
-		"Returns h_mu, the distinct number of ways in which reaction with identifier string \n"
-		"reac can occur in compartment with identifier string comp, by computing the product \n"
-		"of its reactants. Note: in a mesh-based simulation (i.e. Tetexact), returns the sum \n"
-		"of the h_mu's over all tetrahedral elements in the compartment. \n"
+	 { (char *)"API_getTetSpecHandle", _wrap_API_getTetSpecHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the species with identifier string spec in tetrahedral element \n"
+		"with index idx into a handle for getCount, setReacK and the other \n"
+		"handle-based methods, which skip the name lookups. Handles stay valid \n"
+		"for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacH(comp, reac)\n"
+		"    getTetSpecHandle(idx, spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string reac\n"
+		"    * uint idx\n"
+		"    * string spec\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacA", _wrap_API_getCompReacA, METH_VARARGS, (char *)"\n"
-		"Returns the propensity of reaction with identifier string reac in compartment \n"
-		"with identifier string comp. \n"
+	 { (char *)"API_getTriSpecHandle", _wrap_API_getTriSpecHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the species with identifier string spec in triangular element \n"
+		"with index idx into a handle for getCount, setReacK and the other \n"
+		"handle-based methods, which skip the name lookups. Handles stay valid \n"
+		"for the lifetime of the solver.\n"
 		"\n"
-		"The propensity of a reaction is a function of state and is defined as the \n"
-		"function whose product with infinitesimal time dt gives the probability \n"
-		"that the reaction will occur in the next dt. It is the 'stochastic reaction \n"
-		"constant' multiplied by 'h_mu'. \n"
+		"Syntax::\n"
+		"    \n"
+		"    getTriSpecHandle(idx, spec)\n"
+		"    \n"
+		"Arguments:\n"
+		"    * uint idx\n"
+		"    * string spec\n"
 		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), the propensity of a reaction \n"
-		"in a compartment is computed as the sum of the propensities in all tetrahedral \n"
-		"elements of the compartment. \n"
+		"Return:\n"
+		"    uint\n"
+		"\n"
+		""},
+	 { (char *)"API_getCompReacHandle", _wrap_API_getCompReacHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the reaction with identifier string reac in compartment with \n"
+		"identifier string comp into a handle for getCount, setReacK and the \n"
+		"other handle-based methods, which skip the name lookups. Handles stay \n"
+		"valid for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacA(comp, reac)\n"
+		"    getCompReacHandle(comp, reac)\n"
 		"    \n"
 		"Arguments:\n"
 		"    * string comp\n"
 		"    * string reac\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getCompReacExtent", _wrap_API_getCompReacExtent, METH_VARARGS, (char *)"\n"
-		"Return the extent of reaction with identifier string reac in compartment with \n"
-		"identifier string comp, that is the number of times the reaction has occurred up \n"
-		"to the current simulation time. \n"
+	 { (char *)"API_getPatchSReacHandle", _wrap_API_getPatchSReacHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the surface reaction with identifier string sreac in patch with \n"
+		"identifier string patch into a handle for getCount, setReacK and the \n"
+		"other handle-based methods, which skip the name lookups. Handles stay \n"
+		"valid for the lifetime of the solver.\n"
 		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), returns the sum of the reaction \n"
-		"extents in all tetrahedral elements of the compartment.\n"
+		"Syntax::\n"
+		"    \n"
+		"    getPatchSReacHandle(patch, sreac)\n"
+		"    \n"
+		"Arguments:\n"
+		"    * string patch\n"
+		"    * string sreac\n"
+		"\n"
+		"Return:\n"
+		"    uint\n"
+		"\n"
+		""},
+	 { (char *)"API_getTetReacHandle", _wrap_API_getTetReacHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the reaction with identifier string reac in tetrahedral element \n"
+		"with index idx into a handle for getCount, setReacK and the other \n"
+		"handle-based methods, which skip the name lookups. Handles stay valid \n"
+		"for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getCompReacExtent(comp, reac)\n"
+		"    getTetReacHandle(idx, reac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
+		"    * uint idx\n"
 		"    * string reac\n"
 		"\n"
 		"Return:\n"
 		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_resetCompReacExtent", _wrap_API_resetCompReacExtent, METH_VARARGS, (char *)"\n"
-		"Resets the extent of reaction with identifier string reac in compartment with \n"
-		"identifier string comp to zero. \n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), \n"
-		"resets the extents of the reaction in all tetrahedral elements of the compartment.\n"
+	 { (char *)"API_getTriSReacHandle", _wrap_API_getTriSReacHandle, METH_VARARGS, (char *)"\n"
+		"Resolves the surface reaction with identifier string sreac in triangular \n"
+		"element with index idx into a handle for getCount, setReacK and the \n"
+		"other handle-based methods, which skip the name lookups. Handles stay \n"
+		"valid for the lifetime of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    resetCompReacExtent(comp, reac)\n"
+		"    getTriSReacHandle(idx, sreac)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string comp\n"
-		"    * string reac\n"
+		"    * uint idx\n"
+		"    * string sreac\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetVol", _wrap_API_getTetVol, METH_VARARGS, (char *)"\n"
-		"Returns the volume (in m^3) of the tetrahedral element with index idx.\n"
+	 { (char *)"API_getCount", _wrap_API_getCount, METH_VARARGS, (char *)"\n"
+		"Returns the number of molecules referred to by species handle h.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetVol(idx)\n"
+		"    getCount(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetSpecDefined", _wrap_API_getTetSpecDefined, METH_VARARGS, (char *)"\n"
-		"Returns whether species with identifier string spec is defined\n"
-		"in the tetrahedral element with index idx.\n"
+	 { (char *)"API_setCount", _wrap_API_setCount, METH_VARARGS, (char *)"\n"
+		"Sets the number of molecules referred to by species handle h to n.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetSpecDefined(idx, spec)\n"
+		"    setCount(h, n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    * uint h\n"
+		"    * float n\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetCount", _wrap_API_getTetCount, METH_VARARGS, (char *)"\n"
-		"Returns the number of molecules of species with identifier string spec \n"
-		"in the tetrahedral element with index idx.\n"
+	 { (char *)"API_getConc", _wrap_API_getConc, METH_VARARGS, (char *)"\n"
+		"Returns the concentration (in molar units) referred to by species \n"
+		"handle h of a compartment or tetrahedral element.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetCount(idx, spec)\n"
+		"    getConc(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
-		"    uint\n"
+		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetCount", _wrap_API_setTetCount, METH_VARARGS, (char *)"\n"
-		"Sets the number of molecules of species with identifier string spec in \n"
-		"tetrahedral element with index idx to n.\n"
+	 { (char *)"API_setConc", _wrap_API_setConc, METH_VARARGS, (char *)"\n"
+		"Sets the concentration (in molar units) referred to by species handle \n"
+		"h of a compartment or tetrahedral element to c.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetCount(idx, spec, n)\n"
+		"    setConc(h, c)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * uint n\n"
+		"    * uint h\n"
+		"    * float c\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetAmount", _wrap_API_getTetAmount, METH_VARARGS, (char *)"\n"
-		"Returns the amount (in mols) of species with identifier string spec in \n"
-		"tetrahedral element with index idx.\n"
+	 { (char *)"API_getClamped", _wrap_API_getClamped, METH_VARARGS, (char *)"\n"
+		"Returns whether the species referred to by handle h is clamped.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetAmount(idx, spec)\n"
+		"    getClamped(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetAmount", _wrap_API_setTetAmount, METH_VARARGS, (char *)"\n"
-		"Sets the amount (in mols) of species with identifier string spec in tetrahedral \n"
-		"element with index idx to a. This continuous value must be converted internally \n"
-		"to a discrete number of molecules by multiplication with Avogadro's \n"
-		"number. \n"
-		"\n"
-		"Due to the small volumes of tetrahedral elements the difference \n"
-		"between 'rounding up' and 'rounding down' can be a significant difference in \n"
-		"concentration.\n"
+	 { (char *)"API_setClamped", _wrap_API_setClamped, METH_VARARGS, (char *)"\n"
+		"Turns clamping of the species referred to by handle h on or off.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetAmount(idx, spec, a)\n"
+		"    setClamped(h, b)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * float a\n"
+		"    * uint h\n"
+		"    * bool b\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetConc", _wrap_API_getTetConc, METH_VARARGS, (char *)"\n"
-		"Returns the concentration (in Molar units) of species with identifier \n"
-		"string spec in a tetrahedral element with index idx.\n"
+	 { (char *)"API_getReacK", _wrap_API_getReacK, METH_VARARGS, (char *)"\n"
+		"Returns the macroscopic rate constant referred to by reaction handle h.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetConc(idx, spec)\n"
+		"    getReacK(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetConc", _wrap_API_setTetConc, METH_VARARGS, (char *)"\n"
-		"Sets the concentration (in Molar units) of species with identifier string spec \n"
-		"in a tetrahedral element with index idx to conc.This continuous value must be \n"
-		"converted internally to a discrete number of molecules. \n"
-		"\n"
-		"Due to the small volumes of tetrahedral elements the difference between 'rounding \n"
-		"up' and 'rounding down' can be a large difference in concentration.\n"
+	 { (char *)"API_setReacK", _wrap_API_setReacK, METH_VARARGS, (char *)"\n"
+		"Sets the macroscopic rate constant referred to by reaction handle h to \n"
+		"kf.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetConc(idx, spec, conc)\n"
+		"    setReacK(h, kf)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * conc\n"
+		"    * uint h\n"
+		"    * float kf\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetClamped", _wrap_API_getTetClamped, METH_VARARGS, (char *)"\n"
-		"Returns True if concentration of species with identifier string spec in tetrahedral \n"
-		"element with index idx is clamped (buffered), which means the concentration stays the \n"
-		"same regardless of reactions that consume or produce molecules of this species or \n"
-		"diffusion of this species into or out of the tetrahedral element. Returns False if \n"
-		"not.\n"
+	 { (char *)"API_getReacActive", _wrap_API_getReacActive, METH_VARARGS, (char *)"\n"
+		"Returns whether the reaction referred to by handle h is active.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetClamped(idx, spec)\n"
+		"    getReacActive(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
 		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetClamped", _wrap_API_setTetClamped, METH_VARARGS, (char *)"\n"
-		"Sets whether the concentration of species spec in tetrahedral element with \n"
-		"index idx is clamped (clamped = True) or not (clamped = False). \n"
-		"If a species is clamped the concentration stays the same regardless \n"
-		"of reactions that consume or produce molecules of the species or \n"
-		"diffusion of the species into or out of the tetrahedral element.\n"
+	 { (char *)"API_setReacActive", _wrap_API_setReacActive, METH_VARARGS, (char *)"\n"
+		"Activates or deactivates the reaction referred to by handle h.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetClamped(idx, spec, clamped)\n"
+		"    setReacActive(h, a)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * bool clamped\n"
+		"    * uint h\n"
+		"    * bool a\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetReacK", _wrap_API_getTetReacK, METH_VARARGS, (char *)"\n"
-		"Returns the macroscopic reaction constant of reaction with identifier string reac \n"
-		"in tetrahedral element with index idx. The unit of the reaction constant depends \n"
-		"on the order of the reaction.\n"
+	 { (char *)"API_getReacExtent", _wrap_API_getReacExtent, METH_VARARGS, (char *)"\n"
+		"Returns the extent of the compartment reaction or patch surface \n"
+		"reaction referred to by handle h.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetReacK(idx, reac)\n"
+		"    getReacExtent(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetReacK", _wrap_API_setTetReacK, METH_VARARGS, (char *)"\n"
-		"Sets the macroscopic reaction constant of reaction with identifier string reac \n"
-		"in tetrahedral element with index idx to kf. The units of the reaction constant \n"
-		"depends on the order of the reaction.\n"
+	 { (char *)"API_resetReacExtent", _wrap_API_resetReacExtent, METH_VARARGS, (char *)"\n"
+		"Resets the extent of the compartment reaction or patch surface reaction \n"
+		"referred to by handle h.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetReacK(idx, reac, kf)\n"
+		"    resetReacExtent(h)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
-		"    * float kf\n"
+		"    * uint h\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetReacActive", _wrap_API_getTetReacActive, METH_VARARGS, (char *)"\n"
-		"Returns whether reaction with identifier string reac in tetrahedral element \n"
-		"with index idx is active (True) or not (False). If it's not active this means \n"
-		"that the reaction will never occur regardless of whether reactants are present \n"
-		"in sufficient numbers or not.\n"
+	 { (char *)"API_swigregister", API_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Wmrk4", _wrap_new_Wmrk4, METH_VARARGS, (char *)"new_Wmrk4(Model m, Geom g, RNG r) -> Wmrk4"},
+	 { (char *)"delete_Wmrk4", _wrap_delete_Wmrk4, METH_VARARGS, (char *)"delete_Wmrk4(Wmrk4 self)"},
+	 { (char *)"Wmrk4_getSolverName", _wrap_Wmrk4_getSolverName, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver's name.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetReacActive(idx, reac)\n"
+		"    getSolverName()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetReacActive", _wrap_API_setTetReacActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) a reaction with identifier \n"
-		"string reac in tetrahedral element with index idx. If it's not active this means \n"
-		"that the reaction will never occur regardless of whether reactants are present \n"
-		"in sufficient numbers or not.\n"
+	 { (char *)"Wmrk4_getSolverDesc", _wrap_Wmrk4_getSolverDesc, METH_VARARGS, (char *)"\n"
+		"Returns a string giving a short description of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetReacActive(idx, reac, active)\n"
+		"    getSolverDesc()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
-		"    * bool active\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetDiffD", _wrap_API_getTetDiffD, METH_VARARGS, (char *)"\n"
-		"Returns the diffusion constant of diffusion rule with identifier string diff \n"
-		"in tetrahedral element with index idx. This constant is in units m^2/s. \n"
+	 { (char *)"Wmrk4_getSolverAuthors", _wrap_Wmrk4_getSolverAuthors, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver authors names.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetDiffD(idx, diff)\n"
+		"    getSolverAuthors()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string diff\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetDiffD", _wrap_API_setTetDiffD, METH_VARARGS, (char *)"\n"
-		"Sets the diffusion constant of diffusion rule with identifier string diff in \n"
-		"tetrahedral element with index idx to dcst (in m^2/s).\n"
+	 { (char *)"Wmrk4_getSolverEmail", _wrap_Wmrk4_getSolverEmail, METH_VARARGS, (char *)"\n"
+		"Returns a string giving the author's email address.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetDiffD(idx, diff, dcst)\n"
+		"    getSolverEmail()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string diff\n"
-		"    * dcst\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetDiffActive", _wrap_API_getTetDiffActive, METH_VARARGS, (char *)"\n"
-		"Returns whether diffusion with identifier string diff in tetrahedral element \n"
-		"with index idx is active (True) or not (False). If diffusion of a species \n"
-		"is inactive this means the molecules will never diffuse out of the tetrahedron \n"
-		"and has the same effect as a diffusion constant of zero.\n"
+	 { (char *)"Wmrk4_reset", _wrap_Wmrk4_reset, METH_VARARGS, (char *)"\n"
+		"Reset the simulation to the state the solver was initialised to. \n"
+		"Typically, this resets all concentrations of all chemical species in \n"
+		"all elements (whether compartments and patches in a well-mixed solver \n"
+		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
+		"resets the simulation time to zero and resets reaction (and diffusion) \n"
+		"rates to the default values described in the steps.model objects. \n"
+		"All reaction (and diffusion) rules are reset to active and all \n"
+		"compartment volumes and patch areas are reset to default values \n"
+		"described in steps.geom objects (for well-mixed solvers). \n"
+		"Usually, this method should be called before starting each simulation iteration.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetDiffActive(idx, diff)\n"
+		"    reset()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string diff\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setTetDiffActive", _wrap_API_setTetDiffActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) diffusion rule with \n"
-		"identifier string diff in tetrahedral element with index idx. If diffusion of \n"
-		"a species is inactive this means the molecules will never diffuse out of the \n"
-		"tetrahedron and has the same effect as a diffusion constant of zero. \n"
+	 { (char *)"Wmrk4_run", _wrap_Wmrk4_run, METH_VARARGS, (char *)"\n"
+		"Advance the simulation until endtime (given in seconds) is reached. \n"
+		"The endtime must be larger or equal to the current simulation time.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTetDiffActive(idx, diff, active)\n"
+		"    run(endtime)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string diff\n"
-		"    * bool active\n"
+		"    float endtime\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetReacC", _wrap_API_getTetReacC, METH_VARARGS, (char *)"\n"
-		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
-		"of reaction with identifier string reac in tetrahedral element with index idx.\n"
+	 { (char *)"Wmrk4_getTime", _wrap_Wmrk4_getTime, METH_VARARGS, (char *)"\n"
+		"Returns the current simulation time in seconds.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetReacC(idx, reac)\n"
+		"    getTime()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetReacH", _wrap_API_getTetReacH, METH_VARARGS, (char *)"\n"
-		"Returns h_mu, the distinct number of ways in which reaction with identifier string \n"
-		"reac can occur in tetrahedral element with index idx, by computing the product of \n"
-		"its reactants.\n"
+	 { (char *)"Wmrk4_swigregister", Wmrk4_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Wmdirect", _wrap_new_Wmdirect, METH_VARARGS, (char *)"new_Wmdirect(Model m, Geom g, RNG r) -> Wmdirect"},
+	 { (char *)"delete_Wmdirect", _wrap_delete_Wmdirect, METH_VARARGS, (char *)"delete_Wmdirect(Wmdirect self)"},
+	 { (char *)"Wmdirect_getSolverName", _wrap_Wmdirect_getSolverName, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver's name.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetReacH(idx, reac)\n"
+		"    getSolverName()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetReacA", _wrap_API_getTetReacA, METH_VARARGS, (char *)"\n"
-		"Returns the propensity of reaction with identifier string reac in tetrahedral \n"
-		"element with index idx.\n"
+	 { (char *)"Wmdirect_getSolverDesc", _wrap_Wmdirect_getSolverDesc, METH_VARARGS, (char *)"\n"
+		"Returns a string giving a short description of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetReacA(idx, reac)\n"
+		"    getSolverDesc()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getTetDiffA", _wrap_API_getTetDiffA, METH_VARARGS, (char *)"\n"
-		"Returns the propensityof diffusion rule with identifier string diff in \n"
-		"tetrahedral element with index idx. \n"
+	 { (char *)"Wmdirect_getSolverAuthors", _wrap_Wmdirect_getSolverAuthors, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver authors names.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTetDiffA(idx, reac)\n"
+		"    getSolverAuthors()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchArea", _wrap_API_getPatchArea, METH_VARARGS, (char *)"\n"
-		"Returns the area of patch with identifier string pat (in m^2).\n"
+	 { (char *)"Wmdirect_getSolverEmail", _wrap_Wmdirect_getSolverEmail, METH_VARARGS, (char *)"\n"
+		"Returns a string giving the author's email address.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchArea(pat)\n"
+		"    getSolverEmail()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_setPatchArea", _wrap_API_setPatchArea, METH_VARARGS, (char *)"\n"
-		"Sets the area of patch with identifier string pat to area a (in m^2).\n"
+	 { (char *)"Wmdirect_reset", _wrap_Wmdirect_reset, METH_VARARGS, (char *)"\n"
+		"Reset the simulation to the state the solver was initialised to. \n"
+		"Typically, this resets all concentrations of all chemical species in \n"
+		"all elements (whether compartments and patches in a well-mixed solver \n"
+		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
+		"resets the simulation time to zero and resets reaction (and diffusion) \n"
+		"rates to the default values described in the steps.model objects. \n"
+		"All reaction (and diffusion) rules are reset to active and all \n"
+		"compartment volumes and patch areas are reset to default values \n"
+		"described in steps.geom objects (for well-mixed solvers). \n"
+		"Usually, this method should be called before starting each simulation iteration.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchArea(pat, area)\n"
+		"    reset()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * float area\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchCount", _wrap_API_getPatchCount, METH_VARARGS, (char *)"\n"
-		"Returns the number of molecules of species with identifier string spec in patch \n"
-		"with identifier string pat.Note: in a mesh-based simulation (i.e. Tetexact) this \n"
-		"is the combined count from all triangular elements in the patch. \n"
+	 { (char *)"Wmdirect_run", _wrap_Wmdirect_run, METH_VARARGS, (char *)"\n"
+		"Advance the simulation until endtime (given in seconds) is reached. \n"
+		"The endtime must be larger or equal to the current simulation time.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchCount(pat, spec)\n"
+		"    run(endtime)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
+		"    float endtime\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setPatchCount", _wrap_API_setPatchCount, METH_VARARGS, (char *)"\n"
-		"Sets the number of molecules of species with identifier string spec in patch \n"
-		"with identifier string pat to n. Note: in a mesh-based simulation (i.e. Tetexact) \n"
-		"the molecules are divided as equally as possible over all triangular elements in \n"
-		"the patch (i.e. a uniform distribution). \n"
+	 { (char *)"Wmdirect_getTime", _wrap_Wmdirect_getTime, METH_VARARGS, (char *)"\n"
+		"Returns the current simulation time in seconds.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchCount(pat, spec, n)\n"
+		"    getTime()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
-		"    * uint n\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchAmount", _wrap_API_getPatchAmount, METH_VARARGS, (char *)"\n"
-		"Returns the amount (in mols) of species with identifier string spec in patch \n"
-		"with identifier string pat.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) this is the combined amount \n"
-		"from all triangular elements in the patch. \n"
+	 { (char *)"Wmdirect_swigregister", Wmdirect_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Tetexact", _wrap_new_Tetexact, METH_VARARGS, (char *)"\n"
+		"Construct a Tetexact solver. If reorder is True, the tetrahedrons and\n"
+		"triangles are laid out in memory along a space-filling curve through\n"
+		"their barycenters, which can speed up meshes whose element numbering\n"
+		"has poor locality. Tetrahedron and triangle indices are not affected.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchAmount(pat, spec)\n"
+		"    Tetexact(model, geom, rng, reorder = False)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
+		"    * steps.model.Model model\n"
+		"    * steps.geom.Tetmesh geom\n"
+		"    * steps.rng.RNG rng\n"
+		"    * bool reorder\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
-		""},
-	 { (char *)"API_setPatchAmount", _wrap_API_setPatchAmount, METH_VARARGS, (char *)"\n"
-		"Sets the amount (in mols) of species with identifier string spec in patch with \n"
-		"identifier string pat to a. In a discrete solver, such as Wmdirect and Tetexact, \n"
-		"this continuous value is converted internally into a discrete number of molecules \n"
-		"by multiplication with Avogadro's number. \n"
 		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as \n"
-		"equally as possible over all triangular elements in the patch (i.e. a uniform \n"
-		"distribution).\n"
+		"Construct a Tetexact solver. If reorder is True, the tetrahedrons and\n"
+		"triangles are laid out in memory along a space-filling curve through\n"
+		"their barycenters, which can speed up meshes whose element numbering\n"
+		"has poor locality. Tetrahedron and triangle indices are not affected.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchAmount(pat, spec, a)\n"
+		"    Tetexact(model, geom, rng, reorder = False)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
-		"    * float a\n"
+		"    * steps.model.Model model\n"
+		"    * steps.geom.Tetmesh geom\n"
+		"    * steps.rng.RNG rng\n"
+		"    * bool reorder\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchClamped", _wrap_API_getPatchClamped, METH_VARARGS, (char *)"\n"
-		"Sets the amount (in mols) of species with identifier string spec in patch with \n"
-		"identifier string pat to a. In a discrete solver, such as Wmdirect and Tetexact, \n"
-		"this continuous value is converted internally into a discrete number of molecules \n"
-		"by multiplication with Avogadro's number. \n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact) the molecules are divided as equally \n"
-		"as possible over all triangular elements in the patch (i.e. a uniform distribution).\n"
+	 { (char *)"delete_Tetexact", _wrap_delete_Tetexact, METH_VARARGS, (char *)"delete_Tetexact(Tetexact self)"},
+	 { (char *)"Tetexact_getSolverName", _wrap_Tetexact_getSolverName, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver's name.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchClamped(pat, spec)\n"
+		"    getSolverName()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_setPatchClamped", _wrap_API_setPatchClamped, METH_VARARGS, (char *)"\n"
-		"Sets whether the species with identifier string spec in patch with identifier \n"
-		"string pat is clamped (clamped = True) or not (clamped = False). If a species \n"
-		"is clamped the number of molecules stays the same regardless of surface reactions \n"
-		"that consume or produce molecules of the species.\n"
-		"\n"
-		"Note: in a mesh-based simulation this will set the species to be clamped in all \n"
-		"triangular elements of the patch.\n"
+	 { (char *)"Tetexact_getSolverDesc", _wrap_Tetexact_getSolverDesc, METH_VARARGS, (char *)"\n"
+		"Returns a string giving a short description of the solver.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchClamped(pat, spec, clamped)\n"
+		"    getSolverDesc()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string spec\n"
-		"    * bool clamped\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacK", _wrap_API_getPatchSReacK, METH_VARARGS, (char *)"\n"
-		"Returns the macroscopic reaction constant of surface reaction with identifier \n"
-		"string sreac in patch with identifier string pat. The unit of the reaction constant \n"
-		"depends on the order of the reaction.\n"
-		"\n"
-		"Note: In a mesh-based solver (i.e. Tetexact) the value for the patch is returned, \n"
-		"although individual triangle elements may have different values \n"
-		"(set with setTriSReacK).\n"
+	 { (char *)"Tetexact_getSolverAuthors", _wrap_Tetexact_getSolverAuthors, METH_VARARGS, (char *)"\n"
+		"Returns a string of the solver authors names.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacK(pat, reac)\n"
+		"    getSolverAuthors()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_setPatchSReacK", _wrap_API_setPatchSReacK, METH_VARARGS, (char *)"\n"
-		"Sets the macroscopic reaction constant of surface reaction with identifier \n"
-		"string sreac in patch with identifier string pat to kf. The unit of the reaction \n"
-		"constant depends on the order of the reaction. \n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this method sets the surface \n"
-		"reaction constant in all triangular elements of the patch to kf.\n"
-		"\n"
-		"Note: The default value still comes from the steps.model description, so calling \n"
-		"reset() will return the surface reaction constant to that value.\n"
+	 { (char *)"Tetexact_getSolverEmail", _wrap_Tetexact_getSolverEmail, METH_VARARGS, (char *)"\n"
+		"Returns a string giving the author's email address.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchSReacK(pat, reac, kf)\n"
+		"    getSolverEmail()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
-		"    * float kf\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    string\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacActive", _wrap_API_getPatchSReacActive, METH_VARARGS, (char *)"\n"
-		"Returns whether a surface reaction with identifier string sreac in patch with \n"
-		"identifier string pat is active (True) or not (False). If it's not active this means \n"
-		"that a surface reaction will never occur regardless of whether the reactants are \n"
-		"present in sufficient numbers or not. \n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this method will return True only \n"
-		"if the surface reaction is active in all triangular elements in the patch.\n"
+	 { (char *)"Tetexact_reset", _wrap_Tetexact_reset, METH_VARARGS, (char *)"\n"
+		"Reset the simulation to the state the solver was initialised to. \n"
+		"Typically, this resets all concentrations of all chemical species in \n"
+		"all elements (whether compartments and patches in a well-mixed solver \n"
+		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
+		"resets the simulation time to zero and resets reaction (and diffusion) \n"
+		"rates to the default values described in the steps.model objects. \n"
+		"All reaction (and diffusion) rules are reset to active and all \n"
+		"compartment volumes and patch areas are reset to default values \n"
+		"described in steps.geom objects (for well-mixed solvers). \n"
+		"Usually, this method should be called before starting each simulation iteration.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacActive(pat, reac)\n"
+		"    reset()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setPatchSReacActive", _wrap_API_setPatchSReacActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) a surface reaction with \n"
-		"identifier string sreac in patch with identifier string pat. If a surface reaction \n"
-		"is not active this means that a reaction will never occur regardless of whether the \n"
-		"reactants are present in sufficient numbers or not.\n"
-		"\n"
-		"Note: In a mesh-based simulation (i.e. Tetexact) this will activate/ deactivate the \n"
-		"reaction in all triangular elements in the patch.\n"
+	 { (char *)"Tetexact_run", _wrap_Tetexact_run, METH_VARARGS, (char *)"\n"
+		"Advance the simulation until endtime (given in seconds) is reached. \n"
+		"The endtime must be larger or equal to the current simulation time.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setPatchSReacActive(pat, reac, active)\n"
+		"    run(endtime)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
-		"    * bool active\n"
+		"    float endtime\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacC", _wrap_API_getPatchSReacC, METH_VARARGS, (char *)"\n"
-		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
-		"of surface reaction with identifier string sreac in patch with identifier string pat.\n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), the stochastic reaction constant is \n"
-		"computed as the weighted mean of the stochastic reaction constants in all triangular \n"
-		"elements of the patch.\n"
+	 { (char *)"Tetexact_getTime", _wrap_Tetexact_getTime, METH_VARARGS, (char *)"\n"
+		"Returns the current simulation time in seconds.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacC(pat, reac)\n"
+		"    getTime()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacH", _wrap_API_getPatchSReacH, METH_VARARGS, (char *)"\n"
-		"Returns h_mu, the distinct number of ways in which surface reaction with identifier \n"
-		"string sreac can occur in patch with identifier string pat, by computing the product \n"
-		"of its reactants. Note: in a mesh-based simulation (i.e. Tetexact), returns the sum \n"
-		"of the h_mu's over all triangular elements in the patch. \n"
+	 { (char *)"Tetexact_advanceSteps", _wrap_Tetexact_advanceSteps, METH_VARARGS, (char *)"\n"
+		"Returns the current simulation time in seconds.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacH(pat, reac)\n"
+		"    getTime()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacA", _wrap_API_getPatchSReacA, METH_VARARGS, (char *)"\n"
-		"Returns the propensity of surface reaction with identifier string sreac in patch \n"
-		"with identifier string pat. Note: in a mesh-based simulation (i.e. Tetexact), \n"
-		"the propensity of a surface reaction in a patch is computed as the sum of the \n"
-		"propensities in all triangular elements of the patch.\n"
+	 { (char *)"Tetexact_getA0Renorms", _wrap_Tetexact_getA0Renorms, METH_VARARGS, (char *)"\n"
+		"Returns the number of times the running total propensity (A0) of the \n"
+		"solver has been recomputed exactly to remove accumulated rounding error.\n"
+		"The counter is set to zero by reset().\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacA(pat, reac)\n"
+		"    getA0Renorms()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    int\n"
 		"\n"
 		""},
-	 { (char *)"API_getPatchSReacExtent", _wrap_API_getPatchSReacExtent, METH_VARARGS, (char *)"\n"
-		"Returns the extent of surface reaction with identifier string sreac in patch \n"
-		"with identifier string pat, that is the number of times the surface reaction \n"
-		"has occurred up to the current simulation time. \n"
-		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), returns the sum of the reaction \n"
-		"extents in all triangular elements of the patch.\n"
+	 { (char *)"Tetexact_getUpdAllocs", _wrap_Tetexact_getUpdAllocs, METH_VARARGS, (char *)"\n"
+		"Returns the number of times the solver's update path has allocated \n"
+		"memory, by growing its event group storage or its scratch update list.\n"
+		"Once the event groups have settled, setters and steps leave the counter \n"
+		"unchanged, so it can be used to check that a protocol runs without \n"
+		"allocation.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getPatchSReacExtent(pat,reac)\n"
+		"    getUpdAllocs()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    uint\n"
-		"\n"
-		""},
-	 { (char *)"API_resetPatchSReacExtent", _wrap_API_resetPatchSReacExtent, METH_VARARGS, (char *)"\n"
-		"Resets the extent of reaction with identifier string sreac in patch with identifier \n"
-		"string pat to zero. \n"
+		"    int\n"
 		"\n"
-		"Note: in a mesh-based simulation (i.e. Tetexact), resets the extents of the reaction \n"
-		"in all triangular elements of the patch.\n"
+		""},
+	 { (char *)"Tetexact_setEngine", _wrap_Tetexact_setEngine, METH_VARARGS, (char *)"\n"
+		"Selects the simulation engine. 'cr' (the default) samples each event \n"
+		"from all reaction and diffusion events in the mesh with the \n"
+		"composition-rejection method. 'nsm' uses the next-subvolume method: \n"
+		"every tetrahedron and triangle keeps the sum of its own propensities \n"
+		"and a queue orders them by the time of their next event. Both engines \n"
+		"are exact and the simulation state carries over when switching; which \n"
+		"one is faster depends on the model and the mesh.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    resetPatchSReacExtent(pat, reac)\n"
+		"    setEngine(engine)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string pat\n"
-		"    * string reac\n"
+		"    string engine\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_setDiffBoundaryDiffusionActive", _wrap_API_setDiffBoundaryDiffusionActive, METH_VARARGS, (char *)"\n"
-		"Activates or inactivates diffusion across a diffusion boundary for a species.\n"
+	 { (char *)"Tetexact_getEngine", _wrap_Tetexact_getEngine, METH_VARARGS, (char *)"\n"
+		"Returns the simulation engine selected with setEngine, 'cr' or 'nsm', \n"
+		"or 'parallel' after setParallel.\n"
 		"\n"
 		"Syntax::\n"
-		"        \n"
-		"    setDiffBoundaryDiffusionActive(diffb, spec, act)\n"
+		"    \n"
+		"    getEngine()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * string diffb\n"
-		"    * string spec\n"
-		"    * bool act\n"
-		"             \n"
-		"Return:\n"
 		"    None\n"
 		"\n"
+		"Return:\n"
+		"    string\n"
+		"\n"
 		""},
-	 { (char *)"API_getDiffBoundaryDiffusionActive", _wrap_API_getDiffBoundaryDiffusionActive, METH_VARARGS, (char *)"\n"
-		"Returns whether diffusion is active across a diffusion boundary for a species.\n"
+	 { (char *)"Tetexact_setParallel", _wrap_Tetexact_setParallel, METH_VARARGS, (char *)"\n"
+		"Selects the parallel engine. The tetrahedrons are split into nthreads \n"
+		"spatially contiguous domains, each with its own next-subvolume event \n"
+		"queue, random number stream and thread. Tetrahedrons coupled by a patch \n"
+		"triangle stay in one domain. Diffusion across a domain boundary is held \n"
+		"back and delivered every dt, so dt should be small compared with the \n"
+		"mean time a molecule stays in a tetrahedron. The result depends on the \n"
+		"seed, nthreads and dt, but not on the scheduling of the threads. \n"
+		"setEngine switches back to a serial engine.\n"
 		"\n"
 		"Syntax::\n"
-		"\n"
-		"    getDiffBoundaryDiffusionActive(diffb, spec)\n"
-		"\n"
+		"    \n"
+		"    setParallel(nthreads, dt)\n"
+		"    \n"
 		"Arguments:\n"
-		"    * string diffb\n"
-		"    * string spec\n"
+		"    uint nthreads\n"
+		"    float dt\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
-		"\n"
-		""},
-	 { (char *)"API_getTriArea", _wrap_API_getTriArea, METH_VARARGS, (char *)"\n"
-		"Returns the area (in m^2) of the triangular element with index idx.\n"
-		"         \n"
-		"ax::\n"
-		"         \n"
-		"getTriArea(idx)\n"
-		"         \n"
-		"ments:\n"
-		"* uint idx\n"
-		"         \n"
-		"rn:\n"
-		"float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSpecDefined", _wrap_API_getTriSpecDefined, METH_VARARGS, (char *)"\n"
-		"Returns whether species with identifier string spec is defined\n"
-		"in the triangle element with index idx.\n"
+	 { (char *)"Tetexact_getParallelThreads", _wrap_Tetexact_getParallelThreads, METH_VARARGS, (char *)"\n"
+		"Returns the number of threads of the parallel engine, or 0 if it is not \n"
+		"selected.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSpecDefined(idx, spec)\n"
+		"    getParallelThreads()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriCount", _wrap_API_getTriCount, METH_VARARGS, (char *)"\n"
-		"Returns the number of molecules of species with identifier string spec \n"
-		"in the triangular element with index idx.\n"
+	 { (char *)"Tetexact_getParallelSyncDT", _wrap_Tetexact_getParallelSyncDT, METH_VARARGS, (char *)"\n"
+		"Returns the synchronisation time step of the parallel engine.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriCount(idx, spec)\n"
+		"    getParallelSyncDT()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setTriCount", _wrap_API_setTriCount, METH_VARARGS, (char *)"\n"
-		"Sets the number of molecules of species with identifier string spec in \n"
-		"triangular element with index idx to n. \n"
+	 { (char *)"Tetexact_setDiffLeapDT", _wrap_Tetexact_setDiffLeapDT, METH_VARARGS, (char *)"\n"
+		"Sets the time step of leaped diffusion. Every dt the diffusion of the \n"
+		"selected species is advanced by binomial draws over the four faces of \n"
+		"each tetrahedron, instead of one molecule at a time; reactions and all \n"
+		"other diffusion stay exact. Species are selected with setSpecDiffLeap \n"
+		"or setDiffLeapThreshold. dt should be small compared with the mean \n"
+		"time a molecule stays in a tetrahedron. dt = 0 (the default) switches \n"
+		"leaping off.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTriCount(idx, spec, n)\n"
+		"    setDiffLeapDT(dt)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * uint n\n"
+		"    float dt\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriAmount", _wrap_API_getTriAmount, METH_VARARGS, (char *)"\n"
-		"Returns the amount (in mols) of species with identifier string spec in triangular \n"
-		"element with index idx.  \n"
+	 { (char *)"Tetexact_getDiffLeapDT", _wrap_Tetexact_getDiffLeapDT, METH_VARARGS, (char *)"\n"
+		"Returns the time step of leaped diffusion, 0 if it is off.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriAmount(idx, spec)\n"
+		"    getDiffLeapDT()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
 		"    float\n"
 		"\n"
 		""},
-	 { (char *)"API_setTriAmount", _wrap_API_setTriAmount, METH_VARARGS, (char *)"\n"
-		"Sets the amount (in mols) of species with identifier string spec in triangular \n"
-		"element with index idx to a. This continuous value must be converted internally \n"
-		"to a discrete number of molecules by multiplication with Avogadro's number. \n"
+	 { (char *)"Tetexact_setSpecDiffLeap", _wrap_Tetexact_setSpecDiffLeap, METH_VARARGS, (char *)"\n"
+		"Selects whether the diffusion of species spec is always leaped, see \n"
+		"setDiffLeapDT.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTriAmount(idx, spec, a)\n"
+		"    setSpecDiffLeap(spec, leap)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * float a\n"
+		"    string spec\n"
+		"    bool leap\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriClamped", _wrap_API_getTriClamped, METH_VARARGS, (char *)"\n"
-		"Returns True if the species with identifier string spec in triangular element \n"
-		"with index idx is clamped (buffered), which means the number of molecules stays \n"
-		"the same regardless of reactions that consume or produce molecules of this species. \n"
-		"Returns False if not.\n"
+	 { (char *)"Tetexact_getSpecDiffLeap", _wrap_Tetexact_getSpecDiffLeap, METH_VARARGS, (char *)"\n"
+		"Returns whether the diffusion of species spec is always leaped.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriClamped(idx, spec)\n"
+		"    getSpecDiffLeap(spec)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
+		"    string spec\n"
 		"\n"
 		"Return:\n"
 		"    bool\n"
 		"\n"
 		""},
-	 { (char *)"API_setTriClamped", _wrap_API_setTriClamped, METH_VARARGS, (char *)"\n"
-		"Sets whether the concentration of species spec in triangular element with index idx \n"
-		"is clamped (clamped = True) or not (clamped = False). If a species is clamped the \n"
-		"concentration stays the same regardless of reactions that consume or produce \n"
-		"molecules of the species. \n"
+	 { (char *)"Tetexact_setDiffLeapThreshold", _wrap_Tetexact_setDiffLeapThreshold, METH_VARARGS, (char *)"\n"
+		"Sets the count from which the diffusion of any species in a \n"
+		"tetrahedron is leaped, see setDiffLeapDT. 0 (the default) disables \n"
+		"the threshold.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTriClamped(idx, spec, clamped)\n"
+		"    setDiffLeapThreshold(n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string spec\n"
-		"    * bool clamped\n"
+		"    uint n\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSReacK", _wrap_API_getTriSReacK, METH_VARARGS, (char *)"\n"
-		"Returns the macroscopic reaction constant of surface reaction with identifier \n"
-		"string sreac in triangular element with index idx. The units of the reaction \n"
-		"constant depends on the order of the reaction. \n"
+	 { (char *)"Tetexact_getDiffLeapThreshold", _wrap_Tetexact_getDiffLeapThreshold, METH_VARARGS, (char *)"\n"
+		"Returns the count threshold of leaped diffusion, 0 if it is disabled.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSReacK(idx, reac)\n"
+		"    getDiffLeapThreshold()\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"API_setTriSReacK", _wrap_API_setTriSReacK, METH_VARARGS, (char *)"\n"
-		"Sets the macroscopic reaction constant of surface reaction with identifier \n"
-		"string sreac in triangular element with index idx to kf. The units of the \n"
-		"reaction constant depends on the order of the reaction.\n"
+	 { (char *)"Tetexact_getCompTetCountsTets", _wrap_Tetexact_getCompTetCountsTets, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the tetrahedrons in compartment comp, in the \n"
+		"row order of getCompTetCountsView(comp).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTriSReacK(idx, reac, kf)\n"
+		"    getCompTetCountsTets(comp)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
-		"    * float kf\n"
+		"    string comp\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    list<uint>\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSReacActive", _wrap_API_getTriSReacActive, METH_VARARGS, (char *)"\n"
-		"Returns whether surface reaction with identifier string sreac in triangular \n"
-		"element with index idx is active (True) or not (False). If it's not active \n"
-		"this means that the surface reaction will never occur regardless of whether \n"
-		"reactants are present in sufficient numbers or not. \n"
+	 { (char *)"Tetexact_getCompTetCountsSpecs", _wrap_Tetexact_getCompTetCountsSpecs, METH_VARARGS, (char *)"\n"
+		"Returns the names of the species in compartment comp, in the column \n"
+		"order of getCompTetCountsView(comp).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSReacActive(idx, reac)\n"
+		"    getCompTetCountsSpecs(comp)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    string comp\n"
 		"\n"
 		"Return:\n"
-		"    bool\n"
+		"    list<string>\n"
 		"\n"
 		""},
-	 { (char *)"API_setTriSReacActive", _wrap_API_setTriSReacActive, METH_VARARGS, (char *)"\n"
-		"Activate (active = True) or deactivate (active = False) a surface reaction \n"
-		"with identifier string sreac in triangular element with index idx. If it's \n"
-		"not active this means that the surface reaction will never occur regardless \n"
-		"of whether reactants are present in sufficient numbers or not.  \n"
+	 { (char *)"Tetexact_getPatchTriCountsTris", _wrap_Tetexact_getPatchTriCountsTris, METH_VARARGS, (char *)"\n"
+		"Returns the indices of the triangles in patch patch, in the row order \n"
+		"of getPatchTriCountsView(patch).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    setTriSReacActive(idx, reac, active)\n"
+		"    getPatchTriCountsTris(patch)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
-		"    * active\n"
+		"    string patch\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    list<uint>\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSReacC", _wrap_API_getTriSReacC, METH_VARARGS, (char *)"\n"
-		"Returns the 'stochastic reaction constant' (or 'specific probability rate constant') \n"
-		"of surface reaction with identifier string sreac in triangular element with index idx.  \n"
+	 { (char *)"Tetexact_getPatchTriCountsSpecs", _wrap_Tetexact_getPatchTriCountsSpecs, METH_VARARGS, (char *)"\n"
+		"Returns the names of the species in patch patch, in the column order \n"
+		"of getPatchTriCountsView(patch).\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSReacC(idx, reac)\n"
+		"    getPatchTriCountsSpecs(patch)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    string patch\n"
 		"\n"
 		"Return:\n"
-		"   float\n"
+		"    list<string>\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSReacH", _wrap_API_getTriSReacH, METH_VARARGS, (char *)"\n"
-		"Returns h_mu, the distinct number of ways in which surface reaction with identifier \n"
-		"string sreac can occur in triangular element with index idx, by computing the product \n"
-		"of its reactants. \n"
+	 { (char *)"Tetexact_pickCompTets", _wrap_Tetexact_pickCompTets, METH_VARARGS, (char *)"\n"
+		"Returns the indices of n tetrahedrons of compartment comp, each picked \n"
+		"independently with probability proportional to its volume.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSReacH(idx, reac)\n"
+		"    pickCompTets(comp, n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    * string comp\n"
+		"    * uint n\n"
 		"\n"
 		"Return:\n"
-		"   float\n"
+		"    list<uint>\n"
 		"\n"
 		""},
-	 { (char *)"API_getTriSReacA", _wrap_API_getTriSReacA, METH_VARARGS, (char *)"\n"
-		"Returns the propensity of surface reaction with identifier string sreac \n"
-		"in triangular element with index idx. \n"
+	 { (char *)"Tetexact_pickPatchTris", _wrap_Tetexact_pickPatchTris, METH_VARARGS, (char *)"\n"
+		"Returns the indices of n triangles of patch patch, each picked \n"
+		"independently with probability proportional to its area.\n"
 		"\n"
 		"Syntax::\n"
 		"    \n"
-		"    getTriSReacA(idx, reac)\n"
+		"    pickPatchTris(patch, n)\n"
 		"    \n"
 		"Arguments:\n"
-		"    * uint idx\n"
-		"    * string reac\n"
+		"    * string patch\n"
+		"    * uint n\n"
 		"\n"
 		"Return:\n"
-		"   float\n"
+		"    list<uint>\n"
 		"\n"
 		""},
-	 { (char *)"API_swigregister", API_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Wmrk4", _wrap_new_Wmrk4, METH_VARARGS, (char *)"new_Wmrk4(Model m, Geom g, RNG r) -> Wmrk4"},
-	 { (char *)"delete_Wmrk4", _wrap_delete_Wmrk4, METH_VARARGS, (char *)"delete_Wmrk4(Wmrk4 self)"},
-	 { (char *)"Wmrk4_getSolverName", _wrap_Wmrk4_getSolverName, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver's name.\n"
+	 { (char *)"Tetexact__getCompTetCountsView", _wrap_Tetexact__getCompTetCountsView, METH_VARARGS, (char *)"Tetexact__getCompTetCountsView(Tetexact self, PyObject owner, string c) -> PyObject"},
+	 { (char *)"Tetexact__getPatchTriCountsView", _wrap_Tetexact__getPatchTriCountsView, METH_VARARGS, (char *)"Tetexact__getPatchTriCountsView(Tetexact self, PyObject owner, string p) -> PyObject"},
+	 { (char *)"Tetexact_swigregister", Tetexact_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Batch", _wrap_new_Batch, METH_VARARGS, (char *)"\n"
+		"Construction::\n"
+		"\n"
+		"    b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)\n"
+		"\n"
+		"Create a runner for independent realisations of one model and \n"
+		"geometry, run in parallel. Each worker thread owns a solver object of \n"
+		"the given kind ('wmdirect' or 'tetexact') and a random number generator \n"
+		"of the given kind; the model and geometry are shared. Before each \n"
+		"realisation the worker's solver is reset, its generator reseeded and \n"
+		"the initial state replayed, so the results of a realisation depend only \n"
+		"on its seed.\n"
+		"\n"
+		"Arguments:\n"
+		"    * string solver\n"
+		"    * steps.model.Model model\n"
+		"    * steps.geom.Geom geom\n"
+		"    * string rng\n"
+		"    * uint rngbufsize\n"
+		"\n"
+		"\n"
+		"Construction::\n"
+		"\n"
+		"    b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)\n"
+		"\n"
+		"Create a runner for independent realisations of one model and \n"
+		"geometry, run in parallel. Each worker thread owns a solver object of \n"
+		"the given kind ('wmdirect' or 'tetexact') and a random number generator \n"
+		"of the given kind; the model and geometry are shared. Before each \n"
+		"realisation the worker's solver is reset, its generator reseeded and \n"
+		"the initial state replayed, so the results of a realisation depend only \n"
+		"on its seed.\n"
+		"\n"
+		"Arguments:\n"
+		"    * string solver\n"
+		"    * steps.model.Model model\n"
+		"    * steps.geom.Geom geom\n"
+		"    * string rng\n"
+		"    * uint rngbufsize\n"
+		"\n"
+		"\n"
+		"Construction::\n"
+		"\n"
+		"    b = steps.solver.Batch(solver, model, geom, rng = 'mt19937', rngbufsize = 512)\n"
+		"\n"
+		"Create a runner for independent realisations of one model and \n"
+		"geometry, run in parallel. Each worker thread owns a solver object of \n"
+		"the given kind ('wmdirect' or 'tetexact') and a random number generator \n"
+		"of the given kind; the model and geometry are shared. Before each \n"
+		"realisation the worker's solver is reset, its generator reseeded and \n"
+		"the initial state replayed, so the results of a realisation depend only \n"
+		"on its seed.\n"
+		"\n"
+		"Arguments:\n"
+		"    * string solver\n"
+		"    * steps.model.Model model\n"
+		"    * steps.geom.Geom geom\n"
+		"    * string rng\n"
+		"    * uint rngbufsize\n"
+		"\n"
+		""},
+	 { (char *)"delete_Batch", _wrap_delete_Batch, METH_VARARGS, (char *)"delete_Batch(Batch self)"},
+	 { (char *)"Batch_setCompCount", _wrap_Batch_setCompCount, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the number of molecules \n"
+		"of species s in compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverName()\n"
-		"    \n"
+		"\n"
+		"    setCompCount(c, s, n)\n"
+		"\n"
 		"Arguments:\n"
+		"    * string c\n"
+		"    * string s\n"
+		"    * float n\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Batch_setCompConc", _wrap_Batch_setCompConc, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the concentration (in \n"
+		"molar units) of species s in compartment c.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setCompConc(c, s, conc)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string c\n"
+		"    * string s\n"
+		"    * float conc\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_getSolverDesc", _wrap_Wmrk4_getSolverDesc, METH_VARARGS, (char *)"\n"
-		"Returns a string giving a short description of the solver.\n"
+	 { (char *)"Batch_setCompClamped", _wrap_Batch_setCompClamped, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: whether species s is \n"
+		"clamped in compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverDesc()\n"
-		"    \n"
+		"\n"
+		"    setCompClamped(c, s, b)\n"
+		"\n"
 		"Arguments:\n"
+		"    * string c\n"
+		"    * string s\n"
+		"    * bool b\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Batch_setCompReacK", _wrap_Batch_setCompReacK, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the rate constant of \n"
+		"reaction r in compartment c.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setCompReacK(c, r, kf)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string c\n"
+		"    * string r\n"
+		"    * float kf\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_getSolverAuthors", _wrap_Wmrk4_getSolverAuthors, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver authors names.\n"
+	 { (char *)"Batch_setTetCount", _wrap_Batch_setTetCount, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the number of molecules \n"
+		"of species s in tetrahedron tidx (mesh-based solvers only).\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverAuthors()\n"
-		"    \n"
+		"\n"
+		"    setTetCount(tidx, s, n)\n"
+		"\n"
 		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * string s\n"
+		"    * float n\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Batch_setPatchCount", _wrap_Batch_setPatchCount, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the number of molecules \n"
+		"of species s in patch p.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setPatchCount(p, s, n)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string p\n"
+		"    * string s\n"
+		"    * float n\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_getSolverEmail", _wrap_Wmrk4_getSolverEmail, METH_VARARGS, (char *)"\n"
-		"Returns a string giving the author's email address.\n"
+	 { (char *)"Batch_setPatchClamped", _wrap_Batch_setPatchClamped, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: whether species s is \n"
+		"clamped in patch p.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverEmail()\n"
-		"    \n"
+		"\n"
+		"    setPatchClamped(p, s, b)\n"
+		"\n"
 		"Arguments:\n"
+		"    * string p\n"
+		"    * string s\n"
+		"    * bool b\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Batch_setPatchSReacK", _wrap_Batch_setPatchSReacK, METH_VARARGS, (char *)"\n"
+		"Adds to the initial state of every realisation: the rate constant of \n"
+		"surface reaction r in patch p.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    setPatchSReacK(p, r, kf)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string p\n"
+		"    * string r\n"
+		"    * float kf\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_reset", _wrap_Wmrk4_reset, METH_VARARGS, (char *)"\n"
-		"Reset the simulation to the state the solver was initialised to. \n"
-		"Typically, this resets all concentrations of all chemical species in \n"
-		"all elements (whether compartments and patches in a well-mixed solver \n"
-		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
-		"resets the simulation time to zero and resets reaction (and diffusion) \n"
-		"rates to the default values described in the steps.model objects. \n"
-		"All reaction (and diffusion) rules are reset to active and all \n"
-		"compartment volumes and patch areas are reset to default values \n"
-		"described in steps.geom objects (for well-mixed solvers). \n"
-		"Usually, this method should be called before starting each simulation iteration.\n"
+	 { (char *)"Batch_clearInitialState", _wrap_Batch_clearInitialState, METH_VARARGS, (char *)"\n"
+		"Removes everything added to the initial state.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    reset()\n"
-		"    \n"
+		"\n"
+		"    clearInitialState()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
@@ -53761,272 +60359,345 @@ static PyMethodDef SwigMethods[] = {
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_run", _wrap_Wmrk4_run, METH_VARARGS, (char *)"\n"
-		"Advance the simulation until endtime (given in seconds) is reached. \n"
-		"The endtime must be larger or equal to the current simulation time.\n"
+	 { (char *)"Batch_addCompCount", _wrap_Batch_addCompCount, METH_VARARGS, (char *)"\n"
+		"Adds an observable: the number of molecules of species s in \n"
+		"compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    run(endtime)\n"
-		"    \n"
+		"\n"
+		"    addCompCount(c, s)\n"
+		"\n"
 		"Arguments:\n"
-		"    float endtime\n"
+		"    * string c\n"
+		"    * string s\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_getTime", _wrap_Wmrk4_getTime, METH_VARARGS, (char *)"\n"
-		"Returns the current simulation time in seconds.\n"
+	 { (char *)"Batch_addPatchCount", _wrap_Batch_addPatchCount, METH_VARARGS, (char *)"\n"
+		"Adds an observable: the number of molecules of species s in patch p.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getTime()\n"
-		"    \n"
+		"\n"
+		"    addPatchCount(p, s)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string p\n"
+		"    * string s\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmrk4_swigregister", Wmrk4_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Wmdirect", _wrap_new_Wmdirect, METH_VARARGS, (char *)"new_Wmdirect(Model m, Geom g, RNG r) -> Wmdirect"},
-	 { (char *)"delete_Wmdirect", _wrap_delete_Wmdirect, METH_VARARGS, (char *)"delete_Wmdirect(Wmdirect self)"},
-	 { (char *)"Wmdirect_getSolverName", _wrap_Wmdirect_getSolverName, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver's name.\n"
+	 { (char *)"Batch_addTetCount", _wrap_Batch_addTetCount, METH_VARARGS, (char *)"\n"
+		"Adds an observable: the number of molecules of species s in \n"
+		"tetrahedron tidx (mesh-based solvers only).\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverName()\n"
-		"    \n"
+		"\n"
+		"    addTetCount(tidx, s)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * uint tidx\n"
+		"    * string s\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_getSolverDesc", _wrap_Wmdirect_getSolverDesc, METH_VARARGS, (char *)"\n"
-		"Returns a string giving a short description of the solver.\n"
+	 { (char *)"Batch_clearObservables", _wrap_Batch_clearObservables, METH_VARARGS, (char *)"\n"
+		"Removes all observables.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverDesc()\n"
-		"    \n"
+		"\n"
+		"    clearObservables()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_getSolverAuthors", _wrap_Wmdirect_getSolverAuthors, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver authors names.\n"
+	 { (char *)"Batch_countObservables", _wrap_Batch_countObservables, METH_VARARGS, (char *)"\n"
+		"Returns the number of observables.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverAuthors()\n"
-		"    \n"
+		"\n"
+		"    countObservables()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_getSolverEmail", _wrap_Wmdirect_getSolverEmail, METH_VARARGS, (char *)"\n"
-		"Returns a string giving the author's email address.\n"
+	 { (char *)"Batch_run", _wrap_Batch_run, METH_VARARGS, (char *)"\n"
+		"Runs one realisation per seed on nthreads threads (0 for one thread per \n"
+		"realisation) and returns the observables sampled at each time point, \n"
+		"as a flat list which can be reshaped to \n"
+		"(len(seeds), len(tpnts), countObservables()).\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverEmail()\n"
-		"    \n"
+		"\n"
+		"    run(seeds, tpnts, nthreads)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * list<uint> seeds\n"
+		"    * list<float> tpnts\n"
+		"    * uint nthreads\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    list<float>\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_reset", _wrap_Wmdirect_reset, METH_VARARGS, (char *)"\n"
-		"Reset the simulation to the state the solver was initialised to. \n"
-		"Typically, this resets all concentrations of all chemical species in \n"
-		"all elements (whether compartments and patches in a well-mixed solver \n"
-		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
-		"resets the simulation time to zero and resets reaction (and diffusion) \n"
-		"rates to the default values described in the steps.model objects. \n"
-		"All reaction (and diffusion) rules are reset to active and all \n"
-		"compartment volumes and patch areas are reset to default values \n"
-		"described in steps.geom objects (for well-mixed solvers). \n"
-		"Usually, this method should be called before starting each simulation iteration.\n"
+	 { (char *)"Batch_swigregister", Batch_swigregister, METH_VARARGS, NULL},
+	 { (char *)"new_Recorder", _wrap_new_Recorder, METH_VARARGS, (char *)"\n"
+		"Construction::\n"
+		"\n"
+		"    rec = steps.solver.Recorder(sim)\n"
+		"\n"
+		"Create a recorder of time series from solver sim (a Wmrk4, Wmdirect or \n"
+		"Tetexact object). Observables are added with the add... methods and \n"
+		"sampling times with setTimePoints(); run() then advances the solver \n"
+		"through all the time points and samples every observable after each, \n"
+		"without returning to Python in between. The solver must be kept alive \n"
+		"for as long as the recorder is used.\n"
+		"\n"
+		"Arguments:\n"
+		"    * steps.solver.API sim\n"
+		"\n"
+		""},
+	 { (char *)"delete_Recorder", _wrap_delete_Recorder, METH_VARARGS, (char *)"delete_Recorder(Recorder self)"},
+	 { (char *)"Recorder_addCompCount", _wrap_Recorder_addCompCount, METH_VARARGS, (char *)"\n"
+		"Records the number of molecules of species s in compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    reset()\n"
-		"    \n"
+		"\n"
+		"    addCompCount(c, s)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * string c\n"
+		"    * string s\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_run", _wrap_Wmdirect_run, METH_VARARGS, (char *)"\n"
-		"Advance the simulation until endtime (given in seconds) is reached. \n"
-		"The endtime must be larger or equal to the current simulation time.\n"
+	 { (char *)"Recorder_addCompConc", _wrap_Recorder_addCompConc, METH_VARARGS, (char *)"\n"
+		"Records the concentration (in molar units) of species s in \n"
+		"compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    run(endtime)\n"
-		"    \n"
+		"\n"
+		"    addCompConc(c, s)\n"
+		"\n"
 		"Arguments:\n"
-		"    float endtime\n"
+		"    * string c\n"
+		"    * string s\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_getTime", _wrap_Wmdirect_getTime, METH_VARARGS, (char *)"\n"
-		"Returns the current simulation time in seconds.\n"
+	 { (char *)"Recorder_addPatchCount", _wrap_Recorder_addPatchCount, METH_VARARGS, (char *)"\n"
+		"Records the number of molecules of species s in patch p.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getTime()\n"
-		"    \n"
+		"\n"
+		"    addPatchCount(p, s)\n"
+		"\n"
 		"Arguments:\n"
+		"    * string p\n"
+		"    * string s\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Recorder_addTetCount", _wrap_Recorder_addTetCount, METH_VARARGS, (char *)"\n"
+		"Records the number of molecules of species s in tetrahedron \n"
+		"tidx.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    addTetCount(tidx, s)\n"
+		"\n"
+		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * string s\n"
+		"\n"
 		"Return:\n"
-		"    float\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Wmdirect_swigregister", Wmdirect_swigregister, METH_VARARGS, NULL},
-	 { (char *)"new_Tetexact", _wrap_new_Tetexact, METH_VARARGS, (char *)"new_Tetexact(Model m, Geom g, RNG r) -> Tetexact"},
-	 { (char *)"delete_Tetexact", _wrap_delete_Tetexact, METH_VARARGS, (char *)"delete_Tetexact(Tetexact self)"},
-	 { (char *)"Tetexact_getSolverName", _wrap_Tetexact_getSolverName, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver's name.\n"
+	 { (char *)"Recorder_addTetConc", _wrap_Recorder_addTetConc, METH_VARARGS, (char *)"\n"
+		"Records the concentration (in molar units) of species s in \n"
+		"tetrahedron tidx.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverName()\n"
-		"    \n"
+		"\n"
+		"    addTetConc(tidx, s)\n"
+		"\n"
 		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * string s\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Recorder_addTriCount", _wrap_Recorder_addTriCount, METH_VARARGS, (char *)"\n"
+		"Records the number of molecules of species s in triangle tidx.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    addTriCount(tidx, s)\n"
+		"\n"
+		"Arguments:\n"
+		"    * uint tidx\n"
+		"    * string s\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_getSolverDesc", _wrap_Tetexact_getSolverDesc, METH_VARARGS, (char *)"\n"
-		"Returns a string giving a short description of the solver.\n"
+	 { (char *)"Recorder_addCompReacExtent", _wrap_Recorder_addCompReacExtent, METH_VARARGS, (char *)"\n"
+		"Records the extent of reaction r in compartment c.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverDesc()\n"
-		"    \n"
+		"\n"
+		"    addCompReacExtent(c, r)\n"
+		"\n"
 		"Arguments:\n"
+		"    * string c\n"
+		"    * string r\n"
+		"\n"
+		"Return:\n"
 		"    None\n"
 		"\n"
+		""},
+	 { (char *)"Recorder_addPatchSReacExtent", _wrap_Recorder_addPatchSReacExtent, METH_VARARGS, (char *)"\n"
+		"Records the extent of surface reaction sr in patch p.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    addPatchSReacExtent(p, sr)\n"
+		"\n"
+		"Arguments:\n"
+		"    * string p\n"
+		"    * string sr\n"
+		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_getSolverAuthors", _wrap_Tetexact_getSolverAuthors, METH_VARARGS, (char *)"\n"
-		"Returns a string of the solver authors names.\n"
+	 { (char *)"Recorder_clearObservables", _wrap_Recorder_clearObservables, METH_VARARGS, (char *)"\n"
+		"Forgets all observables added so far.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverAuthors()\n"
-		"    \n"
+		"\n"
+		"    clearObservables()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_getSolverEmail", _wrap_Tetexact_getSolverEmail, METH_VARARGS, (char *)"\n"
-		"Returns a string giving the author's email address.\n"
+	 { (char *)"Recorder_countObservables", _wrap_Recorder_countObservables, METH_VARARGS, (char *)"\n"
+		"Returns the number of observables.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getSolverEmail()\n"
-		"    \n"
+		"\n"
+		"    countObservables()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    string\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_reset", _wrap_Tetexact_reset, METH_VARARGS, (char *)"\n"
-		"Reset the simulation to the state the solver was initialised to. \n"
-		"Typically, this resets all concentrations of all chemical species in \n"
-		"all elements (whether compartments and patches in a well-mixed solver \n"
-		"or tetrahedrons and triangles in a mesh-based solver) to zero, \n"
-		"resets the simulation time to zero and resets reaction (and diffusion) \n"
-		"rates to the default values described in the steps.model objects. \n"
-		"All reaction (and diffusion) rules are reset to active and all \n"
-		"compartment volumes and patch areas are reset to default values \n"
-		"described in steps.geom objects (for well-mixed solvers). \n"
-		"Usually, this method should be called before starting each simulation iteration.\n"
+	 { (char *)"Recorder_setTimePoints", _wrap_Recorder_setTimePoints, METH_VARARGS, (char *)"\n"
+		"Sets the sampling times, which must be non-negative and in \n"
+		"non-decreasing order.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    reset()\n"
-		"    \n"
+		"\n"
+		"    setTimePoints(tpnts)\n"
+		"\n"
 		"Arguments:\n"
-		"    None\n"
+		"    * list<float> tpnts\n"
 		"\n"
 		"Return:\n"
 		"    None\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_run", _wrap_Tetexact_run, METH_VARARGS, (char *)"\n"
-		"Advance the simulation until endtime (given in seconds) is reached. \n"
-		"The endtime must be larger or equal to the current simulation time.\n"
+	 { (char *)"Recorder_getTimePoints", _wrap_Recorder_getTimePoints, METH_VARARGS, (char *)"\n"
+		"Returns the sampling times.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    run(endtime)\n"
-		"    \n"
+		"\n"
+		"    getTimePoints()\n"
+		"\n"
 		"Arguments:\n"
-		"    float endtime\n"
+		"    None\n"
 		"\n"
 		"Return:\n"
-		"    None\n"
+		"    list<float>\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_getTime", _wrap_Tetexact_getTime, METH_VARARGS, (char *)"\n"
-		"Returns the current simulation time in seconds.\n"
+	 { (char *)"Recorder_countTimePoints", _wrap_Recorder_countTimePoints, METH_VARARGS, (char *)"\n"
+		"Returns the number of sampling times.\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getTime()\n"
-		"    \n"
+		"\n"
+		"    countTimePoints()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    uint\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_advanceSteps", _wrap_Tetexact_advanceSteps, METH_VARARGS, (char *)"\n"
-		"Returns the current simulation time in seconds.\n"
+	 { (char *)"Recorder_run", _wrap_Recorder_run, METH_VARARGS, (char *)"\n"
+		"Runs the solver to each time point in turn and returns the observables \n"
+		"sampled there, as a flat list which can be reshaped to \n"
+		"(countTimePoints(), countObservables()).\n"
 		"\n"
 		"Syntax::\n"
-		"    \n"
-		"    getTime()\n"
-		"    \n"
+		"\n"
+		"    run()\n"
+		"\n"
 		"Arguments:\n"
 		"    None\n"
 		"\n"
 		"Return:\n"
-		"    float\n"
+		"    list<float>\n"
 		"\n"
 		""},
-	 { (char *)"Tetexact_swigregister", Tetexact_swigregister, METH_VARARGS, NULL},
+	 { (char *)"Recorder_runNP", _wrap_Recorder_runNP, METH_VARARGS, (char *)"\n"
+		"As run(), but writes the samples to counts, a contiguous buffer of \n"
+		"countTimePoints() * countObservables() values, e.g. a NumPy array of \n"
+		"dtype float64; no copies are made.\n"
+		"\n"
+		"Syntax::\n"
+		"\n"
+		"    runNP(counts)\n"
+		"\n"
+		"Arguments:\n"
+		"    * buffer<float> counts\n"
+		"\n"
+		"Return:\n"
+		"    None\n"
+		"\n"
+		""},
+	 { (char *)"Recorder_swigregister", Recorder_swigregister, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
 };
 
@@ -54105,6 +60776,7 @@ static swig_type_info _swigt__p_std__vectorT_unsigned_int_std__allocatorT_unsign
 static swig_type_info _swigt__p_steps__ArgErr = {"_p_steps__ArgErr", "steps::ArgErr *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__Err = {"_p_steps__Err", "steps::Err *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__NotImplErr = {"_p_steps__NotImplErr", "steps::NotImplErr *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_steps__batch__Batch = {"_p_steps__batch__Batch", "steps::batch::Batch *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__model__Diff = {"_p_steps__model__Diff", "steps::model::Diff *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__model__Model = {"_p_steps__model__Model", "steps::model::Model *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__model__Reac = {"_p_steps__model__Reac", "steps::model::Reac *", 0, 0, (void*)0, 0};
@@ -54114,6 +60786,7 @@ static swig_type_info _swigt__p_steps__model__Surfsys = {"_p_steps__model__Surfs
 static swig_type_info _swigt__p_steps__model__Volsys = {"_p_steps__model__Volsys", "steps::model::Volsys *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__rng__RNG = {"_p_steps__rng__RNG", "steps::rng::RNG *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__solver__API = {"_p_steps__solver__API", "steps::solver::API *", 0, 0, (void*)0, 0};
+static swig_type_info _swigt__p_steps__solver__Recorder = {"_p_steps__solver__Recorder", "steps::solver::Recorder *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__tetexact__Tetexact = {"_p_steps__tetexact__Tetexact", "steps::tetexact::Tetexact *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__tetmesh__DiffBoundary = {"_p_steps__tetmesh__DiffBoundary", "steps::tetmesh::DiffBoundary *", 0, 0, (void*)0, 0};
 static swig_type_info _swigt__p_steps__tetmesh__Tetmesh = {"_p_steps__tetmesh__Tetmesh", "steps::tetmesh::Tetmesh *", 0, 0, (void*)0, 0};
@@ -54187,6 +60860,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_steps__ArgErr,
   &_swigt__p_steps__Err,
   &_swigt__p_steps__NotImplErr,
+  &_swigt__p_steps__batch__Batch,
   &_swigt__p_steps__model__Diff,
   &_swigt__p_steps__model__Model,
   &_swigt__p_steps__model__Reac,
@@ -54196,6 +60870,7 @@ static swig_type_info *swig_type_initial[] = {
   &_swigt__p_steps__model__Volsys,
   &_swigt__p_steps__rng__RNG,
   &_swigt__p_steps__solver__API,
+  &_swigt__p_steps__solver__Recorder,
   &_swigt__p_steps__tetexact__Tetexact,
   &_swigt__p_steps__tetmesh__DiffBoundary,
   &_swigt__p_steps__tetmesh__Tetmesh,
@@ -54269,6 +60944,7 @@ static swig_cast_info _swigc__p_std__vectorT_unsigned_int_std__allocatorT_unsign
 static swig_cast_info _swigc__p_steps__ArgErr[] = {  {&_swigt__p_steps__ArgErr, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__Err[] = {  {&_swigt__p_steps__NotImplErr, _p_steps__NotImplErrTo_p_steps__Err, 0, 0},  {&_swigt__p_steps__ArgErr, _p_steps__ArgErrTo_p_steps__Err, 0, 0},  {&_swigt__p_steps__Err, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__NotImplErr[] = {  {&_swigt__p_steps__NotImplErr, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_steps__batch__Batch[] = {  {&_swigt__p_steps__batch__Batch, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__model__Diff[] = {  {&_swigt__p_steps__model__Diff, 0, 0, 0},  {&_swigt__std__vectorT_steps__model__Diff_p_std__allocatorT_steps__model__Diff_p_t_t__value_type, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__model__Model[] = {  {&_swigt__p_steps__model__Model, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__model__Reac[] = {  {&_swigt__p_steps__model__Reac, 0, 0, 0},  {&_swigt__std__vectorT_steps__model__Reac_p_std__allocatorT_steps__model__Reac_p_t_t__value_type, 0, 0, 0},{0, 0, 0, 0}};
@@ -54278,6 +60954,7 @@ static swig_cast_info _swigc__p_steps__model__Surfsys[] = {  {&_swigt__p_steps__
 static swig_cast_info _swigc__p_steps__model__Volsys[] = {  {&_swigt__std__vectorT_steps__model__Volsys_p_std__allocatorT_steps__model__Volsys_p_t_t__value_type, 0, 0, 0},  {&_swigt__p_steps__model__Volsys, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__rng__RNG[] = {  {&_swigt__p_steps__rng__RNG, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__solver__API[] = {  {&_swigt__p_steps__wmrk4__Wmrk4, _p_steps__wmrk4__Wmrk4To_p_steps__solver__API, 0, 0},  {&_swigt__p_steps__wmdirect__Wmdirect, _p_steps__wmdirect__WmdirectTo_p_steps__solver__API, 0, 0},  {&_swigt__p_steps__tetexact__Tetexact, _p_steps__tetexact__TetexactTo_p_steps__solver__API, 0, 0},  {&_swigt__p_steps__solver__API, 0, 0, 0},{0, 0, 0, 0}};
+static swig_cast_info _swigc__p_steps__solver__Recorder[] = {  {&_swigt__p_steps__solver__Recorder, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__tetexact__Tetexact[] = {  {&_swigt__p_steps__tetexact__Tetexact, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__tetmesh__DiffBoundary[] = {  {&_swigt__p_steps__tetmesh__DiffBoundary, 0, 0, 0},{0, 0, 0, 0}};
 static swig_cast_info _swigc__p_steps__tetmesh__Tetmesh[] = {  {&_swigt__p_steps__tetmesh__Tetmesh, 0, 0, 0},{0, 0, 0, 0}};
@@ -54351,6 +61028,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_steps__ArgErr,
   _swigc__p_steps__Err,
   _swigc__p_steps__NotImplErr,
+  _swigc__p_steps__batch__Batch,
   _swigc__p_steps__model__Diff,
   _swigc__p_steps__model__Model,
   _swigc__p_steps__model__Reac,
@@ -54360,6 +61038,7 @@ static swig_cast_info *swig_cast_initial[] = {
   _swigc__p_steps__model__Volsys,
   _swigc__p_steps__rng__RNG,
   _swigc__p_steps__solver__API,
+  _swigc__p_steps__solver__Recorder,
   _swigc__p_steps__tetexact__Tetexact,
   _swigc__p_steps__tetmesh__DiffBoundary,
   _swigc__p_steps__tetmesh__Tetmesh,